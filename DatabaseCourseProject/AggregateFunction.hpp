@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @enum AggregateFunction
+ * @brief Enumerates the aggregate functions supported by the `query` command.
+ */
+enum class AggregateFunction {
+    /**
+     * @brief Number of rows (`COUNT(*)`) or of non-NULL values (`COUNT(column)`).
+     */
+    COUNT,
+
+    /**
+     * @brief Sum of the non-NULL values of a numeric column.
+     */
+    SUM,
+
+    /**
+     * @brief Arithmetic mean of the non-NULL values of a numeric column.
+     */
+    AVG,
+
+    /**
+     * @brief Smallest non-NULL value of a column.
+     */
+    MIN,
+
+    /**
+     * @brief Largest non-NULL value of a column.
+     */
+    MAX
+};
@@ -0,0 +1,112 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "QueryOperator.hpp"
+#include "AggregateFunction.hpp"
+
+/**
+ * @class AggregateOperator
+ * @brief Blocking operator implementing GROUP BY and the aggregate functions.
+ *
+ * Groups are found through a hash map keyed by the normalized group values.
+ * Each group keeps one running state per aggregate, so the input is never
+ * buffered. Output rows hold the group columns followed by the aggregates and
+ * are emitted in the order in which the groups first appeared. Without group
+ * columns there is exactly one group, even for an empty input.
+ */
+class AggregateOperator : public QueryOperator {
+public:
+    /**
+     * @brief One aggregate to compute.
+     */
+    struct AggregateSpec {
+        AggregateFunction function; ///< The function.
+        int column;                 ///< Input position of the argument; -1 for `COUNT(*)`.
+        ColumnType type;            ///< Type of the argument.
+    };
+
+private:
+    /**
+     * @brief The running state of one aggregate in one group.
+     */
+    struct AggregateState {
+        long long count;    ///< Rows (COUNT(*)) or non-NULL values seen.
+        double sum;         ///< Sum of the values (SUM, AVG on Double columns).
+        long long integerSum; ///< Exact sum of Integer values (SUM on Integer columns).
+        std::string best;   ///< Current MIN or MAX, in display form.
+        double bestNumber;  ///< Numeric value of `best` for numeric arguments.
+    };
+
+    /**
+     * @brief A group: its key cells and one state per aggregate.
+     */
+    struct Group {
+        QueryRow keys;                       ///< Values of the group columns.
+        std::vector<AggregateState> states;  ///< One state per aggregate.
+    };
+
+    std::vector<int> groupColumns;                   ///< Input positions of the group columns.
+    std::vector<ColumnType> groupTypes;              ///< Types of the group columns.
+    std::vector<AggregateSpec> aggregates;           ///< The aggregates to compute.
+    std::vector<Group> groups;                       ///< Groups in order of appearance.
+    std::unordered_map<std::string, size_t> index;   ///< Normalized group key -> position in `groups`.
+
+    /**
+     * @brief Creates a group with empty aggregate states.
+     * @param keys The values of the group columns.
+     * @return The position of the new group.
+     */
+    size_t addGroup(const QueryRow& keys);
+
+    /**
+     * @brief Folds one input row into an aggregate state.
+     * @param spec The aggregate.
+     * @param state The state to update.
+     * @param row The input row.
+     */
+    static void accumulate(const AggregateSpec& spec, AggregateState& state, const QueryRow& row);
+
+    /**
+     * @brief Produces the final value of an aggregate.
+     * @param spec The aggregate.
+     * @param state The final state.
+     * @return The value in display form; empty (NULL) if no value was aggregated.
+     */
+    static std::string result(const AggregateSpec& spec, const AggregateState& state);
+
+public:
+    /**
+     * @brief Constructs the operator.
+     * @param groupColumns Input positions of the group columns.
+     * @param groupTypes Types of the group columns.
+     * @param aggregates The aggregates to compute, in output order.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    AggregateOperator(const std::vector<int>& groupColumns, const std::vector<ColumnType>& groupTypes,
+        const std::vector<AggregateSpec>& aggregates, QueryOperator* next);
+
+    /**
+     * @brief Returns the type of an aggregate's result.
+     *
+     * COUNT yields Integer, AVG yields Double, SUM keeps Integer and otherwise
+     * yields Double, MIN and MAX keep the argument type.
+     *
+     * @param spec The aggregate.
+     * @return The result type.
+     */
+    static ColumnType resultType(const AggregateSpec& spec);
+
+    /**
+     * @brief Adds a row to its group.
+     * @param row The input row.
+     * @return Always `true`; the whole input is needed.
+     * @throws std::runtime_error If a numeric argument holds a non-numeric value.
+     */
+    bool consume(const QueryRow& row) override;
+
+    /**
+     * @brief Pushes one row per group downstream and forwards `finish()`.
+     */
+    void finish() override;
+};
@@ -0,0 +1,191 @@
+#include "AggregateOperator.hpp"
+#include "QueryValueUtils.hpp"
+
+/**
+ * @brief Constructs the operator.
+ *
+ * Without group columns the single global group is created right away, so
+ * that `COUNT(*)` over an empty input still yields a row with 0.
+ *
+ * @param groupColumns Input positions of the group columns.
+ * @param groupTypes Types of the group columns.
+ * @param aggregates The aggregates to compute, in output order.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+AggregateOperator::AggregateOperator(const std::vector<int>& groupColumns, const std::vector<ColumnType>& groupTypes,
+    const std::vector<AggregateSpec>& aggregates, QueryOperator* next)
+    : QueryOperator(next), groupColumns(groupColumns), groupTypes(groupTypes), aggregates(aggregates) {
+
+    if (groupColumns.empty()) {
+        index[""] = addGroup(QueryRow());
+    }
+}
+
+/**
+ * @brief Returns the type of an aggregate's result.
+ * @param spec The aggregate.
+ * @return The result type.
+ */
+ColumnType AggregateOperator::resultType(const AggregateSpec& spec) {
+    switch (spec.function) {
+    case AggregateFunction::COUNT:
+        return ColumnType::INTEGER;
+    case AggregateFunction::AVG:
+        return ColumnType::DOUBLE;
+    case AggregateFunction::SUM:
+        return spec.type == ColumnType::INTEGER ? ColumnType::INTEGER : ColumnType::DOUBLE;
+    default:
+        return spec.type;
+    }
+}
+
+/**
+ * @brief Creates a group with empty aggregate states.
+ * @param keys The values of the group columns.
+ * @return The position of the new group.
+ */
+size_t AggregateOperator::addGroup(const QueryRow& keys) {
+    Group group;
+    group.keys = keys;
+    group.states.assign(aggregates.size(), AggregateState{ 0, 0.0, 0, "", 0.0 });
+    groups.push_back(group);
+    return groups.size() - 1;
+}
+
+/**
+ * @brief Folds one input row into an aggregate state.
+ *
+ * NULL arguments are ignored by every function except `COUNT(*)`.
+ *
+ * @param spec The aggregate.
+ * @param state The state to update.
+ * @param row The input row.
+ * @throws std::runtime_error If a numeric argument holds a non-numeric value.
+ */
+void AggregateOperator::accumulate(const AggregateSpec& spec, AggregateState& state, const QueryRow& row) {
+    if (spec.column < 0) {
+        ++state.count;
+        return;
+    }
+
+    const std::string& value = row[spec.column];
+    if (value.empty()) {
+        return;
+    }
+
+    bool numeric = QueryValueUtils::isNumeric(spec.type);
+    double number = numeric ? QueryValueUtils::toNumber(value) : 0.0;
+
+    switch (spec.function) {
+    case AggregateFunction::COUNT:
+        break;
+    case AggregateFunction::SUM:
+    case AggregateFunction::AVG:
+        state.sum += number;
+        if (spec.type == ColumnType::INTEGER) {
+            state.integerSum += static_cast<long long>(number);
+        }
+        break;
+    case AggregateFunction::MIN:
+    case AggregateFunction::MAX: {
+        bool isMin = spec.function == AggregateFunction::MIN;
+        bool better = state.count == 0;
+        if (!better) {
+            int order = numeric
+                ? (number < state.bestNumber ? -1 : (state.bestNumber < number ? 1 : 0))
+                : value.compare(state.best);
+            better = isMin ? order < 0 : order > 0;
+        }
+        if (better) {
+            state.best = value;
+            state.bestNumber = number;
+        }
+        break;
+    }
+    }
+    ++state.count;
+}
+
+/**
+ * @brief Produces the final value of an aggregate.
+ *
+ * Integer results are printed as integers, Double results like `DoubleColumn` does.
+ *
+ * @param spec The aggregate.
+ * @param state The final state.
+ * @return The value in display form; empty (NULL) if no value was aggregated.
+ */
+std::string AggregateOperator::result(const AggregateSpec& spec, const AggregateState& state) {
+    if (spec.function == AggregateFunction::COUNT) {
+        return std::to_string(state.count);
+    }
+    if (state.count == 0) {
+        return "";
+    }
+
+    switch (spec.function) {
+    case AggregateFunction::SUM:
+        return spec.type == ColumnType::INTEGER ? std::to_string(state.integerSum) : std::to_string(state.sum);
+    case AggregateFunction::AVG:
+        return std::to_string(state.sum / static_cast<double>(state.count));
+    default:
+        return state.best;
+    }
+}
+
+/**
+ * @brief Adds a row to its group, creating the group on first sight.
+ * @param row The input row.
+ * @return Always `true`.
+ * @throws std::runtime_error If a numeric argument holds a non-numeric value.
+ */
+bool AggregateOperator::consume(const QueryRow& row) {
+    size_t position = 0;
+
+    if (!groupColumns.empty()) {
+        std::string key;
+        QueryRow keys;
+        for (size_t i = 0; i < groupColumns.size(); ++i) {
+            const std::string& value = row[groupColumns[i]];
+            key += value.empty()
+                ? std::string("\x01")
+                : QueryValueUtils::normalizeKey(value, QueryValueUtils::isNumeric(groupTypes[i]));
+            key += '\x1f';
+            keys.push_back(value);
+        }
+
+        auto found = index.find(key);
+        if (found == index.end()) {
+            position = addGroup(keys);
+            index[key] = position;
+        }
+        else {
+            position = found->second;
+        }
+    }
+
+    Group& group = groups[position];
+    for (size_t i = 0; i < aggregates.size(); ++i) {
+        accumulate(aggregates[i], group.states[i], row);
+    }
+    return true;
+}
+
+/**
+ * @brief Pushes one row per group downstream and forwards `finish()`.
+ */
+void AggregateOperator::finish() {
+    for (const Group& group : groups) {
+        QueryRow output = group.keys;
+        for (size_t i = 0; i < aggregates.size(); ++i) {
+            output.push_back(result(aggregates[i], group.states[i]));
+        }
+        if (!next->consume(output)) {
+            break;
+        }
+    }
+    groups.clear();
+    index.clear();
+
+    QueryOperator::finish();
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * @class AllocationCounter
+ * @brief Counts the bytes requested from the global `operator new`, per thread.
+ *
+ * The program replaces the global allocation functions (see
+ * `AllocationCounterImpl.cpp`) with versions that call `malloc` and, only
+ * while counting is switched on for the calling thread, add the requested
+ * size to a `thread_local` counter. Threads that are not counting pay one
+ * thread-local flag check per allocation; no counter is shared between
+ * threads. `ExecutionProfile` switches counting on for the threads working
+ * for it and collects their counts, which is how `explain` reports allocations.
+ */
+class AllocationCounter {
+public:
+    /**
+     * @brief Switches counting on or off for the calling thread.
+     * @param counting `true` to count the allocations of the calling thread from now on.
+     */
+    static void setCounting(bool counting);
+
+    /**
+     * @brief Returns the bytes the calling thread allocated while counting since the previous call, and resets them.
+     * @return The counted bytes. Freed memory is not subtracted.
+     */
+    static size_t takeCountedBytes();
+};
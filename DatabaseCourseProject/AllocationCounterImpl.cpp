@@ -0,0 +1,115 @@
+#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+    /// Whether the allocations of the calling thread are counted.
+    thread_local bool countingThread = false;
+
+    /// Bytes the calling thread allocated while counting, since the last `takeCountedBytes`.
+    thread_local size_t threadAllocated = 0;
+
+    /**
+     * @brief Allocates `size` bytes and counts them if the calling thread is counting.
+     * @param size The requested size.
+     * @return The allocated memory, or nullptr if `malloc` failed.
+     */
+    void* countedAllocate(size_t size) {
+        if (countingThread) {
+            threadAllocated += size;
+        }
+        return std::malloc(size == 0 ? 1 : size);
+    }
+}
+
+/**
+ * @brief Switches counting on or off for the calling thread.
+ * @param counting `true` to count the allocations of the calling thread from now on.
+ */
+void AllocationCounter::setCounting(bool counting) {
+    countingThread = counting;
+}
+
+/**
+ * @brief Returns the bytes the calling thread allocated while counting since the previous call, and resets them.
+ * @return The counted bytes.
+ */
+size_t AllocationCounter::takeCountedBytes() {
+    size_t bytes = threadAllocated;
+    threadAllocated = 0;
+    return bytes;
+}
+
+/**
+ * @brief Replacement of the global `operator new` that counts the requested bytes.
+ * @param size The requested size.
+ * @return The allocated memory.
+ * @throws std::bad_alloc If the memory cannot be allocated.
+ */
+void* operator new(size_t size) {
+    void* memory = countedAllocate(size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief Replacement of the global `operator new[]` that counts the requested bytes.
+ * @param size The requested size.
+ * @return The allocated memory.
+ * @throws std::bad_alloc If the memory cannot be allocated.
+ */
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+/**
+ * @brief Non-throwing replacement of the global `operator new`.
+ * @param size The requested size.
+ * @return The allocated memory, or nullptr on failure.
+ */
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+/**
+ * @brief Non-throwing replacement of the global `operator new[]`.
+ * @param size The requested size.
+ * @return The allocated memory, or nullptr on failure.
+ */
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+/**
+ * @brief Releases memory obtained from the replaced `operator new`.
+ * @param memory The memory to release, or nullptr.
+ */
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief Releases memory obtained from the replaced `operator new[]`.
+ * @param memory The memory to release, or nullptr.
+ */
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief Sized variant of `operator delete`.
+ * @param memory The memory to release, or nullptr.
+ */
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+/**
+ * @brief Sized variant of `operator delete[]`.
+ * @param memory The memory to release, or nullptr.
+ */
+void operator delete[](void* memory, size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <atomic>
+#include <memory>
+
+/**
+ * @class CancellationToken
+ * @brief A shared flag used to cooperatively cancel long-running work.
+ *
+ * Copies of a `CancellationToken` share the same underlying flag, so a token
+ * can be handed to any number of tasks and cancelled from a single place.
+ * Cancellation is cooperative: nothing is interrupted forcibly, running work
+ * is expected to poll `isCancelled()` at convenient points (for example
+ * between row ranges) and stop early.
+ */
+class CancellationToken {
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled; ///< Flag shared between all copies of the token.
+
+public:
+    /**
+     * @brief Constructs a new, not yet cancelled token.
+     */
+    CancellationToken();
+
+    /**
+     * @brief Requests cancellation of all work observing this token.
+     *
+     * The request is visible to every copy of the token. Calling `cancel()`
+     * more than once has no additional effect.
+     */
+    void cancel() const;
+
+    /**
+     * @brief Checks whether cancellation has been requested.
+     * @return `true` if `cancel()` was called on this token or any of its copies.
+     */
+    bool isCancelled() const;
+};
@@ -0,0 +1,28 @@
+#include "CancellationToken.hpp"
+
+/**
+ * @brief Constructs a new, not yet cancelled token.
+ *
+ * Allocates the shared flag that all copies of this token will observe.
+ */
+CancellationToken::CancellationToken()
+    : cancelled(std::make_shared<std::atomic<bool>>(false)) {
+}
+
+/**
+ * @brief Requests cancellation of all work observing this token.
+ *
+ * The flag is stored with release semantics so that any state written before
+ * the cancellation is visible to the tasks that observe it.
+ */
+void CancellationToken::cancel() const {
+    cancelled->store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Checks whether cancellation has been requested.
+ * @return `true` if the shared flag has been set.
+ */
+bool CancellationToken::isCancelled() const {
+    return cancelled->load(std::memory_order_acquire);
+}
@@ -11,7 +11,7 @@
  * of `Table` objects, providing functionalities to add, remove, and retrieve tables
  * by name. It also tracks the file path on disk where the catalog's metadata
  * is or will be stored. The `Catalog` relies on the `Table` class's copy
- * semantics for proper deep copying of table data.
+ * semantics, which share the table data copy-on-write.
  */
 class Catalog {
 private:
@@ -19,9 +19,9 @@ private:
      * @brief A collection of `Table` objects.
      *
      * Tables are stored by value, meaning each `Table` object within this vector
-     * is a separate, independent copy. The `Table` class's own deep copy
+     * behaves as a separate, independent copy. The `Table` class's own copy
      * constructor and assignment operator ensure that the `TableColumn*`
-     * within each `Table` are properly managed.
+     * within each `Table` are properly managed and share their values copy-on-write.
      */
     std::vector<Table> tableCollection;
 
@@ -57,9 +57,10 @@ public:
     /**
      * @brief Copy constructor for Catalog.
      *
-     * Performs a deep copy of the `tableCollection` vector and the `catalogPath`.
-     * The deep copy of tables is handled automatically by `std::vector` and
-     * the `Table` class's own copy constructor.
+     * Copies the `tableCollection` vector and the `catalogPath`.
+     * The tables are copied by `std::vector` and the `Table` class's own copy
+     * constructor. Column values are copied on write, so the copy costs
+     * O(tables * columns) and copies no rows.
      *
      * @param other The Catalog object to copy from.
      */
@@ -68,23 +69,46 @@ public:
     /**
      * @brief Copy assignment operator for Catalog.
      *
-     * Performs a deep copy of the `tableCollection` and `catalogPath` from
-     * another Catalog instance to this object. Handles self-assignment correctly.
-     * The deep copy of tables is managed by `std::vector` and `Table::operator=`.
+     * Copies the `tableCollection` and `catalogPath` from another Catalog
+     * instance to this object. Handles self-assignment correctly.
+     * The tables are copied by `std::vector` and `Table::operator=`, which
+     * share the column values copy-on-write.
      *
      * @param other The Catalog object to assign from.
      * @return A reference to this Catalog object after assignment.
      */
     Catalog& operator=(const Catalog& other);
 
+    /**
+     * @brief Move constructor for Catalog.
+     *
+     * Takes over the tables of `other` without copying or cloning any column.
+     * `other` is left empty.
+     *
+     * @param other The Catalog object to move from.
+     */
+    Catalog(Catalog&& other) noexcept;
+
+    /**
+     * @brief Move assignment operator for Catalog.
+     *
+     * Replaces the tables of this catalog with those of `other` without
+     * copying or cloning any column. `other` is left empty.
+     *
+     * @param other The Catalog object to move from.
+     * @return A reference to this Catalog object after assignment.
+     */
+    Catalog& operator=(Catalog&& other) noexcept;
+
     /**
      * @brief Adds a new table to the catalog.
      *
      * Before adding, this method checks if a table with the same name already exists
      * in the catalog to enforce uniqueness. If the name is unique, the table is
-     * added as a copy into the internal collection.
+     * moved into the internal collection. Callers that hand over a table they
+     * no longer need pass it as an rvalue, so no column is cloned.
      *
-     * @param table The `Table` object to add. It is passed by value to ensure a copy.
+     * @param table The `Table` object to add. Passed by value; moved from if the argument is an rvalue.
      * @throws std::runtime_error If a table with the same name already exists in the catalog.
      */
     void addTable(Table table);
@@ -49,6 +49,14 @@ public:
      */
     void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares an exclusive lock on the modified table; commands on other tables keep running.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
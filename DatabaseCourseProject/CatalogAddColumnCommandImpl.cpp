@@ -72,15 +72,32 @@ void CatalogAddColumnCommand::execute(const std::vector<std::string>& params) {
         }
         catch (const std::exception& e) {
             context.outputConsoleWritter.printLine(e.what());
+            context.metrics.recordError();
             return;
         }
         context.outputConsoleWritter.printLine("New empty column created and added successfuly. ");
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
 }
 
+/**
+ * @brief Modifies the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table.
+ */
+LockSet CatalogAddColumnCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+    return LockSet::writeTable(params[1]);
+}
+
 /**
  * @brief Creates a deep copy of the current `CatalogAddColumnCommand` object.
  *
@@ -28,7 +28,8 @@ public:
     /**
     * @brief Executes the aggregate command, performing calculations on matching rows.
     *
-    * This method takes a table name, a search column index, a search value, a target
+    * This method takes a table name, a condition (a search column index and a
+    * search value, or a WHERE expression), a target
     * column index (for aggregation), and the desired operation. It filters rows
     * based on the search condition and then applies the aggregate operation
     * (sum, product, minimum, or maximum) to the values in the specified target column
@@ -38,15 +39,17 @@ public:
     * Expected format:
     * - `params[0]`: "aggregate" (command name)
     * - `params[1]`: Name of the table to perform aggregation on.
-    * - `params[2]`: Index of the column to use for the search condition (0-indexed).
-    * - `params[3]`: Value to match in the search column.
+    * - `params[2]`: Index of the column to use for the search condition (0-indexed), or `where`.
+    * - `params[3]`: Value to match in the search column, or a WHERE expression
+    *   (see `CommandParser::parseExpression`).
     * - `params[4]`: Index of the column on which the aggregation will be performed (0-indexed).
     * - `params[5]`: The aggregation operation to perform ("sum", "product", "minimum", or "maximum").
     *
     * @throws std::runtime_error If no catalog is currently loaded.
     * @throws std::runtime_error If the number of parameters is incorrect (not 6).
     * @throws std::runtime_error If the specified table does not exist.
-    * @throws std::out_of_range If the search column index or target column index is invalid (out of bounds).
+    * @throws std::runtime_error If the condition is invalid or references a column that does not exist.
+    * @throws std::out_of_range If the target column index is invalid (out of bounds).
     * @throws std::runtime_error If the target column is not of a numeric type (Integer or Double).
     * @throws std::runtime_error If a non-numeric value is found in the target column during aggregation.
     * @throws std::runtime_error If no rows match the search criterion.
@@ -55,6 +58,14 @@ public:
     */
     void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares a shared lock on the table, so readers of the same table run in parallel.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
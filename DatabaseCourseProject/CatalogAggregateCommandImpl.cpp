@@ -2,12 +2,32 @@
 #include "CommandContext.hpp" 
 #include "Table.hpp"          
 #include "TableColumn.hpp"   
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
 #include "ColumnType.hpp"    
 #include "Operations.hpp"    
+#include "CommandParser.hpp"
+#include "Expression.hpp"
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>        
 #include <string>            
 #include <vector>            
 
+/**
+ * @brief Appends the values of the given rows of a numeric column without NULL cells.
+ * @tparam T The native type of the column.
+ * @param column The column, which must hold no NULL cell.
+ * @param rows The row ids to read.
+ * @param values Receives the values.
+ */
+template <typename T>
+static void collectValues(const TypedColumn<T>& column, const std::vector<int>& rows, std::vector<double>& values) {
+    const ColumnSegments<T>& cells = column.getSegments();
+    for (int i : rows) {
+        values.push_back(cells.value(i));
+    }
+}
 
 /**
  * @brief Constructs a CatalogAggregateCommand object, initializing it with the shared command context.
@@ -24,15 +44,18 @@ CatalogAggregateCommand::CatalogAggregateCommand(CommandContext& context)
  * @brief Executes the aggregate command, performing a calculation on filtered numeric data.
  *
  * This function parses the command-line arguments to extract the table name,
- * search column index, search value, target column index, and the desired
+ * the condition, the target column index, and the desired
  * aggregation operation. It then performs the following steps:
  * 1. Validates that a catalog is loaded and that the correct number of parameters (6) is provided.
  * 2. Retrieves the target `Table` from the `context.loadedCatalog`.
- * 3. Validates that both search and target column indices are within valid bounds.
+ * 3. Validates that the target column index is within valid bounds and binds the condition
+ * (either `<column-n> <value>` or `where "<expression>"`, see `CommandParser::parseCondition`).
  * 4. Ensures the target column is of a numeric type (Integer or Double) suitable for aggregation.
- * 5. Iterates through the table's rows: if a row matches the `searchValue` in the `searchColumn`,
+ * 5. Evaluates the condition batch by batch with `Expression::matchingRows`. For every matching row
  * it attempts to convert the value from the `targetColumn` to a `double` and adds it to a
  * temporary collection of cells. Non-numeric values in the target column will cause an error.
+ * When the target column holds no NULL cell (`TableColumn::hasNoNulls`) the values are read
+ * directly from its segments instead of being formatted and parsed back.
  * 6. If no rows match the search condition, an error is thrown.
  * 7. Performs the specified aggregation operation ("sum", "product", "minimum", "maximum")
  * using the collected numeric values.
@@ -43,20 +66,21 @@ CatalogAggregateCommand::CatalogAggregateCommand(CommandContext& context)
  * Expected elements:
  * - `params[0]`: "aggregate"
  * - `params[1]`: Table name.
- * - `params[2]`: Search column index (as a string, converted to int).
- * - `params[3]`: Search value (string).
+ * - `params[2]`: Search column index (as a string), or `where`.
+ * - `params[3]`: Search value (string), or the WHERE expression.
  * - `params[4]`: Target column index (as a string, converted to int).
  * - `params[5]`: Operation name ("sum", "product", "minimum", "maximum").
  *
  * @throws std::runtime_error If `context.loadedCatalogExists` is `false`.
  * @throws std::runtime_error If `params.size()` is not 6.
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails (table not found).
- * @throws std::out_of_range If `params[2]` or `params[4]` cannot be converted to an integer, or if the resulting
- * `searchColumn` or `targetColumn` index is out of bounds for the table.
+ * @throws std::runtime_error If `params[2]` is not a column index or the expression is invalid.
+ * @throws std::out_of_range If `params[4]` cannot be converted to an integer, or if the resulting
+ * `targetColumn` index is out of bounds for the table.
  * @throws std::runtime_error If the `targetColumn` is not `ColumnType::INTEGER` or `ColumnType::DOUBLE`.
  * @throws std::runtime_error If `std::stod` fails to convert a value from the `targetColumn` to a double,
  * indicating non-numeric data where numeric was expected.
- * @throws std::runtime_error If no rows are found that match the `seacrhValue` in the `searchColumn`.
+ * @throws std::runtime_error If no rows are found that match the condition.
  * @throws std::invalid_argument If `params[5]` (operation name) is not one of the recognized operations.
  * @throws std::exception Catches any other unexpected exceptions and reports their messages.
  */
@@ -69,34 +93,44 @@ void CatalogAggregateCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("Not enough parameters! ");
     }
 
+    Expression* condition = nullptr;
+
     try {
         const std::string& tableName = params[1];
-        int searchColumn = std::stoi(params[2]);
-        const std::string& seacrhValue = params[3];
         int targetColumn = std::stoi(params[4]);
         const std::string& operation = params[5];
 
+        ProfilePhase resolution("table resolution");
         Table& table = context.loadedCatalog.returnTableByName(tableName);
 
-        if (searchColumn >= table.getNumberOfColumns() || searchColumn < 0) {
-            throw std::out_of_range("Invalid search column index. ");
-        }
-
         if (targetColumn >= table.getNumberOfColumns() || targetColumn < 0) {
             throw std::out_of_range("Invalid target column index. ");
         }
 
-        TableColumn* col1 = table.getColumnAtGivenIndex(searchColumn);
         TableColumn* col2 = table.getColumnAtGivenIndex(targetColumn);
 
         if (col2->getType() != ColumnType::INTEGER && col2->getType() != ColumnType::DOUBLE) {
             throw std::runtime_error("Incompatible column types. ");
         }
 
+        condition = CommandParser::parseCondition(params[2], params[3]);
+        condition->bind(table);
+        resolution.stop();
+
+        ProfilePhase materialization("materialization");
         std::vector<double> cells;
 
-        for (int i = 0; i < table.getColumnAtGivenIndex(0)->getSize(); i++) {
-            if (col1->matchesValues(i, seacrhValue)) {
+        std::vector<int> rows = condition->matchingRows(table.getNumberOfRows());
+        cells.reserve(rows.size());
+
+        if (col2->hasNoNulls() && col2->getType() == ColumnType::INTEGER) {
+            collectValues(*static_cast<const IntegerColumn*>(col2), rows, cells);
+        }
+        else if (col2->hasNoNulls()) {
+            collectValues(*static_cast<const DoubleColumn*>(col2), rows, cells);
+        }
+        else {
+            for (int i : rows) {
                 std::string valStr = col2->returnValueAtGivenIndexAsString(i);
                 try {
                     double val = std::stod(valStr);
@@ -108,6 +142,8 @@ void CatalogAggregateCommand::execute(const std::vector<std::string>& params) {
             }
         }
 
+        materialization.stop();
+
         if (cells.empty()) {
             throw std::runtime_error("No matching rows found.");
         }
@@ -130,10 +166,29 @@ void CatalogAggregateCommand::execute(const std::vector<std::string>& params) {
         }
 
         context.outputConsoleWritter.printLine(std::to_string(result));
+        Instrumentation::recordRowsReturned(1);
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete condition;
+}
+
+/**
+ * @brief Reads the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogAggregateCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::readTables({ params[1] });
 }
 
 /**
@@ -0,0 +1,68 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class CatalogBulkInsertCommand
+ * @brief Command to insert many rows into a table in one step, all or nothing.
+ *
+ * The rows are given either inline, as consecutive groups of one value per
+ * column, or as a row file. All rows are converted and validated in a
+ * `TableAppender` before the table is changed; if any value is invalid, no row
+ * is inserted. This replaces one `insert` dispatch per row when loading data.
+ */
+class CatalogBulkInsertCommand : public  Command {
+private:
+	/// Reference to the shared command execution context, providing access to the loaded catalog and I/O utilities.
+	CommandContext& context;
+public:
+	/**
+	* @brief Constructs a CatalogBulkInsertCommand instance.
+	*
+	* @param context A reference to the `CommandContext` object, which encapsulates
+	* the application's shared database catalog, console output handler and file input handler.
+	*/
+	CatalogBulkInsertCommand(CommandContext& context);
+
+    /**
+     * @brief Executes the 'bulkinsert' command, adding many rows to a table.
+     *
+     * @param params A constant reference to a vector of strings representing command-line parameters.
+     * Expected format:
+     * - `params[0]`: "bulkinsert" (command name)
+     * - `params[1]`: The name of the table into which the rows will be inserted.
+     * - `params[2]`: `values` or `file`.
+     * - With `values`, `params[3]`...`params[N]`: the values of the rows, row after row,
+     *   one value per column in column order.
+     * - With `file`, `params[3]`: the path of a row file (see `InputFileReader::readRowsFromFile`).
+     *
+     * @throws std::runtime_error If no catalog is currently loaded.
+     * @throws std::runtime_error If the number of parameters is insufficient (less than 4).
+     * @throws std::runtime_error If `params[2]` is neither `values` nor `file`.
+     * @throws std::runtime_error If the specified table does not exist in the catalog.
+     * @throws std::runtime_error If the number of values is not a multiple of the number of columns,
+     * a row file line has the wrong number of values or a value does not fit its column. No row is inserted.
+     */
+	void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares an exclusive lock on the modified table; commands on other tables keep running.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
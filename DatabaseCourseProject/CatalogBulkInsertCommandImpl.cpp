@@ -0,0 +1,117 @@
+#include "CatalogBulkInsertCommand.hpp"
+#include "CommandContext.hpp"
+#include "Table.hpp"
+#include "Catalog.hpp"
+#include "TableAppender.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Constructs a CatalogBulkInsertCommand object, initializing it with the shared command context.
+ *
+ * @param context A reference to the `CommandContext` object. This context provides
+ * access to the application's shared database catalog and I/O utilities.
+ */
+CatalogBulkInsertCommand::CatalogBulkInsertCommand(CommandContext& context)
+	: context(context) {
+}
+
+/**
+ * @brief Executes the 'bulkinsert' command, adding many rows to a table.
+ *
+ * Inline values are cut into rows of `table.getNumberOfColumns()` values; a
+ * row file is read with `InputFileReader::readRowsFromFile`. Either way every
+ * row is staged in a `TableAppender`, which converts the values into typed
+ * staging columns. Only when all rows have been staged are they committed,
+ * which reserves the column storage once and appends every column in one go.
+ * The first invalid row aborts the command and the table is left unchanged.
+ *
+ * @param params A constant reference to a vector of strings containing command-line arguments.
+ * Expected elements:
+ * - `params[0]`: "bulkinsert"
+ * - `params[1]`: The name of the table to insert into.
+ * - `params[2]`: `values` followed by the values of all rows, or `file` followed by the path of a row file.
+ *
+ * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
+ * @throws std::runtime_error If `params.size()` is less than 4.
+ * @throws std::exception Catches any other exceptions (unknown table or source, rows that do
+ * not fit the table, unreadable file) and reports their messages to the console.
+ */
+void CatalogBulkInsertCommand::execute(const std::vector<std::string>& params) {
+
+    if (!context.loadedCatalogExists) {
+        throw std::runtime_error("There is no file opened! ");
+    }
+
+    if (params.size() < 4) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
+    try {
+        const std::string& tableName = params[1];
+        const std::string& source = params[2];
+
+        Table& table = context.loadedCatalog.returnTableByName(tableName);
+        TableAppender appender(table);
+
+        if (source == "values") {
+            size_t columnCount = static_cast<size_t>(table.getNumberOfColumns());
+            size_t valueCount = params.size() - 3;
+            if (columnCount == 0 || valueCount % columnCount != 0) {
+                throw std::runtime_error("Number of values is not a multiple of the number of columns. ");
+            }
+
+            std::vector<std::string> row(columnCount);
+            for (size_t first = 3; first < params.size(); first += columnCount) {
+                row.assign(params.begin() + first, params.begin() + first + columnCount);
+                try {
+                    appender.appendRow(row);
+                }
+                catch (const std::exception& e) {
+                    throw std::runtime_error("Row " + std::to_string(appender.getRowCount() + 1) + ": " + e.what());
+                }
+            }
+        }
+        else if (source == "file") {
+            context.inputFileReader.readRowsFromFile(params[3], appender);
+        }
+        else {
+            throw std::runtime_error("Unknown row source: " + source + ". Expected 'values' or 'file'. ");
+        }
+
+        int rows = appender.getRowCount();
+        appender.commit();
+        context.outputConsoleWritter.printLine(std::to_string(rows) + " rows added to " + tableName + ". ");
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Modifies the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table.
+ */
+LockSet CatalogBulkInsertCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+    return LockSet::writeTable(params[1]);
+}
+
+/**
+ * @brief Creates a deep copy of the current `CatalogBulkInsertCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `CatalogBulkInsertCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* CatalogBulkInsertCommand::clone(CommandContext& newContext) const {
+    return new CatalogBulkInsertCommand(newContext);
+}
@@ -15,6 +15,10 @@
 #include <string>
 #include "CatalogUpdateCommand.hpp"
 #include "CatalogShowTablesCommand.hpp"
+#include "CatalogSortCommand.hpp"
+#include "CatalogQueryCommand.hpp"
+#include "CatalogGenerateCommand.hpp"
+#include "CatalogBulkInsertCommand.hpp"
 
 /**
  * @class CatalogCommandFactory
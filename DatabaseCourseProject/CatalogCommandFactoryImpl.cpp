@@ -32,5 +32,9 @@ Command* CatalogCommandFactory::createCommand(const std::string& name, CommandCo
     if (name == "describe") return new CatalogDescribeCommand(context);
     if (name == "showtables") return new CatalogShowTablesCommand(context);
     if (name == "update") return new CatalogUpdateCommand(context);
+    if (name == "sort") return new CatalogSortCommand(context);
+    if (name == "query") return new CatalogQueryCommand(context);
+    if (name == "generate") return new CatalogGenerateCommand(context);
+    if (name == "bulkinsert") return new CatalogBulkInsertCommand(context);
     throw std::runtime_error("Unknown catalog command: " + name + "Please type 'help' for a list of supported commands. ");
 }
\ No newline at end of file
@@ -27,28 +27,37 @@ public:
     /**
     * @brief Executes the count command, determining the number of matching rows.
     *
-    * This method counts the occurrences of a specified `searchValue` within a
-    * `searchColumnIndex` of a given `tableName`. It retrieves the table from
-    * the loaded catalog, iterates through the relevant column, and increments
-    * a counter for each cell that matches the criteria. The final count is
-    * then printed to the console.
+    * This method counts the rows of a given `tableName` that satisfy the condition,
+    * either a `searchValue` within a `searchColumnIndex` or a WHERE expression.
+    * It retrieves the table from the loaded catalog and evaluates the condition
+    * batch by batch, counting the set bits of each selection bitmap. The final
+    * count is then printed to the console.
     *
     * @param params A constant reference to a vector of strings representing command-line parameters.
     * Expected format:
     * - `params[0]`: "count" (command name)
     * - `params[1]`: The name of the table to perform the count operation on.
-    * - `params[2]`: The 0-indexed integer position of the column to search within.
-    * - `params[3]`: The value (as a string) to match against cells in the specified column.
+    * - `params[2]`: The 0-indexed integer position of the column to search within, or `where`.
+    * - `params[3]`: The value (as a string) to match against cells in the specified column,
+    *   or a WHERE expression (see `CommandParser::parseExpression`).
     *
     * @throws std::runtime_error If no catalog is currently loaded.
     * @throws std::runtime_error If the number of parameters is incorrect (not 4).
     * @throws std::runtime_error If the specified table does not exist in the catalog.
-    * @throws std::out_of_range If `params[2]` cannot be converted to an integer, or if the
-    * resulting `searchColumnIndex` is out of bounds for the table.
+    * @throws std::runtime_error If `params[2]` is neither a column index nor `where`, or the expression is invalid.
+    * @throws std::runtime_error If the condition references a column that does not exist.
     * @throws std::exception Any other unexpected exceptions propagated from underlying operations.
     */
     void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares a shared lock on the table, so readers of the same table run in parallel.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
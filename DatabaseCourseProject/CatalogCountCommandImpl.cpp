@@ -2,6 +2,10 @@
 #include "CommandContext.hpp" 
 #include "Table.hpp"          
 #include "TableColumn.hpp"    
+#include "CommandParser.hpp"
+#include "Expression.hpp"
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>          
 #include <string>             
 #include <vector>      
@@ -20,27 +24,28 @@ CatalogCountCommand::CatalogCountCommand(CommandContext& context)
 /**
  * @brief Executes the 'count' command, tallying rows based on a column condition.
  *
- * This function processes the command-line arguments to determine the target table,
- * the column to search within, and the value to match. It performs validation checks
- * to ensure a catalog is loaded, parameters are correct, and the table exists.
+ * This function processes the command-line arguments to determine the target table
+ * and the condition. It performs validation checks to ensure a catalog is loaded,
+ * parameters are correct, and the table exists.
  *
- * The method then retrieves the specified table and column. It iterates through
- * the cells of the `searchColumnIndex`. For each cell, it checks if the value
- * matches the `searchValue`. A counter is incremented for every match found.
+ * The condition is either the classic `<column-n> <value>` equality or
+ * `where "<expression>"` (see `CommandParser::parseCondition`). It is bound to the
+ * table and evaluated batch by batch with `Expression::countMatches`, which only
+ * counts the set bits of each selection bitmap and never materializes row ids.
  * Finally, the total count of matching rows is printed to the console in a user-friendly format.
  *
  * @param params A constant reference to a vector of strings containing command-line arguments.
  * Expected elements:
  * - `params[0]`: "count"
  * - `params[1]`: Name of the table to search.
- * - `params[2]`: Index of the column (as a string, converted to int) to apply the search condition.
- * - `params[3]`: The value (string) to match against cells in the search column.
+ * - `params[2]`: Index of the column (as a string) to apply the search condition, or `where`.
+ * - `params[3]`: The value (string) to match against cells in the search column, or the WHERE expression.
  *
  * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
  * @throws std::runtime_error If `params.size()` is not 4 (incorrect number of arguments).
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails (table not found).
- * @throws std::out_of_range If `params[2]` cannot be converted to an integer, or if the resulting
- * `searchColumnIndex` is out of bounds for the table.
+ * @throws std::runtime_error If `params[2]` is not a column index or the expression is invalid.
+ * @throws std::runtime_error If a column referenced by the condition does not exist.
  * @throws std::exception Catches any other unexpected exceptions and reports their messages to the console.
  */
 void CatalogCountCommand::execute(const std::vector<std::string>& params) {
@@ -53,31 +58,52 @@ void CatalogCountCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("Not enough parameters! ");
     }
 
+    Expression* condition = nullptr;
+
     try {
         const std::string& tableName = params[1];
-        int searchColumnIndex = std::stoi(params[2]);
-        const std::string& searchValue = params[3];
 
+        ProfilePhase resolution("table resolution");
         Table& table = context.loadedCatalog.returnTableByName(tableName);
 
-        int counter = 0;
+        condition = CommandParser::parseCondition(params[2], params[3]);
+        condition->bind(table);
+        resolution.stop();
 
-        TableColumn* searchCol = table.getColumnAtGivenIndex(searchColumnIndex);
-        int size = searchCol->getSize();
+        int counter = condition->countMatches(table.getNumberOfRows());
 
-        for (int i = 0; i < size; i++) {
-            if (searchCol->matchesValues(i, searchValue)) {
-                counter++;
-            }
+        if (params[2] == "where") {
+            context.outputConsoleWritter.printLine(std::to_string(counter) + " row(s) of table "
+                + tableName + " match " + condition->toString() + ".");
         }
-
-        context.outputConsoleWritter.printLine("Column number " + std::to_string(searchColumnIndex)
-            + " of table " + tableName + " contains " + searchValue + " " + std::to_string(counter)
-            + " time/times.");
+        else {
+            context.outputConsoleWritter.printLine("Column number " + params[2]
+                + " of table " + tableName + " contains " + params[3] + " " + std::to_string(counter)
+                + " time/times.");
+        }
+        Instrumentation::recordRowsReturned(1);
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete condition;
+}
+
+/**
+ * @brief Reads the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogCountCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::readTables({ params[1] });
 }
 
 /**
@@ -27,25 +27,34 @@ public:
      * @brief Executes the delete rows command, removing matching records from a table.
      *
      * This method searches for rows in the specified `tableName` where the value in
-     * `searchColumnIndex` matches `searchValue`. All rows that satisfy this condition
+     * `searchColumnIndex` matches `searchValue`, or that satisfy a WHERE expression. All rows that satisfy this condition
      * are then deleted from the table. A count of the deleted rows is displayed to the console.
      *
      * @param params A constant reference to a vector of strings representing command-line parameters.
      * Expected format:
      * - `params[0]`: "delete" (command name)
      * - `params[1]`: The name of the target table from which rows will be deleted.
-     * - `params[2]`: The 0-indexed integer position of the column to search within.
-     * - `params[3]`: The value (as a string) to match against cells in the specified column.
+     * - `params[2]`: The 0-indexed integer position of the column to search within, or `where`.
+     * - `params[3]`: The value (as a string) to match against cells in the specified column,
+     *   or a WHERE expression (see `CommandParser::parseExpression`).
      *
      * @throws std::runtime_error If no catalog is currently loaded.
      * @throws std::runtime_error If the number of parameters is incorrect (not 4).
      * @throws std::runtime_error If the specified table does not exist in the catalog.
-     * @throws std::out_of_range If `params[2]` cannot be converted to an integer, or if the
-     * resulting `searchColumnIndex` is out of bounds for the table.
+     * @throws std::runtime_error If `params[2]` is neither a column index nor `where`, or the expression is invalid.
+     * @throws std::runtime_error If the condition references a column that does not exist.
      * @throws std::exception Any other unexpected exceptions propagated from underlying operations.
      */
 	void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares an exclusive lock on the modified table; commands on other tables keep running.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
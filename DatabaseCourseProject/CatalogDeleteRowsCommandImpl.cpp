@@ -2,6 +2,8 @@
 #include "CommandContext.hpp" 
 #include "Table.hpp"          
 #include "TableColumn.hpp"    
+#include "CommandParser.hpp"
+#include "Expression.hpp"
 #include <stdexcept>          
 #include <string>             
 #include <vector>             
@@ -20,29 +22,29 @@ CatalogDeleteRowsCommand::CatalogDeleteRowsCommand(CommandContext& context)
 /**
  * @brief Executes the 'delete' command, removing rows from a table based on a condition.
  *
- * This function processes the command-line arguments to identify the target table,
- * the column to search within, and the value to match. It performs validation checks
- * to ensure a catalog is loaded, parameters are correct, and the table exists.
+ * This function processes the command-line arguments to identify the target table
+ * and the condition. It performs validation checks to ensure a catalog is loaded,
+ * parameters are correct, and the table exists.
  *
- * The method then retrieves the specified table and column. It iterates through
- * the rows of the table in reverse order (from last to first) to safely delete
- * rows without affecting subsequent iteration indices. For each row, it checks
- * if the value in the `searchColumnIndex` matches the `searchValue`. If a match
- * is found, the entire row is deleted from the table, and a counter is incremented.
+ * The condition is either the classic `<column-n> <value>` equality or
+ * `where "<expression>"` (see `CommandParser::parseCondition`). It is bound to the
+ * table and all matching row ids are collected by `Expression::matchingRows`
+ * before anything is removed. The rows are then deleted in reverse order (from
+ * last to first), so earlier row ids stay valid while later rows are removed.
  * Finally, the total count of deleted rows is printed to the console.
  *
  * @param params A constant reference to a vector of strings containing command-line arguments.
  * Expected elements:
  * - `params[0]`: "delete"
  * - `params[1]`: Name of the table from which rows will be deleted.
- * - `params[2]`: Index of the column (as a string, converted to int) to apply the search condition.
- * - `params[3]`: The value (string) to match against cells in the search column.
+ * - `params[2]`: Index of the column (as a string) to apply the search condition, or `where`.
+ * - `params[3]`: The value (string) to match against cells in the search column, or the WHERE expression.
  *
  * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
  * @throws std::runtime_error If `params.size()` is not 4 (incorrect number of arguments).
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails (table not found).
- * @throws std::out_of_range If `params[2]` cannot be converted to an integer, or if the
- * resulting `searchColumnIndex` is out of bounds for the table.
+ * @throws std::runtime_error If `params[2]` is not a column index or the expression is invalid.
+ * @throws std::runtime_error If a column referenced by the condition does not exist.
  * @throws std::exception Catches any other unexpected exceptions and reports their messages to the console.
  */
 void CatalogDeleteRowsCommand::execute(const std::vector<std::string>& params) {
@@ -55,31 +57,46 @@ void CatalogDeleteRowsCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("Not enough parameters! ");
     }
 
+    Expression* condition = nullptr;
+
     try {
 		const std::string& tableName = params[1];
-		int searchColumnIndex = std::stoi(params[2]);
-		const std::string& searchValue = params[3];
 
         Table& table = context.loadedCatalog.returnTableByName(tableName);
 
-        TableColumn* searchCol = table.getColumnAtGivenIndex(searchColumnIndex);
+        condition = CommandParser::parseCondition(params[2], params[3]);
+        condition->bind(table);
 
-        int size = searchCol->getSize();
-        int deletedCount = 0;
+        std::vector<int> rows = condition->matchingRows(table.getNumberOfRows());
 
-        for (int i = size - 1; i >= 0; --i) {
-            if (searchCol->matchesValues(i, searchValue)) {
-                table.deleteGivenRow(i);
-                deletedCount++;
-            }
+        for (auto it = rows.rbegin(); it != rows.rend(); ++it) {
+            table.deleteGivenRow(*it);
         }
 
-        context.outputConsoleWritter.printLine("Deleted " + std::to_string(deletedCount) + " row(s).");
+        context.outputConsoleWritter.printLine("Deleted " + std::to_string(rows.size()) + " row(s).");
 
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete condition;
+}
+
+/**
+ * @brief Modifies the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table.
+ */
+LockSet CatalogDeleteRowsCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::writeTable(params[1]);
 }
 
 /**
@@ -7,8 +7,8 @@
  * @brief Command to display the schema (column types) of a specified table.
  *
  * This command allows users to inspect the structure of a table loaded in the
- * current database catalog. It lists each column's type, helping users
- * understand the data types stored within the table.
+ * current database catalog. It lists each column's type and statistics, helping users
+ * understand the data stored within the table.
  */
 class CatalogDescribeCommand : public  Command {
 private:
@@ -28,7 +28,7 @@ public:
      *
      * This method retrieves the specified table from the loaded catalog and
      * then iterates through all its columns. For each column, it prints
-     * its data type to the console. The columns are listed with a 1-based index
+     * its data type and its `ColumnStatistics` to the console. The columns are listed with a 1-based index
      * for user readability.
      *
      * @param params A constant reference to a vector of strings representing command-line parameters.
@@ -43,6 +43,14 @@ public:
      */
 	void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares a shared lock on the table, so readers of the same table run in parallel.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
@@ -24,8 +24,9 @@ CatalogDescribeCommand::CatalogDescribeCommand(CommandContext& context)
  *
  * The method then retrieves the specified table from the `context.loadedCatalog`.
  * It iterates through each `TableColumn` within the table and prints its data type
- * to the console. The columns are displayed with a 1-based index for user-friendliness,
- * rather than their internal 0-based index.
+ * to the console, followed by a line with the column statistics (row and NULL counts,
+ * estimated distinct count, bounds and, for numeric columns, the histogram). The columns
+ * are displayed with a 1-based index for user-friendliness, rather than their internal 0-based index.
  * Any exceptions (e.g., table not found) are caught and their messages are printed to the console.
  *
  * @param params A constant reference to a vector of strings containing command-line arguments.
@@ -59,14 +60,31 @@ void CatalogDescribeCommand::execute(const std::vector<std::string>& params) {
             context.outputConsoleWritter.printLine(
                 "Type of column " + std::to_string(index) + ": " + col->getTypeAsString()
             );
+            context.outputConsoleWritter.printLine("  " + col->getStatistics().toString());
             index++;
         }
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
 }
 
+/**
+ * @brief Reads the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogDescribeCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+    return LockSet::readTables({ params[1] });
+}
+
 /**
  * @brief Creates a deep copy of the current `CatalogDescribeCommand` object.
  *
@@ -45,6 +45,14 @@ public:
      */
 	void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares a shared lock on the table, so readers of the same table run in parallel.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
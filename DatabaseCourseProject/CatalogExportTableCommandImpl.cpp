@@ -61,6 +61,21 @@ void CatalogExportTableCommand::execute(const std::vector<std::string>& params)
     context.outputConsoleWritter.printLine("Table exported to: " + filepath);
 }
 
+/**
+ * @brief Reads the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogExportTableCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+    return LockSet::readTables({ params[1] });
+}
+
 /**
  * @brief Creates a deep copy of the current `CatalogExportTableCommand` object.
  *
@@ -0,0 +1,74 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class CatalogGenerateCommand
+ * @brief Command that creates a table of synthetic data for scale testing.
+ *
+ * The columns and their value distributions are described by a schema (see
+ * `ColumnGenerator`). Rows are generated in parallel on the shared
+ * `TaskScheduler`, either directly into the columns of a new table of the
+ * loaded catalog or streamed into a table file, which keeps only one block of
+ * rows in memory and therefore scales to tables larger than the memory.
+ */
+class CatalogGenerateCommand : public  Command {
+private:
+	/// Reference to the shared command execution context, providing access to the loaded catalog and I/O utilities.
+	CommandContext& context;
+public:
+	/**
+	 * @brief Constructs a CatalogGenerateCommand instance.
+	 *
+	 * @param context A reference to the `CommandContext` object, which encapsulates
+	 * the application's shared database catalog, task scheduler and I/O utility handlers.
+	 */
+	CatalogGenerateCommand(CommandContext& context);
+
+    /**
+	* @brief Executes the 'generate' command.
+	*
+	* Without a file, the table is generated in memory and added to the loaded
+	* catalog; it is stored next to the catalog as `<table>.csv` on the next `save`.
+	* With a file, the rows are written to that file block by block and can be
+	* loaded with `import` later; no catalog is needed in this case.
+	*
+	* The same schema and row count always produce the same data, independent
+	* of the number of worker threads.
+	*
+	* @param params A constant reference to a vector of strings representing command-line parameters.
+	* Expected format:
+	* - `params[0]`: "generate" (command name)
+	* - `params[1]`: The name of the new table.
+	* - `params[2]`: The number of rows.
+	* - `params[3]`: The schema, e.g. `id:int:seq,city:string:card=50:len=6:null=0.1`.
+	* - `params[4]`: Optional path of a table file to stream the rows into.
+	*
+	* @throws std::runtime_error If no file is given and no catalog is currently loaded.
+	* @throws std::runtime_error If the number of parameters is incorrect (not 4 or 5).
+	* @throws std::exception Any errors while parsing the schema, generating or writing
+	* (invalid row count, duplicate table name, unwritable file) are caught and reported.
+	*/
+	void execute(const std::vector<std::string>& params) override;
+
+	/**
+	 * @brief Declares an exclusive lock on the catalog when the table is added to it.
+	 *
+	 * @param params The parameters of `execute`.
+	 * @return The locks to hold during `execute`.
+	 */
+	LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+	/**
+	* @brief Creates a deep copy of the current object.
+	*
+	* This override implements the polymorphic cloning behavior defined in `Command`.
+	* It constructs a new instance, associating it
+	* with the provided `newContext`.
+	*
+	* @param newContext A reference to the `CommandContext` that the new cloned command should use.
+	* @return A pointer to a newly allocated object, which is a deep copy of this instance.
+	*/
+	Command* clone(CommandContext& newContext) const override;
+
+};
@@ -0,0 +1,337 @@
+#include "CatalogGenerateCommand.hpp"
+#include "CommandContext.hpp"
+#include "Catalog.hpp"
+#include "ColumnFactory.hpp"
+#include "ColumnGenerator.hpp"
+#include "FileUtils.hpp"
+#include "FormattedCells.hpp"
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
+#include "TaskScheduler.hpp"
+#include "TraceSpan.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /// Rows per generation task. Each chunk has its own random engine, seeded by the chunk index.
+    const int CHUNK_ROWS = 65536;
+
+    /// Chunks generated per block and worker; a block is the unit appended to the columns or the file.
+    const int CHUNKS_PER_WORKER = 2;
+
+    /// Base seed of the chunk random engines.
+    const unsigned long long SEED = 0x5DEECE66DULL;
+
+    /**
+     * @brief The generated cells of one column of a block, in the native type of the column.
+     *
+     * Only the vector of the column's type is used. NULL cells hold `0` or an
+     * empty string as their value.
+     */
+    struct GeneratedColumn {
+        std::vector<int> integers;        ///< The values of an int column.
+        std::vector<double> doubles;      ///< The values of a double column.
+        std::vector<std::string> strings; ///< The values of a string column.
+        std::vector<char> nulls;          ///< 1 for every NULL cell, 0 otherwise.
+    };
+
+    /**
+     * @brief Generates the rows [firstRow, firstRow + rowCount) in parallel.
+     *
+     * The block is cut into chunks of `CHUNK_ROWS` rows aligned to multiples of
+     * `CHUNK_ROWS`, so a chunk always gets the same seed and thus the same data.
+     * Within a chunk the cells are drawn row by row, NULL decision first.
+     *
+     * @param generators One generator per column.
+     * @param firstRow The first row of the block; a multiple of `CHUNK_ROWS`.
+     * @param rowCount The number of rows of the block.
+     * @param scheduler The scheduler running the chunks.
+     * @param block Receives the cells, one entry per column.
+     */
+    void generateBlock(const std::vector<ColumnGenerator>& generators, long long firstRow, int rowCount,
+        TaskScheduler& scheduler, std::vector<GeneratedColumn>& block) {
+
+        block.resize(generators.size());
+        for (size_t column = 0; column < generators.size(); ++column) {
+            GeneratedColumn& cells = block[column];
+            cells.nulls.resize(rowCount);
+            switch (generators[column].getType()) {
+            case ColumnType::INTEGER: cells.integers.resize(rowCount); break;
+            case ColumnType::DOUBLE: cells.doubles.resize(rowCount); break;
+            default: cells.strings.resize(rowCount); break;
+            }
+        }
+
+        int chunks = (rowCount + CHUNK_ROWS - 1) / CHUNK_ROWS;
+        scheduler.parallelFor(0, chunks, 1, [&](int begin, int end) {
+            for (int chunk = begin; chunk < end; ++chunk) {
+                TraceSpan span("generate chunk");
+                int chunkBegin = chunk * CHUNK_ROWS;
+                int chunkEnd = std::min(rowCount, chunkBegin + CHUNK_ROWS);
+                long long chunkIndex = (firstRow + chunkBegin) / CHUNK_ROWS;
+                std::mt19937_64 random(SEED + static_cast<unsigned long long>(chunkIndex) * 0x9E3779B97F4A7C15ULL);
+
+                for (int row = chunkBegin; row < chunkEnd; ++row) {
+                    for (size_t column = 0; column < generators.size(); ++column) {
+                        const ColumnGenerator& generator = generators[column];
+                        GeneratedColumn& cells = block[column];
+                        bool null = generator.drawNull(random);
+                        cells.nulls[row] = null ? 1 : 0;
+
+                        switch (generator.getType()) {
+                        case ColumnType::INTEGER:
+                            cells.integers[row] = null ? 0 : generator.generateInteger(firstRow + row, random);
+                            break;
+                        case ColumnType::DOUBLE:
+                            cells.doubles[row] = null ? 0.0 : generator.generateDouble(random);
+                            break;
+                        default:
+                            cells.strings[row] = null ? std::string() : generator.generateString(random);
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Appends the generated values of a numeric column to it, without formatting or parsing them.
+     * @tparam T The native type of the column.
+     * @param column The column; a `TypedColumn<T>`.
+     * @param values The values of the block.
+     * @param nulls The NULL flags of the block.
+     */
+    template <typename T>
+    void appendTyped(TableColumn* column, const std::vector<T>& values, const std::vector<char>& nulls) {
+        TypedColumn<T>* target = static_cast<TypedColumn<T>*>(column);
+        for (size_t row = 0; row < values.size(); ++row) {
+            target->appendValue(values[row], nulls[row] != 0);
+        }
+    }
+
+    /**
+     * @brief Formats the generated cells of one column as they are written to a table file.
+     *
+     * Doubles are written with the 4 decimal places they were rounded to.
+     *
+     * @param generator The generator of the column.
+     * @param cells The cells of the block.
+     * @param out Receives one cell per row, empty for NULL.
+     */
+    void formatColumn(const ColumnGenerator& generator, const GeneratedColumn& cells, FormattedCells& out) {
+        out.clear();
+        for (size_t row = 0; row < cells.nulls.size(); ++row) {
+            if (cells.nulls[row] != 0) {
+                out.endCell();
+                continue;
+            }
+            switch (generator.getType()) {
+            case ColumnType::INTEGER:
+                ColumnTraits<int>::append(out.buffer(), cells.integers[row]);
+                break;
+            case ColumnType::DOUBLE: {
+                char text[64];
+                int length = std::snprintf(text, sizeof(text), "%.4f", cells.doubles[row]);
+                out.buffer().append(text, static_cast<size_t>(length));
+                break;
+            }
+            default:
+                out.buffer() += cells.strings[row];
+                break;
+            }
+            out.endCell();
+        }
+    }
+
+    /**
+     * @brief Parses the row count.
+     * @param text The text.
+     * @return The row count.
+     * @throws std::runtime_error If `text` is not a positive integer that fits a column.
+     */
+    long long parseRowCount(const std::string& text) {
+        try {
+            size_t parsed = 0;
+            long long rows = std::stoll(text, &parsed);
+            if (parsed == text.size() && rows > 0 && rows <= INT_MAX) {
+                return rows;
+            }
+        }
+        catch (const std::exception&) {
+        }
+        throw std::runtime_error("The number of rows must be an integer between 1 and " + std::to_string(INT_MAX) + ". ");
+    }
+}
+
+/**
+ * @brief Constructs a CatalogGenerateCommand object, initializing it with the shared command context.
+ *
+ * @param context A reference to the `CommandContext` object, which provides access
+ * to the loaded catalog, the task scheduler and the I/O handlers.
+ */
+CatalogGenerateCommand::CatalogGenerateCommand(CommandContext& context)
+	: context(context) {
+}
+
+/**
+ * @brief Executes the 'generate' command.
+ *
+ * Rows are produced in blocks of `CHUNK_ROWS * CHUNKS_PER_WORKER` rows per
+ * worker. The chunks of a block are generated in parallel in the native type
+ * of every column; then the block is either appended to the columns, one
+ * column per task, or formatted and appended to the file. Numbers are
+ * appended with `TypedColumn::appendValue`, so only string cells go through
+ * `addCell`.
+ * The statistics of the columns are completed right after the last block,
+ * so the first read of the new table does not build them under its lock.
+ *
+ * @param params A constant reference to a vector of strings containing command-line arguments.
+ * Expected elements:
+ * - `params[0]`: "generate"
+ * - `params[1]`: The table name.
+ * - `params[2]`: The number of rows.
+ * - `params[3]`: The schema.
+ * - `params[4]`: Optional table file to stream the rows into.
+ *
+ * @throws std::runtime_error If no file is given and `context.loadedCatalogExists` is `false`.
+ * @throws std::runtime_error If `params.size()` is not 4 or 5.
+ * @throws std::exception Catches any other exceptions and reports their messages to the console.
+ */
+void CatalogGenerateCommand::execute(const std::vector<std::string>& params) {
+
+    if (params.size() != 4 && params.size() != 5) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
+    bool toFile = params.size() == 5;
+    if (!toFile && !context.loadedCatalogExists) {
+        throw std::runtime_error("There is no file opened! ");
+    }
+
+    std::vector<TableColumn*> columns;
+
+    try {
+        const std::string& tableName = params[1];
+        long long rows = parseRowCount(params[2]);
+        std::vector<ColumnGenerator> generators = ColumnGenerator::parseSchema(params[3]);
+
+        std::vector<std::string> names;
+        std::vector<std::string> types;
+        for (const ColumnGenerator& generator : generators) {
+            generator.checkRowCount(rows);
+            names.push_back(generator.getName());
+            types.push_back(generator.getTypeAsString());
+        }
+
+        if (toFile) {
+            context.outputFileWritter.writeTableHeaderToFile(tableName, types, names, params[4]);
+        }
+        else {
+            for (Table& table : context.loadedCatalog) {
+                if (table.getName() == tableName) {
+                    throw std::runtime_error("Duplicate table name in catalog: '" + tableName + "'. A table with this name already exists.");
+                }
+            }
+            for (size_t i = 0; i < generators.size(); ++i) {
+                columns.push_back(ColumnFactory::makeColumn(names[i], types[i]));
+            }
+        }
+
+        long long blockRows = static_cast<long long>(CHUNK_ROWS) * CHUNKS_PER_WORKER * context.taskScheduler.getThreadCount();
+        std::vector<GeneratedColumn> block;
+        std::vector<FormattedCells> formatted(generators.size());
+
+        for (long long firstRow = 0; firstRow < rows; firstRow += blockRows) {
+            int count = static_cast<int>(std::min(blockRows, rows - firstRow));
+            generateBlock(generators, firstRow, count, context.taskScheduler, block);
+
+            if (toFile) {
+                context.taskScheduler.parallelFor(0, static_cast<int>(block.size()), 1, [&](int begin, int end) {
+                    for (int column = begin; column < end; ++column) {
+                        formatColumn(generators[column], block[column], formatted[column]);
+                    }
+                });
+                context.outputFileWritter.appendRowsToFile(formatted, params[4]);
+                continue;
+            }
+
+            context.taskScheduler.parallelFor(0, static_cast<int>(columns.size()), 1, [&](int begin, int end) {
+                for (int column = begin; column < end; ++column) {
+                    TraceSpan span("append column block");
+                    GeneratedColumn& cells = block[column];
+                    switch (generators[column].getType()) {
+                    case ColumnType::INTEGER:
+                        appendTyped(columns[column], cells.integers, cells.nulls);
+                        break;
+                    case ColumnType::DOUBLE:
+                        appendTyped(columns[column], cells.doubles, cells.nulls);
+                        break;
+                    default:
+                        for (std::string& cell : cells.strings) {
+                            columns[column]->addCell(std::move(cell));
+                        }
+                        break;
+                    }
+                }
+            });
+        }
+
+        if (toFile) {
+            context.outputConsoleWritter.printLine("Generated " + std::to_string(rows) + " rows into: " + params[4]
+                + ". Use 'import " + params[4] + "' to load them. ");
+            return;
+        }
+
+        context.taskScheduler.parallelFor(0, static_cast<int>(columns.size()), 1, [&](int begin, int end) {
+            for (int column = begin; column < end; ++column) {
+                columns[column]->finishStatistics();
+            }
+        });
+
+        std::string tablePath = FileUtils::getDirectoryPath(context.loadedCatalog.getPath()) + "/" + tableName + ".csv";
+        Table table(columns, tableName, tablePath);
+        columns.clear();
+        context.loadedCatalog.addTable(std::move(table));
+
+        context.outputConsoleWritter.printLine("Generated table " + tableName + " with " + std::to_string(rows)
+            + " rows. It will be saved to " + tablePath + ". ");
+    }
+    catch (const std::exception& e) {
+        for (TableColumn* column : columns) {
+            delete column;
+        }
+        context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Adds a table to the catalog, unless the rows are written to a file.
+ *
+ * Generating into a file (`params[4]`) touches no shared data at all.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the catalog, or no locks.
+ */
+LockSet CatalogGenerateCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() == 5) {
+        return LockSet();
+    }
+    return LockSet::catalog(LockMode::EXCLUSIVE);
+}
+
+/**
+ * @brief Creates a deep copy of the current `CatalogGenerateCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `CatalogGenerateCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* CatalogGenerateCommand::clone(CommandContext& newContext) const {
+    return new CatalogGenerateCommand(newContext);
+}
@@ -2,6 +2,7 @@
 #include <vector>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 /**
  * @brief Constructs an empty Catalog instance.
@@ -40,8 +41,9 @@ Catalog::~Catalog() {
  * @brief Copy constructor for Catalog.
  *
  * Performs a member-wise copy of `tableCollection` and `catalogPath`.
- * Since `std::vector` performs element-wise copy and `Table` has a deep
- * copy constructor, this results in a deep copy of all tables and their columns.
+ * Since `std::vector` performs element-wise copy and the `Table` copy
+ * constructor shares the column values copy-on-write, this costs
+ * O(tables * columns) and copies no rows.
  *
  * @param other The Catalog object to copy from.
  */
@@ -53,7 +55,7 @@ Catalog::Catalog(const Catalog& other)
 /**
  * @brief Copy assignment operator for Catalog.
  *
- * Ensures proper deep copying from `other` to this object.
+ * Ensures proper copying from `other` to this object.
  * It prevents self-assignment to avoid accidental data corruption.
  * The assignment operation for `std::vector<Table>` handles
  * deleting old `Table` objects and copying new ones, utilizing
@@ -70,16 +72,45 @@ Catalog& Catalog::operator=(const Catalog& other) {
     return *this;
 }
 
+/**
+ * @brief Move constructor for Catalog.
+ *
+ * Moves `tableCollection` and `catalogPath`; the tables keep their columns.
+ *
+ * @param other The Catalog object to move from.
+ */
+Catalog::Catalog(Catalog&& other) noexcept
+    : tableCollection(std::move(other.tableCollection)),
+    catalogPath(std::move(other.catalogPath)) {
+}
+
+/**
+ * @brief Move assignment operator for Catalog.
+ *
+ * The previous tables of this catalog are destroyed; the tables of `other`
+ * are moved in without cloning their columns.
+ *
+ * @param other The Catalog object to move from.
+ * @return A reference to this Catalog object, allowing for chaining assignments.
+ */
+Catalog& Catalog::operator=(Catalog&& other) noexcept {
+    if (this != &other) {
+        this->tableCollection = std::move(other.tableCollection);
+        this->catalogPath = std::move(other.catalogPath);
+    }
+    return *this;
+}
+
 /**
  * @brief Adds a new table to the catalog.
  *
  * Before adding, this method iterates through the existing tables to ensure
  * that no other table with the same name already exists. If a duplicate name
  * is found, an exception is thrown. Otherwise, the provided `Table` object
- * (which is a copy of the original passed by value) is moved into the
- * `tableCollection`.
+ * (which is a copy of the original, or the original itself if it was passed
+ * as an rvalue) is moved into the `tableCollection`.
  *
- * @param table The `Table` object to add to the catalog. Passed by value to ensure a copy.
+ * @param table The `Table` object to add to the catalog.
  * @throws std::runtime_error If a table with the same name (`table.getName()`)
  * already exists in the `tableCollection`.
  */
@@ -5,6 +5,7 @@
 #include "Catalog.hpp"        
 #include <stdexcept>          
 #include <string>             
+#include <utility>
 
 /**
  * @brief Constructs a CatalogImportCommand object, initializing it with the shared command context.
@@ -57,13 +58,15 @@ void CatalogImportCommand::execute(const std::vector<std::string>& params) {
 
     try {
         Table table = context.inputFileReader.readTableFromFile(filepath);
+        std::string tableName = table.getName();
 
-        context.loadedCatalog.addTable(table);
+        context.loadedCatalog.addTable(std::move(table));
 
-        context.outputConsoleWritter.printLine("Succesfuly imported table - " + table.getName() + ". ");
+        context.outputConsoleWritter.printLine("Succesfuly imported table - " + tableName + ". ");
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
 }
 
@@ -15,6 +15,9 @@ class CatalogInnerJoinCommand : public Command {
 private:
 	/// Reference to the shared command execution context, providing access to the loaded catalog and I/O utilities.
 	CommandContext& context;
+
+	/// Largest number of row pairs for which the join compares every pair instead of building a hash table.
+	static const size_t NESTED_LOOP_LIMIT = 4096;
 public:
 	/**
 	* @brief Constructs a CatalogInnerJoinCommand instance.
@@ -53,6 +56,17 @@ public:
      */
 	void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares shared locks on both joined tables.
+     *
+     * The locks are acquired in the order of the table names, whatever order the
+     * tables are given in, so two joins of the same tables cannot deadlock.
+     *
+     * @param params The parameters of `execute`; `params[1]` and `params[3]` name the tables.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
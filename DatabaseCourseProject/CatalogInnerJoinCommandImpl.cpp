@@ -5,9 +5,15 @@
 #include "ColumnType.hpp"     
 #include "OutputFileWritter.hpp" 
 #include "FileUtils.hpp"      
+#include "ProfilePhase.hpp"
+#include "TraceSpan.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>          
 #include <string>             
 #include <vector>             
+#include <unordered_map>
+#include <utility>
+#include <algorithm>
 
 /**
  * @brief Constructs a CatalogInnerJoinCommand object, initializing it with the shared command context.
@@ -35,11 +41,14 @@ CatalogInnerJoinCommand::CatalogInnerJoinCommand(CommandContext& context)
  * followed by cloning all columns from the second table, explicitly *excluding* the join column
  * from the second table to prevent duplication in the result.
  *
- * The core join logic involves nested loops: for each row in the first table and each row in
- * the second table, it compares the values in their respective join columns. If the values
- * match, a new row is constructed in `resultCols` by combining the data from the matching
- * rows (all columns from the first table, and all columns from the second table *except*
- * its join column).
+ * The join algorithm is chosen from the column statistics. When both tables are tiny
+ * (at most `NESTED_LOOP_LIMIT` row pairs), a nested loop compares every pair of rows.
+ * Otherwise a hash join is used: the join values of the table with fewer rows are
+ * hashed and the other table probes them. The matching row pairs are ordered by
+ * (first table row, second table row), so the result is the same with either build
+ * side. The result buffers are pre-sized from the row and distinct counts. For every
+ * match a row is constructed by combining the data from the matching rows (all columns
+ * from the first table, and all columns from the second table *except* its join column).
  *
  * Finally, a new `Table` object is created from `resultCols` with an automatically generated
  * name (e.g., "inner_join_of_table1_and_table2") and a file path. This resulting table is then
@@ -80,11 +89,12 @@ void CatalogInnerJoinCommand::execute(const std::vector<std::string>& params) {
 		const std::string& tableName2 = params[3];
 		int column2 = std::stoi(params[4]);
 
+        ProfilePhase resolution("table resolution");
         Table& table1 = context.loadedCatalog.returnTableByName(tableName1);
         Table& table2 = context.loadedCatalog.returnTableByName(tableName2);
 
-        if (column1 >= table1.getColumnAtGivenIndex(0)->getSize() ||
-            column2 >= table1.getColumnAtGivenIndex(0)->getSize()) {
+        if (column1 < 0 || column1 >= table1.getNumberOfColumns() ||
+            column2 < 0 || column2 >= table2.getNumberOfColumns()) {
 
             throw std::runtime_error("Invalid column index. ");
         }
@@ -95,6 +105,7 @@ void CatalogInnerJoinCommand::execute(const std::vector<std::string>& params) {
         if (col1->getType() != col2->getType()) {
             throw std::runtime_error("Incompatible column types. ");
         }
+        resolution.stop();
 
         std::vector<std::string> resultColNames;
         std::vector<std::string> resultColTypes;
@@ -112,27 +123,86 @@ void CatalogInnerJoinCommand::execute(const std::vector<std::string>& params) {
             resultColTypes.push_back(table2.getColumnAtGivenIndex(i)->getTypeAsString());
         }
 
-        std::vector<std::vector<std::string>> resultRows;
+        ProfilePhase scan("scan");
+        const ColumnStatistics& stats1 = col1->getStatistics();
+        const ColumnStatistics& stats2 = col2->getStatistics();
+        size_t size1 = stats1.getRowCount();
+        size_t size2 = stats2.getRowCount();
 
-        for (int i = 0; i < col1->getSize(); ++i) {
-            for (int j = 0; j < col2->getSize(); ++j) {
-                if (col1->returnValueAtGivenIndexAsString(i) == col2->returnValueAtGivenIndexAsString(j)) {
-                    std::vector<std::string> row;
+        std::vector<std::pair<int, int>> matches;
+        size_t distinct = std::max<size_t>(1, std::max(stats1.estimateDistinctCount(), stats2.estimateDistinctCount()));
+        matches.reserve(std::min<size_t>(size1 * size2 / distinct, size1 + size2));
 
-                    for (auto& col : table1) {
-                        row.push_back(col->returnValueAtGivenIndexAsString(i));
+        if (size1 * size2 <= NESTED_LOOP_LIMIT) {
+            Instrumentation::recordAccessPath("nested loop join of " + table1.getName() + " and " + table2.getName());
+            TraceSpan span("join nested loop");
+            for (int i = 0; i < col1->getSize(); ++i) {
+                std::string value = col1->returnValueAtGivenIndexAsString(i);
+                for (int j = 0; j < col2->getSize(); ++j) {
+                    if (value == col2->returnValueAtGivenIndexAsString(j)) {
+                        matches.push_back(std::make_pair(i, j));
                     }
+                }
+            }
+        }
+        else {
+            bool buildOnFirst = size1 < size2;
+            TableColumn* build = buildOnFirst ? col1 : col2;
+            TableColumn* probe = buildOnFirst ? col2 : col1;
+            Instrumentation::recordAccessPath("hash join, build side " + (buildOnFirst ? table1 : table2).getName()
+                + ", probe side " + (buildOnFirst ? table2 : table1).getName());
+
+            std::unordered_map<std::string, std::vector<int>> buckets;
+            buckets.reserve(buildOnFirst ? stats1.estimateDistinctCount() + stats1.getNullCount()
+                : stats2.estimateDistinctCount() + stats2.getNullCount());
+            {
+                TraceSpan span("join build");
+                for (int i = 0; i < build->getSize(); ++i) {
+                    buckets[build->returnValueAtGivenIndexAsString(i)].push_back(i);
+                }
+            }
 
-                    for (int k = 0; k < table2.getNumberOfColumns(); ++k) {
-                        if (k == column2) {
-                            continue;
-                        }
-                        row.push_back(table2.getColumnAtGivenIndex(k)->returnValueAtGivenIndexAsString(j));
+            {
+                TraceSpan span("join probe");
+                for (int j = 0; j < probe->getSize(); ++j) {
+                    auto found = buckets.find(probe->returnValueAtGivenIndexAsString(j));
+                    if (found == buckets.end()) {
+                        continue;
                     }
+                    for (int i : found->second) {
+                        matches.push_back(buildOnFirst ? std::make_pair(i, j) : std::make_pair(j, i));
+                    }
+                }
+            }
+
+            if (buildOnFirst) {
+                std::sort(matches.begin(), matches.end());
+            }
+        }
+
+        Instrumentation::recordRows(static_cast<long long>(size1 + size2), static_cast<long long>(matches.size()));
+        scan.stop();
 
-                    resultRows.push_back(row);
+        ProfilePhase materialization("materialization");
+        std::vector<std::vector<std::string>> resultRows;
+        resultRows.reserve(matches.size());
+
+        for (const std::pair<int, int>& match : matches) {
+            std::vector<std::string> row;
+            row.reserve(resultColNames.size());
+
+            for (auto& col : table1) {
+                row.push_back(col->returnValueAtGivenIndexAsString(match.first));
+            }
+
+            for (int k = 0; k < table2.getNumberOfColumns(); ++k) {
+                if (k == column2) {
+                    continue;
                 }
+                row.push_back(table2.getColumnAtGivenIndex(k)->returnValueAtGivenIndexAsString(match.second));
             }
+
+            resultRows.push_back(row);
         }
 
         std::vector<TableColumn*> resultCols;
@@ -145,6 +215,8 @@ void CatalogInnerJoinCommand::execute(const std::vector<std::string>& params) {
             resultCols.push_back(newCol);
         }
 
+        materialization.stop();
+
         std::string targetFolder = FileUtils::getDirectoryPath(table1.getFilename());
         std::string name = "inner_join_of_" + table1.getName() + "_and_" + table2.getName();
         std::string newName = name;
@@ -157,12 +229,32 @@ void CatalogInnerJoinCommand::execute(const std::vector<std::string>& params) {
         }
 
         Table resTable(resultCols, "Inner_join_result", newTablePath);
+        ProfilePhase io("file I/O");
         context.outputFileWritter.writeTableToFile(resTable, newTablePath);
+        io.stop();
+        Instrumentation::recordRowsReturned(static_cast<long long>(resultRows.size()));
         context.outputConsoleWritter.printLine("The result of the operation was saved at: " + newTablePath);
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Reads the tables named by `params[1]` and `params[3]`.
+ *
+ * A self-join locks its table once. The result is only written to a file and
+ * does not become part of the catalog, so the catalog is merely read.
+ *
+ * @param params The parameters of `execute`.
+ * @return Shared locks on both tables.
+ */
+LockSet CatalogInnerJoinCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 4) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::readTables({ params[1], params[3] });
 }
 
 /**
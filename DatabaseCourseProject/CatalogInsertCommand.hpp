@@ -29,8 +29,9 @@ public:
      * This method adds a new row of data to the table identified by `params[1]`.
      * The values for the new row are taken from `params[2]` onwards.
      * The number of provided values must exactly match the number of columns
-     * in the target table. Each value is added to its corresponding column,
-     * potentially involving type conversion based on the column's type.
+     * in the target table. Each value is converted to the type of its column;
+     * the row is only added once every value has been converted, so a failed
+     * insert leaves the table unchanged.
      *
      * @param params A constant reference to a vector of strings representing command-line parameters.
      * Expected format:
@@ -49,6 +50,14 @@ public:
 	void execute(const std::vector<std::string>& params) override;
 
    
+    /**
+     * @brief Declares an exclusive lock on the modified table; commands on other tables keep running.
+     *
+     * @param params The parameters of `execute`; `params[1]` names the table.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
@@ -3,6 +3,7 @@
 #include "Table.hpp"          
 #include "TableColumn.hpp"    
 #include "Catalog.hpp"        
+#include "TableAppender.hpp"
 #include <stdexcept>          
 #include <string>             
 #include <vector>             
@@ -28,9 +29,10 @@ CatalogInsertCommand::CatalogInsertCommand(CommandContext& context)
  * 3. Retrieves the specified table from the `context.loadedCatalog`.
  * 4. Ensures that the number of provided values exactly matches the number of columns in the table.
  *
- * The method then iterates through the table's columns and, for each column, calls its
- * `addCell` method with the corresponding value from the input parameters. This effectively
- * adds a new row to the table. A success message is printed to the console upon
+ * The row is appended through a `TableAppender`, which converts every value
+ * before the first column grows. A value that does not fit its column
+ * therefore leaves the table unchanged instead of lengthening only the columns
+ * before it. A success message is printed to the console upon
  * successful insertion. Any errors (e.g., table not found, wrong number of values,
  * type conversion failures) are caught and reported to the console.
  *
@@ -45,8 +47,7 @@ CatalogInsertCommand::CatalogInsertCommand(CommandContext& context)
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails to find the specified table.
  * @throws std::runtime_error If the number of `values` provided does not match `table.getNumberOfColumns()`.
  * @throws std::exception Any exceptions propagated from `TableColumn::addCell` (e.g.,
- * `std::invalid_argument` or `std::out_of_range` during internal string-to-numeric conversion
- * if the value format is incorrect for the column's type).
+ * a value whose format is incorrect for the column's type). The table is left unchanged.
  */
 void CatalogInsertCommand::execute(const std::vector<std::string>& params) {
 
@@ -54,25 +55,40 @@ void CatalogInsertCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("There is no file opened! ");
     }
 
+    if (params.size() < 2) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
     try {
 		const std::string& tableName = params[1];
 		std::vector<std::string> values(params.begin() + 2, params.end());
 
         Table& table = context.loadedCatalog.returnTableByName(tableName);
 
-        if (values.size() != table.getNumberOfColumns()) {
-            throw std::runtime_error("Number of values is not equal to number of column. ");
-        }
-        int i = 0;
-        for (auto& col : table) {
-            col->addCell(values[i]);
-            ++i;
-        }
+        TableAppender appender(table);
+        appender.appendRow(values);
+        appender.commit();
         context.outputConsoleWritter.printLine("New row added successfuly. ");
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Modifies the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table.
+ */
+LockSet CatalogInsertCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::writeTable(params[1]);
 }
 
 /**
@@ -29,9 +29,9 @@ public:
 	*
 	* This method retrieves the specified table from the loaded catalog. It then
 	* prints the table's overall name, followed by its column names and their
-	* respective data types as headers. Subsequently, all rows of the table are
-	* fetched as strings and passed to `IOUtils::printInPageFormat` for paginated
-	* output to the console. This allows users to browse large tables page by page.
+	* respective data types as headers. Subsequently, a `TableRowCursor` over the
+	* table is passed to `IOUtils::printInPageFormat`, which formats the rows of one
+	* page at a time for paginated output to the console. This allows users to browse large tables page by page.
 	*
 	* @param params A constant reference to a vector of strings representing command-line parameters.
 	* Expected format:
@@ -46,6 +46,14 @@ public:
 	*/
 	void execute(const std::vector<std::string>& params) override;
 
+	/**
+	 * @brief Declares a shared lock on the table, so readers of the same table run in parallel.
+	 *
+	 * @param params The parameters of `execute`; `params[1]` names the table.
+	 * @return The locks to hold during `execute`.
+	 */
+	LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
 	/**
 	* @brief Creates a deep copy of the current object.
 	*
@@ -4,6 +4,8 @@
 #include "TableColumn.hpp"        
 #include "IOUtils.hpp"            
 #include "Catalog.hpp"            
+#include "TableRowCursor.hpp"
+#include "RecordFormat.hpp"
 #include <stdexcept>              
 #include <string>                 
 #include <vector>                 
@@ -29,12 +31,14 @@ CatalogPrintCommand::CatalogPrintCommand(CommandContext& context)
  * The method then retrieves the specified table from the `context.loadedCatalog`.
  * It first prints the table's name. Following that, it iterates through the table's
  * columns to print all column names on one line, and then all column types on the next line,
- * serving as a header for the data.
+ * serving as a header for the data. In unattended runs (the console reader is
+ * not interactive) only the column names are printed, as a record (see `RecordFormat`)
+ * like the rows that follow.
  *
- * All rows of the table are then retrieved as formatted strings using `table.getRowAsString(i)`.
- * These rows are collected into a `std::vector<std::string>`. Finally, `IOUtils::printInPageFormat`
- * is used to output these rows to the console with pagination, allowing the user to
- * navigate through large result sets. Any errors (e.g., table not found) are caught
+ * The rows themselves are supplied by a `TableRowCursor`. `IOUtils::printInPageFormat`
+ * pulls one page of row ids at a time from it and formats only those rows with
+ * `table.getRowAsString(i)`, allowing the user to navigate through large tables
+ * without materializing them. Any errors (e.g., table not found) are caught
  * and reported to the console.
  *
  * @param params A constant reference to a vector of strings containing command-line arguments.
@@ -64,31 +68,49 @@ void CatalogPrintCommand::execute(const std::vector<std::string>& params) {
 
         std::string command;
 
-        context.outputConsoleWritter.printLine("Table: " + name);
+        if (context.inputConsoleReader.isInteractive()) {
+            context.outputConsoleWritter.printLine("Table: " + name);
 
-        for (auto& col : table) {
-            context.outputConsoleWritter.print(col->getName() + " ");
+            for (auto& col : table) {
+                context.outputConsoleWritter.print(col->getName() + " ");
+            }
+            context.outputConsoleWritter.printLine("");
+            for (auto& col : table) {
+                context.outputConsoleWritter.print(col->getTypeAsString() + " ");
+            }
+            context.outputConsoleWritter.printLine("");
         }
-        context.outputConsoleWritter.printLine("");
-        for (auto& col : table) {
-            context.outputConsoleWritter.print(col->getTypeAsString() + " ");
+        else {
+            std::vector<std::string> names;
+            for (auto& col : table) {
+                names.push_back(col->getName());
+            }
+            context.outputConsoleWritter.printLine(RecordFormat::formatRecord(names));
         }
-        context.outputConsoleWritter.printLine("");
-        std::vector<std::string> rows;
+        TableRowCursor cursor(table);
 
-        int size = table.getColumnAtGivenIndex(0)->getSize();
-
-        for (int i = 0; i < size; i++) {
-            rows.push_back(table.getRowAsString(i));
-
-        }
-
-        IOUtils::printInPageFormat(rows, context.outputConsoleWritter, context.inputConsoleReader);
+        IOUtils::printInPageFormat(cursor, context.outputConsoleWritter, context.inputConsoleReader);
 
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Reads the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogPrintCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::readTables({ params[1] });
 }
 
 /**
@@ -0,0 +1,66 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class CatalogQueryCommand
+ * @brief Command to run a statement of the supported SQL subset against the loaded catalog.
+ *
+ * The statement is parsed by `QueryParser`, compiled by `QueryPlanner` into a
+ * push-based pipeline of operators (scan, filter, hash join, aggregate, sort,
+ * limit, projection) and executed. New query shapes therefore need no new
+ * command class. See `QueryParser` for the grammar.
+ */
+class CatalogQueryCommand : public Command {
+private:
+    /// Reference to the shared command execution context, providing access to the loaded catalog and I/O utilities.
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs a CatalogQueryCommand instance.
+     *
+     * @param context A reference to the `CommandContext` object, which encapsulates
+     * the application's shared database catalog and console I/O handlers.
+     */
+    CatalogQueryCommand(CommandContext& context);
+
+    /**
+    * @brief Executes the 'query' command.
+    *
+    * All parameters after the command name are joined with spaces into the
+    * statement, so it may be written with or without surrounding double quotes.
+    * The names of the result columns are printed first, followed by the rows
+    * in the paginated format of `IOUtils::printInPageFormat`.
+    *
+    * @param params A constant reference to a vector of strings representing command-line parameters.
+    * Expected format:
+    * - `params[0]`: "query" (command name)
+    * - `params[1...]`: The statement, e.g. `SELECT name, COUNT(*) FROM Orders GROUP BY name`.
+    *
+    * @throws std::runtime_error If no catalog is currently loaded.
+    * @throws std::runtime_error If no statement is given.
+    * @throws std::runtime_error If the statement is invalid or cannot be resolved against the catalog.
+    */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares shared locks on the tables named after FROM and JOIN.
+     *
+     * @param params The parameters of `execute`, i.e. the statement.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+};
@@ -0,0 +1,124 @@
+#include "CatalogQueryCommand.hpp"
+#include "CommandContext.hpp"
+#include "Catalog.hpp"
+#include "IOUtils.hpp"
+#include "QueryParser.hpp"
+#include "QueryPlanner.hpp"
+#include "QueryPipeline.hpp"
+#include "RecordFormat.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Constructs a CatalogQueryCommand object, initializing it with the shared command context.
+ *
+ * @param context A reference to the `CommandContext` object. This context provides
+ * access to the application's shared database catalog and console I/O handlers.
+ */
+CatalogQueryCommand::CatalogQueryCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Executes the 'query' command.
+ *
+ * The parameters after the command name are joined back into the statement,
+ * which is parsed with `QueryParser::parse` and compiled with
+ * `QueryPlanner::compile`. The pipeline is executed once; the header with the
+ * result column names is printed, followed by the result rows through
+ * `IOUtils::printInPageFormat`. In unattended runs the header is printed as
+ * a record like the rows. Any errors are caught and reported.
+ *
+ * @param params A constant reference to a vector of strings containing command-line arguments.
+ * Expected elements:
+ * - `params[0]`: "query"
+ * - `params[1...]`: The statement.
+ *
+ * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
+ * @throws std::runtime_error If `params.size()` is less than 2.
+ * @throws std::exception Catches any other exceptions (invalid statement, unknown table or column,
+ * non-numeric data) and reports their messages to the console.
+ */
+void CatalogQueryCommand::execute(const std::vector<std::string>& params) {
+
+    if (!context.loadedCatalogExists) {
+        throw std::runtime_error("There is no file opened! ");
+    }
+
+    if (params.size() < 2) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
+    QueryPipeline* pipeline = nullptr;
+
+    try {
+        std::string sql;
+        for (size_t i = 1; i < params.size(); ++i) {
+            sql += params[i] + " ";
+        }
+
+        pipeline = QueryPlanner::compile(QueryParser::parse(sql), context.loadedCatalog);
+        pipeline->execute();
+
+        std::string header = RecordFormat::formatRecord(pipeline->getColumnNames());
+        if (context.inputConsoleReader.isInteractive()) {
+            header = RecordFormat::toDisplayRow(header);
+        }
+        context.outputConsoleWritter.printLine(header);
+
+        IOUtils::printInPageFormat(pipeline->getRows(), context.outputConsoleWritter, context.inputConsoleReader);
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete pipeline;
+}
+
+/**
+ * @brief Reads the tables of the statement.
+ *
+ * The statement is parsed once more to find its FROM and JOIN tables. A
+ * statement that does not parse only locks the catalog; `execute` then
+ * reports the syntax error.
+ *
+ * @param params The parameters of `execute`.
+ * @return Shared locks on the queried tables.
+ */
+LockSet CatalogQueryCommand::requiredLocks(const std::vector<std::string>& params) const {
+    std::string sql;
+    for (size_t i = 1; i < params.size(); ++i) {
+        sql += params[i] + " ";
+    }
+
+    try {
+        SelectStatement statement = QueryParser::parse(sql);
+        std::vector<std::string> tables = { statement.fromTable };
+        if (statement.joined) {
+            tables.push_back(statement.joinTable);
+        }
+        return LockSet::readTables(tables);
+    }
+    catch (const std::exception&) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+}
+
+/**
+ * @brief Creates a deep copy of the current `CatalogQueryCommand` object.
+ *
+ * This override constructs a new `CatalogQueryCommand` instance,
+ * associating it with the provided `newContext`. Since `CatalogQueryCommand`
+ * itself only holds a reference to `CommandContext` and no other dynamically
+ * allocated members, a simple construction with the new context is sufficient
+ * for cloning this command object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `CatalogQueryCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* CatalogQueryCommand::clone(CommandContext& newContext) const {
+    return new CatalogQueryCommand(newContext);
+}
@@ -60,6 +60,7 @@ void CatalogRenameCommand::execute(const std::vector<std::string>& params) {
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
 }
 
@@ -7,8 +7,9 @@
  * @brief Command to select and display rows from a table that meet a specific condition.
  *
  * This command allows users to filter and view data from a table based on a
- * value match in a designated column. All rows satisfying the condition are
- * displayed in a paginated format.
+ * value match in a designated column or on a WHERE expression. The rows satisfying the condition are
+ * displayed in a paginated format, optionally projected to some columns,
+ * ordered by a column and cut down with `limit`/`offset`.
  */
 class CatalogSelectCommand : public  Command {
 private:
@@ -26,29 +27,39 @@ public:
     /**
 	* @brief Executes the 'select' command, filtering and printing matching table rows.
 	*
-	* This method identifies rows in a specified `tableName` where the value in
-	* `searchColumnIndex` matches `searchValue`. It retrieves the table and the
-	* target column. For each row, if the condition is met, the entire row is
-	* formatted as a string and collected. The collected matching rows are then
-	* displayed to the console using a paginated format via `IOUtils::printInPageFormat`.
+	* This method identifies rows in a specified `tableName` that satisfy the
+	* parsed condition. Matching rows are produced lazily, one batch at a time,
+	* by a `FilteredRowCursor` and displayed to the console using a paginated format
+	* via `IOUtils::printInPageFormat`, which formats only the rows of the current page.
 	 *
 	* @param params A constant reference to a vector of strings representing command-line parameters.
 	* Expected format:
 	* - `params[0]`: "select" (command name)
-	* - `params[1]`: The 0-indexed integer position of the column to search within (as a string).
-	* - `params[2]`: The value (as a string) to match against cells in the specified column.
+	* - `params[1]`: The 0-indexed integer position of the column to search within (as a string), or `where`.
+	* - `params[2]`: The value (as a string) to match against cells in the specified column,
+	*   or a WHERE expression (see `CommandParser::parseExpression`).
 	* - `params[3]`: The name of the table to perform the selection on.
+	* - `params[4...]`: Optional clauses (see `SelectOptions`): `columns <i,j,...>`,
+	*   `orderby <column-n> [asc|desc]`, `limit <n>`, `offset <m>`.
 	*
 	* @throws std::runtime_error If no catalog is currently loaded.
-	* @throws std::runtime_error If the number of parameters is incorrect (not 4).
-	* @throws std::runtime_error If `params[1]` cannot be converted to an integer.
+	* @throws std::runtime_error If the number of parameters is incorrect (less than 4).
+	* @throws std::runtime_error If `params[1]` is neither a column index nor `where`, or the expression is invalid.
 	* @throws std::runtime_error If the specified table does not exist in the catalog.
-	* @throws std::out_of_range If `searchColumnIndex` is out of bounds for the table's columns.
+	* @throws std::runtime_error If the condition references a column that does not exist.
 	* @throws std::exception Any other unexpected exceptions propagated from underlying operations
 	* (e.g., during table data retrieval or I/O operations from `IOUtils::printInPageFormat`).
 	*/
 	void execute(const std::vector<std::string>& params) override;
 
+	/**
+	 * @brief Declares a shared lock on the selected table, so readers of the same table run in parallel.
+	 *
+	 * @param params The parameters of `execute`; `params[3]` names the table.
+	 * @return The locks to hold during `execute`.
+	 */
+	LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
 	/**
 	* @brief Creates a deep copy of the current object.
 	*
@@ -4,9 +4,19 @@
 #include "TableColumn.hpp"        
 #include "IOUtils.hpp"            
 #include "Catalog.hpp"            
+#include "FilteredRowCursor.hpp"
+#include "CommandParser.hpp"
+#include "Expression.hpp"
+#include "RowIdListCursor.hpp"
+#include "RowSelection.hpp"
+#include "SelectOptions.hpp"
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>              
 #include <string>                 
 #include <vector>                 
+#include <algorithm>
+#include <utility>
 
 /**
  * @brief Constructs a CatalogSelectCommand object, initializing it with the shared command context.
@@ -22,32 +32,42 @@ CatalogSelectCommand::CatalogSelectCommand(CommandContext& context)
 /**
  * @brief Executes the 'select' command, displaying rows matching a column condition.
  *
- * This function processes the command-line arguments to obtain the column index for
- * searching, the value to match, and the target table name. It performs validation
+ * This function processes the command-line arguments to obtain the condition
+ * and the target table name. It performs validation
  * checks to ensure a catalog is loaded, parameters are correct, and the table exists.
  *
  * The method then retrieves the specified table from the `context.loadedCatalog`
- * and the column to search within. It iterates through all rows of the table.
- * For each row, it checks if the value in the `columnToSearch` matches the `value` argument.
- * If a match is found, the entire row is retrieved as a formatted string using
- * `table.getRowAsString(i)` and added to a `std::vector<std::string>`.
+ * and binds the condition to it. The condition is either the classic
+ * `<column-n> <value>` equality or `where "<expression>"` (see
+ * `CommandParser::parseCondition`). A `FilteredRowCursor` then evaluates it batch
+ * by batch into a selection bitmap, turned into a selection vector of matching
+ * row ids. Rows are not collected up front: `IOUtils::printInPageFormat` pulls
+ * just enough of them to fill the displayed page. Only the rows on that page are formatted with
+ * `table.getRowAsString`, so the first page of a huge result appears immediately.
  *
- * Finally, the collected matching rows are passed to `IOUtils::printInPageFormat`
- * for paginated output to the console, allowing the user to browse filtered data.
+ * The optional clauses parsed by `SelectOptions` are applied on row ids:
+ * - `columns` sets the projection used when rows are formatted.
+ * - Without `orderby`, `offset` skips rows of the cursor and `limit` stops the
+ *   scan as soon as enough rows were collected.
+ * - `orderby` with `limit` keeps only the best `offset + limit` rows in a
+ *   bounded heap (`RowSelection::topK`); without `limit` all matching row ids
+ *   are sorted.
  * Any errors (e.g., table not found, invalid column index) are caught and reported.
  *
  * @param params A constant reference to a vector of strings containing command-line arguments.
  * Expected elements:
  * - `params[0]`: "select"
- * - `params[1]`: The 0-indexed integer position of the column (as a string) to search.
- * - `params[2]`: The value (string) to match against cells in the search column.
+ * - `params[1]`: The 0-indexed integer position of the column (as a string) to search, or `where`.
+ * - `params[2]`: The value (string) to match against cells in the search column, or the WHERE expression.
  * - `params[3]`: The name of the table to select from.
+ * - `params[4...]`: Optional clauses: `columns <i,j,...>`, `orderby <column-n> [asc|desc]`,
+ *   `limit <n>`, `offset <m>`.
  *
  * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
- * @throws std::runtime_error If `params.size()` is not 4 (incorrect number of arguments).
- * @throws std::invalid_argument If `params[1]` cannot be converted to an integer.
+ * @throws std::runtime_error If `params.size()` is less than 4 (incorrect number of arguments).
+ * @throws std::runtime_error If `params[1]` is not a column index or the expression is invalid.
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails to find the specified table.
- * @throws std::out_of_range If the parsed `numberOfColumn` index is less than 0 or greater than or equal to the table's actual number of columns.
+ * @throws std::runtime_error If a column referenced by the condition or the clauses does not exist.
  * @throws std::exception Catches any other unexpected exceptions and reports their messages to the console.
  */
 void CatalogSelectCommand::execute(const std::vector<std::string>& params) {
@@ -56,39 +76,85 @@ void CatalogSelectCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("There is no file opened! ");
     }
     
-    if (params.size() != 4) {
+    if (params.size() < 4) {
         throw std::runtime_error("Not enough parameters! ");
     }
 
+    Expression* condition = nullptr;
+
     try {
-        const int numberOfColumn = std::stoi(params[1]);
-        const std::string& value = params[2];
         const std::string& name = params[3];
 
+        ProfilePhase resolution("table resolution");
         Table& table = context.loadedCatalog.returnTableByName(name);
 
-        TableColumn* columnToSearch = table.getColumnAtGivenIndex(numberOfColumn);
+        condition = CommandParser::parseCondition(params[1], params[2]);
+        condition->bind(table);
+        resolution.stop();
+
+        const SelectOptions options = SelectOptions::fromParameters(params, 4);
 
-        if (numberOfColumn < 0 || numberOfColumn >= columnToSearch->getSize()) {
-            throw std::out_of_range("Invalid column index");
+        for (int column : options.projection) {
+            table.getColumnAtGivenIndex(column);
         }
 
-        std::vector<std::string> rows;
+        FilteredRowCursor cursor(table, *condition);
+        cursor.setProjection(options.projection);
 
-        int size = columnToSearch->getSize();
+        if (options.ordered) {
+            const TableColumn& orderColumn = *table.getColumnAtGivenIndex(options.orderColumn);
 
-        for (int i = 0; i < size; i++) {
-            if (columnToSearch->matchesValues(i, value)) {
-                rows.push_back(table.getRowAsString(i));
+            ProfilePhase materialization("materialization");
+            Instrumentation::recordAccessPath(options.limited
+                ? "top-" + std::to_string(options.offset + options.limit) + " heap on column " + std::to_string(options.orderColumn)
+                : "full sort of the matching row ids on column " + std::to_string(options.orderColumn));
+            std::vector<int> rowIds = options.limited
+                ? RowSelection::topK(cursor, orderColumn, options.descending, options.offset + options.limit,
+                    static_cast<size_t>(table.getNumberOfRows()))
+                : RowSelection::sortAll(cursor, orderColumn, options.descending);
+            rowIds.erase(rowIds.begin(), rowIds.begin() + std::min(options.offset, rowIds.size()));
+            materialization.stop();
 
-            }
+            RowIdListCursor ordered(table, std::move(rowIds), options.projection);
+            IOUtils::printInPageFormat(ordered, context.outputConsoleWritter, context.inputConsoleReader);
         }
+        else {
+            RowSelection::skip(cursor, options.offset);
+
+            if (options.limited) {
+                ProfilePhase materialization("materialization");
+                std::vector<int> rowIds = RowSelection::take(cursor, options.limit);
+                materialization.stop();
 
-        IOUtils::printInPageFormat(rows, context.outputConsoleWritter, context.inputConsoleReader);
+                RowIdListCursor limited(table, std::move(rowIds), options.projection);
+                IOUtils::printInPageFormat(limited, context.outputConsoleWritter, context.inputConsoleReader);
+            }
+            else {
+                IOUtils::printInPageFormat(cursor, context.outputConsoleWritter, context.inputConsoleReader);
+            }
+        }
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete condition;
+}
+
+/**
+ * @brief Reads the table named by `params[3]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return A shared lock on the table.
+ */
+LockSet CatalogSelectCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 4) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::readTables({ params[3] });
 }
 
 /**
@@ -40,6 +40,14 @@ public:
      */
 	void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares a shared lock on the catalog; no table content is read.
+     *
+     * @param params The parameters of `execute`.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
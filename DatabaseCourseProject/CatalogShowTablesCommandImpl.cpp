@@ -54,6 +54,15 @@ void CatalogShowTablesCommand::execute(const std::vector<std::string>& params) {
     }
 }
 
+/**
+ * @brief Reads the list of tables.
+ * @param params The parameters of `execute`. Unused.
+ * @return A shared lock on the catalog.
+ */
+LockSet CatalogShowTablesCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet::catalog(LockMode::SHARED);
+}
+
 /**
  * @brief Creates a deep copy of the current `CatalogShowTablesCommand` object.
  *
@@ -0,0 +1,72 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class CatalogSortCommand
+ * @brief Command to sort a table by one of its columns.
+ *
+ * The rows are sorted with an `ExternalSorter`, which stays within the memory
+ * budget given by the `--sort-memory` startup option and spills sorted runs
+ * to temporary files in the catalog directory when the table is larger.
+ * The result either replaces the rows of the loaded table, which reach its
+ * file with the next `save`, or is added to the catalog as a new table, which
+ * allows data to be pre-clustered for range lookups.
+ */
+class CatalogSortCommand : public Command {
+private:
+    /// Reference to the shared command execution context, providing access to the loaded catalog and I/O utilities.
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs a CatalogSortCommand instance.
+     *
+     * @param context A reference to the `CommandContext` object, which encapsulates
+     * the application's shared database catalog, options and I/O handlers.
+     */
+    CatalogSortCommand(CommandContext& context);
+
+    /**
+    * @brief Executes the 'sort' command.
+    *
+    * Sorts the rows of `params[1]` by the column `params[2]`. Without a target
+    * table name, the loaded table is replaced by its rows in sorted order; its
+    * file is only rewritten by `save` or `saveas`. With a target name, the sorted rows are written to
+    * `<catalog directory>/<target>.csv` and added to the catalog as a new table.
+    *
+    * @param params A constant reference to a vector of strings representing command-line parameters.
+    * Expected format:
+    * - `params[0]`: "sort" (command name)
+    * - `params[1]`: The name of the table to sort.
+    * - `params[2]`: The 0-indexed integer position of the column to sort by.
+    * - `params[3]` (optional): "asc" (default) or "desc".
+    * - last (optional): The name of a new table receiving the sorted rows.
+    *
+    * @throws std::runtime_error If no catalog is currently loaded.
+    * @throws std::runtime_error If the number of parameters is incorrect.
+    * @throws std::runtime_error If the table does not exist, the column index is invalid,
+    * the target table already exists or a file cannot be written.
+    */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares an exclusive lock on the sorted table, or on the catalog when the rows become a new table.
+     *
+     * @param params The parameters of `execute`.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+};
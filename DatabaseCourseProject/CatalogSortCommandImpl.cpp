@@ -0,0 +1,169 @@
+#include "CatalogSortCommand.hpp"
+#include "CommandContext.hpp"
+#include "Table.hpp"
+#include "Catalog.hpp"
+#include "ExternalSorter.hpp"
+#include "FileUtils.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Constructs a CatalogSortCommand object, initializing it with the shared command context.
+ *
+ * @param context A reference to the `CommandContext` object. This context provides
+ * access to the loaded catalog, the startup options (memory budget) and the file reader
+ * used to load the sorted result.
+ */
+CatalogSortCommand::CatalogSortCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Executes the 'sort' command.
+ *
+ * The parameters after the column index are an optional direction (`asc` or
+ * `desc`) followed by an optional target table name. The rows are sorted by
+ * an `ExternalSorter`, in memory if the table fits in the budget and
+ * otherwise through temporary run files in the directory of the catalog.
+ * Either way the values keep their native type and full precision.
+ *
+ * - In place: the loaded table is replaced by the sorted one. The table file
+ *   itself is not touched: like any other change, the new order reaches it
+ *   with `save` or `saveas`, and inside a transaction only the private table
+ *   of the transaction is replaced.
+ * - Into a new table: the sorted table is renamed, written to
+ *   `<catalog directory>/<target>.csv` and added to the catalog.
+ *
+ * @param params A constant reference to a vector of strings containing command-line arguments.
+ * Expected elements:
+ * - `params[0]`: "sort"
+ * - `params[1]`: The name of the table to sort.
+ * - `params[2]`: The 0-indexed integer position of the column to sort by.
+ * - `params[3]` (optional): "asc" or "desc".
+ * - last (optional): The name of the table receiving the sorted rows.
+ *
+ * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
+ * @throws std::runtime_error If fewer than 3 or more than 5 parameters are given.
+ * @throws std::exception Catches errors of the sort itself (invalid table or column,
+ * existing target, file system errors) and reports them to the console.
+ */
+void CatalogSortCommand::execute(const std::vector<std::string>& params) {
+
+    if (!context.loadedCatalogExists) {
+        throw std::runtime_error("There is no file opened! ");
+    }
+
+    if (params.size() < 3) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+    if (params.size() > 5) {
+        throw std::runtime_error("Too many parameters! ");
+    }
+
+    try {
+        const std::string& name = params[1];
+        const int column = std::stoi(params[2]);
+
+        bool descending = false;
+        size_t next = 3;
+        if (next < params.size() && (params[next] == "asc" || params[next] == "desc")) {
+            descending = params[next] == "desc";
+            ++next;
+        }
+
+        std::string targetName;
+        if (next < params.size()) {
+            targetName = params[next++];
+        }
+        if (next != params.size()) {
+            throw std::runtime_error("Invalid parameters: expected [asc|desc] [<new table>] after the column. ");
+        }
+
+        Table& table = context.loadedCatalog.returnTableByName(name);
+
+        if (column < 0 || column >= table.getNumberOfColumns()) {
+            throw std::out_of_range("Invalid column index");
+        }
+
+        std::string directory = FileUtils::getDirectoryPath(context.loadedCatalog.getPath());
+        ExternalSorter sorter(context.options.sortMemoryBudget, directory);
+
+        std::string targetPath;
+        if (!targetName.empty()) {
+            for (const Table& existing : context.loadedCatalog) {
+                if (existing.getName() == targetName) {
+                    throw std::runtime_error("Table with name '" + targetName + "' already exists. ");
+                }
+            }
+
+            targetPath = directory + "/" + targetName + ".csv";
+            if (FileUtils::fileExists(targetPath)) {
+                throw std::runtime_error("File already exists: " + targetPath);
+            }
+        }
+
+        Table sorted = sorter.sort(table, column, descending);
+        std::string runs = std::to_string(sorter.getSpilledRunCount());
+
+        if (targetName.empty()) {
+            table = std::move(sorted);
+
+            context.outputConsoleWritter.printLine("Table " + name + " sorted by column " + params[2]
+                + " (" + runs + " runs spilled to disk). ");
+        }
+        else {
+            sorted.setName(targetName);
+            sorted.setTablePath(targetPath);
+            context.outputFileWritter.writeTableToFile(sorted, targetPath);
+            context.loadedCatalog.addTable(std::move(sorted));
+
+            context.outputConsoleWritter.printLine("Sorted rows of " + name + " saved as table " + targetName
+                + " at " + targetPath + " (" + runs + " runs spilled to disk). ");
+        }
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+}
+
+/**
+ * @brief Modifies the table named by `params[1]`, or the catalog when a new table is created.
+ *
+ * Sorting in place replaces the rows of one table. Saving the sorted rows as a
+ * new table adds it to the catalog, which requires the catalog exclusively.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table or on the catalog.
+ */
+LockSet CatalogSortCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 3) {
+        return LockSet::catalog(LockMode::SHARED);
+    }
+
+    bool createsTable = params.size() == 5
+        || (params.size() == 4 && params[3] != "asc" && params[3] != "desc");
+    if (createsTable) {
+        return LockSet::catalog(LockMode::EXCLUSIVE);
+    }
+    return LockSet::writeTable(params[1]);
+}
+
+/**
+ * @brief Creates a deep copy of the current `CatalogSortCommand` object.
+ *
+ * This override constructs a new `CatalogSortCommand` instance,
+ * associating it with the provided `newContext`. Since `CatalogSortCommand`
+ * itself only holds a reference to `CommandContext` and no other dynamically
+ * allocated members, a simple construction with the new context is sufficient
+ * for cloning this command object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `CatalogSortCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* CatalogSortCommand::clone(CommandContext& newContext) const {
+    return new CatalogSortCommand(newContext);
+}
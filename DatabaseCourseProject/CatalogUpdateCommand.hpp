@@ -27,7 +27,8 @@ public:
 	* @brief Executes the 'update' command, modifying table data conditionally.
 	*
 	* This method identifies rows in a specified `tableName` where the value in
-	* `searchColumnIndex` matches `searchValue`. For each matching row, it updates
+	* `searchColumnIndex` matches `searchValue`, or that satisfy a WHERE expression.
+	* All matching rows are selected before any cell changes. For each matching row, it updates
 	* the cell in `targetColumnIndex` to `targetValue`. The `targetValue` will be
 	* converted to the appropriate type for the `targetColumn`. A success message
 	* is printed to the console upon completion.
@@ -36,21 +37,32 @@ public:
 	* Expected format:
 	* - `params[0]`: "update" (command name)
 	* - `params[1]`: The name of the table to update.
-	* - `params[2]`: The 0-indexed integer position of the column to search within (as a string).
-	* - `params[3]`: The value (as a string) to match in the search column.
+	* - `params[2]`: The 0-indexed integer position of the column to search within (as a string), or `where`.
+	* - `params[3]`: The value (as a string) to match in the search column,
+	*   or a WHERE expression (see `CommandParser::parseExpression`).
 	* - `params[4]`: The 0-indexed integer position of the column to update (as a string).
 	* - `params[5]`: The new value (as a string) to set in the target column.
 	*
 	* @throws std::runtime_error If no catalog is currently loaded.
 	* @throws std::runtime_error If the number of parameters is incorrect (not 6).
-	* @throws std::invalid_argument If `params[2]` or `params[4]` cannot be converted to an integer.
+	* @throws std::runtime_error If `params[2]` is neither a column index nor `where`, or the expression is invalid.
+	* @throws std::invalid_argument If `params[4]` cannot be converted to an integer.
 	* @throws std::runtime_error If the specified table does not exist in the catalog.
-	* @throws std::out_of_range If `searchColumnIndex` or `targetColumnIndex` is out of bounds for the table's columns.
+	* @throws std::runtime_error If the condition references a column that does not exist.
+	* @throws std::out_of_range If `targetColumnIndex` is out of bounds for the table's columns.
 	* @throws std::exception Any exceptions propagated from `TableColumn::changeValueAtIndex`
 	* (e.g., `std::invalid_argument` if `targetValue` cannot be converted to the target column's type).
 	*/
 	void execute(const std::vector<std::string>& params) override;
 
+	/**
+	 * @brief Declares an exclusive lock on the modified table; commands on other tables keep running.
+	 *
+	 * @param params The parameters of `execute`; `params[1]` names the table.
+	 * @return The locks to hold during `execute`.
+	 */
+	LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
 	/**
 	* @brief Creates a deep copy of the current object.
 	*
@@ -3,6 +3,8 @@
 #include "Table.hpp"              
 #include "TableColumn.hpp"        
 #include "Catalog.hpp"            
+#include "CommandParser.hpp"
+#include "Expression.hpp"
 #include <stdexcept>              
 #include <string>                 
 #include <vector>                 
@@ -22,17 +24,17 @@ CatalogUpdateCommand::CatalogUpdateCommand(CommandContext& context)
  * @brief Executes the 'update' command, conditionally modifying table data.
  *
  * This function processes the command-line arguments to obtain the table name,
- * the search column index, the search value, the target column index, and the
- * new target value. It performs validation checks to ensure a catalog is loaded,
+ * the condition, the target column index, and the new target value. It performs validation checks to ensure a catalog is loaded,
  * parameters are correct, and the table exists.
  *
- * The method then retrieves the specified table from the `context.loadedCatalog`,
- * along with the `searchCol` and `targetCol`. It validates that both column
- * indices are within the table's bounds.
+ * The method then retrieves the specified table from the `context.loadedCatalog`
+ * and the `targetCol`, and binds the condition to the table. The condition is
+ * either the classic `<column-n> <value>` equality or `where "<expression>"`
+ * (see `CommandParser::parseCondition`).
  *
- * It iterates through all rows of the table. For each row, if the value in the
- * `searchCol` at the current row index matches the `searchValue`, then the
- * value in the `targetCol` at the same row index is updated to `targetValue`
+ * All matching row ids are collected by `Expression::matchingRows` before the
+ * first value changes, so updating a column the condition reads cannot affect
+ * which rows are selected. For each of them the value in the `targetCol` is updated to `targetValue`
  * using `targetCol->changeValueAtIndex()`. This method handles necessary type
  * conversions and validations for the target column. A success message is
  * printed to the console upon completion of the update operation. Any errors
@@ -43,16 +45,18 @@ CatalogUpdateCommand::CatalogUpdateCommand(CommandContext& context)
  * Expected elements:
  * - `params[0]`: "update"
  * - `params[1]`: Name of the table to be updated.
- * - `params[2]`: 0-indexed integer position of the column to search within (as a string).
- * - `params[3]`: Value (string) to match in the search column.
+ * - `params[2]`: 0-indexed integer position of the column to search within (as a string), or `where`.
+ * - `params[3]`: Value (string) to match in the search column, or the WHERE expression.
  * - `params[4]`: 0-indexed integer position of the column to update (as a string).
  * - `params[5]`: New value (string) to set in the target column.
  *
  * @throws std::runtime_error If `context.loadedCatalogExists` is `false` (no catalog loaded).
  * @throws std::runtime_error If `params.size()` is not 6 (incorrect number of arguments).
- * @throws std::invalid_argument If `params[2]` or `params[4]` cannot be converted to a valid integer.
+ * @throws std::runtime_error If `params[2]` is not a column index or the expression is invalid.
+ * @throws std::invalid_argument If `params[4]` cannot be converted to a valid integer.
  * @throws std::runtime_error If `context.loadedCatalog.returnTableByName()` fails to find the specified table.
- * @throws std::out_of_range If `searchColumnIndex` or `targetColumnIndex` is less than 0 or greater than or equal to the table's number of columns.
+ * @throws std::runtime_error If a column referenced by the condition does not exist.
+ * @throws std::out_of_range If `targetColumnIndex` is less than 0 or greater than or equal to the table's number of columns.
  * @throws std::exception Catches any exceptions propagated from `TableColumn::changeValueAtIndex`
  * (e.g., `std::invalid_argument` if `targetValue` format is incorrect for the target column's type, or `std::out_of_range` if `i` is invalid, though the loop should prevent that).
  * Catches any other unexpected exceptions and reports their messages to the console.
@@ -67,30 +71,46 @@ void CatalogUpdateCommand::execute(const std::vector<std::string>& params) {
         throw std::runtime_error("Not enough parameters! ");
     }
 
+    Expression* condition = nullptr;
+
     try {
         const std::string& tableName = params[1];
-        int searchColumnIndex = std::stoi(params[2]);
-        const std::string& searchValue = params[3];
         int targetColumnIndex = std::stoi(params[4]);
         const std::string& targetValue = params[5];
 
         Table& table = context.loadedCatalog.returnTableByName(tableName);
 
-        TableColumn* searchCol = table.getColumnAtGivenIndex(searchColumnIndex);
         TableColumn* targetCol = table.getColumnAtGivenIndex(targetColumnIndex);
 
-        int size = searchCol->getSize();
+        condition = CommandParser::parseCondition(params[2], params[3]);
+        condition->bind(table);
 
-        for (int i = 0; i < size; ++i) {
-            if (searchCol->matchesValues(i, searchValue)) {
-                targetCol->changeValueAtIndex(i, targetValue);
-            }
+        for (int row : condition->matchingRows(table.getNumberOfRows())) {
+            targetCol->changeValueAtIndex(row, targetValue);
         }
         context.outputConsoleWritter.printLine("Update was successful. ");
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+
+    delete condition;
+}
+
+/**
+ * @brief Modifies the table named by `params[1]`.
+ *
+ * Without a table name only the catalog is locked; `execute` then reports the missing parameters.
+ *
+ * @param params The parameters of `execute`.
+ * @return An exclusive lock on the table.
+ */
+LockSet CatalogUpdateCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2) {
+        return LockSet::catalog(LockMode::SHARED);
     }
+    return LockSet::writeTable(params[1]);
 }
 
 /**
@@ -0,0 +1,133 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include "Expression.hpp"
+#include "TableColumn.hpp"
+#include "ColumnType.hpp"
+#include "ColumnSegments.hpp"
+
+/**
+ * @class ColumnExpression
+ * @brief Abstract base class for the leaves of an expression tree that test one column.
+ *
+ * It resolves the column index during `bind()` and offers the batch scan loop
+ * shared by all leaves: cells are tested against a predicate directly on the
+ * segments of the typed column storage and the results are packed 64 at a time into the words
+ * of a `SelectionBitmap`.
+ */
+class ColumnExpression : public Expression {
+protected:
+    int columnIndex;            ///< The 0-indexed position of the tested column.
+    const TableColumn* column;  ///< The bound column, or nullptr before `bind()`.
+
+    /**
+     * @brief Packs the NULL flags of [begin, end) of the bound column into `result`.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch, set for the NULL cells.
+     */
+    void scanNullFlags(int begin, int end, SelectionBitmap& result) const;
+
+    /**
+     * @brief Merges the zone maps of the bound column over [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param zone Receives the merged zone, with Integer bounds converted to `double`.
+     * @return `true` if the column keeps zone maps, i.e. it is numeric; `zone` is left unchanged otherwise.
+     */
+    bool summarizeZones(int begin, int end, ColumnSegments<double>::Zone& zone) const;
+
+    /**
+     * @brief Converts a literal to a number for comparison with a numeric column.
+     * @param literal The literal as written in the expression.
+     * @return The numeric value.
+     * @throws std::runtime_error If `literal` is not a number.
+     */
+    double parseNumericLiteral(const std::string& literal) const;
+
+    /**
+     * @brief Tests the cells of [begin, end) with `test` and packs the results into `result`.
+     *
+     * The range is walked segment by segment (see `ColumnSegments::forEachPiece`)
+     * in chunks of up to 64 cells that never cross a segment or a word of
+     * `result`, so a batch that crosses a segment boundary still fills whole
+     * words. `test` returns the bits of a whole chunk, which lets it combine
+     * them with the validity bitmap of the segment in one operation.
+     *
+     * @tparam T The native type of the column.
+     * @tparam ChunkTest A callable taking the segment, the offset of the first cell and the
+     * number of cells of a chunk and returning a `uint64_t` with one bit per cell, lowest first.
+     * @param cells The segments of the column.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param test The test applied to every chunk.
+     * @param result Receives one bit per row of the batch.
+     */
+    template <typename T, typename ChunkTest>
+    static void packCells(const ColumnSegments<T>& cells, int begin, int end, ChunkTest test, SelectionBitmap& result) {
+        result.reset(end - begin);
+
+        int wordIndex = 0;
+        int bit = 0;
+        uint64_t word = 0;
+        cells.forEachPiece(begin, end, [&](const typename ColumnSegments<T>::Segment& segment, int offset, int count) {
+            for (int i = offset, last = offset + count; i < last;) {
+                int take = std::min(last - i, SelectionBitmap::WORD_BITS - bit);
+                word |= test(segment, i, take) << bit;
+                i += take;
+                bit += take;
+
+                if (bit == SelectionBitmap::WORD_BITS) {
+                    result.setWord(wordIndex++, word);
+                    word = 0;
+                    bit = 0;
+                }
+            }
+        });
+        if (bit > 0) {
+            result.setWord(wordIndex, word);
+        }
+    }
+
+    /**
+     * @brief Tests the non-NULL cells of [begin, end) with `predicate`.
+     *
+     * The predicate runs on every cell without branching on its NULL flag;
+     * the results are then masked with the validity bits of the segment, which
+     * is skipped entirely for segments without NULL cells.
+     *
+     * @tparam T The native type of the column.
+     * @tparam Predicate A callable taking a `const T&` and returning `bool`.
+     * @param cells The segments of the column.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param predicate The test applied to every non-NULL cell.
+     * @param result Receives one bit per row of the batch.
+     */
+    template <typename T, typename Predicate>
+    static void scanColumn(const ColumnSegments<T>& cells, int begin, int end, Predicate predicate, SelectionBitmap& result) {
+        packCells(cells, begin, end, [&predicate](const typename ColumnSegments<T>::Segment& segment, int offset, int count) {
+            uint64_t bits = 0;
+            for (int k = 0; k < count; ++k) {
+                bits |= uint64_t(predicate(segment.values[offset + k])) << k;
+            }
+            return segment.nullCount == 0 ? bits : bits & segment.validity.extract(offset, count);
+        }, result);
+    }
+
+public:
+    /**
+     * @brief Creates a leaf for the given column.
+     * @param columnIndex The 0-indexed position of the tested column.
+     */
+    explicit ColumnExpression(int columnIndex);
+
+    /**
+     * @brief Resolves the column against `table`.
+     * @param table The table the expression will be evaluated on.
+     * @throws std::runtime_error If the column index is out of bounds.
+     */
+    void bind(const Table& table) override;
+};
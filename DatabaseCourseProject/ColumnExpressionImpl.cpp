@@ -0,0 +1,109 @@
+#include "ColumnExpression.hpp"
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
+#include "StringColumn.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Creates a leaf for the given column.
+ * @param columnIndex The 0-indexed position of the tested column.
+ */
+ColumnExpression::ColumnExpression(int columnIndex)
+    : columnIndex(columnIndex), column(nullptr) {
+}
+
+/**
+ * @brief Resolves the column against `table`.
+ * @param table The table the expression will be evaluated on.
+ * @throws std::runtime_error If the column index is out of bounds.
+ */
+void ColumnExpression::bind(const Table& table) {
+    column = table.getColumnAtGivenIndex(columnIndex);
+}
+
+/**
+ * @brief Returns the NULL flags of a chunk of cells, without reading the bitmap of a segment with no NULL cell.
+ * @tparam T The native type of the column.
+ * @param segment The segment holding the chunk.
+ * @param offset The offset of the first cell of the chunk.
+ * @param count The number of cells, at most 64.
+ * @return One bit per NULL cell, lowest first.
+ */
+template <typename T>
+static uint64_t nullBits(const typename ColumnSegments<T>::Segment& segment, int offset, int count) {
+    return segment.nullCount == 0 ? 0 : segment.validity.extractNulls(offset, count);
+}
+
+/**
+ * @brief Packs the NULL flags of [begin, end) of the bound column into `result`.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch, set for the NULL cells.
+ */
+void ColumnExpression::scanNullFlags(int begin, int end, SelectionBitmap& result) const {
+    switch (column->getType()) {
+    case ColumnType::INTEGER:
+        packCells(static_cast<const IntegerColumn*>(column)->getSegments(), begin, end,
+            nullBits<int>, result);
+        break;
+    case ColumnType::DOUBLE:
+        packCells(static_cast<const DoubleColumn*>(column)->getSegments(), begin, end,
+            nullBits<double>, result);
+        break;
+    default:
+        packCells(static_cast<const StringColumn*>(column)->getSegments(), begin, end,
+            nullBits<std::string>, result);
+        break;
+    }
+}
+
+/**
+ * @brief Merges the zone maps of the bound column over [begin, end).
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param zone Receives the merged zone, with Integer bounds converted to `double`.
+ * @return `true` if the column is numeric and keeps zone maps.
+ */
+bool ColumnExpression::summarizeZones(int begin, int end, ColumnSegments<double>::Zone& zone) const {
+    switch (column->getType()) {
+    case ColumnType::INTEGER: {
+        ColumnSegments<int>::Zone integers = static_cast<const IntegerColumn*>(column)->getSegments().summarize(begin, end);
+        zone.min = integers.min;
+        zone.max = integers.max;
+        zone.nullCount = integers.nullCount;
+        zone.rowCount = integers.rowCount;
+        return true;
+    }
+    case ColumnType::DOUBLE:
+        zone = static_cast<const DoubleColumn*>(column)->getSegments().summarize(begin, end);
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Converts a literal to a number for comparison with a numeric column.
+ *
+ * The whole literal must be consumed, so "12abc" is rejected instead of being
+ * read as 12.
+ *
+ * @param literal The literal as written in the expression.
+ * @return The numeric value.
+ * @throws std::runtime_error If `literal` is not a number.
+ */
+double ColumnExpression::parseNumericLiteral(const std::string& literal) const {
+    size_t parsed = 0;
+    double value = 0;
+    try {
+        value = std::stod(literal, &parsed);
+    }
+    catch (const std::exception&) {
+        parsed = 0;
+    }
+    if (literal.empty() || parsed != literal.size()) {
+        throw std::runtime_error("Invalid value '" + literal + "' for " + column->getTypeAsString()
+            + " column " + std::to_string(columnIndex) + ". ");
+    }
+    return value;
+}
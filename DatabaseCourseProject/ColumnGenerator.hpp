@@ -0,0 +1,143 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <random>
+#include "ColumnType.hpp"
+
+/**
+ * @class ColumnGenerator
+ * @brief Produces synthetic cell values for one column of a generated table.
+ *
+ * A generator is parsed from one column definition of the `generate` schema:
+ * @code
+ * <name>:<type>[:<distribution>][:<option>=<value>...]
+ * @endcode
+ *
+ * - `<type>`: `int`, `double` or `string`.
+ * - `<distribution>`:
+ *   - `seq` (int only): `min`, `min + 1`, ... by row number (`min` defaults to 1).
+ *   - `uniform` (default): ints and doubles uniform in [`min`, `max`],
+ *     strings uniform over `card` distinct values.
+ *   - `zipf`: ints in [`min`, `max`] or strings over `card` values, where the
+ *     k-th value has a probability proportional to 1/k^`s` (`s` defaults to 1).
+ * - Options: `min`, `max`, `card` (distinct strings), `len` (string length),
+ *   `s` (zipf skew) and `null` (ratio of NULL cells in [0, 1]).
+ *
+ * Example: `hits:int:zipf:min=1:max=1000:s=1.2:null=0.05`.
+ *
+ * Values only depend on the row number and the random engine passed in, so
+ * the same seed always reproduces the same table.
+ */
+class ColumnGenerator {
+private:
+    /**
+     * @brief The supported value distributions.
+     */
+    enum class Distribution {
+        SEQUENCE,
+        UNIFORM,
+        ZIPF
+    };
+
+    std::string name;             ///< The column name.
+    ColumnType type;              ///< The column type.
+    Distribution distribution;    ///< How values are drawn.
+    long long minimum;            ///< Smallest int value, or start of a sequence.
+    long long maximum;            ///< Largest int value.
+    double doubleMinimum;         ///< Smallest double value.
+    double doubleMaximum;         ///< Largest double value.
+    long long cardinality;        ///< Number of distinct strings.
+    int length;                   ///< Length of every string.
+    double skew;                  ///< Zipf exponent.
+    double nullRatio;             ///< Probability of a NULL cell.
+    std::vector<double> zipfCdf;  ///< Cumulative zipf probabilities of the ranks, empty for other distributions.
+
+    /**
+     * @brief Draws a zero-based zipf rank.
+     * @param random The random engine.
+     * @return A rank in [0, zipfCdf.size()).
+     */
+    long long drawZipfRank(std::mt19937_64& random) const;
+
+    /**
+     * @brief Returns the distinct string with the given id.
+     * @param id The value id in [0, cardinality).
+     * @return A lowercase string of `length` characters, unique per id.
+     */
+    std::string makeString(long long id) const;
+
+public:
+    /**
+     * @brief Parses one column definition.
+     * @param definition The definition, e.g. `price:double:uniform:min=0:max=100`.
+     * @return The generator.
+     * @throws std::runtime_error If the definition is malformed or its options are inconsistent.
+     */
+    static ColumnGenerator parse(const std::string& definition);
+
+    /**
+     * @brief Parses a complete schema: comma-separated column definitions.
+     * @param schema The schema, e.g. `id:int:seq,city:string:card=50:len=6`.
+     * @return One generator per column.
+     * @throws std::runtime_error If the schema is empty, a definition is invalid or a name repeats.
+     */
+    static std::vector<ColumnGenerator> parseSchema(const std::string& schema);
+
+    /**
+     * @brief Returns the column name.
+     * @return The name.
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Returns the column type as written in table files.
+     * @return `Integer`, `Double` or `String`.
+     */
+    std::string getTypeAsString() const;
+
+    /**
+     * @brief Checks that a table of `rows` rows can be generated with this column.
+     * @param rows The number of rows.
+     * @throws std::runtime_error If a sequence would leave the integer range.
+     */
+    void checkRowCount(long long rows) const;
+
+    /**
+     * @brief Returns the column type.
+     * @return The type; it decides which of the `generate...` methods applies.
+     */
+    ColumnType getType() const;
+
+    /**
+     * @brief Draws whether the next cell is NULL.
+     *
+     * Called once per cell before its value, so every cell consumes the same
+     * random numbers regardless of the outcome.
+     *
+     * @param random The random engine of the calling thread.
+     * @return `true` if the cell is NULL; no value is drawn for it then.
+     */
+    bool drawNull(std::mt19937_64& random) const;
+
+    /**
+     * @brief Produces the value of one row of an int column.
+     * @param row The zero-based row number.
+     * @param random The random engine of the calling thread.
+     * @return The value.
+     */
+    int generateInteger(long long row, std::mt19937_64& random) const;
+
+    /**
+     * @brief Produces the value of one row of a double column, rounded to 4 decimal places.
+     * @param random The random engine of the calling thread.
+     * @return The value.
+     */
+    double generateDouble(std::mt19937_64& random) const;
+
+    /**
+     * @brief Produces the value of one row of a string column.
+     * @param random The random engine of the calling thread.
+     * @return The value; never empty.
+     */
+    std::string generateString(std::mt19937_64& random) const;
+};
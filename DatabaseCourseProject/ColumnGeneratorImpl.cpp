@@ -0,0 +1,416 @@
+#include "ColumnGenerator.hpp"
+#include "CommandParser.hpp"
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    /// Largest zipf domain; the cumulative table holds one double per value.
+    const long long MAX_ZIPF_DOMAIN = 10000000;
+
+    /// Longest generated string.
+    const int MAX_STRING_LENGTH = 256;
+
+    /// Most base-26 digits `makeString` scrambles; 26^13 still fits in 64 bits.
+    const int SCRAMBLED_DIGITS = 13;
+
+    /**
+     * @brief Mixes the bits of a number, for the hashed characters of generated strings.
+     * @param x The input.
+     * @return The mixed value.
+     */
+    unsigned long long scramble(unsigned long long x) {
+        x *= 0x9E3779B97F4A7C15ULL;
+        x ^= x >> 29;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        return x ^ (x >> 32);
+    }
+
+    /**
+     * @brief Returns `text` in lowercase, so keywords of the schema are case-insensitive.
+     * @param text The text.
+     * @return The lowercase text.
+     */
+    std::string toLower(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        return text;
+    }
+
+    /**
+     * @brief Parses an integer option value.
+     * @param option The option name used in the error message.
+     * @param value The text.
+     * @return The value.
+     * @throws std::runtime_error If `value` is not an integer.
+     */
+    long long parseInteger(const std::string& option, const std::string& value) {
+        try {
+            size_t parsed = 0;
+            long long number = std::stoll(value, &parsed);
+            if (parsed == value.size()) {
+                return number;
+            }
+        }
+        catch (const std::exception&) {
+        }
+        throw std::runtime_error("Invalid value for " + option + ": " + value + ". ");
+    }
+
+    /**
+     * @brief Parses a floating point option value.
+     * @param option The option name used in the error message.
+     * @param value The text.
+     * @return The value.
+     * @throws std::runtime_error If `value` is not a number.
+     */
+    double parseReal(const std::string& option, const std::string& value) {
+        try {
+            size_t parsed = 0;
+            double number = std::stod(value, &parsed);
+            if (parsed == value.size()) {
+                return number;
+            }
+        }
+        catch (const std::exception&) {
+        }
+        throw std::runtime_error("Invalid value for " + option + ": " + value + ". ");
+    }
+}
+
+/**
+ * @brief Draws a zero-based zipf rank by binary search in the cumulative table.
+ * @param random The random engine.
+ * @return A rank in [0, zipfCdf.size()).
+ */
+long long ColumnGenerator::drawZipfRank(std::mt19937_64& random) const {
+    double point = std::uniform_real_distribution<double>(0.0, 1.0)(random);
+    auto found = std::lower_bound(zipfCdf.begin(), zipfCdf.end(), point);
+    if (found == zipfCdf.end()) {
+        --found;
+    }
+    return static_cast<long long>(found - zipfCdf.begin());
+}
+
+/**
+ * @brief Returns the distinct string with the given id.
+ *
+ * The id modulo 26^w, with w = min(`length`, `SCRAMBLED_DIGITS`), goes
+ * through a bijection of [0, 26^w) and is written in base 26 across the last
+ * w characters, so distinct ids give distinct strings without sharing a
+ * common prefix. The bijection adds to every digit in turn a hash of the
+ * other digits, which can be undone digit by digit; two passes let every
+ * digit depend on all others. Longer strings hold the rest of the id,
+ * id / 26^w < 26, in the character before them and hashed characters in
+ * front.
+ *
+ * @param id The value id in [0, cardinality).
+ * @return A lowercase string of `length` characters.
+ */
+std::string ColumnGenerator::makeString(long long id) const {
+    int width = std::min(length, SCRAMBLED_DIGITS);
+    unsigned long long place[SCRAMBLED_DIGITS];
+    unsigned long long domain = 1;
+    for (int i = 0; i < width; ++i) {
+        place[i] = domain;
+        domain *= 26;
+    }
+
+    unsigned long long low = static_cast<unsigned long long>(id) % domain;
+    unsigned long long high = static_cast<unsigned long long>(id) / domain;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < width; ++i) {
+            unsigned long long digit = low / place[i] % 26;
+            unsigned long long rest = low - digit * place[i];
+            unsigned long long shift = scramble(rest * 2 * SCRAMBLED_DIGITS + pass * SCRAMBLED_DIGITS + i) % 26;
+            low = rest + (digit + shift) % 26 * place[i];
+        }
+    }
+
+    std::string value(length, 'a');
+    int position = length - 1;
+    for (int i = 0; i < width; ++i, --position) {
+        value[position] = static_cast<char>('a' + low % 26);
+        low /= 26;
+    }
+    if (position >= 0) {
+        value[position--] = static_cast<char>('a' + high);
+    }
+    unsigned long long hash = static_cast<unsigned long long>(id);
+    for (; position >= 0; --position) {
+        hash = scramble(hash);
+        value[position] = static_cast<char>('a' + hash % 26);
+    }
+    return value;
+}
+
+/**
+ * @brief Parses one column definition.
+ *
+ * After the name and type, an optional distribution may follow; every
+ * remaining part must be a `key=value` option that applies to the type and
+ * distribution.
+ *
+ * @param definition The definition, e.g. `price:double:uniform:min=0:max=100`.
+ * @return The generator.
+ * @throws std::runtime_error If the definition is malformed or its options are inconsistent.
+ */
+ColumnGenerator ColumnGenerator::parse(const std::string& definition) {
+    std::vector<std::string> parts = CommandParser::parseCommand(definition, ':');
+    if (parts.size() < 2 || parts[0].empty()) {
+        throw std::runtime_error("Invalid column definition: '" + definition + "'. Expected <name>:<type>[:<distribution>][:<option>=<value>...]. ");
+    }
+
+    ColumnGenerator generator;
+    generator.name = parts[0];
+    std::string type = toLower(parts[1]);
+    if (type == "int" || type == "integer") {
+        generator.type = ColumnType::INTEGER;
+    }
+    else if (type == "double") {
+        generator.type = ColumnType::DOUBLE;
+    }
+    else if (type == "string") {
+        generator.type = ColumnType::STRING;
+    }
+    else {
+        throw std::runtime_error("Unknown column type '" + parts[1] + "' in: " + definition + ". ");
+    }
+
+    generator.distribution = Distribution::UNIFORM;
+    generator.minimum = 0;
+    generator.maximum = 999999;
+    generator.doubleMinimum = 0.0;
+    generator.doubleMaximum = 1.0;
+    generator.cardinality = 1000;
+    generator.length = 8;
+    generator.skew = 1.0;
+    generator.nullRatio = 0.0;
+
+    size_t next = 2;
+    if (parts.size() > 2 && parts[2].find('=') == std::string::npos) {
+        std::string distribution = toLower(parts[2]);
+        if (distribution == "seq") {
+            if (generator.type != ColumnType::INTEGER) {
+                throw std::runtime_error("Only int columns can be sequences: " + definition + ". ");
+            }
+            generator.distribution = Distribution::SEQUENCE;
+            generator.minimum = 1;
+        }
+        else if (distribution == "zipf") {
+            if (generator.type == ColumnType::DOUBLE) {
+                throw std::runtime_error("Double columns only support the uniform distribution: " + definition + ". ");
+            }
+            generator.distribution = Distribution::ZIPF;
+        }
+        else if (distribution != "uniform") {
+            throw std::runtime_error("Unknown distribution '" + parts[2] + "' in: " + definition + ". ");
+        }
+        next = 3;
+    }
+
+    for (size_t i = next; i < parts.size(); ++i) {
+        size_t equals = parts[i].find('=');
+        if (equals == std::string::npos) {
+            throw std::runtime_error("Expected <option>=<value> instead of '" + parts[i] + "' in: " + definition + ". ");
+        }
+        std::string key = toLower(parts[i].substr(0, equals));
+        std::string value = parts[i].substr(equals + 1);
+
+        if (key == "null") {
+            generator.nullRatio = parseReal(key, value);
+            if (generator.nullRatio < 0.0 || generator.nullRatio > 1.0) {
+                throw std::runtime_error("The null ratio must be between 0 and 1: " + definition + ". ");
+            }
+        }
+        else if ((key == "min" || key == "max") && generator.type == ColumnType::DOUBLE) {
+            (key == "min" ? generator.doubleMinimum : generator.doubleMaximum) = parseReal(key, value);
+        }
+        else if ((key == "min" || key == "max") && generator.type == ColumnType::INTEGER) {
+            long long number = parseInteger(key, value);
+            if (number < INT_MIN || number > INT_MAX) {
+                throw std::runtime_error("Value out of the integer range: " + definition + ". ");
+            }
+            (key == "min" ? generator.minimum : generator.maximum) = number;
+        }
+        else if ((key == "card" || key == "len") && generator.type == ColumnType::STRING) {
+            long long number = parseInteger(key, value);
+            if (key == "card") {
+                generator.cardinality = number;
+            }
+            else {
+                generator.length = static_cast<int>(std::min<long long>(number, INT_MAX));
+            }
+        }
+        else if (key == "s" && generator.distribution == Distribution::ZIPF) {
+            generator.skew = parseReal(key, value);
+        }
+        else {
+            throw std::runtime_error("Option '" + key + "' does not apply to: " + definition + ". ");
+        }
+    }
+
+    if (generator.type == ColumnType::INTEGER && generator.distribution != Distribution::SEQUENCE
+        && generator.minimum > generator.maximum) {
+        throw std::runtime_error("min must not exceed max: " + definition + ". ");
+    }
+    if (generator.type == ColumnType::DOUBLE && !(generator.doubleMinimum <= generator.doubleMaximum)) {
+        throw std::runtime_error("min must not exceed max: " + definition + ". ");
+    }
+    if (generator.type == ColumnType::STRING) {
+        if (generator.length < 1 || generator.length > MAX_STRING_LENGTH) {
+            throw std::runtime_error("len must be between 1 and " + std::to_string(MAX_STRING_LENGTH) + ": " + definition + ". ");
+        }
+        if (generator.cardinality < 1) {
+            throw std::runtime_error("card must be at least 1: " + definition + ". ");
+        }
+        double distinctStrings = std::pow(26.0, generator.length);
+        if (distinctStrings < static_cast<double>(generator.cardinality)) {
+            throw std::runtime_error("len is too short for card distinct strings: " + definition + ". ");
+        }
+    }
+    if (generator.distribution == Distribution::ZIPF) {
+        if (generator.skew <= 0.0) {
+            throw std::runtime_error("The zipf exponent s must be positive: " + definition + ". ");
+        }
+        long long domain = generator.type == ColumnType::STRING
+            ? generator.cardinality
+            : generator.maximum - generator.minimum + 1;
+        if (domain > MAX_ZIPF_DOMAIN) {
+            throw std::runtime_error("The zipf domain is limited to " + std::to_string(MAX_ZIPF_DOMAIN) + " values: " + definition + ". ");
+        }
+
+        generator.zipfCdf.resize(static_cast<size_t>(domain));
+        double sum = 0.0;
+        for (long long k = 0; k < domain; ++k) {
+            sum += 1.0 / std::pow(static_cast<double>(k + 1), generator.skew);
+            generator.zipfCdf[k] = sum;
+        }
+        for (double& probability : generator.zipfCdf) {
+            probability /= sum;
+        }
+    }
+
+    return generator;
+}
+
+/**
+ * @brief Parses a complete schema: comma-separated column definitions.
+ * @param schema The schema, e.g. `id:int:seq,city:string:card=50:len=6`.
+ * @return One generator per column.
+ * @throws std::runtime_error If the schema is empty, a definition is invalid or a name repeats.
+ */
+std::vector<ColumnGenerator> ColumnGenerator::parseSchema(const std::string& schema) {
+    std::vector<ColumnGenerator> generators;
+
+    for (const std::string& definition : CommandParser::parseCommand(schema, ',')) {
+        ColumnGenerator generator = parse(definition);
+        for (const ColumnGenerator& existing : generators) {
+            if (existing.name == generator.name) {
+                throw std::runtime_error("Duplicate column name: " + generator.name + ". ");
+            }
+        }
+        generators.push_back(generator);
+    }
+
+    if (generators.empty()) {
+        throw std::runtime_error("The schema has no columns. ");
+    }
+    return generators;
+}
+
+/**
+ * @brief Returns the column name.
+ * @return The name.
+ */
+const std::string& ColumnGenerator::getName() const {
+    return name;
+}
+
+/**
+ * @brief Returns the column type as written in table files.
+ * @return `Integer`, `Double` or `String`.
+ */
+std::string ColumnGenerator::getTypeAsString() const {
+    switch (type) {
+    case ColumnType::INTEGER: return "Integer";
+    case ColumnType::DOUBLE: return "Double";
+    default: return "String";
+    }
+}
+
+/**
+ * @brief Checks that a table of `rows` rows can be generated with this column.
+ * @param rows The number of rows.
+ * @throws std::runtime_error If a sequence would leave the integer range.
+ */
+void ColumnGenerator::checkRowCount(long long rows) const {
+    if (distribution == Distribution::SEQUENCE && rows > 0 && minimum + rows - 1 > INT_MAX) {
+        throw std::runtime_error("The sequence of column " + name + " exceeds the integer range. ");
+    }
+}
+
+/**
+ * @brief Returns the column type.
+ * @return The type; it decides which of the `generate...` methods applies.
+ */
+ColumnType ColumnGenerator::getType() const {
+    return type;
+}
+
+/**
+ * @brief Draws whether the next cell is NULL.
+ *
+ * Nothing is drawn for columns without NULL cells.
+ *
+ * @param random The random engine of the calling thread.
+ * @return `true` if the cell is NULL.
+ */
+bool ColumnGenerator::drawNull(std::mt19937_64& random) const {
+    return nullRatio > 0.0 && std::uniform_real_distribution<double>(0.0, 1.0)(random) < nullRatio;
+}
+
+/**
+ * @brief Produces the value of one row of an int column.
+ * @param row The zero-based row number.
+ * @param random The random engine of the calling thread.
+ * @return The value; `checkRowCount` and `parse` keep it within the integer range.
+ */
+int ColumnGenerator::generateInteger(long long row, std::mt19937_64& random) const {
+    if (distribution == Distribution::SEQUENCE) {
+        return static_cast<int>(minimum + row);
+    }
+    if (distribution == Distribution::ZIPF) {
+        return static_cast<int>(minimum + drawZipfRank(random));
+    }
+    return static_cast<int>(std::uniform_int_distribution<long long>(minimum, maximum)(random));
+}
+
+/**
+ * @brief Produces the value of one row of a double column.
+ *
+ * The value is rounded to 4 decimal places, the precision written to
+ * generated table files, so a table generated in memory holds the same
+ * values as one generated into a file and imported.
+ *
+ * @param random The random engine of the calling thread.
+ * @return The value.
+ */
+double ColumnGenerator::generateDouble(std::mt19937_64& random) const {
+    double value = std::uniform_real_distribution<double>(doubleMinimum, doubleMaximum)(random);
+    return std::round(value * 10000.0) / 10000.0;
+}
+
+/**
+ * @brief Produces the value of one row of a string column.
+ * @param random The random engine of the calling thread.
+ * @return The value; never empty.
+ */
+std::string ColumnGenerator::generateString(std::mt19937_64& random) const {
+    return makeString(distribution == Distribution::ZIPF
+        ? drawZipfRank(random)
+        : std::uniform_int_distribution<long long>(0, cardinality - 1)(random));
+}
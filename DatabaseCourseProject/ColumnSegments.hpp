@@ -0,0 +1,623 @@
+#pragma once
+#include "ValidityBitmap.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ColumnSegments
+ * @brief The cells of a column, stored as a list of segments of at most `SEGMENT_ROWS` rows.
+ *
+ * Appending fills the last segment and then starts a new one, so the cells
+ * already stored are never moved, however large the column grows. Deleting a
+ * cell only shifts the cells after it within its own segment; a segment that
+ * becomes empty is dropped. Row ids are translated to a segment and an offset
+ * with a shift while every segment but the last is full, and with a binary
+ * search over the first row ids of the segments after deletes made some of
+ * them shorter.
+ *
+ * Segments are shared between copies of the column and the snapshots taken
+ * from it (see `TableColumn::snapshot`). A write to a shared segment copies
+ * only that segment first and drops the reference to the old one, which the
+ * other holders keep alive until they are destroyed, so copies and snapshots
+ * cost O(segments) and a write after a snapshot copies at most `SEGMENT_ROWS` cells.
+ *
+ * Scans visit the column piece by piece with `forEachPiece`, each piece being
+ * a contiguous run of cells inside one segment; segments are also the unit
+ * for splitting work on a column between threads.
+ *
+ * For numeric types every segment also keeps a zone map: the minimum, the
+ * maximum and the NULL count of each block of `BLOCK_ROWS` cells. Appends and
+ * deletes keep the zones exact; an update only widens the zone of its block,
+ * so a zone may be wider than the values it covers but never narrower. Scans
+ * use `summarize` to skip the blocks that cannot hold a match.
+ *
+ * @tparam T The native type of the cells.
+ */
+template <typename T>
+class ColumnSegments {
+public:
+    static const int SEGMENT_SHIFT = 16;                 ///< log2 of `SEGMENT_ROWS`.
+    static const int SEGMENT_ROWS = 1 << SEGMENT_SHIFT;  ///< The maximum number of cells per segment.
+    static const int BLOCK_SHIFT = 10;                   ///< log2 of `BLOCK_ROWS`.
+    static const int BLOCK_ROWS = 1 << BLOCK_SHIFT;      ///< The number of cells summarized by one zone.
+    static const bool HAS_ZONES = std::is_arithmetic<T>::value; ///< Whether zone maps are kept; only for numeric types.
+
+    /**
+     * @struct Zone
+     * @brief The summary of a block of cells.
+     *
+     * A zone without non-NULL cells has `min` greater than `max`.
+     */
+    struct Zone {
+        T min;         ///< A lower bound of the non-NULL values.
+        T max;         ///< An upper bound of the non-NULL values.
+        int nullCount; ///< The number of NULL cells.
+        int rowCount;  ///< The number of cells.
+
+        /**
+         * @brief Constructs the zone of an empty block.
+         */
+        Zone()
+            : min(std::numeric_limits<T>::max()), max(std::numeric_limits<T>::lowest()), nullCount(0), rowCount(0) {
+        }
+
+        /**
+         * @brief Adds a cell to the zone.
+         * @param value The value of the cell.
+         * @param null Whether the cell is NULL.
+         */
+        void add(const T& value, bool null) {
+            ++rowCount;
+            if (null) {
+                ++nullCount;
+            }
+            else {
+                widen(value);
+            }
+        }
+
+        /**
+         * @brief Widens the bounds of the zone to include a non-NULL value.
+         * @param value The value.
+         */
+        void widen(const T& value) {
+            if (value < min) {
+                min = value;
+            }
+            if (max < value) {
+                max = value;
+            }
+        }
+
+        /**
+         * @brief Merges another zone into this one.
+         * @param other The zone to merge.
+         */
+        void merge(const Zone& other) {
+            if (other.min < min) {
+                min = other.min;
+            }
+            if (max < other.max) {
+                max = other.max;
+            }
+            nullCount += other.nullCount;
+            rowCount += other.rowCount;
+        }
+
+        /**
+         * @brief Checks whether every cell of the zone is NULL.
+         * @return `true` if the zone has no non-NULL cell; also for an empty zone.
+         */
+        bool allNull() const {
+            return nullCount == rowCount;
+        }
+    };
+
+    /**
+     * @struct Segment
+     * @brief A contiguous run of cells with its metadata.
+     */
+    struct Segment {
+        std::vector<T> values;   ///< The values; unspecified for NULL cells.
+        ValidityBitmap validity; ///< One bit per cell, cleared for NULL cells.
+        int nullCount;           ///< The number of NULL cells of the segment.
+        std::vector<Zone> zones; ///< One zone per block of `BLOCK_ROWS` cells; empty unless `HAS_ZONES`.
+
+        /**
+         * @brief Constructs an empty segment.
+         */
+        Segment() : nullCount(0) {}
+
+        /**
+         * @brief Returns the number of cells of the segment.
+         * @return The number of cells.
+         */
+        int size() const {
+            return static_cast<int>(values.size());
+        }
+    };
+
+private:
+    std::vector<std::shared_ptr<Segment>> segments;      ///< The segments in row order. Never empty segments.
+    std::vector<int> firstRows;                          ///< The row id of the first cell of every segment.
+    std::vector<std::shared_ptr<Segment>> spareSegments; ///< Empty segments allocated by `reserve`, used by later appends. Not shared with copies.
+    int rowCount;                                        ///< The total number of cells.
+    int nullCount;                                       ///< The total number of NULL cells; 0 lets readers skip the NULL flags.
+    bool uniform;                                        ///< Whether every segment but the last holds exactly `SEGMENT_ROWS` cells.
+
+    /**
+     * @brief Translates a row id to a segment and an offset inside it.
+     * @param row A valid row id.
+     * @param segmentIndex Receives the index of the segment.
+     * @param offset Receives the offset of the row inside the segment.
+     */
+    void locate(int row, int& segmentIndex, int& offset) const {
+        if (uniform) {
+            segmentIndex = row >> SEGMENT_SHIFT;
+            offset = row & (SEGMENT_ROWS - 1);
+            return;
+        }
+        segmentIndex = static_cast<int>(std::upper_bound(firstRows.begin(), firstRows.end(), row) - firstRows.begin()) - 1;
+        offset = row - firstRows[segmentIndex];
+    }
+
+    /**
+     * @brief Adds the cells [from, size) of a segment to its zones, starting new zones as needed.
+     * @param segment The segment.
+     * @param from The offset of the first cell not yet covered by a zone.
+     */
+    static void extendZones(Segment& segment, int from) {
+        if (!HAS_ZONES) {
+            return;
+        }
+        for (int i = from; i < segment.size(); ++i) {
+            if ((i & (BLOCK_ROWS - 1)) == 0) {
+                segment.zones.push_back(Zone());
+            }
+            segment.zones.back().add(segment.values[i], segment.validity.isNull(i));
+        }
+    }
+
+    /**
+     * @brief Recomputes the zones of a segment from the block holding `from` onwards.
+     *
+     * Called after a delete shifted the cells after `from`; costs as much as the shift itself.
+     *
+     * @param segment The segment.
+     * @param from The offset of the first changed cell.
+     */
+    static void rebuildZones(Segment& segment, int from) {
+        if (!HAS_ZONES) {
+            return;
+        }
+        int block = from >> BLOCK_SHIFT;
+        segment.zones.resize(block);
+        extendZones(segment, block << BLOCK_SHIFT);
+    }
+
+    /**
+     * @brief Returns the number of zones a segment of `cells` cells needs.
+     * @param cells The number of cells.
+     * @return The number of blocks, or 0 without zone maps.
+     */
+    static int zonesFor(int cells) {
+        return HAS_ZONES ? (cells + BLOCK_ROWS - 1) >> BLOCK_SHIFT : 0;
+    }
+
+    /**
+     * @brief Gives the column its own copy of a segment if a copy or snapshot still shares it.
+     *
+     * The caller holds the table exclusively, so the use count cannot grow
+     * while it is checked; a count of one means that every other user of the
+     * segment is gone, and the acquire fence orders their reads before the
+     * writes that follow.
+     *
+     * @param index The index of the segment.
+     * @return The segment, safe to modify.
+     */
+    Segment& writableSegment(size_t index) {
+        std::shared_ptr<Segment>& segment = segments[index];
+        if (segment.use_count() == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return *segment;
+        }
+
+        segment = std::make_shared<Segment>(*segment);
+        return *segment;
+    }
+
+    /**
+     * @brief Returns the segment that the next appended cell goes to.
+     *
+     * A new segment, preferably a spare one, is started if there is no
+     * segment yet or the last one is full.
+     *
+     * @return The last segment, safe to modify and with room for at least one cell.
+     */
+    Segment& appendableTail() {
+        if (segments.empty() || segments.back()->size() >= SEGMENT_ROWS) {
+            std::shared_ptr<Segment> segment;
+            if (!spareSegments.empty()) {
+                segment = std::move(spareSegments.back());
+                spareSegments.pop_back();
+            }
+            else {
+                segment = std::make_shared<Segment>();
+            }
+            segments.reserve(segments.size() + 1);
+            firstRows.reserve(firstRows.size() + 1);
+            segments.push_back(std::move(segment));
+            firstRows.push_back(rowCount);
+        }
+        return writableSegment(segments.size() - 1);
+    }
+
+public:
+    /**
+     * @brief Constructs an empty column storage.
+     */
+    ColumnSegments()
+        : rowCount(0), nullCount(0), uniform(true) {
+    }
+
+    /**
+     * @brief Shares all segments of `other`. Costs O(segments).
+     * @param other The storage to copy.
+     */
+    ColumnSegments(const ColumnSegments& other)
+        : segments(other.segments), firstRows(other.firstRows), rowCount(other.rowCount), nullCount(other.nullCount), uniform(other.uniform) {
+    }
+
+    /**
+     * @brief Takes over the segments of `other`, which is left empty.
+     * @param other The storage to move from.
+     */
+    ColumnSegments(ColumnSegments&& other) noexcept
+        : segments(std::move(other.segments)), firstRows(std::move(other.firstRows)),
+        spareSegments(std::move(other.spareSegments)), rowCount(other.rowCount), nullCount(other.nullCount), uniform(other.uniform) {
+        other.clear();
+    }
+
+    /**
+     * @brief Shares all segments of `other`. Replaced segments stay alive while a copy or snapshot still holds them.
+     * @param other The storage to copy.
+     * @return This storage.
+     */
+    ColumnSegments& operator=(const ColumnSegments& other) {
+        if (this != &other) {
+            segments = other.segments;
+            firstRows = other.firstRows;
+            spareSegments.clear();
+            rowCount = other.rowCount;
+            nullCount = other.nullCount;
+            uniform = other.uniform;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The number of cells.
+     */
+    int size() const {
+        return rowCount;
+    }
+
+    /**
+     * @brief Tells whether the storage holds no NULL cell, so readers can skip the NULL flags.
+     * @return `true` if no cell is NULL.
+     */
+    bool hasNoNulls() const {
+        return nullCount == 0;
+    }
+
+    /**
+     * @brief Returns the value of a cell.
+     * @param row A valid row id.
+     * @return The value; unspecified if the cell is NULL.
+     */
+    const T& value(int row) const {
+        int segmentIndex, offset;
+        locate(row, segmentIndex, offset);
+        return segments[segmentIndex]->values[offset];
+    }
+
+    /**
+     * @brief Tells whether a cell is NULL.
+     * @param row A valid row id.
+     * @return `true` if the cell is NULL.
+     */
+    bool isNull(int row) const {
+        int segmentIndex, offset;
+        locate(row, segmentIndex, offset);
+        return segments[segmentIndex]->validity.isNull(offset);
+    }
+
+    /**
+     * @brief Overwrites a cell, copying its segment first if it is shared.
+     * @param row A valid row id.
+     * @param value The new value.
+     * @param null Whether the cell becomes NULL.
+     */
+    void set(int row, const T& value, bool null) {
+        int segmentIndex, offset;
+        locate(row, segmentIndex, offset);
+        Segment& segment = writableSegment(segmentIndex);
+
+        int nullDelta = int(null) - int(segment.validity.isNull(offset));
+        segment.nullCount += nullDelta;
+        nullCount += nullDelta;
+        if (HAS_ZONES) {
+            Zone& zone = segment.zones[offset >> BLOCK_SHIFT];
+            zone.nullCount += nullDelta;
+            if (!null) {
+                zone.widen(value);
+            }
+        }
+        segment.values[offset] = value;
+        segment.validity.set(offset, null);
+    }
+
+    /**
+     * @brief Appends a cell to the last segment, starting a new segment if it is full.
+     * @param value The value.
+     * @param null Whether the cell is NULL.
+     */
+    void push_back(const T& value, bool null) {
+        Segment& tail = appendableTail();
+        tail.zones.reserve(zonesFor(tail.size() + 1));
+        tail.values.push_back(value);
+        try {
+            tail.validity.push_back(null);
+        }
+        catch (...) {
+            tail.values.pop_back();
+            throw;
+        }
+        tail.nullCount += int(null);
+        nullCount += int(null);
+        extendZones(tail, tail.size() - 1);
+        ++rowCount;
+    }
+
+    /**
+     * @brief Appends `count` NULL cells, filling the NULL flags a word at a time.
+     * @param count The number of cells.
+     */
+    void appendNulls(int count) {
+        while (count > 0) {
+            Segment& tail = appendableTail();
+            int from = tail.size();
+            int take = std::min(count, SEGMENT_ROWS - from);
+
+            tail.values.resize(from + take);
+            tail.validity.append(true, take);
+            tail.nullCount += take;
+            extendZones(tail, from);
+
+            rowCount += take;
+            nullCount += take;
+            count -= take;
+        }
+    }
+
+    /**
+     * @brief Removes a cell. Only the cells after it in the same segment are shifted, and only their zones recomputed.
+     * @param row A valid row id.
+     */
+    void erase(int row) {
+        int segmentIndex, offset;
+        locate(row, segmentIndex, offset);
+        Segment& segment = writableSegment(segmentIndex);
+
+        segment.nullCount -= int(segment.validity.isNull(offset));
+        nullCount -= int(segment.validity.isNull(offset));
+        segment.values.erase(segment.values.begin() + offset);
+        segment.validity.erase(offset);
+        rebuildZones(segment, offset);
+        --rowCount;
+
+        size_t shifted = segmentIndex + 1;
+        if (segment.values.empty()) {
+            segments.erase(segments.begin() + segmentIndex);
+            firstRows.erase(firstRows.begin() + segmentIndex);
+            shifted = segmentIndex;
+        }
+        for (size_t i = shifted; i < firstRows.size(); ++i) {
+            --firstRows[i];
+        }
+
+        uniform = true;
+        for (size_t i = 0; i + 1 < segments.size(); ++i) {
+            if (segments[i]->size() != SEGMENT_ROWS) {
+                uniform = false;
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Allocates the storage for `capacity` cells in total.
+     *
+     * The last segment is made writable and grown to take its share; the
+     * segments needed beyond it are allocated as spares. Appending up to
+     * `capacity` cells afterwards, also with `append`, allocates nothing.
+     *
+     * @param capacity The number of cells the storage should hold without allocating.
+     */
+    void reserve(int capacity) {
+        int needed = capacity - rowCount;
+        if (needed <= 0) {
+            return;
+        }
+
+        if (!segments.empty() && segments.back()->size() < SEGMENT_ROWS) {
+            Segment& tail = writableSegment(segments.size() - 1);
+            int fill = std::min(needed, SEGMENT_ROWS - tail.size());
+            tail.values.reserve(tail.size() + fill);
+            tail.validity.reserve(tail.size() + fill);
+            tail.zones.reserve(zonesFor(tail.size() + fill));
+            needed -= fill;
+        }
+
+        int required = (needed + SEGMENT_ROWS - 1) / SEGMENT_ROWS;
+        std::vector<std::shared_ptr<Segment>> spares;
+        spares.reserve(required);
+        for (int i = required - 1; i >= 0; --i) {
+            std::shared_ptr<Segment> spare = std::make_shared<Segment>();
+            int cells = std::min(needed - i * SEGMENT_ROWS, SEGMENT_ROWS);
+            spare->values.reserve(cells);
+            spare->validity.reserve(cells);
+            spare->zones.reserve(zonesFor(cells));
+            spares.push_back(std::move(spare));
+        }
+        segments.reserve(segments.size() + required);
+        firstRows.reserve(firstRows.size() + required);
+        spareSegments.swap(spares);
+    }
+
+    /**
+     * @brief Moves all cells of `staged` to the end of this storage and leaves `staged` empty.
+     *
+     * The cells fill the last segment before new segments are started, so
+     * appending in small batches does not fragment the column. Allocates
+     * nothing if `reserve` made room for the cells before.
+     *
+     * @param staged The cells to append. Must not be this storage.
+     */
+    void append(ColumnSegments& staged) {
+        for (const std::shared_ptr<Segment>& source : staged.segments) {
+            int copied = 0;
+            while (copied < source->size()) {
+                Segment& tail = appendableTail();
+                int take = std::min(source->size() - copied, SEGMENT_ROWS - tail.size());
+
+                tail.values.insert(tail.values.end(),
+                    std::make_move_iterator(source->values.begin() + copied),
+                    std::make_move_iterator(source->values.begin() + copied + take));
+                tail.validity.append(source->validity, copied, take);
+                int appendedNulls = source->nullCount == 0 ? 0 : source->validity.countNulls(copied, take);
+                tail.nullCount += appendedNulls;
+                nullCount += appendedNulls;
+                extendZones(tail, tail.size() - take);
+
+                rowCount += take;
+                copied += take;
+            }
+        }
+        spareSegments.clear();
+        staged.clear();
+    }
+
+    /**
+     * @brief Removes all cells.
+     */
+    void clear() {
+        segments.clear();
+        firstRows.clear();
+        spareSegments.clear();
+        rowCount = 0;
+        nullCount = 0;
+        uniform = true;
+    }
+
+    /**
+     * @brief Checks whether both storages hold the very same segments.
+     * @param other The storage to compare with.
+     * @return `true` if every segment is shared with `other`.
+     */
+    bool sharesWith(const ColumnSegments& other) const {
+        return segments == other.segments;
+    }
+
+    /**
+     * @brief Returns the number of segments.
+     * @return The number of segments.
+     */
+    int segmentCount() const {
+        return static_cast<int>(segments.size());
+    }
+
+    /**
+     * @brief Returns a segment.
+     * @param index The index of the segment, in [0, segmentCount()).
+     * @return The segment.
+     */
+    const Segment& segment(int index) const {
+        return *segments[index];
+    }
+
+    /**
+     * @brief Returns the row id of the first cell of a segment.
+     * @param index The index of the segment, in [0, segmentCount()).
+     * @return The row id.
+     */
+    int segmentFirstRow(int index) const {
+        return firstRows[index];
+    }
+
+    /**
+     * @brief Merges the zones of all blocks overlapping [begin, end).
+     *
+     * The result bounds every non-NULL value of the range; it may also cover
+     * cells next to the range that share a block with it.
+     *
+     * @param begin The first row id.
+     * @param end One past the last row id; at most `size()`.
+     * @return The merged zone.
+     */
+    Zone summarize(int begin, int end) const {
+        static_assert(HAS_ZONES, "Zone maps are only kept for numeric columns.");
+
+        Zone summary;
+        forEachPiece(begin, end, [&summary](const Segment& segment, int offset, int count) {
+            int lastBlock = (offset + count - 1) >> BLOCK_SHIFT;
+            for (int block = offset >> BLOCK_SHIFT; block <= lastBlock; ++block) {
+                summary.merge(segment.zones[block]);
+            }
+        });
+        return summary;
+    }
+
+    /**
+     * @brief Visits the cells of [begin, end) as contiguous pieces, one per segment touched.
+     *
+     * @tparam Visitor A callable taking `(const Segment& segment, int offset, int count)`;
+     * the piece consists of the cells [offset, offset + count) of `segment`.
+     * @param begin The first row id.
+     * @param end One past the last row id; at most `size()`.
+     * @param visit The callable.
+     */
+    template <typename Visitor>
+    void forEachPiece(int begin, int end, Visitor visit) const {
+        if (begin >= end) {
+            return;
+        }
+
+        int segmentIndex, offset;
+        locate(begin, segmentIndex, offset);
+        for (int row = begin; row < end; ++segmentIndex, offset = 0) {
+            const Segment& current = *segments[segmentIndex];
+            int count = std::min(end - row, current.size() - offset);
+            visit(current, offset, count);
+            row += count;
+        }
+    }
+};
+
+/// Definitions of the constants, needed where they are bound to a reference, e.g. by `std::min`.
+template <typename T>
+const int ColumnSegments<T>::SEGMENT_SHIFT;
+template <typename T>
+const int ColumnSegments<T>::SEGMENT_ROWS;
+template <typename T>
+const int ColumnSegments<T>::BLOCK_SHIFT;
+template <typename T>
+const int ColumnSegments<T>::BLOCK_ROWS;
+template <typename T>
+const bool ColumnSegments<T>::HAS_ZONES;
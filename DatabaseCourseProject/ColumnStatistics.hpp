@@ -0,0 +1,175 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "ColumnType.hpp"
+#include "ComparisonOperator.hpp"
+
+/**
+ * @class ColumnStatistics
+ * @brief Summary of the values of one column, used to estimate and prune predicates.
+ *
+ * The statistics hold:
+ * - the exact row and NULL counts, and the number of NaN cells of a Double column,
+ * - a HyperLogLog sketch estimating the number of distinct values,
+ * - the minimum and maximum value,
+ * - for numeric columns an equi-depth histogram of `HISTOGRAM_BUCKETS` buckets.
+ *
+ * Columns update the statistics incrementally on every change. Inserted values
+ * enter the sketch and widen the bounds; removed values only lower the counts,
+ * so after deletions the bounds and the sketch are conservative (they may
+ * describe values that are gone, never miss one that exists). Once the number
+ * of changes since the last full build exceeds a fifth of the rows, `isStale()`
+ * reports it and the owning column rebuilds everything from its data.
+ *
+ * NaN values enter the row count and the sketch but neither the bounds nor
+ * the histogram, since they are unordered. Every comparison with a NaN cell
+ * is false except `!=`, so only `!=` must not be pruned while NaN cells exist.
+ */
+class ColumnStatistics {
+public:
+    /// Number of buckets of the equi-depth histogram.
+    static const int HISTOGRAM_BUCKETS = 16;
+
+private:
+    /// log2 of the number of sketch registers.
+    static const int SKETCH_BITS = 10;
+
+    ColumnType type;                       ///< Type of the described column.
+    size_t rowCount;                       ///< Number of cells.
+    size_t nullCount;                      ///< Number of NULL cells.
+    size_t nanCount;                       ///< Number of NaN cells added since the last full build; not lowered by removals.
+    std::vector<unsigned char> sketch;     ///< HyperLogLog registers.
+
+    bool bounded;                          ///< Whether the bounds below are set (a non-NULL value was seen).
+    double minNumber;                      ///< Smallest value of a numeric column.
+    double maxNumber;                      ///< Largest value of a numeric column.
+    std::string minText;                   ///< Smallest value of a String column.
+    std::string maxText;                   ///< Largest value of a String column.
+
+    std::vector<double> bucketBounds;      ///< Upper bound of every histogram bucket, ascending.
+    std::vector<size_t> bucketCounts;      ///< Number of values in every histogram bucket.
+
+    bool built;                            ///< Whether a full build has happened.
+    size_t changes;                        ///< Changes since the last full build.
+
+    /**
+     * @brief Adds a value hash to the distinct-count sketch.
+     * @param hash The hash of the value.
+     */
+    void addHash(uint64_t hash);
+
+    /**
+     * @brief Estimates the fraction of the histogram values that are smaller than `value`.
+     * @param value The value.
+     * @return A fraction in [0, 1], interpolated linearly inside the bucket containing `value`.
+     */
+    double fractionBelow(double value) const;
+
+public:
+    /**
+     * @brief Creates empty statistics for a column of the given type.
+     * @param type The column type.
+     */
+    explicit ColumnStatistics(ColumnType type);
+
+    /**
+     * @brief Forgets all values, ahead of a full build.
+     */
+    void clear();
+
+    /**
+     * @brief Records a new NULL cell.
+     */
+    void addNull();
+
+    /**
+     * @brief Records `count` new NULL cells at once.
+     * @param count The number of cells.
+     */
+    void addNulls(size_t count);
+
+    /**
+     * @brief Records a new cell of a numeric column.
+     * @param value The value; NaN is counted but does not widen the bounds.
+     */
+    void addNumber(double value);
+
+    /**
+     * @brief Records a new cell of a String column.
+     * @param value The value.
+     */
+    void addText(const std::string& value);
+
+    /**
+     * @brief Records the removal of a cell.
+     * @param wasNull Whether the removed cell was NULL.
+     */
+    void remove(bool wasNull);
+
+    /**
+     * @brief Completes a full build: builds the histogram and resets the change counter.
+     *
+     * The column calls this after `clear()` and after adding all of its cells.
+     *
+     * @param values The non-NULL values of a numeric column, in any order; empty for String columns.
+     * NaN values are left out of the histogram.
+     */
+    void finishBuild(std::vector<double> values);
+
+    /**
+     * @brief Checks whether the statistics should be rebuilt from the column data.
+     * @return `true` before the first build and after many changes.
+     */
+    bool isStale() const;
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The exact row count.
+     */
+    size_t getRowCount() const;
+
+    /**
+     * @brief Returns the number of NULL cells.
+     * @return The exact NULL count.
+     */
+    size_t getNullCount() const;
+
+    /**
+     * @brief Estimates the number of distinct non-NULL values.
+     * @return The estimate, never more than the number of non-NULL cells.
+     */
+    size_t estimateDistinctCount() const;
+
+    /**
+     * @brief Estimates the fraction of rows satisfying `column op literal`.
+     *
+     * Equality uses the distinct count, ranges use the histogram (or a fixed
+     * third for String columns). NULL cells never qualify.
+     *
+     * @param op The comparison.
+     * @param literal The literal, in display form.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity(ComparisonOperator op, const std::string& literal) const;
+
+    /**
+     * @brief Checks whether `column op literal` provably matches no row.
+     *
+     * This is the case when the column has no non-NULL value, or when the
+     * literal lies outside the bounds in a way that excludes every value.
+     * `!=` is never pruned while the column may hold NaN cells.
+     *
+     * @param op The comparison.
+     * @param literal The literal, in display form.
+     * @return `true` if no row can match; `false` if some row might.
+     */
+    bool excludes(ComparisonOperator op, const std::string& literal) const;
+
+    /**
+     * @brief Formats the statistics for `describe`.
+     * @return A one-line summary.
+     */
+    std::string toString() const;
+};
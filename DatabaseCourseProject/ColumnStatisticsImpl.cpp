@@ -0,0 +1,400 @@
+#include "ColumnStatistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+
+namespace {
+    /**
+     * @brief Scrambles a hash so that all of its bits are usable by the sketch.
+     * @param x The input hash.
+     * @return The mixed hash (the splitmix64 finalizer).
+     */
+    uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Parses a literal compared with a numeric column.
+     * @param literal The literal.
+     * @param value Receives the number.
+     * @return `false` if the literal is not a number.
+     */
+    bool parseNumber(const std::string& literal, double& value) {
+        try {
+            size_t parsed = 0;
+            value = std::stod(literal, &parsed);
+            return parsed == literal.size();
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Formats a bound for display, printing Integer columns without decimals.
+     * @param value The bound.
+     * @param type The column type.
+     * @return The formatted bound.
+     */
+    std::string formatNumber(double value, ColumnType type) {
+        return type == ColumnType::INTEGER
+            ? std::to_string(static_cast<long long>(value))
+            : std::to_string(value);
+    }
+}
+
+/**
+ * @brief Creates empty statistics for a column of the given type.
+ * @param type The column type.
+ */
+ColumnStatistics::ColumnStatistics(ColumnType type)
+    : type(type), rowCount(0), nullCount(0), nanCount(0), sketch(size_t(1) << SKETCH_BITS, 0),
+    bounded(false), minNumber(0.0), maxNumber(0.0), built(false), changes(0) {
+}
+
+/**
+ * @brief Forgets all values, ahead of a full build.
+ */
+void ColumnStatistics::clear() {
+    rowCount = 0;
+    nullCount = 0;
+    nanCount = 0;
+    std::fill(sketch.begin(), sketch.end(), 0);
+    bounded = false;
+    minText.clear();
+    maxText.clear();
+    bucketBounds.clear();
+    bucketCounts.clear();
+}
+
+/**
+ * @brief Adds a value hash to the distinct-count sketch.
+ *
+ * The top `SKETCH_BITS` bits select the register, which keeps the largest
+ * position of the first set bit seen among the remaining bits.
+ *
+ * @param hash The hash of the value.
+ */
+void ColumnStatistics::addHash(uint64_t hash) {
+    hash = mix(hash);
+    size_t index = static_cast<size_t>(hash >> (64 - SKETCH_BITS));
+    uint64_t rest = (hash << SKETCH_BITS) | (uint64_t(1) << (SKETCH_BITS - 1));
+
+    unsigned char rank = 1;
+    while ((rest & (uint64_t(1) << 63)) == 0) {
+        rest <<= 1;
+        ++rank;
+    }
+    sketch[index] = std::max(sketch[index], rank);
+}
+
+/**
+ * @brief Records a new NULL cell.
+ */
+void ColumnStatistics::addNull() {
+    ++rowCount;
+    ++nullCount;
+    ++changes;
+}
+
+/**
+ * @brief Records `count` new NULL cells at once, as `count` calls to `addNull()` would.
+ * @param count The number of cells.
+ */
+void ColumnStatistics::addNulls(size_t count) {
+    rowCount += count;
+    nullCount += count;
+    changes += count;
+}
+
+/**
+ * @brief Records a new cell of a numeric column, widening the bounds.
+ *
+ * A NaN value is only counted: it has no place in the ordering the bounds describe.
+ *
+ * @param value The value.
+ */
+void ColumnStatistics::addNumber(double value) {
+    ++rowCount;
+    ++changes;
+
+    double normalized = value == 0.0 ? 0.0 : value;
+    uint64_t bits;
+    std::memcpy(&bits, &normalized, sizeof(bits));
+    addHash(bits);
+
+    if (std::isnan(value)) {
+        ++nanCount;
+        return;
+    }
+    if (!bounded || value < minNumber) minNumber = value;
+    if (!bounded || value > maxNumber) maxNumber = value;
+    bounded = true;
+}
+
+/**
+ * @brief Records a new cell of a String column, widening the bounds.
+ * @param value The value.
+ */
+void ColumnStatistics::addText(const std::string& value) {
+    ++rowCount;
+    ++changes;
+
+    addHash(std::hash<std::string>()(value));
+
+    if (!bounded || value < minText) minText = value;
+    if (!bounded || value > maxText) maxText = value;
+    bounded = true;
+}
+
+/**
+ * @brief Records the removal of a cell. The sketch, the bounds and the NaN count are left as they are.
+ * @param wasNull Whether the removed cell was NULL.
+ */
+void ColumnStatistics::remove(bool wasNull) {
+    if (rowCount > 0) {
+        --rowCount;
+    }
+    if (wasNull && nullCount > 0) {
+        --nullCount;
+    }
+    ++changes;
+}
+
+/**
+ * @brief Completes a full build: builds the histogram and resets the change counter.
+ *
+ * The values are sorted and cut into buckets holding the same number of
+ * values (equi-depth). Each bucket stores its largest value, so skewed data
+ * gets narrow buckets where values are dense. NaN values are dropped first;
+ * they are unordered and would neither sort nor bound a bucket.
+ *
+ * @param values The non-NULL values of a numeric column; empty for String columns.
+ */
+void ColumnStatistics::finishBuild(std::vector<double> values) {
+    bucketBounds.clear();
+    bucketCounts.clear();
+
+    if (nanCount > 0) {
+        values.erase(std::remove_if(values.begin(), values.end(), [](double value) {
+            return std::isnan(value);
+        }), values.end());
+    }
+
+    if (!values.empty()) {
+        std::sort(values.begin(), values.end());
+        size_t n = values.size();
+        size_t buckets = std::min(n, static_cast<size_t>(HISTOGRAM_BUCKETS));
+
+        for (size_t i = 0; i < buckets; ++i) {
+            size_t begin = i * n / buckets;
+            size_t end = (i + 1) * n / buckets;
+            bucketBounds.push_back(values[end - 1]);
+            bucketCounts.push_back(end - begin);
+        }
+    }
+
+    built = true;
+    changes = 0;
+}
+
+/**
+ * @brief Checks whether the statistics should be rebuilt from the column data.
+ * @return `true` before the first build and once the changes exceed a fifth of the rows.
+ */
+bool ColumnStatistics::isStale() const {
+    return !built || changes > rowCount / 5;
+}
+
+/**
+ * @brief Returns the number of cells.
+ * @return The exact row count.
+ */
+size_t ColumnStatistics::getRowCount() const {
+    return rowCount;
+}
+
+/**
+ * @brief Returns the number of NULL cells.
+ * @return The exact NULL count.
+ */
+size_t ColumnStatistics::getNullCount() const {
+    return nullCount;
+}
+
+/**
+ * @brief Estimates the number of distinct non-NULL values.
+ *
+ * Uses the HyperLogLog estimator, with linear counting for small
+ * cardinalities where it is more accurate.
+ *
+ * @return The estimate, never more than the number of non-NULL cells.
+ */
+size_t ColumnStatistics::estimateDistinctCount() const {
+    size_t nonNull = rowCount - nullCount;
+    if (nonNull == 0) {
+        return 0;
+    }
+
+    double m = static_cast<double>(sketch.size());
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (unsigned char rank : sketch) {
+        sum += std::ldexp(1.0, -rank);
+        if (rank == 0) {
+            ++zeros;
+        }
+    }
+
+    double estimate = 0.7213 / (1.0 + 1.079 / m) * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+
+    size_t distinct = static_cast<size_t>(estimate + 0.5);
+    return std::max<size_t>(1, std::min(distinct, nonNull));
+}
+
+/**
+ * @brief Estimates the fraction of the histogram values that are smaller than `value`.
+ * @param value The value.
+ * @return A fraction in [0, 1].
+ */
+double ColumnStatistics::fractionBelow(double value) const {
+    size_t total = 0;
+    for (size_t count : bucketCounts) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0.5;
+    }
+
+    double below = 0.0;
+    for (size_t i = 0; i < bucketBounds.size(); ++i) {
+        double lower = i == 0 ? minNumber : bucketBounds[i - 1];
+        double upper = bucketBounds[i];
+
+        if (value > upper) {
+            below += static_cast<double>(bucketCounts[i]);
+        }
+        else {
+            if (value > lower && upper > lower) {
+                below += bucketCounts[i] * (value - lower) / (upper - lower);
+            }
+            break;
+        }
+    }
+    return below / static_cast<double>(total);
+}
+
+/**
+ * @brief Estimates the fraction of rows satisfying `column op literal`.
+ * @param op The comparison.
+ * @param literal The literal, in display form.
+ * @return A fraction in [0, 1].
+ */
+double ColumnStatistics::estimateSelectivity(ComparisonOperator op, const std::string& literal) const {
+    if (rowCount == 0 || excludes(op, literal)) {
+        return 0.0;
+    }
+
+    double nonNull = static_cast<double>(rowCount - nullCount) / static_cast<double>(rowCount);
+    double equal = nonNull / static_cast<double>(std::max<size_t>(1, estimateDistinctCount()));
+
+    double value;
+    bool useHistogram = !bucketBounds.empty() && parseNumber(literal, value);
+    double below = useHistogram ? fractionBelow(value) : 1.0 / 3.0;
+    double above = useHistogram ? 1.0 - below : 1.0 / 3.0;
+
+    double result;
+    switch (op) {
+    case ComparisonOperator::EQUAL:            result = equal; break;
+    case ComparisonOperator::NOT_EQUAL:        result = nonNull - equal; break;
+    case ComparisonOperator::LESS:             result = nonNull * below; break;
+    case ComparisonOperator::LESS_OR_EQUAL:    result = nonNull * below + equal; break;
+    case ComparisonOperator::GREATER:          result = nonNull * above; break;
+    default:                                   result = nonNull * above + equal; break;
+    }
+    return std::min(1.0, std::max(0.0, result));
+}
+
+/**
+ * @brief Checks whether `column op literal` provably matches no row.
+ *
+ * Only the bounds are used, which are always a superset of the present values.
+ * NaN cells lie outside the bounds but only satisfy `!=`, so `!=` is not
+ * pruned while the column may hold one. A NaN literal only satisfies `!=`.
+ *
+ * @param op The comparison.
+ * @param literal The literal, in display form.
+ * @return `true` if no row can match.
+ */
+bool ColumnStatistics::excludes(ComparisonOperator op, const std::string& literal) const {
+    if (rowCount == nullCount) {
+        return true;
+    }
+    if (!bounded) {
+        return false;
+    }
+
+    int belowMin;
+    int aboveMax;
+    bool single;
+    if (type == ColumnType::STRING) {
+        belowMin = literal.compare(minText);
+        aboveMax = literal.compare(maxText);
+        single = minText == maxText;
+    }
+    else {
+        double value;
+        if (!parseNumber(literal, value)) {
+            return false;
+        }
+        if (std::isnan(value)) {
+            return op != ComparisonOperator::NOT_EQUAL;
+        }
+        belowMin = value < minNumber ? -1 : (value > minNumber ? 1 : 0);
+        aboveMax = value < maxNumber ? -1 : (value > maxNumber ? 1 : 0);
+        single = minNumber == maxNumber;
+    }
+
+    switch (op) {
+    case ComparisonOperator::EQUAL:            return belowMin < 0 || aboveMax > 0;
+    case ComparisonOperator::NOT_EQUAL:        return nanCount == 0 && single && belowMin == 0;
+    case ComparisonOperator::LESS:             return belowMin <= 0;
+    case ComparisonOperator::LESS_OR_EQUAL:    return belowMin < 0;
+    case ComparisonOperator::GREATER:          return aboveMax >= 0;
+    default:                                   return aboveMax > 0;
+    }
+}
+
+/**
+ * @brief Formats the statistics for `describe`.
+ * @return For example `rows=25 nulls=0 distinct~25 min=0 max=24 histogram=[1 3 ... 24]`,
+ * with ` nans=<count>` after the NULL count if NaN cells were added.
+ */
+std::string ColumnStatistics::toString() const {
+    std::string result = "rows=" + std::to_string(rowCount)
+        + " nulls=" + std::to_string(nullCount)
+        + (nanCount > 0 ? " nans=" + std::to_string(nanCount) : std::string())
+        + " distinct~" + std::to_string(estimateDistinctCount());
+
+    if (bounded) {
+        result += type == ColumnType::STRING
+            ? " min=" + minText + " max=" + maxText
+            : " min=" + formatNumber(minNumber, type) + " max=" + formatNumber(maxNumber, type);
+    }
+
+    if (!bucketBounds.empty()) {
+        result += " histogram=[";
+        for (size_t i = 0; i < bucketBounds.size(); ++i) {
+            result += (i == 0 ? "" : " ") + formatNumber(bucketBounds[i], type);
+        }
+        result += "]";
+    }
+    return result;
+}
@@ -15,6 +15,7 @@
 #include "OutputFileWritter.hpp"
 #include "InputConsoleReader.hpp"
 #include "CommandContext.hpp"
+#include "LockSet.hpp"
 
 /**
  * @class Command
@@ -33,6 +34,48 @@ public:
      */
     virtual void execute(const std::vector<std::string>& params) = 0;
 
+    /**
+     * @brief Declares the locks the command needs while it executes with the given parameters.
+     *
+     * The `Engine` acquires them before calling `execute` (see `LockManager`).
+     * The default takes the catalog exclusively, which is always safe; read-only
+     * commands and commands that modify a single table override it so that they
+     * can run in parallel with commands on other tables.
+     *
+     * @param params The same parameters `execute` will receive.
+     * @return The locks to hold during `execute`.
+     */
+    virtual LockSet requiredLocks(const std::vector<std::string>& /*params*/) const {
+        return LockSet::catalog(LockMode::EXCLUSIVE);
+    }
+
+    /**
+     * @brief Tells whether the command works on the private tables of an open transaction.
+     *
+     * Inside a transaction (see `CommandContext::transaction`) the `Engine`
+     * runs such commands on the transaction's workspace instead of the live
+     * catalog. Commands that control the transaction itself override it to
+     * return `false`, so they keep working on the live catalog.
+     *
+     * @return `true` by default.
+     */
+    virtual bool runsInsideTransaction() const {
+        return true;
+    }
+
+    /**
+     * @brief Tells whether the command reports an `ExecutionProfile` of its own execution.
+     *
+     * For such commands the `Engine` starts the profile before it waits for
+     * the locks and takes the snapshot, and passes it on through
+     * `CommandContext::profile`, so the report also covers those phases.
+     *
+     * @return `false` by default; `explain` returns `true`.
+     */
+    virtual bool profilesExecution() const {
+        return false;
+    }
+
     /**
      * @brief Virtual destructor for safe cleanup.
      */
@@ -5,6 +5,11 @@
 #include "InputFileReader.hpp"
 #include "OutputFileWritter.hpp"
 #include "Catalog.hpp"
+#include "TaskScheduler.hpp"
+#include "MetricsRegistry.hpp"
+#include "StartupOptions.hpp"
+#include "Transaction.hpp"
+#include "ExecutionProfile.hpp"
 
 
 /**
@@ -51,6 +56,47 @@ struct CommandContext {
      */
     InputFileReader& inputFileReader;
 
+    /**
+     * @brief Shared work-stealing thread pool owned by the `Engine`.
+     *
+     * Commands use it for fork/join work and parallel loops over row ranges.
+     */
+    TaskScheduler& taskScheduler;
+
+    /**
+     * @brief Always-on metrics owned by the `Engine`, e.g. command latencies and error counts.
+     */
+    MetricsRegistry& metrics;
+
+    /**
+     * @brief Options the program was started with, e.g. the memory budget of `sort`.
+     */
+    const StartupOptions& options;
+
+    /**
+     * @brief The transaction opened by `begin`, or `nullptr` outside of a transaction.
+     *
+     * Every session has its own. It is owned by the context; `commit` and
+     * `rollback` delete it, and the session deletes a transaction that is still open when it ends.
+     */
+    Transaction* transaction;
+
+    /**
+     * @brief The profile the `Engine` started for the running command, or `nullptr`.
+     *
+     * Only set while a command that returns `true` from `Command::profilesExecution` runs.
+     * The profile belongs to the `Engine`.
+     */
+    ExecutionProfile* profile;
+
+    /**
+     * @brief The number of the server session the context belongs to, or 0 for the console session.
+     *
+     * Written with every captured command, so a replay runs the commands of
+     * each session on a context of its own (see `Engine::replay`).
+     */
+    int sessionNumber;
+
     /**
      * @brief Constructs a new CommandContext.
      *
@@ -59,20 +105,32 @@ struct CommandContext {
      * @param inputConsoleReader Reference to console reader.
      * @param outputFileWritter Reference to file writer.
      * @param inputFileReader Reference to file reader.
+     * @param taskScheduler Reference to the shared task scheduler.
+     * @param metrics Reference to the metrics registry of the engine.
+     * @param options Reference to the startup options owned by the engine.
      */
     CommandContext(
         Catalog& loadedCatalogRef,
         OutputConsoleWritter& outputConsoleWritter,
         InputConsoleReader& inputConsoleReader,
         OutputFileWritter& outputFileWritter,
-        InputFileReader& inputFileReader
+        InputFileReader& inputFileReader,
+        TaskScheduler& taskScheduler,
+        MetricsRegistry& metrics,
+        const StartupOptions& options
     )
         : loadedCatalog(loadedCatalogRef),
         loadedCatalogExists(false),
         outputConsoleWritter(outputConsoleWritter),
         inputConsoleReader(inputConsoleReader),
         outputFileWritter(outputFileWritter),
-        inputFileReader(inputFileReader)
+        inputFileReader(inputFileReader),
+        taskScheduler(taskScheduler),
+        metrics(metrics),
+        options(options),
+        transaction(nullptr),
+        profile(nullptr),
+        sessionNumber(0)
     {}
 
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <string>
+#include "Expression.hpp"
 
 /**
  * @class CommandParser
@@ -9,7 +10,8 @@
  * `CommandParser` provides methods to break down a single input string
  * (representing a command and its arguments) into a collection of individual
  * tokens (words or phrases). It supports parsing by a custom delimiter
- * and a specialized parsing for raw commands that handles quoted strings.
+ * and a specialized parsing for raw commands that handles quoted strings,
+ * as well as the WHERE expressions accepted by the filtering commands.
  */
 class CommandParser {
 public:
@@ -40,4 +42,42 @@ public:
     * @return A `std::vector<std::string>` containing the parsed tokens, with quotes removed.
     */
 	static std::vector<std::string> parseRawCommand(const std::string& line);
+
+    /**
+    * @brief Parses a WHERE expression into an expression tree.
+    *
+    * Grammar (keywords are case-insensitive):
+    * - `expr      := and { OR and }`
+    * - `and       := unary { AND unary }`
+    * - `unary     := NOT unary | '(' expr ')' | predicate`
+    * - `predicate := $n op literal | $n [NOT] IN '(' literal { ',' literal } ')' | $n IS [NOT] NULL`
+    * - `op        := = | != | <> | < | <= | > | >=`
+    *
+    * `$n` refers to the column at 0-indexed position `n`. Literals are numbers,
+    * bare words or text in single quotes (double quotes are already consumed by
+    * `parseRawCommand`), e.g. `$0 >= 10 AND ($2 = 'New York' OR $2 IS NULL)`.
+    *
+    * @param text The expression text.
+    * @return The root of the unbound expression tree.
+    * @throws std::runtime_error If the text is not a valid expression.
+    * @warning The caller is responsible for deleting the returned pointer.
+    */
+	static Expression* parseExpression(const std::string& text);
+
+    /**
+    * @brief Parses the condition slot of a filtering command.
+    *
+    * Commands such as `select`, `count`, `update`, `delete` and `aggregate` take a
+    * `<column-n> <value>` pair. If the first token is the keyword `where`, the second
+    * token is parsed with `parseExpression`. Otherwise the pair is turned into the
+    * equivalent expression `$n = value`, or `$n IS NULL` for an empty value, which
+    * keeps the classic syntax working.
+    *
+    * @param columnOrKeyword The column index, or `where`.
+    * @param valueOrExpression The value to match, or the expression text.
+    * @return The root of the unbound expression tree.
+    * @throws std::runtime_error If the column index or the expression is invalid.
+    * @warning The caller is responsible for deleting the returned pointer.
+    */
+	static Expression* parseCondition(const std::string& columnOrKeyword, const std::string& valueOrExpression);
 };
\ No newline at end of file
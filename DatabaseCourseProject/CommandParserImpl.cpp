@@ -1,4 +1,11 @@
 #include "CommandParser.hpp"
+#include "ComparisonExpression.hpp"
+#include "InExpression.hpp"
+#include "IsNullExpression.hpp"
+#include "LogicalExpression.hpp"
+#include "NotExpression.hpp"
+#include <cctype>
+#include <stdexcept>
 
 /**
  * @brief Parses a string into a vector of tokens using a specified delimiter.
@@ -72,3 +79,293 @@ std::vector<std::string> CommandParser::parseRawCommand(const std::string& line)
     return tokens;
 
 }
+
+namespace {
+    /**
+     * @brief A lexical token of a WHERE expression.
+     */
+    struct ExpressionToken {
+        enum Kind { COLUMN, WORD, QUOTED, OPERATOR, LEFT_PAREN, RIGHT_PAREN, COMMA, END };
+
+        Kind kind;
+        std::string text;
+    };
+
+    /**
+     * @brief Splits the expression text into tokens.
+     * @param text The expression text.
+     * @return The tokens, terminated by an `END` token.
+     * @throws std::runtime_error On an unterminated string or a malformed column reference.
+     */
+    std::vector<ExpressionToken> tokenizeExpression(const std::string& text) {
+        std::vector<ExpressionToken> tokens;
+        const std::string delimiters = " \t()=,!<>'";
+        size_t i = 0;
+
+        while (i < text.size()) {
+            char ch = text[i];
+
+            if (ch == ' ' || ch == '\t') {
+                ++i;
+            }
+            else if (ch == '(') {
+                tokens.push_back({ ExpressionToken::LEFT_PAREN, "(" });
+                ++i;
+            }
+            else if (ch == ')') {
+                tokens.push_back({ ExpressionToken::RIGHT_PAREN, ")" });
+                ++i;
+            }
+            else if (ch == ',') {
+                tokens.push_back({ ExpressionToken::COMMA, "," });
+                ++i;
+            }
+            else if (ch == '=' || ch == '!' || ch == '<' || ch == '>') {
+                std::string op(1, ch);
+                if (i + 1 < text.size() && (text[i + 1] == '=' || (ch == '<' && text[i + 1] == '>'))) {
+                    op += text[i + 1];
+                }
+                if (op == "!") {
+                    throw std::runtime_error("Invalid expression: '!' must be followed by '='. ");
+                }
+                tokens.push_back({ ExpressionToken::OPERATOR, op });
+                i += op.size();
+            }
+            else if (ch == '\'') {
+                size_t close = text.find('\'', i + 1);
+                if (close == std::string::npos) {
+                    throw std::runtime_error("Invalid expression: unterminated string literal. ");
+                }
+                tokens.push_back({ ExpressionToken::QUOTED, text.substr(i + 1, close - i - 1) });
+                i = close + 1;
+            }
+            else {
+                size_t start = i;
+                while (i < text.size() && delimiters.find(text[i]) == std::string::npos) {
+                    ++i;
+                }
+                std::string word = text.substr(start, i - start);
+
+                if (word[0] == '$') {
+                    if (word.size() == 1 || word.find_first_not_of("0123456789", 1) != std::string::npos) {
+                        throw std::runtime_error("Invalid expression: bad column reference '" + word + "'. ");
+                    }
+                    tokens.push_back({ ExpressionToken::COLUMN, word.substr(1) });
+                }
+                else {
+                    tokens.push_back({ ExpressionToken::WORD, word });
+                }
+            }
+        }
+
+        tokens.push_back({ ExpressionToken::END, "" });
+        return tokens;
+    }
+
+    /**
+     * @brief Recursive descent parser over the tokens of a WHERE expression.
+     *
+     * Every method returns a newly allocated subtree. When a later part of the
+     * input turns out to be invalid, the subtrees built so far are deleted
+     * before the exception propagates.
+     */
+    class ExpressionParser {
+    private:
+        std::vector<ExpressionToken> tokens;
+        size_t position;
+
+        const ExpressionToken& peek() const {
+            return tokens[position];
+        }
+
+        bool isKeyword(const ExpressionToken& token, const std::string& keyword) const {
+            if (token.kind != ExpressionToken::WORD || token.text.size() != keyword.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < keyword.size(); ++i) {
+                if (std::toupper(static_cast<unsigned char>(token.text[i])) != keyword[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool acceptKeyword(const std::string& keyword) {
+            if (isKeyword(peek(), keyword)) {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        void expect(ExpressionToken::Kind kind, const std::string& description) {
+            if (peek().kind != kind) {
+                throw std::runtime_error("Invalid expression: expected " + description + " near '" + peek().text + "'. ");
+            }
+            ++position;
+        }
+
+        std::string parseLiteral() {
+            const ExpressionToken& token = peek();
+            bool reserved = isKeyword(token, "AND") || isKeyword(token, "OR") || isKeyword(token, "NOT")
+                || isKeyword(token, "IN") || isKeyword(token, "IS") || isKeyword(token, "NULL");
+
+            if (token.kind == ExpressionToken::QUOTED || (token.kind == ExpressionToken::WORD && !reserved)) {
+                ++position;
+                return token.text;
+            }
+            throw std::runtime_error("Invalid expression: expected a value near '" + token.text + "'. ");
+        }
+
+        Expression* parsePredicate() {
+            if (peek().kind != ExpressionToken::COLUMN) {
+                throw std::runtime_error("Invalid expression: expected a column ($n) near '" + peek().text + "'. ");
+            }
+            int column = std::stoi(peek().text);
+            ++position;
+
+            if (acceptKeyword("IS")) {
+                bool negated = acceptKeyword("NOT");
+                if (!acceptKeyword("NULL")) {
+                    throw std::runtime_error("Invalid expression: expected NULL after IS. ");
+                }
+                return new IsNullExpression(column, negated);
+            }
+
+            bool negatedIn = acceptKeyword("NOT");
+            if (acceptKeyword("IN")) {
+                expect(ExpressionToken::LEFT_PAREN, "'('");
+                std::vector<std::string> literals;
+                literals.push_back(parseLiteral());
+                while (peek().kind == ExpressionToken::COMMA) {
+                    ++position;
+                    literals.push_back(parseLiteral());
+                }
+                expect(ExpressionToken::RIGHT_PAREN, "')'");
+
+                Expression* in = new InExpression(column, literals);
+                return negatedIn ? new NotExpression(in) : in;
+            }
+            if (negatedIn) {
+                throw std::runtime_error("Invalid expression: expected IN after NOT. ");
+            }
+
+            if (peek().kind != ExpressionToken::OPERATOR) {
+                throw std::runtime_error("Invalid expression: expected an operator near '" + peek().text + "'. ");
+            }
+            std::string symbol = peek().text;
+            ++position;
+
+            ComparisonOperator op;
+            if (symbol == "=") op = ComparisonOperator::EQUAL;
+            else if (symbol == "!=" || symbol == "<>") op = ComparisonOperator::NOT_EQUAL;
+            else if (symbol == "<") op = ComparisonOperator::LESS;
+            else if (symbol == "<=") op = ComparisonOperator::LESS_OR_EQUAL;
+            else if (symbol == ">") op = ComparisonOperator::GREATER;
+            else if (symbol == ">=") op = ComparisonOperator::GREATER_OR_EQUAL;
+            else throw std::runtime_error("Invalid expression: unknown operator '" + symbol + "'. ");
+
+            return new ComparisonExpression(column, op, parseLiteral());
+        }
+
+        Expression* parseUnary() {
+            if (acceptKeyword("NOT")) {
+                return new NotExpression(parseUnary());
+            }
+            if (peek().kind == ExpressionToken::LEFT_PAREN) {
+                ++position;
+                Expression* inner = parseOr();
+                try {
+                    expect(ExpressionToken::RIGHT_PAREN, "')'");
+                }
+                catch (...) {
+                    delete inner;
+                    throw;
+                }
+                return inner;
+            }
+            return parsePredicate();
+        }
+
+        Expression* parseBinary(LogicalOperator op) {
+            const std::string keyword = op == LogicalOperator::AND ? "AND" : "OR";
+
+            Expression* left = op == LogicalOperator::AND ? parseUnary() : parseBinary(LogicalOperator::AND);
+            while (acceptKeyword(keyword)) {
+                Expression* right = nullptr;
+                try {
+                    right = op == LogicalOperator::AND ? parseUnary() : parseBinary(LogicalOperator::AND);
+                }
+                catch (...) {
+                    delete left;
+                    throw;
+                }
+                left = new LogicalExpression(op, left, right);
+            }
+            return left;
+        }
+
+        Expression* parseOr() {
+            return parseBinary(LogicalOperator::OR);
+        }
+
+    public:
+        explicit ExpressionParser(const std::string& text)
+            : tokens(tokenizeExpression(text)), position(0) {
+        }
+
+        Expression* parse() {
+            Expression* root = parseOr();
+            if (peek().kind != ExpressionToken::END) {
+                delete root;
+                throw std::runtime_error("Invalid expression: unexpected '" + peek().text + "'. ");
+            }
+            return root;
+        }
+    };
+}
+
+/**
+ * @brief Parses a WHERE expression into an expression tree.
+ *
+ * The text is tokenized first (column references, operators, parentheses,
+ * commas, quoted and bare literals) and then parsed by recursive descent with
+ * the precedence NOT > AND > OR.
+ *
+ * @param text The expression text.
+ * @return The root of the unbound expression tree.
+ * @throws std::runtime_error If the text is not a valid expression.
+ * @warning The caller is responsible for deleting the returned pointer.
+ */
+Expression* CommandParser::parseExpression(const std::string& text) {
+    ExpressionParser parser(text);
+    return parser.parse();
+}
+
+/**
+ * @brief Parses the condition slot of a filtering command.
+ *
+ * @param columnOrKeyword The column index, or `where`.
+ * @param valueOrExpression The value to match, or the expression text.
+ * @return The root of the unbound expression tree.
+ * @throws std::runtime_error If the column index or the expression is invalid.
+ * @warning The caller is responsible for deleting the returned pointer.
+ */
+Expression* CommandParser::parseCondition(const std::string& columnOrKeyword, const std::string& valueOrExpression) {
+    if (columnOrKeyword == "where") {
+        return parseExpression(valueOrExpression);
+    }
+
+    int column;
+    try {
+        column = std::stoi(columnOrKeyword);
+    }
+    catch (const std::exception&) {
+        throw std::runtime_error("Invalid column index: " + columnOrKeyword);
+    }
+
+    if (valueOrExpression.empty()) {
+        return new IsNullExpression(column, false);
+    }
+    return new ComparisonExpression(column, ComparisonOperator::EQUAL, valueOrExpression);
+}
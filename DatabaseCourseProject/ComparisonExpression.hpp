@@ -0,0 +1,83 @@
+#pragma once
+#include <string>
+#include "ColumnExpression.hpp"
+#include "ComparisonOperator.hpp"
+
+/**
+ * @class ComparisonExpression
+ * @brief Leaf comparing a column with a literal: `$n = v`, `$n != v`, `$n < v`, `$n <= v`, `$n > v`, `$n >= v`.
+ *
+ * Numeric columns compare numerically, String columns lexicographically.
+ * NULL cells never match.
+ */
+class ComparisonExpression : public ColumnExpression {
+private:
+    ComparisonOperator op;  ///< The comparison to apply.
+    std::string literal;    ///< The literal as written in the expression.
+    double numericLiteral;  ///< The literal converted for numeric columns during `bind()`.
+
+    /**
+     * @brief Runs the column scan with the functor matching `op`.
+     *
+     * @tparam T The native type of the column.
+     * @tparam L The type of the converted literal.
+     * @param cells The segments of the column.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param value The converted literal.
+     * @param result Receives one bit per row of the batch.
+     */
+    template <typename T, typename L>
+    void compareColumn(const ColumnSegments<T>& cells,
+        int begin, int end, const L& value, SelectionBitmap& result) const;
+
+public:
+    /**
+     * @brief Creates the comparison `$columnIndex op literal`.
+     * @param columnIndex The 0-indexed position of the compared column.
+     * @param op The comparison to apply.
+     * @param literal The value to compare with.
+     */
+    ComparisonExpression(int columnIndex, ComparisonOperator op, const std::string& literal);
+
+    /**
+     * @brief Resolves the column and converts the literal to its type.
+     * @param table The table the expression will be evaluated on.
+     * @throws std::runtime_error If the column index is invalid or the literal is not a number for a numeric column.
+     */
+    void bind(const Table& table) override;
+
+    /**
+     * @brief Compares the cells of [begin, end) with the literal.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch.
+     */
+    void evaluate(int begin, int end, SelectionBitmap& result) const override;
+
+    /**
+     * @brief Returns the comparison as text, e.g. `$1 >= 10`.
+     * @return The expression as text.
+     */
+    std::string toString() const override;
+
+    /**
+     * @brief Estimates the selectivity from the histogram or the distinct count of the column.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity() const override;
+
+    /**
+     * @brief Checks the literal against the bounds of the column.
+     * @return `true` if no row can match.
+     */
+    bool isProvablyEmpty() const override;
+
+    /**
+     * @brief Checks the literal against the zone maps of a numeric column over [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `true` if no row of the batch can match; always `false` for String columns.
+     */
+    bool isProvablyEmptyIn(int begin, int end) const override;
+};
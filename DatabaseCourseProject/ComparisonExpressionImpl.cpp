@@ -0,0 +1,158 @@
+#include "ComparisonExpression.hpp"
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
+#include "StringColumn.hpp"
+#include <functional>
+
+/**
+ * @brief Creates the comparison `$columnIndex op literal`.
+ * @param columnIndex The 0-indexed position of the compared column.
+ * @param op The comparison to apply.
+ * @param literal The value to compare with.
+ */
+ComparisonExpression::ComparisonExpression(int columnIndex, ComparisonOperator op, const std::string& literal)
+    : ColumnExpression(columnIndex), op(op), literal(literal), numericLiteral(0) {
+}
+
+/**
+ * @brief Resolves the column and converts the literal to its type.
+ * @param table The table the expression will be evaluated on.
+ * @throws std::runtime_error If the column index is invalid or the literal is not a number for a numeric column.
+ */
+void ComparisonExpression::bind(const Table& table) {
+    ColumnExpression::bind(table);
+    if (column->getType() != ColumnType::STRING) {
+        numericLiteral = parseNumericLiteral(literal);
+    }
+}
+
+/**
+ * @brief Runs the column scan with the functor matching `op`.
+ *
+ * The operator is dispatched once per batch; inside the scan loop the
+ * comparison is a transparent standard functor that the compiler inlines.
+ * Integer cells are compared with the literal as `double`, so `$0 < 2.5`
+ * works on Integer columns as expected.
+ *
+ * @param cells The segments of the column.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param value The converted literal.
+ * @param result Receives one bit per row of the batch.
+ */
+template <typename T, typename L>
+void ComparisonExpression::compareColumn(const ColumnSegments<T>& cells,
+    int begin, int end, const L& value, SelectionBitmap& result) const {
+
+    switch (op) {
+    case ComparisonOperator::EQUAL:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::equal_to<>()(cell, value); }, result);
+        break;
+    case ComparisonOperator::NOT_EQUAL:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::not_equal_to<>()(cell, value); }, result);
+        break;
+    case ComparisonOperator::LESS:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::less<>()(cell, value); }, result);
+        break;
+    case ComparisonOperator::LESS_OR_EQUAL:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::less_equal<>()(cell, value); }, result);
+        break;
+    case ComparisonOperator::GREATER:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::greater<>()(cell, value); }, result);
+        break;
+    case ComparisonOperator::GREATER_OR_EQUAL:
+        scanColumn(cells, begin, end, [&value](const T& cell) { return std::greater_equal<>()(cell, value); }, result);
+        break;
+    }
+}
+
+/**
+ * @brief Compares the cells of [begin, end) with the literal.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch.
+ */
+void ComparisonExpression::evaluate(int begin, int end, SelectionBitmap& result) const {
+    switch (column->getType()) {
+    case ColumnType::INTEGER: {
+        const IntegerColumn* integers = static_cast<const IntegerColumn*>(column);
+        compareColumn(integers->getSegments(), begin, end, numericLiteral, result);
+        break;
+    }
+    case ColumnType::DOUBLE: {
+        const DoubleColumn* doubles = static_cast<const DoubleColumn*>(column);
+        compareColumn(doubles->getSegments(), begin, end, numericLiteral, result);
+        break;
+    }
+    case ColumnType::STRING: {
+        const StringColumn* strings = static_cast<const StringColumn*>(column);
+        compareColumn(strings->getSegments(), begin, end, literal, result);
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Returns the comparison as text, e.g. `$1 >= 10`.
+ * @return The expression as text.
+ */
+std::string ComparisonExpression::toString() const {
+    static const char* symbols[] = { "=", "!=", "<", "<=", ">", ">=" };
+    return "$" + std::to_string(columnIndex) + " " + symbols[static_cast<int>(op)] + " '" + literal + "'";
+}
+
+/**
+ * @brief Estimates the selectivity from the histogram or the distinct count of the column.
+ * @return A fraction in [0, 1].
+ */
+double ComparisonExpression::estimateSelectivity() const {
+    if (column == nullptr) {
+        return 1.0;
+    }
+    return column->getStatistics().estimateSelectivity(op, literal);
+}
+
+/**
+ * @brief Checks the literal against the bounds of the column.
+ * @return `true` if no row can match.
+ */
+bool ComparisonExpression::isProvablyEmpty() const {
+    return column != nullptr && column->getStatistics().excludes(op, literal);
+}
+
+/**
+ * @brief Checks the literal against the zone maps of a numeric column over [begin, end).
+ *
+ * A batch whose cells are all NULL never matches. Otherwise the literal is
+ * compared with the merged bounds of the batch, e.g. `$0 = 5` skips a batch
+ * whose values lie in [100, 200]. `!=` only skips batches without values,
+ * since a NaN cell of a Double column is not covered by the bounds.
+ *
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @return `true` if no row of the batch can match.
+ */
+bool ComparisonExpression::isProvablyEmptyIn(int begin, int end) const {
+    ColumnSegments<double>::Zone zone;
+    if (!summarizeZones(begin, end, zone)) {
+        return false;
+    }
+    if (zone.allNull()) {
+        return true;
+    }
+
+    switch (op) {
+    case ComparisonOperator::EQUAL:
+        return numericLiteral < zone.min || zone.max < numericLiteral;
+    case ComparisonOperator::LESS:
+        return zone.min >= numericLiteral;
+    case ComparisonOperator::LESS_OR_EQUAL:
+        return zone.min > numericLiteral;
+    case ComparisonOperator::GREATER:
+        return zone.max <= numericLiteral;
+    case ComparisonOperator::GREATER_OR_EQUAL:
+        return zone.max < numericLiteral;
+    default:
+        return false;
+    }
+}
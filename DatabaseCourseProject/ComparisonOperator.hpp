@@ -0,0 +1,37 @@
+#pragma once
+
+/**
+ * @enum ComparisonOperator
+ * @brief Enumerates the binary comparisons supported in WHERE expressions.
+ */
+enum class ComparisonOperator {
+    /**
+     * @brief `=`: the cell equals the literal.
+     */
+    EQUAL,
+
+    /**
+     * @brief `!=` (or `<>`): the cell differs from the literal.
+     */
+    NOT_EQUAL,
+
+    /**
+     * @brief `<`: the cell orders before the literal.
+     */
+    LESS,
+
+    /**
+     * @brief `<=`: the cell orders before or equal to the literal.
+     */
+    LESS_OR_EQUAL,
+
+    /**
+     * @brief `>`: the cell orders after the literal.
+     */
+    GREATER,
+
+    /**
+     * @brief `>=`: the cell orders after or equal to the literal.
+     */
+    GREATER_OR_EQUAL
+};
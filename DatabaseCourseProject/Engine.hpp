@@ -3,6 +3,12 @@
 #include "Command.hpp"
 #include "OutputConsoleWritter.hpp"
 #include "InputConsoleReader.hpp"
+#include "StartupOptions.hpp"
+#include "TaskScheduler.hpp"
+#include "MetricsRegistry.hpp"
+#include "WorkloadRecorder.hpp"
+#include "Socket.hpp"
+#include "LockManager.hpp"
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -22,26 +28,30 @@ public:
     /**
      * @brief Constructs the Engine, initializes shared resources, and registers supported commands.
      *
-     * This constructor sets up the `CommandContext` which contains the `Catalog`
-     * and all necessary I/O handlers. It then uses `FileCommandFactory` and
-     * `CatalogCommandFactory` to create and register all recognized commands.
+     * This constructor creates the shared `TaskScheduler`, sets up the `CommandContext`
+     * which contains the `Catalog`, the scheduler and all necessary I/O handlers.
+     * It then uses `FileCommandFactory` and `CatalogCommandFactory` to create and
+     * register all recognized commands.
      *
      * @param outputConsoleWritter A reference to the console output handler.
      * @param inputConsoleReader A reference to the console input handler.
      * @param outputFileWritter A reference to the file output handler for saving data.
      * @param inputFileReader A reference to the file input handler for loading data.
+     * @param options Startup options, e.g. the number of worker threads of the scheduler.
      */
     Engine(
         OutputConsoleWritter& outputConsoleWritter,
         InputConsoleReader& inputConsoleReader,
         OutputFileWritter& outputFileWritter,
-        InputFileReader& inputFileReader
+        InputFileReader& inputFileReader,
+        const StartupOptions& options = StartupOptions()
     );
 
     /**
      * @brief Copy constructor for the Engine class.
      *
-     * Performs a deep copy of the `other` Engine object. 
+     * Performs a deep copy of the `other` Engine object. The copy gets its own
+     * task scheduler with the same number of worker threads.
      *
      * @param other The Engine object to be copied.
      */
@@ -65,8 +75,8 @@ public:
      * @brief Destructor.
      *
      * Calls `clearMemory()` to clean up dynamically allocated `Command` objects
-     * stored in the `commands` map, preventing memory leaks when an Engine object
-     * is destroyed.
+     * stored in the `commands` map, then shuts down the task scheduler and
+     * deletes the metrics registry, preventing memory leaks when an Engine object is destroyed.
      */
     ~Engine();
 
@@ -104,6 +114,49 @@ public:
     */
     void run();
 
+    /**
+    * @brief Re-executes a captured workload instead of running the interactive loop.
+    *
+    * The commands of the workload file run back to back, or with their original
+    * pauses if `paced` is set. Their console output is discarded and pagination
+    * is disabled, so no input is needed. Afterwards the per-command latency
+    * distributions of the replay are printed (see `ReplayReport`) and the exit
+    * reports are written like after an interactive session. The commands of
+    * every captured server session run on a context of their own, so their
+    * transactions stay apart.
+    *
+    * @param filepath The workload file written by a `--capture-file` session.
+    * @param paced Whether the original pacing is kept.
+    */
+    void replay(const std::string& filepath, bool paced);
+
+    /**
+    * @brief Executes a script of commands in batch mode instead of running the interactive loop.
+    *
+    * The commands run back to back without a banner, prompts or pagination;
+    * result rows are printed as tab-separated records (see `RecordFormat`) and
+    * every failed command is reported on the standard error stream with its line number.
+    *
+    * @param filepath The script file, or `-` to read the commands from standard input.
+    * @param continueOnError Whether the script continues after a failed command instead of stopping.
+    * @return `true` if the script could be read and every command succeeded.
+    */
+    bool runScript(const std::string& filepath, bool continueOnError);
+
+    /**
+    * @brief Serves the loaded catalog to many concurrent client sessions instead of running the interactive loop.
+    *
+    * Listens on `127.0.0.1:port`. Every client connection becomes a session
+    * with its own socket reader and writer and its own commands, all bound to
+    * the one in-memory catalog of this engine. Commands of different sessions
+    * run in parallel as far as their table locks allow; reads run on snapshots
+    * and never wait for writers. The server runs until a client
+    * sends `shutdown`; the exit reports are then written like after an interactive session.
+    *
+    * @param port The TCP port to listen on.
+    */
+    void serve(int port);
+
 private:
     /**
      * @brief Frees all dynamically allocated `Command` objects and clears the map.
@@ -123,7 +176,11 @@ private:
      * `Command` object with the given arguments. If the command is not found,
      * an "Unknown command" message is printed to the console.
      * All exceptions thrown during command execution are caught and their
-     * messages are displayed to the user.
+     * messages are displayed to the user. The execution time of every command
+     * is recorded in the `MetricsRegistry`, failures are counted as errors.
+     * The locks declared by the command (see `Command::requiredLocks`) are held while it runs;
+     * read-only commands only hold them while their snapshot is taken (see `executeOnSnapshot`).
+     * Inside a transaction, commands run on its private tables (see `executeInTransaction`).
      *
      * @param args A constant reference to a vector of strings representing
      * the parsed command name and its parameters. The first element
@@ -131,12 +188,102 @@ private:
      */
     void dispatchCommand(const std::vector<std::string>& params);
 
+    /**
+     * @brief Dispatches a command to the commands of a particular context.
+     *
+     * Works like `dispatchCommand(params)`, which uses the engine's own
+     * `commands` and `context`; server sessions pass theirs instead.
+     *
+     * @param params The parsed command name and its parameters.
+     * @param commandMap The commands to look the command name up in.
+     * @param commandContext The context the commands are bound to; errors are printed to its writer.
+     */
+    void dispatchCommand(const std::vector<std::string>& params,
+        std::unordered_map<std::string, Command*>& commandMap,
+        CommandContext& commandContext);
+
+    /**
+     * @brief Executes a read-only command against a snapshot of the tables it reads.
+     *
+     * The tables named in `locks` are snapshotted while the locks are held
+     * (see `Table::snapshot`); the command then runs on a copy bound to a
+     * context whose catalog only contains the snapshots, without any lock.
+     * Writers of those tables therefore never wait for a long read, and the
+     * read sees the tables as they were when it started.
+     *
+     * @param command The command to execute. It is cloned for the snapshot context.
+     * @param params The command name and its parameters.
+     * @param locks The read-only locks declared by the command.
+     * @param commandContext The context the command is bound to.
+     */
+    void executeOnSnapshot(const Command& command, const std::vector<std::string>& params,
+        const LockSet& locks, CommandContext& commandContext);
+
+    /**
+     * @brief Executes a command on the private tables of the session's transaction.
+     *
+     * Tables the transaction has not used yet are snapshotted into it under
+     * shared locks; the command then runs without locks on a copy bound to the
+     * transaction's workspace (see `Transaction`). Tables the command locks
+     * exclusively are recorded as modified for `commit`.
+     *
+     * @param command The command to execute. It is cloned for the transaction context.
+     * @param params The command name and its parameters.
+     * @param locks The locks declared by the command.
+     * @param commandContext The context of the session; `commandContext.transaction` must be set.
+     * @throws std::runtime_error If the command needs the catalog exclusively, e.g. `open` or `import`.
+     */
+    void executeInTransaction(const Command& command, const std::vector<std::string>& params,
+        const LockSet& locks, CommandContext& commandContext);
+
+    /**
+     * @brief Runs one client session of the server until the client disconnects or leaves.
+     *
+     * @param client The client connection. Owned by `serve`, which deletes it after the session ended.
+     * @param sessionNumber The number of the session, used to name its thread in traces.
+     */
+    void runSession(Socket* client, int sessionNumber);
+
+    /**
+     * @brief Starts the session services requested by the startup options.
+     *
+     * Names the calling thread in traces, starts session tracing, opens the
+     * workload capture and opens the catalog given on the command line. Failures are reported to the console and do not stop the session.
+     */
+    void beginSession();
+
+    /**
+     * @brief Writes the exit reports requested by the startup options.
+     *
+     * Ends the workload capture and writes the metrics and the session trace.
+     * Failures are reported to the console.
+     */
+    void endSession();
+
+    /// Options the program was started with. Exposed to commands through the context.
+    StartupOptions options;
+
     /// Currently loaded catalog used by commands.
     Catalog loadedCatalog; 
 
+    /// Work-stealing thread pool shared by all commands. Owned by the engine.
+    TaskScheduler* taskScheduler;
+
+    /// Always-on metrics of the executed commands. Owned by the engine.
+    MetricsRegistry* metrics;
+
+    /// Captures the dispatched commands while `options.captureFile` is set. Each engine has its own.
+    WorkloadRecorder recorder;
+
     /// Shared context passed to commands.
     CommandContext context;
 
+    /// Table and catalog locks taken around every dispatched command. Each engine has its own.
+    LockManager lockManager;
+
+    /// The listening socket while `serve` runs, `nullptr` otherwise. Shut down by the `shutdown` request of a session.
+    Socket* listener;
+
     /// Map of supported command names to their corresponding Command objects.
     std::unordered_map<std::string, Command*> commands;
 };
@@ -10,13 +10,65 @@
 #include "CatalogCommandFactory.hpp"
 #include "CommandParser.hpp"
 #include "SupportedCommands.hpp"
+#include "TraceSpan.hpp"
+#include "ReplayReport.hpp"
+#include "InputSocketReader.hpp"
+#include "OutputSocketWritter.hpp"
+#include "ScopedLocks.hpp"
+#include "ProfilePhase.hpp"
 #include <stdexcept> 
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <map>
+
+namespace {
+    /**
+     * @brief A client session of the server and the thread running it.
+     */
+    struct ServerSession {
+        Socket* client;             ///< The connection; closed by deleting it once the thread is joined.
+        std::thread thread;         ///< The thread running `Engine::runSession`.
+        std::atomic<bool> finished; ///< Set by the thread when the session has ended.
+    };
+
+    /**
+     * @brief Joins the sessions that have ended and closes their connections.
+     * @param sessions The sessions of the server; the ended ones are removed.
+     */
+    void joinFinishedSessions(std::vector<std::unique_ptr<ServerSession>>& sessions) {
+        std::vector<std::unique_ptr<ServerSession>> running;
+        for (std::unique_ptr<ServerSession>& session : sessions) {
+            if (session->finished) {
+                session->thread.join();
+                delete session->client;
+            }
+            else {
+                running.push_back(std::move(session));
+            }
+        }
+        sessions.swap(running);
+    }
+
+    /**
+     * @brief The context and command objects a replay uses for one captured server session.
+     */
+    struct ReplaySession {
+        std::unique_ptr<CommandContext> context;          ///< The context of the session; owns its transaction.
+        std::unordered_map<std::string, Command*> commands; ///< Command objects bound to `context`. Owned.
+    };
+}
 
 /**
  * @brief Constructs the `Engine` and initializes its core components.
  *
  * This constructor takes references to necessary I/O and file handling
  * utilities, along with the `Catalog` itself, to construct the `CommandContext`.
+ * The shared `TaskScheduler` is created first, sized by `options.workerThreadCount`,
+ * so that every command sees the same thread pool through the context. The
+ * `MetricsRegistry` is created and installed next, so that low-level code can
+ * report to it through `Instrumentation`.
  * It then populates the `commands` map using `FileCommandFactory`
  * and `CatalogCommandFactory` to create all supported `Command` objects.
  * Any errors during command creation (e.g., if a factory fails to produce a command)
@@ -27,14 +79,21 @@
  * @param inputConsoleReader A reference to the console input reader.
  * @param outputFileWritter A reference to the file output writer.
  * @param inputFileReader A reference to the file input reader.
+ * @param options Startup options used to configure the shared services.
  */
 Engine::Engine(OutputConsoleWritter& outputConsoleWritter,
     InputConsoleReader& inputConsoleReader,
     OutputFileWritter& outputFileWritter,
-    InputFileReader& inputFileReader)
-    : loadedCatalog(Catalog()),
-    context(loadedCatalog, outputConsoleWritter, inputConsoleReader, outputFileWritter, inputFileReader)
+    InputFileReader& inputFileReader,
+    const StartupOptions& options)
+    : options(options),
+    loadedCatalog(Catalog()),
+    taskScheduler(new TaskScheduler(options.workerThreadCount)),
+    metrics(new MetricsRegistry()),
+    context(loadedCatalog, outputConsoleWritter, inputConsoleReader, outputFileWritter, inputFileReader, *taskScheduler, *metrics, this->options),
+    listener(nullptr)
 {
+    metrics->install();
 
     for (const auto& name : SupportedCommands::returnSupportedFileCommands()) {
         try {
@@ -64,8 +123,10 @@ Engine::Engine(OutputConsoleWritter& outputConsoleWritter,
  * which handles spaces and quoted strings.
  * 3.  The parsed arguments are passed to `dispatchCommand` for execution.
  * 4.  The loop continues until the user explicitly enters the "exit" command.
- * Upon receiving "exit", a goodbye message is printed, and the loop breaks,
- * terminating the application.
+ * Upon receiving "exit", the exit reports are written (see `endSession`),
+ * a goodbye message is printed, and the loop breaks, terminating the application.
+ *
+ * Session tracing and the workload capture start before the first prompt (see `beginSession`).
  */
 void Engine::run() {
 
@@ -75,6 +136,8 @@ void Engine::run() {
     context.outputConsoleWritter.printLine("  Type 'exit' to quit the program.");
     context.outputConsoleWritter.printLine("===========================================\n");
 
+    beginSession();
+
     while (true) {
         context.outputConsoleWritter.print(">> ");
 
@@ -89,6 +152,7 @@ void Engine::run() {
         dispatchCommand(args);
 
         if (args[0] == "exit") { 
+            endSession();
             context.outputConsoleWritter.printLine("Goodbye!");
             break; 
         }
@@ -98,6 +162,399 @@ void Engine::run() {
     }
 }
 
+/**
+ * @brief Re-executes a captured workload and prints its latency report.
+ *
+ * The workload is loaded completely before the first command runs, so a
+ * malformed file is rejected without side effects. While replaying, the
+ * console reader is switched to non-interactive mode (the pager prints all
+ * rows without prompting) and the console writer is muted, so the measured
+ * latencies are not dominated by terminal output. Each command is timed
+ * around `dispatchCommand`; a command counts as failed if it raised the
+ * error counter of the metrics registry. Empty lines and `exit` are skipped.
+ *
+ * Commands of the console session (0) run on the engine's context. Every
+ * server session of a `--serve` capture gets a context and command objects of
+ * its own, created at its first command like in `runSession`, so `begin`,
+ * `commit` and `rollback` act on the transaction of the session that issued
+ * them. The sessions run on the calling thread in capture order; a
+ * transaction a session left open is rolled back at the end of the replay.
+ *
+ * With `paced` set, every command waits until its captured offset from the
+ * start of the replay has passed; commands that are already late run immediately.
+ *
+ * @param filepath The workload file written by a `--capture-file` session.
+ * @param paced Whether the original pacing is kept.
+ */
+void Engine::replay(const std::string& filepath, bool paced) {
+    std::vector<WorkloadEntry> entries;
+    try {
+        entries = context.inputFileReader.readWorkloadFromFile(filepath);
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        return;
+    }
+
+    beginSession();
+
+    ReplayReport report;
+    context.inputConsoleReader.setInteractive(false);
+    context.outputConsoleWritter.setSilent(true);
+
+    std::map<int, ReplaySession> sessions;
+    std::chrono::steady_clock::time_point replayStart = std::chrono::steady_clock::now();
+
+    for (const WorkloadEntry& entry : entries) {
+        std::vector<std::string> args = CommandParser::parseRawCommand(entry.commandLine);
+        if (args.empty() || args[0] == "exit") {
+            continue;
+        }
+
+        if (paced) {
+            std::this_thread::sleep_until(replayStart + std::chrono::microseconds(entry.offsetMicroseconds));
+        }
+
+        std::unordered_map<std::string, Command*>* commandMap = &commands;
+        CommandContext* commandContext = &context;
+        if (entry.sessionNumber != 0) {
+            ReplaySession& session = sessions[entry.sessionNumber];
+            if (!session.context) {
+                session.context.reset(new CommandContext(loadedCatalog, context.outputConsoleWritter,
+                    context.inputConsoleReader, context.outputFileWritter, context.inputFileReader,
+                    *taskScheduler, *metrics, options));
+                session.context->sessionNumber = entry.sessionNumber;
+                for (const auto& pair : commands) {
+                    session.commands[pair.first] = pair.second->clone(*session.context);
+                }
+            }
+            session.context->loadedCatalogExists = context.loadedCatalogExists;
+            commandMap = &session.commands;
+            commandContext = session.context.get();
+        }
+
+        uint64_t errorsBefore = metrics->getErrorCount();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        dispatchCommand(args, *commandMap, *commandContext);
+
+        std::chrono::microseconds elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        report.record(args[0], static_cast<uint64_t>(elapsed.count()), metrics->getErrorCount() != errorsBefore);
+    }
+
+    std::chrono::microseconds total = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - replayStart);
+    report.setTotalTime(static_cast<uint64_t>(total.count()));
+
+    for (auto& pair : sessions) {
+        delete pair.second.context->transaction;
+        for (auto& command : pair.second.commands) {
+            delete command.second;
+        }
+    }
+
+    context.outputConsoleWritter.setSilent(false);
+    context.inputConsoleReader.setInteractive(true);
+
+    for (const std::string& line : report.toLines(filepath, paced)) {
+        context.outputConsoleWritter.printLine(line);
+    }
+
+    endSession();
+}
+
+/**
+ * @brief Executes a script of commands in batch mode.
+ *
+ * A script file is read completely before the first command runs; with `-`
+ * the commands are read from standard input one line at a time, so a script
+ * can be streamed through a pipe. Empty lines and lines starting with `#` are
+ * skipped and `exit` ends the script early.
+ *
+ * While the script runs, the console reader is not interactive, so the pager
+ * prints all rows at once as records, and the console writer buffers its
+ * output instead of flushing every line. A command counts as failed if it
+ * raised the error counter of the metrics registry; its error message is
+ * printed by the command as usual and the script position is reported on the
+ * standard error stream. Unless `continueOnError` is set, the script stops there.
+ *
+ * @param filepath The script file, or `-` to read the commands from standard input.
+ * @param continueOnError Whether the script continues after a failed command.
+ * @return `true` if the script could be read and every command succeeded.
+ */
+bool Engine::runScript(const std::string& filepath, bool continueOnError) {
+    bool fromConsole = filepath == "-";
+    std::string scriptName = fromConsole ? "<stdin>" : filepath;
+
+    std::vector<std::string> lines;
+    if (!fromConsole) {
+        try {
+            lines = context.inputFileReader.readLinesFromFile(filepath);
+        }
+        catch (const std::exception& e) {
+            context.outputConsoleWritter.printError(e.what());
+            return false;
+        }
+    }
+
+    beginSession();
+
+    context.inputConsoleReader.setInteractive(false);
+    context.outputConsoleWritter.setBuffered(true);
+
+    bool succeeded = true;
+    size_t lineNumber = 0;
+    std::string line;
+
+    while (fromConsole ? context.inputConsoleReader.readNextLine(line) : lineNumber < lines.size()) {
+        if (!fromConsole) {
+            line = lines[lineNumber];
+        }
+        ++lineNumber;
+
+        size_t firstCharacter = line.find_first_not_of(" \t");
+        if (firstCharacter == std::string::npos || line[firstCharacter] == '#') {
+            continue;
+        }
+
+        std::vector<std::string> args = CommandParser::parseRawCommand(line);
+        if (args.empty()) {
+            continue;
+        }
+        if (args[0] == "exit") {
+            break;
+        }
+
+        uint64_t errorsBefore = metrics->getErrorCount();
+        dispatchCommand(args);
+
+        if (metrics->getErrorCount() != errorsBefore) {
+            succeeded = false;
+            context.outputConsoleWritter.printError(scriptName + ":" + std::to_string(lineNumber) + ": command failed: " + line);
+            if (!continueOnError) {
+                break;
+            }
+        }
+    }
+
+    context.outputConsoleWritter.setBuffered(false);
+    context.inputConsoleReader.setInteractive(true);
+
+    endSession();
+    return succeeded;
+}
+
+/**
+ * @brief Serves the loaded catalog to concurrent client sessions.
+ *
+ * The accept loop runs on the calling thread and starts one thread per
+ * client (see `runSession`). Sessions share the catalog, the task scheduler,
+ * the metrics and the file reader and writer of this engine; only their
+ * console reader and writer and their command objects are their own.
+ *
+ * Commands of different sessions run concurrently under the locks they
+ * declare (see `LockManager`): reads run on snapshots and hold their table
+ * locks only while the snapshot is taken, a writer of a table only waits for
+ * the other writers of that table, and commands that change the set of
+ * tables run alone. Reading the next command and sending the
+ * response happen outside the locks, so a slow client only delays its own session.
+ *
+ * Every accepted connection first joins the sessions that have ended and
+ * closes their connections, so a long-running server holds threads and
+ * sockets only for the sessions that are still open (plus those that ended
+ * since the last connection).
+ *
+ * When a session requests `shutdown`, the listener is shut down and the
+ * accept loop ends. The remaining client connections are then shut down as
+ * well, the session threads are joined and the exit reports are written.
+ *
+ * @param port The TCP port to listen on.
+ */
+void Engine::serve(int port) {
+    try {
+        listener = Socket::listenOnLocalhost(port);
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        return;
+    }
+
+    beginSession();
+
+    context.outputConsoleWritter.printLine("Serving on 127.0.0.1:" + std::to_string(port)
+        + (context.loadedCatalogExists ? " with catalog " + loadedCatalog.getPath() : " without a catalog")
+        + ". Send 'shutdown' from a client to stop the server.");
+
+    std::vector<std::unique_ptr<ServerSession>> sessions;
+    int sessionCount = 0;
+
+    while (Socket* client = listener->accept()) {
+        joinFinishedSessions(sessions);
+
+        std::unique_ptr<ServerSession> session(new ServerSession());
+        session->client = client;
+        session->finished = false;
+        ServerSession* started = session.get();
+        int sessionNumber = ++sessionCount;
+        started->thread = std::thread([this, started, sessionNumber]() {
+            runSession(started->client, sessionNumber);
+            started->finished = true;
+        });
+        sessions.push_back(std::move(session));
+    }
+
+    for (std::unique_ptr<ServerSession>& session : sessions) {
+        session->client->shutdown();
+    }
+    for (std::unique_ptr<ServerSession>& session : sessions) {
+        session->thread.join();
+        delete session->client;
+    }
+    delete listener;
+    listener = nullptr;
+
+    context.outputConsoleWritter.printLine("Server stopped after " + std::to_string(sessionCount) + " session(s).");
+    endSession();
+}
+
+/**
+ * @brief Runs one client session of the server.
+ *
+ * The session reads one command line at a time and answers it with the
+ * command output followed by `.ok` or `.error` (see `OutputSocketWritter`).
+ * A command fails if it raised the error counter of the calling thread (see
+ * `MetricsRegistry::getErrorCountOfCurrentThread`), which is not affected by
+ * the commands of other sessions. Besides the regular
+ * commands a session understands:
+ * - `exit`: ends the session,
+ * - `shutdown`: ends the session and stops the server.
+ *
+ * `open` and `close` are refused, since the catalog is shared by all sessions.
+ * Every session has its own transaction (see `begin`); one that is still
+ * running when the session ends is rolled back.
+ * The session ends when the client disconnects or the connection breaks.
+ * Its connection is then shut down and its trace buffer released (see
+ * `TraceRecorder::releaseThread`).
+ *
+ * @param client The client connection. Owned by `serve`.
+ * @param sessionNumber The number of the session, used to name its thread in traces.
+ */
+void Engine::runSession(Socket* client, int sessionNumber) {
+    TraceRecorder::setThreadName("session " + std::to_string(sessionNumber));
+
+    InputSocketReader reader(*client);
+    OutputSocketWritter writer(*client);
+
+    CommandContext sessionContext(loadedCatalog, writer, reader,
+        context.outputFileWritter, context.inputFileReader, *taskScheduler, *metrics, options);
+    sessionContext.loadedCatalogExists = context.loadedCatalogExists;
+    sessionContext.sessionNumber = sessionNumber;
+
+    std::unordered_map<std::string, Command*> sessionCommands;
+    for (const auto& pair : commands) {
+        sessionCommands[pair.first] = pair.second->clone(sessionContext);
+    }
+
+    std::string line;
+    while (!writer.isBroken() && reader.readNextLine(line)) {
+        if (line.find_first_not_of(" \t") == std::string::npos) {
+            writer.endResponse(true);
+            continue;
+        }
+
+        std::vector<std::string> args = CommandParser::parseRawCommand(line);
+        bool succeeded = true;
+
+        if (args[0] == "exit" || args[0] == "shutdown") {
+            writer.printLine(args[0] == "exit" ? "Goodbye!" : "Shutting down the server. ");
+            writer.endResponse(true);
+            if (args[0] == "shutdown") {
+                listener->shutdown();
+            }
+            break;
+        }
+        else if (args[0] == "open" || args[0] == "close") {
+            writer.printLine("The catalog is shared by all sessions; '" + args[0] + "' is not available in a session. ");
+            metrics->recordError();
+            succeeded = false;
+        }
+        else {
+            uint64_t errorsBefore = MetricsRegistry::getErrorCountOfCurrentThread();
+            dispatchCommand(args, sessionCommands, sessionContext);
+            succeeded = MetricsRegistry::getErrorCountOfCurrentThread() == errorsBefore;
+        }
+
+        writer.endResponse(succeeded);
+    }
+
+    delete sessionContext.transaction;
+    for (auto& pair : sessionCommands) {
+        delete pair.second;
+    }
+    client->shutdown();
+    TraceRecorder::releaseThread();
+}
+
+/**
+ * @brief Starts the session services requested by the startup options.
+ *
+ * The calling thread is named "main" in traces. Tracing is enabled when
+ * `options.traceFile` is set and the workload capture is opened when
+ * `options.captureFile` is set; a capture file that cannot be opened is
+ * reported and the session continues without capturing. Finally the catalog
+ * given by `options.catalogFile` is opened like with the `open` command.
+ */
+void Engine::beginSession() {
+    TraceRecorder::setThreadName("main");
+    if (!options.traceFile.empty()) {
+        TraceRecorder::enable();
+    }
+
+    if (!options.captureFile.empty()) {
+        try {
+            recorder.open(options.captureFile);
+        }
+        catch (const std::exception& e) {
+            context.outputConsoleWritter.printLine(e.what());
+        }
+    }
+
+    if (!options.catalogFile.empty()) {
+        dispatchCommand({ "open", options.catalogFile });
+    }
+}
+
+/**
+ * @brief Writes the exit reports requested by the startup options.
+ *
+ * The workload capture is closed, the metrics are written to
+ * `options.metricsFile` in Prometheus text format (if a file was given) and
+ * the session trace is written to `options.traceFile` (if tracing was
+ * requested at startup). Write failures are printed to the console.
+ */
+void Engine::endSession() {
+    recorder.close();
+
+    if (!options.metricsFile.empty()) {
+        try {
+            context.outputFileWritter.writeTextToFile(metrics->toPrometheus(), options.metricsFile);
+        }
+        catch (const std::exception& e) {
+            context.outputConsoleWritter.printLine(e.what());
+        }
+    }
+    if (!options.traceFile.empty()) {
+        TraceRecorder::disable();
+        try {
+            context.outputFileWritter.writeTextToFile(TraceRecorder::toChromeJson(), options.traceFile);
+        }
+        catch (const std::exception& e) {
+            context.outputConsoleWritter.printLine(e.what());
+        }
+    }
+}
+
 /**
  * @brief Dispatches a parsed command for execution.
  *
@@ -113,35 +570,244 @@ void Engine::run() {
  * If the `commandName` is not found in the `commands` map, an "Unknown command"
  * message is displayed  to the user, guiding them to available commands.
  *
+ * The execution time of every known command is recorded in the metrics
+ * registry under the command name; thrown exceptions and unknown commands are
+ * counted as errors. The measured time includes waiting for the locks the
+ * command declares with `Command::requiredLocks`. Commands that modify data
+ * hold them until they return; commands that only read tables run on a
+ * snapshot and hold them only while it is taken (see `executeOnSnapshot`).
+ * Inside a transaction, commands that use the catalog run on the private
+ * tables of the transaction instead (see `executeInTransaction`). For
+ * commands that profile themselves (`explain`), an `ExecutionProfile` is
+ * started before the locks are requested and handed to the command through
+ * the context, so the lock wait, the snapshot and the statistics built for it
+ * appear as phases of the report. While a workload is captured, every dispatched command
+ * line is appended to the capture file before it runs, including unknown commands,
+ * so a replay reproduces the same errors.
+ *
  * @param params A constant reference to a `std::vector<std::string>` containing
  * the command name (at index 0) and its subsequent parameters.
  */
 void Engine::dispatchCommand(const std::vector<std::string>& params) {
+    dispatchCommand(params, commands, context);
+}
+
+/**
+ * @brief Dispatches a parsed command to the commands of a particular context.
+ *
+ * This is the implementation behind `dispatchCommand(params)`. Server sessions
+ * call it with their own command objects and context, so errors are printed
+ * to the client while latencies, errors and the workload capture still go to
+ * the engine's shared metrics and recorder.
+ *
+ * @param params The command name (at index 0) and its subsequent parameters.
+ * @param commandMap The commands to look the command name up in.
+ * @param commandContext The context the commands are bound to.
+ */
+void Engine::dispatchCommand(const std::vector<std::string>& params,
+    std::unordered_map<std::string, Command*>& commandMap,
+    CommandContext& commandContext) {
     const std::string& commandName = params[0];
 
-    auto command = commands.find(commandName);
-    if (command != commands.end()) {
+    if (recorder.isRecording()) {
+        recorder.record(params, commandContext.sessionNumber);
+    }
+
+    auto command = commandMap.find(commandName);
+    if (command != commandMap.end()) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        ExecutionProfile profile;
         try {
-            command->second->execute(params);
+            if (command->second->profilesExecution()) {
+                profile.start();
+                commandContext.profile = &profile;
+            }
+
+            LockSet locks = command->second->requiredLocks(params);
+            if (commandContext.transaction != nullptr && command->second->runsInsideTransaction()
+                && locks.catalogMode != LockMode::NONE) {
+                executeInTransaction(*command->second, params, locks, commandContext);
+            }
+            else if (locks.isReadOnly() && !locks.tables.empty()) {
+                executeOnSnapshot(*command->second, params, locks, commandContext);
+            }
+            else {
+                ProfilePhase lockWait("lock wait");
+                ScopedLocks held(lockManager, locks);
+                lockWait.stop();
+
+                TraceSpan span("execute", commandName);
+                command->second->execute(params);
+            }
         }
         catch (const std::exception& e) {
-            context.outputConsoleWritter.printLine(e.what());
+            commandContext.outputConsoleWritter.printLine(e.what());
+            metrics->recordError();
         }
+        commandContext.profile = nullptr;
+        std::chrono::microseconds elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        metrics->recordLatency(commandName, static_cast<uint64_t>(elapsed.count()));
     }
     else {
-        context.outputConsoleWritter.printLine("Unknown command: " + commandName);
+        commandContext.outputConsoleWritter.printLine("Unknown command: " + commandName);
+        metrics->recordError();
     }
 }
 
+/**
+ * @brief Executes a read-only command against a snapshot of the tables it reads.
+ *
+ * The snapshot tables share their segments with the live tables, and every
+ * segment stays alive for as long as a snapshot holds it: a writer that
+ * modifies a shared segment copies it first and only drops its own
+ * reference (see `ColumnSegments`). All tables are snapshotted under the same set of locks,
+ * which makes multi-table reads such as `innerjoin` consistent. Tables that
+ * do not exist are left out; the command reports them as usual.
+ *
+ * The snapshot catalog keeps the path of the loaded catalog, so commands that
+ * derive file names from it behave as before.
+ *
+ * @param command The command to execute.
+ * @param params The command name and its parameters.
+ * @param locks The read-only locks declared by the command.
+ * @param commandContext The context the command is bound to.
+ * @throws Any exception thrown by the command.
+ */
+void Engine::executeOnSnapshot(const Command& command, const std::vector<std::string>& params,
+    const LockSet& locks, CommandContext& commandContext) {
+    Catalog snapshot(commandContext.loadedCatalog.getPath());
+
+    {
+        TraceSpan span("snapshot", params[0]);
+        ProfilePhase lockWait("lock wait");
+        ScopedLocks held(lockManager, locks);
+        lockWait.stop();
+
+        ProfilePhase snapshotPhase("snapshot");
+        for (const auto& pair : locks.tables) {
+            for (const Table& table : commandContext.loadedCatalog) {
+                if (table.getName() == pair.first) {
+                    snapshot.addTable(table.snapshot());
+                    break;
+                }
+            }
+        }
+    }
+
+    CommandContext snapshotContext(snapshot,
+        commandContext.outputConsoleWritter,
+        commandContext.inputConsoleReader,
+        commandContext.outputFileWritter,
+        commandContext.inputFileReader,
+        commandContext.taskScheduler,
+        commandContext.metrics,
+        commandContext.options);
+    snapshotContext.loadedCatalogExists = commandContext.loadedCatalogExists;
+    snapshotContext.profile = commandContext.profile;
+
+    Command* reader = command.clone(snapshotContext);
+    try {
+        TraceSpan span("execute", params[0]);
+        reader->execute(params);
+    }
+    catch (...) {
+        delete reader;
+        throw;
+    }
+    delete reader;
+}
+
+/**
+ * @brief Executes a command on the private tables of the running transaction.
+ *
+ * Tables the transaction has not used yet are snapshotted into it first,
+ * under shared locks only, so joining a table to a transaction never waits
+ * for long reads and copies no values. The command then runs without any
+ * lock on a copy bound to a context whose catalog is the workspace of the
+ * transaction: it sees the earlier changes of the transaction, and its own
+ * changes copy the columns they modify instead of touching the live tables.
+ * `commit` later publishes the tables whose values the commands actually
+ * changed, so a command that fails or changes nothing adds no table to it.
+ *
+ * Commands that add, remove, rename or reload tables need the whole catalog
+ * and are refused until the transaction ends.
+ *
+ * @param command The command to execute. It is cloned for the transaction context.
+ * @param params The command name and its parameters.
+ * @param locks The locks declared by the command.
+ * @param commandContext The context of the session; holds the transaction.
+ * @throws std::runtime_error If the command needs the catalog exclusively.
+ * @throws Any exception thrown by the command.
+ */
+void Engine::executeInTransaction(const Command& command, const std::vector<std::string>& params,
+    const LockSet& locks, CommandContext& commandContext) {
+    if (locks.catalogMode == LockMode::EXCLUSIVE) {
+        throw std::runtime_error("'" + params[0] + "' is not available inside a transaction. Commit or roll it back first. ");
+    }
+
+    Transaction& transaction = *commandContext.transaction;
+
+    LockSet joining;
+    for (const auto& pair : locks.tables) {
+        if (!transaction.contains(pair.first)) {
+            joining.addTable(pair.first, LockMode::SHARED);
+        }
+    }
+    if (!joining.tables.empty()) {
+        TraceSpan span("snapshot", params[0]);
+        ProfilePhase lockWait("lock wait");
+        ScopedLocks held(lockManager, joining);
+        lockWait.stop();
+
+        ProfilePhase snapshotPhase("snapshot");
+        for (const auto& pair : joining.tables) {
+            for (const Table& table : commandContext.loadedCatalog) {
+                if (table.getName() == pair.first) {
+                    transaction.addTable(table);
+                    break;
+                }
+            }
+        }
+    }
+
+    CommandContext transactionContext(transaction.getWorkspace(),
+        commandContext.outputConsoleWritter,
+        commandContext.inputConsoleReader,
+        commandContext.outputFileWritter,
+        commandContext.inputFileReader,
+        commandContext.taskScheduler,
+        commandContext.metrics,
+        commandContext.options);
+    transactionContext.loadedCatalogExists = commandContext.loadedCatalogExists;
+    transactionContext.profile = commandContext.profile;
+
+    Command* worker = command.clone(transactionContext);
+    try {
+        TraceSpan span("execute", params[0]);
+        worker->execute(params);
+    }
+    catch (...) {
+        delete worker;
+        throw;
+    }
+    delete worker;
+}
+
 /**
  * @brief Destroys the `Engine` instance.
  *
  * This destructor calls the `clearMemory()` helper method to release all
  * dynamically allocated `Command` objects managed by this Engine instance,
- * preventing memory leaks.
+ * preventing memory leaks. The task scheduler is deleted after no
+ * command can submit work to it anymore; its destructor joins the workers.
+ * A transaction that is still running is rolled back first.
  */
 Engine::~Engine() {
+    delete context.transaction;
     this->clearMemory();
+    delete taskScheduler;
+    delete metrics;
 }
 
 /**
@@ -150,23 +816,33 @@ Engine::~Engine() {
  * Performs a deep copy of the `other` Engine object.
  *
  * 1.  It first copies the `loadedCatalog` from `other.loadedCatalog`.
- * 2.  Then, it initializes the `context` of the new Engine instance. 
+ * 2.  A new `TaskScheduler` with the same number of workers is created, since
+ * a thread pool cannot be shared between two owners. The copy starts with
+ * its own, empty `MetricsRegistry`; the one of `other` stays installed.
+ * 3.  Then, it initializes the `context` of the new Engine instance. 
  * The new `context` is bound to *this* object's newly copied `loadedCatalog`,
  * while maintaining references to the same external I/O utilities
  * (console, file readers/writers) as the source `other` Engine.
- * 3.  Finally, it iterates through `other.commands` and performs a deep copy
+ * 4.  Finally, it iterates through `other.commands` and performs a deep copy
  * of each `Command` object using its `clone()` method. Each cloned command
  * is then associated with the `context` of the *newly constructed* Engine.
  *
  * @param other The Engine object to be copied.
  */
 Engine::Engine(const Engine& other)
-    : loadedCatalog(other.loadedCatalog), 
+    : options(other.options),
+    loadedCatalog(other.loadedCatalog), 
+    taskScheduler(new TaskScheduler(other.taskScheduler ? other.taskScheduler->getThreadCount() : 0)),
+    metrics(new MetricsRegistry()),
     context(loadedCatalog, 
         other.context.outputConsoleWritter,
         other.context.inputConsoleReader,
         other.context.outputFileWritter,
-        other.context.inputFileReader)
+        other.context.inputFileReader,
+        *taskScheduler,
+        *metrics,
+        options),
+    listener(nullptr)
 {
     for (const auto& pair : other.commands) {
         commands[pair.first] = pair.second->clone(context); 
@@ -182,6 +858,7 @@ Engine::Engine(const Engine& other)
  * to prevent unnecessary operations and potential self-destruction.
  * 2.  All dynamically allocated `Command` objects currently owned by
  * the left-hand side object (`*this`) are `delete`d, and the `commands` map is cleared.
+ * A running transaction of `*this` is rolled back; the one of `other` is not copied.
  * 3.  The `loadedCatalog` is copied from the `other` Engine.
  * 4.  The `CommandContext` needs to be effectively "re-bound" or
  * re-initialized to point to the newly copied `loadedCatalog` of `*this` object,
@@ -200,7 +877,10 @@ Engine& Engine::operator=(const Engine& other) {
     }
 
     this->clearMemory();
+    delete context.transaction;
+    context.transaction = nullptr;
 
+    options = other.options;
     loadedCatalog = other.loadedCatalog; 
 
     for (const auto& pair : other.commands) {
@@ -233,24 +913,34 @@ void Engine::clearMemory() {
  * or expiring `other` Engine object. This avoids expensive deep copies.
  *
  * 1.  The `loadedCatalog` is moved from `other.loadedCatalog`.
- * 2.  The `context` is initialized, binding to the *newly moved* `loadedCatalog`
+ * 2.  Ownership of the `TaskScheduler` and the `MetricsRegistry` is taken
+ * over from `other`; running workers and recorded metrics are not affected by the move.
+ * 3.  The `context` is initialized, binding to the *newly moved* `loadedCatalog`
  * of *this* Engine object. The references to external I/O utilities remain the same.
- * 3.  Ownership of the `Command` objects is transferred
+ * 4.  Ownership of the `Command` objects is transferred
  * from `other.commands` to `this->commands` using `std::move` on the map.
  * This leaves `other.commands` empty.
  *
  * @param other The Engine object to be moved from (an an rvalue reference).
  */
 Engine::Engine(Engine&& other) noexcept
-    : loadedCatalog(std::move(other.loadedCatalog)), 
+    : options(other.options),
+    loadedCatalog(std::move(other.loadedCatalog)), 
+    taskScheduler(other.taskScheduler),
+    metrics(other.metrics),
     context(loadedCatalog,
         other.context.outputConsoleWritter,
         other.context.inputConsoleReader,
         other.context.outputFileWritter,
-        other.context.inputFileReader),
+        other.context.inputFileReader,
+        *taskScheduler,
+        *metrics,
+        options),
+    listener(nullptr),
     commands(std::move(other.commands)) 
 {
-
+    other.taskScheduler = nullptr;
+    other.metrics = nullptr;
 }
 
 /**
@@ -262,13 +952,14 @@ Engine::Engine(Engine&& other) noexcept
  * and ownership of `Command` objects from `other`. Self-assignment is handled.
  *
  * 1.  Prevents erroneous operations if `this` and `other` are the same object.
- * 2.  Calls `clearMemory()` to release existing `Command` objects owned by `*this`.
+ * 2.  Calls `clearMemory()` to release existing `Command` objects owned by `*this`
+ * and rolls back a running transaction of `*this`.
  * 3.  `loadedCatalog` is moved from `other.loadedCatalog`.
  * Ownership of `Command` objects (their raw pointers) is moved from `other.commands` to `this->commands`.
  * 4.  The `context` member is a value holding references.
  * After `loadedCatalog = std::move(other.loadedCatalog)`, the `context` of `*this`
  * implicitly operates on its now-updated `loadedCatalog`. The references to
- * external I/O objects remain unchanged.
+ * external I/O objects and to this engine's own `TaskScheduler` remain unchanged.
  *
  * @param other The Engine object to be moved from (an rvalue reference).
  * @return A reference to the current Engine object (`*this`) after the move.
@@ -279,7 +970,10 @@ Engine& Engine::operator=(Engine&& other) noexcept {
     }
 
     this->clearMemory(); 
+    delete context.transaction;
+    context.transaction = nullptr;
 
+    options = other.options;
     loadedCatalog = std::move(other.loadedCatalog); 
     commands = std::move(other.commands);       
 
@@ -0,0 +1,165 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstddef>
+
+/**
+ * @class ExecutionProfile
+ * @brief Collects the execution breakdown of one command for `explain`.
+ *
+ * While a profile is started it is the *active* profile of the program.
+ * Instrumented code reports to it through `Instrumentation`, which skips the
+ * profile when none is active, so profiling costs a single pointer check
+ * during normal execution.
+ *
+ * The profile gathers:
+ * - the time spent in each phase (see `ProfilePhase`), e.g. `scan` or `file I/O`.
+ *   Phases may nest; a phase is charged only the time not spent in its nested phases.
+ * - the number of rows scanned and matched,
+ * - the bytes read from and written to files,
+ * - the bytes allocated by the threads working for the profile (see `AllocationCounter`):
+ *   the thread that started it, and workers while they run tasks it submitted
+ *   (see `TaskGroup`), but not other sessions,
+ * - the access paths chosen, e.g. a filtered scan or a hash join.
+ *
+ * Phases are only timed on the thread that started the profile; the counters
+ * may be updated from any thread.
+ */
+class ExecutionProfile {
+private:
+    static std::atomic<ExecutionProfile*> active; ///< The started profile, or nullptr.
+
+    std::thread::id owner;                                   ///< Thread that started the profile.
+    std::chrono::steady_clock::time_point startTime;         ///< When `start()` was called.
+    double totalSeconds;                                     ///< Wall time between `start()` and `stop()`.
+    std::atomic<long long> allocatedBytes;                   ///< Bytes allocated by the threads working for the profile.
+
+    std::vector<std::string> phaseNames;                     ///< Phase names, in order of first use.
+    std::vector<double> phaseSeconds;                        ///< Exclusive time of every phase.
+    std::vector<double> openPhases;                          ///< Time spent in nested phases, per open phase.
+
+    std::atomic<long long> rowsScanned;                      ///< Rows examined.
+    std::atomic<long long> rowsMatched;                      ///< Rows that qualified.
+    std::atomic<long long> bytesRead;                        ///< Bytes read from files.
+    std::atomic<long long> bytesWritten;                     ///< Bytes written to files.
+    std::atomic<long long> columnClones;                     ///< Columns cloned with `TableColumn::clone()`.
+    std::vector<std::string> accessPaths;                    ///< Access paths, in the order they were chosen.
+
+public:
+    /**
+     * @brief Constructs an empty profile that is not started.
+     */
+    ExecutionProfile();
+
+    /**
+     * @brief Stops the profile if it is still active.
+     */
+    ~ExecutionProfile();
+
+    /**
+     * @brief Deleted copy constructor; instrumented code holds pointers to the active profile.
+     */
+    ExecutionProfile(const ExecutionProfile& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; instrumented code holds pointers to the active profile.
+     */
+    ExecutionProfile& operator=(const ExecutionProfile& other) = delete;
+
+    /**
+     * @brief Makes this the active profile and starts the clock.
+     * @throws std::runtime_error If another profile is already active.
+     */
+    void start();
+
+    /**
+     * @brief Stops the clock and deactivates the profile.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the active profile.
+     * @return The started profile, or nullptr when nothing is being profiled.
+     */
+    static ExecutionProfile* current();
+
+    /**
+     * @brief Returns the profile the calling thread works for.
+     *
+     * This is the started profile on the thread that started it, and the
+     * profile of the submitting thread inside a task (see `switchCallingThread`).
+     *
+     * @return The profile, or nullptr if the calling thread works for none.
+     */
+    static ExecutionProfile* ofCallingThread();
+
+    /**
+     * @brief Lets the calling thread work for another profile, e.g. while it runs a task.
+     *
+     * The allocations counted so far are charged to the profile the thread
+     * worked for until now; from now on they are counted for `profile`, or
+     * not at all if it is nullptr.
+     *
+     * @param profile The profile to work for, or nullptr.
+     * @return The profile the thread worked for before, to be restored afterwards.
+     */
+    static ExecutionProfile* switchCallingThread(ExecutionProfile* profile);
+
+    /**
+     * @brief Checks whether phases reported from the calling thread are timed.
+     * @return `true` on the thread that started the profile.
+     */
+    bool ownsCallingThread() const;
+
+    /**
+     * @brief Marks the start of a phase. Called by `ProfilePhase`.
+     */
+    void enterPhase();
+
+    /**
+     * @brief Charges the exclusive time of a finished phase. Called by `ProfilePhase`.
+     * @param name The phase name.
+     * @param seconds The wall time of the phase, including its nested phases.
+     */
+    void leavePhase(const std::string& name, double seconds);
+
+    /**
+     * @brief Adds scanned and matched rows.
+     * @param scanned The number of rows examined.
+     * @param matched The number of them that qualified.
+     */
+    void addRows(long long scanned, long long matched);
+
+    /**
+     * @brief Adds bytes read from a file.
+     * @param bytes The number of bytes.
+     */
+    void addBytesRead(long long bytes);
+
+    /**
+     * @brief Adds bytes written to a file.
+     * @param bytes The number of bytes.
+     */
+    void addBytesWritten(long long bytes);
+
+    /**
+     * @brief Adds cloned columns.
+     * @param columns The number of columns.
+     */
+    void addColumnClones(long long columns);
+
+    /**
+     * @brief Records an access path chosen by the profiled command.
+     * @param path A short description, e.g. `filtered scan of 1000 rows: $0 > '3'`.
+     */
+    void addAccessPath(const std::string& path);
+
+    /**
+     * @brief Formats the collected breakdown.
+     * @return One line per figure, ready to be printed.
+     */
+    std::vector<std::string> report() const;
+};
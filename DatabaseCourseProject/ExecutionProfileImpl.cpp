@@ -0,0 +1,234 @@
+#include "ExecutionProfile.hpp"
+#include "AllocationCounter.hpp"
+#include <stdexcept>
+#include <cstdio>
+
+std::atomic<ExecutionProfile*> ExecutionProfile::active(nullptr);
+
+namespace {
+    /// The profile the calling thread works for, see `ExecutionProfile::ofCallingThread`.
+    thread_local ExecutionProfile* workingFor = nullptr;
+
+    /**
+     * @brief Formats a duration in milliseconds with three decimals.
+     * @param seconds The duration in seconds.
+     * @return The duration as text, e.g. `1.250 ms`.
+     */
+    std::string formatMilliseconds(double seconds) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.3f ms", seconds * 1000.0);
+        return buffer;
+    }
+}
+
+/**
+ * @brief Constructs an empty profile that is not started.
+ */
+ExecutionProfile::ExecutionProfile()
+    : totalSeconds(0.0), allocatedBytes(0),
+    rowsScanned(0), rowsMatched(0), bytesRead(0), bytesWritten(0), columnClones(0) {
+}
+
+/**
+ * @brief Stops the profile if it is still active.
+ */
+ExecutionProfile::~ExecutionProfile() {
+    if (active.load() == this) {
+        stop();
+    }
+}
+
+/**
+ * @brief Makes this the active profile and starts the clock.
+ *
+ * The calling thread starts counting its allocations for the profile.
+ *
+ * @throws std::runtime_error If another profile is already active.
+ */
+void ExecutionProfile::start() {
+    ExecutionProfile* expected = nullptr;
+    if (!active.compare_exchange_strong(expected, this)) {
+        throw std::runtime_error("Another command is already being profiled. ");
+    }
+
+    owner = std::this_thread::get_id();
+    switchCallingThread(this);
+    startTime = std::chrono::steady_clock::now();
+}
+
+/**
+ * @brief Stops the clock and deactivates the profile.
+ *
+ * Must be called on the thread that started the profile; its counted
+ * allocations are charged and counting ends.
+ */
+void ExecutionProfile::stop() {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    totalSeconds = elapsed.count();
+    if (workingFor == this) {
+        switchCallingThread(nullptr);
+    }
+
+    ExecutionProfile* expected = this;
+    active.compare_exchange_strong(expected, nullptr);
+}
+
+/**
+ * @brief Returns the active profile.
+ * @return The started profile, or nullptr when nothing is being profiled.
+ */
+ExecutionProfile* ExecutionProfile::current() {
+    return active.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the profile the calling thread works for.
+ * @return The profile, or nullptr if the calling thread works for none.
+ */
+ExecutionProfile* ExecutionProfile::ofCallingThread() {
+    return workingFor;
+}
+
+/**
+ * @brief Lets the calling thread work for another profile.
+ *
+ * The bytes counted so far are added to the previous profile with one atomic
+ * addition, so allocations themselves never touch shared memory.
+ *
+ * @param profile The profile to work for, or nullptr.
+ * @return The profile the thread worked for before.
+ */
+ExecutionProfile* ExecutionProfile::switchCallingThread(ExecutionProfile* profile) {
+    ExecutionProfile* previous = workingFor;
+    size_t counted = AllocationCounter::takeCountedBytes();
+    if (previous != nullptr) {
+        previous->allocatedBytes.fetch_add(static_cast<long long>(counted), std::memory_order_relaxed);
+    }
+    workingFor = profile;
+    AllocationCounter::setCounting(profile != nullptr);
+    return previous;
+}
+
+/**
+ * @brief Checks whether phases reported from the calling thread are timed.
+ * @return `true` on the thread that started the profile.
+ */
+bool ExecutionProfile::ownsCallingThread() const {
+    return owner == std::this_thread::get_id();
+}
+
+/**
+ * @brief Marks the start of a phase by opening a slot for the time of its nested phases.
+ */
+void ExecutionProfile::enterPhase() {
+    openPhases.push_back(0.0);
+}
+
+/**
+ * @brief Charges the exclusive time of a finished phase.
+ *
+ * The time of the nested phases is subtracted, and the full time of the
+ * phase is added to the nested time of its enclosing phase.
+ *
+ * @param name The phase name.
+ * @param seconds The wall time of the phase, including its nested phases.
+ */
+void ExecutionProfile::leavePhase(const std::string& name, double seconds) {
+    double nested = openPhases.back();
+    openPhases.pop_back();
+    if (!openPhases.empty()) {
+        openPhases.back() += seconds;
+    }
+
+    for (size_t i = 0; i < phaseNames.size(); ++i) {
+        if (phaseNames[i] == name) {
+            phaseSeconds[i] += seconds - nested;
+            return;
+        }
+    }
+    phaseNames.push_back(name);
+    phaseSeconds.push_back(seconds - nested);
+}
+
+/**
+ * @brief Adds scanned and matched rows.
+ * @param scanned The number of rows examined.
+ * @param matched The number of them that qualified.
+ */
+void ExecutionProfile::addRows(long long scanned, long long matched) {
+    rowsScanned.fetch_add(scanned, std::memory_order_relaxed);
+    rowsMatched.fetch_add(matched, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds bytes read from a file.
+ * @param bytes The number of bytes.
+ */
+void ExecutionProfile::addBytesRead(long long bytes) {
+    bytesRead.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds bytes written to a file.
+ * @param bytes The number of bytes.
+ */
+void ExecutionProfile::addBytesWritten(long long bytes) {
+    bytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds cloned columns.
+ * @param columns The number of columns.
+ */
+void ExecutionProfile::addColumnClones(long long columns) {
+    columnClones.fetch_add(columns, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Records an access path chosen by the profiled command.
+ *
+ * Access paths are only kept from the profiling thread, see `Instrumentation::recordAccessPath`.
+ *
+ * @param path A short description of the access path.
+ */
+void ExecutionProfile::addAccessPath(const std::string& path) {
+    accessPaths.push_back(path);
+}
+
+/**
+ * @brief Formats the collected breakdown.
+ *
+ * Time that was not charged to any phase (argument parsing, paging prompts
+ * and other bookkeeping) is listed as `other`.
+ *
+ * @return One line per figure, ready to be printed.
+ */
+std::vector<std::string> ExecutionProfile::report() const {
+    std::vector<std::string> lines;
+    lines.push_back("Execution profile:");
+    lines.push_back("  Total time: " + formatMilliseconds(totalSeconds));
+
+    double charged = 0.0;
+    for (size_t i = 0; i < phaseNames.size(); ++i) {
+        lines.push_back("    " + phaseNames[i] + ": " + formatMilliseconds(phaseSeconds[i]));
+        charged += phaseSeconds[i];
+    }
+    if (!phaseNames.empty() && totalSeconds > charged) {
+        lines.push_back("    other: " + formatMilliseconds(totalSeconds - charged));
+    }
+
+    lines.push_back("  Rows scanned: " + std::to_string(rowsScanned.load()));
+    lines.push_back("  Rows matched: " + std::to_string(rowsMatched.load()));
+    lines.push_back("  Bytes read: " + std::to_string(bytesRead.load()));
+    lines.push_back("  Bytes written: " + std::to_string(bytesWritten.load()));
+    lines.push_back("  Columns cloned: " + std::to_string(columnClones.load()));
+    lines.push_back("  Bytes allocated: " + std::to_string(allocatedBytes.load()));
+
+    if (accessPaths.empty()) {
+        lines.push_back("  Access path: none");
+    }
+    for (const std::string& path : accessPaths) {
+        lines.push_back("  Access path: " + path);
+    }
+    return lines;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Table.hpp"
+#include "SelectionBitmap.hpp"
+
+/**
+ * @class Expression
+ * @brief Abstract base class for the nodes of a WHERE expression tree.
+ *
+ * Expressions are produced by `CommandParser::parseExpression` and refer to
+ * columns by their 0-indexed position. Before evaluation a tree is bound to a
+ * table with `bind()`, which resolves the columns and converts the literals to
+ * the column types once, so that no string parsing happens per row.
+ *
+ * Evaluation is vectorized: `evaluate()` processes a whole batch of rows and
+ * writes the result into a `SelectionBitmap`. Leaves run tight loops over the
+ * typed column storage and inner nodes combine the bitmaps of their children
+ * word by word.
+ *
+ * NULL cells never satisfy a comparison or an IN list; `IS NULL` tests for
+ * them explicitly. `NOT` inverts the selection of its operand.
+ */
+class Expression {
+private:
+    /**
+     * @brief Records the access path of a filter scan, including the rows skipped by the zone maps.
+     * @param rowCount The number of rows of the bound table.
+     * @param skippedRows The number of rows in batches skipped by the zone maps.
+     */
+    void recordScan(int rowCount, int skippedRows) const;
+
+public:
+    /// Number of rows evaluated per batch by the helper methods.
+    static const int BATCH_SIZE = 1024;
+
+    /**
+     * @brief Virtual destructor. Inner nodes delete their children.
+     */
+    virtual ~Expression() = default;
+
+    /**
+     * @brief Resolves the columns of the expression against `table`.
+     *
+     * @param table The table the expression will be evaluated on. It must outlive the binding.
+     * @throws std::runtime_error If a column index is out of bounds or a literal cannot be
+     * converted to the type of its column.
+     */
+    virtual void bind(const Table& table) = 0;
+
+    /**
+     * @brief Evaluates the expression for the rows [begin, end).
+     *
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch; it is resized to `end - begin`.
+     * @note The expression must be bound first.
+     */
+    virtual void evaluate(int begin, int end, SelectionBitmap& result) const = 0;
+
+    /**
+     * @brief Returns a readable form of the expression, e.g. for error and diagnostic output.
+     * @return The expression as text.
+     */
+    virtual std::string toString() const = 0;
+
+    /**
+     * @brief Estimates the fraction of rows that satisfy the expression.
+     *
+     * The estimate is derived from the `ColumnStatistics` of the bound columns
+     * and assumes that the operands of `AND`/`OR` are independent.
+     *
+     * @return A fraction in [0, 1]; 1 before the expression is bound.
+     */
+    virtual double estimateSelectivity() const = 0;
+
+    /**
+     * @brief Checks whether the statistics prove that no row satisfies the expression.
+     *
+     * Scans use this to skip the table entirely, e.g. for `$0 > 100` on a
+     * column whose maximum is 50. A `false` result does not guarantee a match.
+     *
+     * @return `true` if no row can match; `false` if some row might or the expression is not bound.
+     */
+    virtual bool isProvablyEmpty() const = 0;
+
+    /**
+     * @brief Checks whether the zone maps prove that no row of [begin, end) satisfies the expression.
+     *
+     * Scans ask this for every batch before evaluating it, so a lookup on a
+     * sorted or clustered numeric column only evaluates the few batches whose
+     * blocks can hold a match (see `ColumnSegments::summarize`). A `false`
+     * result does not guarantee a match.
+     *
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `true` if no row of the batch can match.
+     * @note The expression must be bound first.
+     */
+    virtual bool isProvablyEmptyIn(int begin, int end) const = 0;
+
+    /**
+     * @brief Counts the rows of [0, rowCount) that satisfy the expression.
+     * @param rowCount The number of rows of the bound table.
+     * @return The number of matching rows.
+     */
+    int countMatches(int rowCount) const;
+
+    /**
+     * @brief Returns the ids of all rows of [0, rowCount) that satisfy the expression.
+     * @param rowCount The number of rows of the bound table.
+     * @return The matching row ids in ascending order.
+     */
+    std::vector<int> matchingRows(int rowCount) const;
+};
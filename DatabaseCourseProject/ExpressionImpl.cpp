@@ -0,0 +1,94 @@
+#include "Expression.hpp"
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
+#include "TraceSpan.hpp"
+#include <algorithm>
+
+/**
+ * @brief Records the access path of a filter scan.
+ * @param rowCount The number of rows of the bound table.
+ * @param skippedRows The number of rows in batches skipped by the zone maps.
+ */
+void Expression::recordScan(int rowCount, int skippedRows) const {
+    std::string path = "vectorized filter scan of " + std::to_string(rowCount) + " rows";
+    if (skippedRows > 0) {
+        path += ", " + std::to_string(skippedRows) + " skipped by zone maps";
+    }
+    Instrumentation::recordAccessPath(path + ": " + toString());
+}
+
+/**
+ * @brief Counts the rows of [0, rowCount) that satisfy the expression.
+ *
+ * The rows are evaluated in batches of `BATCH_SIZE` and only the set bits of
+ * each batch are counted; no row id is materialized. Nothing is evaluated
+ * when the statistics prove that no row matches, and batches are skipped
+ * when the zone maps prove that none of their rows matches.
+ *
+ * @param rowCount The number of rows of the bound table.
+ * @return The number of matching rows.
+ */
+int Expression::countMatches(int rowCount) const {
+    ProfilePhase phase("scan");
+    TraceSpan span("filter scan");
+    SelectionBitmap selection;
+    int total = 0;
+
+    if (isProvablyEmpty()) {
+        Instrumentation::recordAccessPath("scan skipped, statistics prove " + toString() + " matches no row");
+        return 0;
+    }
+
+    int skippedRows = 0;
+    for (int begin = 0; begin < rowCount; begin += BATCH_SIZE) {
+        int end = std::min(rowCount, begin + BATCH_SIZE);
+        if (isProvablyEmptyIn(begin, end)) {
+            skippedRows += end - begin;
+            continue;
+        }
+        evaluate(begin, end, selection);
+        total += selection.count();
+    }
+
+    recordScan(rowCount, skippedRows);
+    Instrumentation::recordRows(rowCount - skippedRows, total);
+    return total;
+}
+
+/**
+ * @brief Returns the ids of all rows of [0, rowCount) that satisfy the expression.
+ *
+ * The result vector is pre-sized with the estimated number of matches, and
+ * the scan is skipped when the statistics prove that no row matches. Batches
+ * ruled out by the zone maps are not evaluated.
+ *
+ * @param rowCount The number of rows of the bound table.
+ * @return The matching row ids in ascending order.
+ */
+std::vector<int> Expression::matchingRows(int rowCount) const {
+    ProfilePhase phase("scan");
+    TraceSpan span("filter scan");
+    SelectionBitmap selection;
+    std::vector<int> rows;
+
+    if (isProvablyEmpty()) {
+        Instrumentation::recordAccessPath("scan skipped, statistics prove " + toString() + " matches no row");
+        return rows;
+    }
+    rows.reserve(static_cast<size_t>(estimateSelectivity() * rowCount));
+
+    int skippedRows = 0;
+    for (int begin = 0; begin < rowCount; begin += BATCH_SIZE) {
+        int end = std::min(rowCount, begin + BATCH_SIZE);
+        if (isProvablyEmptyIn(begin, end)) {
+            skippedRows += end - begin;
+            continue;
+        }
+        evaluate(begin, end, selection);
+        selection.appendSetRows(begin, rows);
+    }
+
+    recordScan(rowCount, skippedRows);
+    Instrumentation::recordRows(rowCount - skippedRows, static_cast<long long>(rows.size()));
+    return rows;
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <istream>
+#include "Table.hpp"
+#include "ColumnType.hpp"
+
+/**
+ * @class ExternalSorter
+ * @brief Sorts the rows of a table by one column within a fixed memory budget.
+ *
+ * If a reordered copy of the table fits in the budget, a permutation of the
+ * row ids is sorted with `TableColumn::compareValues` and every column is
+ * rebuilt from it with `TableColumn::permute`, so the values never leave
+ * their native type. Otherwise the rows are encoded and collected in memory
+ * until the budget is used up; every full buffer is sorted and spilled as a
+ * run to a temporary file, and the runs are combined with a k-way merge that
+ * appends the rows to the columns of the result. Only one buffer plus one row
+ * per run is held in memory at a time.
+ *
+ * Run files use a lossless encoding: a cell is written as `-` if it is NULL
+ * and as `<length>:<text>` otherwise, with doubles at `max_digits10`
+ * significant digits, and every row is prefixed with its length the same
+ * way. Commas, line breaks and the full precision of the values survive the
+ * round trip.
+ *
+ * The sort is stable. Values are compared in the native type of the column;
+ * NULL values come first in ascending and last in descending order, which
+ * matches `select ... orderby`.
+ */
+class ExternalSorter {
+private:
+    /**
+     * @brief One row waiting to be sorted, together with its parsed sort key.
+     */
+    struct SortRecord {
+        bool isNull;       ///< Whether the key cell is NULL.
+        double number;     ///< The key of Integer and Double columns.
+        std::string text;  ///< The key of String columns.
+        std::string line;  ///< The complete row in run encoding.
+    };
+
+    size_t memoryBudget;        ///< Maximum number of bytes held in memory by the sort.
+    std::string tempDirectory;  ///< Directory for the temporary run files.
+    int column;                 ///< The column to sort by.
+    ColumnType keyType;         ///< The type of the sort column.
+    bool descending;            ///< `true` for descending order.
+    size_t spilledRuns;         ///< Number of runs spilled by the last sort.
+
+    /**
+     * @brief Estimates the memory an in-memory sort of `table` needs.
+     * @param table The table to sort.
+     * @return The bytes of the row-id permutation plus a reordered copy of all columns.
+     */
+    static size_t estimateBytes(const Table& table);
+
+    /**
+     * @brief Appends the run encoding of a cell to `out`.
+     * @param source The column holding the cell.
+     * @param row The 0-indexed row.
+     * @param out The string to append to.
+     */
+    static void encodeCell(const TableColumn& source, int row, std::string& out);
+
+    /**
+     * @brief Decodes the cell starting at `position` of an encoded row.
+     * @param line The encoded row.
+     * @param position The offset of the cell; advanced past it.
+     * @param cell Receives the text of the cell, empty for NULL.
+     * @return `false` if the cell is NULL.
+     * @throws std::runtime_error If the encoding is malformed.
+     */
+    static bool decodeCell(const std::string& line, size_t& position, std::string& cell);
+
+    /**
+     * @brief Reads the next length-prefixed row of a run file.
+     * @param in The run file.
+     * @param line Receives the encoded row.
+     * @return `false` at the end of the file.
+     * @throws std::runtime_error If the run file is truncated.
+     */
+    static bool readRecord(std::istream& in, std::string& line);
+
+    /**
+     * @brief Builds a record from a row read back from a run file, decoding its key.
+     * @param line The encoded row.
+     * @return The record holding the row and its key.
+     */
+    SortRecord makeRecord(std::string line) const;
+
+    /**
+     * @brief Builds a record for a row of the table, reading its key from the sort column.
+     * @param line The encoded row.
+     * @param key The sort column.
+     * @param row The 0-indexed row.
+     * @return The record holding the row and its key.
+     */
+    SortRecord makeRecord(std::string line, const TableColumn& key, int row) const;
+
+    /**
+     * @brief Checks whether `left` orders strictly before `right`.
+     * @param left The first record.
+     * @param right The second record.
+     * @return `true` if `left` comes first.
+     */
+    bool orderedBefore(const SortRecord& left, const SortRecord& right) const;
+
+    /**
+     * @brief Returns the approximate number of bytes a record occupies in memory.
+     * @param record The record to measure.
+     * @return The estimated size in bytes.
+     */
+    static size_t recordSize(const SortRecord& record);
+
+    /**
+     * @brief Sorts a permutation of the row ids and reorders every column by it.
+     * @param table The table to sort.
+     * @return The columns of the sorted table.
+     */
+    std::vector<TableColumn*> sortInMemory(const Table& table) const;
+
+    /**
+     * @brief Sorts the rows through runs spilled to temporary files.
+     * @param table The table to sort.
+     * @param columns Receives the columns of the sorted table.
+     * @throws std::runtime_error If a run file cannot be written or read.
+     */
+    void sortWithRuns(const Table& table, std::vector<TableColumn*>& columns);
+
+    /**
+     * @brief Sorts the buffer and writes it to a new run file.
+     * @param buffer The records to spill. It is cleared afterwards.
+     * @param runPaths Receives the path of the new run file.
+     * @param runPrefix The path prefix of the run files.
+     * @throws std::runtime_error If the run file cannot be written.
+     */
+    void spillRun(std::vector<SortRecord>& buffer, std::vector<std::string>& runPaths, const std::string& runPrefix) const;
+
+    /**
+     * @brief Merges the sorted run files into the columns of the result.
+     * @param runPaths The run files in creation order.
+     * @param columns The empty columns receiving the merged rows.
+     * @throws std::runtime_error If a run file cannot be opened or is malformed.
+     */
+    void mergeRuns(const std::vector<std::string>& runPaths, std::vector<TableColumn*>& columns) const;
+
+public:
+    /**
+     * @brief Creates a sorter with the given memory budget.
+     *
+     * @param memoryBudget Maximum number of bytes the sort keeps in memory at once.
+     * @param tempDirectory Directory in which temporary run files are created.
+     */
+    ExternalSorter(size_t memoryBudget, const std::string& tempDirectory);
+
+    /**
+     * @brief Returns the rows of `table` sorted by `column` as a new table.
+     *
+     * The result has the name and path of `table` and complete statistics.
+     * Temporary run files are removed before the method returns, also on failure.
+     *
+     * @param table The table to sort. It is not modified.
+     * @param column The 0-indexed position of the column to sort by.
+     * @param descending `true` to sort from the largest value to the smallest.
+     * @return The sorted table.
+     * @throws std::runtime_error If `column` is out of bounds or a run file cannot be written or read.
+     */
+    Table sort(const Table& table, int column, bool descending);
+
+    /**
+     * @brief Returns the number of runs the last `sort` spilled to disk.
+     * @return The number of runs; 0 if the table was sorted in memory.
+     */
+    size_t getSpilledRunCount() const;
+};
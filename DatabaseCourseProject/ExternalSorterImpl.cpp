@@ -0,0 +1,517 @@
+#include "ExternalSorter.hpp"
+#include "TableColumn.hpp"
+#include "ColumnFactory.hpp"
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
+#include "StringColumn.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+    /// Number of spilling sorts started by this process; keeps the run files of concurrent sorts of one table apart.
+    std::atomic<unsigned long long> nextSortId(0);
+}
+
+/**
+ * @brief Creates a sorter with the given memory budget.
+ *
+ * @param memoryBudget Maximum number of bytes the sort keeps in memory at once.
+ * @param tempDirectory Directory in which temporary run files are created.
+ */
+ExternalSorter::ExternalSorter(size_t memoryBudget, const std::string& tempDirectory)
+    : memoryBudget(memoryBudget), tempDirectory(tempDirectory),
+    column(0), keyType(ColumnType::STRING), descending(false), spilledRuns(0) {
+}
+
+/**
+ * @brief Estimates the memory an in-memory sort of `table` needs.
+ *
+ * The sort holds a permutation of the row ids and builds a reordered copy of
+ * every column. Numeric cells take the size of their type; string cells take
+ * the size of a `std::string` plus their text.
+ *
+ * @param table The table to sort.
+ * @return The estimated size in bytes.
+ */
+size_t ExternalSorter::estimateBytes(const Table& table) {
+    size_t rows = static_cast<size_t>(table.getNumberOfRows());
+    size_t bytes = rows * sizeof(int);
+
+    for (const TableColumn* source : table) {
+        switch (source->getType()) {
+        case ColumnType::INTEGER:
+            bytes += rows * sizeof(int);
+            break;
+        case ColumnType::DOUBLE:
+            bytes += rows * sizeof(double);
+            break;
+        case ColumnType::STRING: {
+            const ColumnSegments<std::string>& cells = static_cast<const StringColumn*>(source)->getSegments();
+            bytes += rows * sizeof(std::string);
+            cells.forEachPiece(0, cells.size(), [&bytes](const ColumnSegments<std::string>::Segment& segment, int offset, int count) {
+                for (int i = offset; i < offset + count; ++i) {
+                    bytes += segment.values[i].size();
+                }
+            });
+            break;
+        }
+        }
+    }
+    return bytes;
+}
+
+/**
+ * @brief Appends the run encoding of a cell to `out`.
+ *
+ * A NULL cell is written as `-`, any other as `<length>:<text>`. Doubles are
+ * formatted with `max_digits10` significant digits, so `std::stod` restores
+ * exactly the same value.
+ *
+ * @param source The column holding the cell.
+ * @param row The 0-indexed row.
+ * @param out The string to append to.
+ */
+void ExternalSorter::encodeCell(const TableColumn& source, int row, std::string& out) {
+    std::string text;
+
+    switch (source.getType()) {
+    case ColumnType::INTEGER: {
+        const ColumnSegments<int>& cells = static_cast<const IntegerColumn&>(source).getSegments();
+        if (cells.isNull(row)) {
+            out += '-';
+            return;
+        }
+        text = std::to_string(cells.value(row));
+        break;
+    }
+    case ColumnType::DOUBLE: {
+        const ColumnSegments<double>& cells = static_cast<const DoubleColumn&>(source).getSegments();
+        if (cells.isNull(row)) {
+            out += '-';
+            return;
+        }
+        char buffer[64];
+        int length = std::snprintf(buffer, sizeof(buffer), "%.*g", std::numeric_limits<double>::max_digits10, cells.value(row));
+        text.assign(buffer, static_cast<size_t>(length));
+        break;
+    }
+    case ColumnType::STRING: {
+        const ColumnSegments<std::string>& cells = static_cast<const StringColumn&>(source).getSegments();
+        if (cells.isNull(row)) {
+            out += '-';
+            return;
+        }
+        text = cells.value(row);
+        break;
+    }
+    }
+
+    out += std::to_string(text.size());
+    out += ':';
+    out += text;
+}
+
+/**
+ * @brief Decodes the cell starting at `position` of an encoded row.
+ * @param line The encoded row.
+ * @param position The offset of the cell; advanced past it.
+ * @param cell Receives the text of the cell, empty for NULL.
+ * @return `false` if the cell is NULL.
+ * @throws std::runtime_error If the encoding is malformed.
+ */
+bool ExternalSorter::decodeCell(const std::string& line, size_t& position, std::string& cell) {
+    cell.clear();
+    if (position < line.size() && line[position] == '-') {
+        ++position;
+        return false;
+    }
+
+    size_t colon = line.find(':', position);
+    if (colon == std::string::npos || colon == position) {
+        throw std::runtime_error("Malformed sort run: missing cell length. ");
+    }
+    size_t length = std::stoul(line.substr(position, colon - position));
+    if (length > line.size() - colon - 1) {
+        throw std::runtime_error("Malformed sort run: cell exceeds its row. ");
+    }
+
+    cell.assign(line, colon + 1, length);
+    position = colon + 1 + length;
+    return true;
+}
+
+/**
+ * @brief Reads the next row of a run file, written as `<length>:<encoded row>`.
+ * @param in The run file.
+ * @param line Receives the encoded row.
+ * @return `false` at the end of the file.
+ * @throws std::runtime_error If the run file is truncated.
+ */
+bool ExternalSorter::readRecord(std::istream& in, std::string& line) {
+    size_t length;
+    if (!(in >> length)) {
+        return false;
+    }
+    if (in.get() != ':') {
+        throw std::runtime_error("Malformed sort run: missing row length. ");
+    }
+
+    line.resize(length);
+    if (length > 0 && !in.read(&line[0], static_cast<std::streamsize>(length))) {
+        throw std::runtime_error("Malformed sort run: truncated row. ");
+    }
+    return true;
+}
+
+/**
+ * @brief Builds a record from a row read back from a run file, decoding its key.
+ *
+ * The cells before the key are skipped; numeric keys are restored exactly
+ * with `std::stod`, since they were encoded losslessly.
+ *
+ * @param line The encoded row.
+ * @return The record holding the row and its key.
+ */
+ExternalSorter::SortRecord ExternalSorter::makeRecord(std::string line) const {
+    SortRecord record;
+    record.number = 0;
+
+    size_t position = 0;
+    std::string key;
+    for (int j = 0; j < column; ++j) {
+        decodeCell(line, position, key);
+    }
+    record.isNull = !decodeCell(line, position, key);
+
+    if (!record.isNull) {
+        if (keyType == ColumnType::STRING) {
+            record.text = std::move(key);
+        }
+        else {
+            record.number = std::stod(key);
+        }
+    }
+    record.line = std::move(line);
+    return record;
+}
+
+/**
+ * @brief Builds a record for a row of the table, reading its key from the sort column.
+ *
+ * The key is read from the typed storage of the column, so the row does not
+ * have to be decoded again to find it.
+ *
+ * @param line The encoded row.
+ * @param key The sort column; its type is `keyType`.
+ * @param row The 0-indexed row.
+ * @return The record holding the row and its key.
+ */
+ExternalSorter::SortRecord ExternalSorter::makeRecord(std::string line, const TableColumn& key, int row) const {
+    SortRecord record;
+    record.line = std::move(line);
+    record.number = 0;
+
+    switch (keyType) {
+    case ColumnType::INTEGER: {
+        const ColumnSegments<int>& cells = static_cast<const IntegerColumn&>(key).getSegments();
+        record.isNull = cells.isNull(row);
+        if (!record.isNull) {
+            record.number = cells.value(row);
+        }
+        break;
+    }
+    case ColumnType::DOUBLE: {
+        const ColumnSegments<double>& cells = static_cast<const DoubleColumn&>(key).getSegments();
+        record.isNull = cells.isNull(row);
+        if (!record.isNull) {
+            record.number = cells.value(row);
+        }
+        break;
+    }
+    case ColumnType::STRING: {
+        const ColumnSegments<std::string>& cells = static_cast<const StringColumn&>(key).getSegments();
+        record.isNull = cells.isNull(row);
+        if (!record.isNull) {
+            record.text = cells.value(row);
+        }
+        break;
+    }
+    }
+    return record;
+}
+
+/**
+ * @brief Checks whether `left` orders strictly before `right`.
+ *
+ * NULL keys are the smallest values; `descending` reverses the whole order.
+ *
+ * @param left The first record.
+ * @param right The second record.
+ * @return `true` if `left` comes first.
+ */
+bool ExternalSorter::orderedBefore(const SortRecord& left, const SortRecord& right) const {
+    int comparison;
+    if (left.isNull || right.isNull) {
+        comparison = (left.isNull ? 0 : 1) - (right.isNull ? 0 : 1);
+    }
+    else if (keyType == ColumnType::STRING) {
+        comparison = left.text.compare(right.text);
+    }
+    else {
+        comparison = left.number < right.number ? -1 : (right.number < left.number ? 1 : 0);
+    }
+    return descending ? comparison > 0 : comparison < 0;
+}
+
+/**
+ * @brief Returns the approximate number of bytes a record occupies in memory.
+ * @param record The record to measure.
+ * @return The estimated size in bytes.
+ */
+size_t ExternalSorter::recordSize(const SortRecord& record) {
+    return sizeof(SortRecord) + record.line.capacity() + record.text.capacity();
+}
+
+/**
+ * @brief Sorts a permutation of the row ids and reorders every column by it.
+ *
+ * The permutation is sorted stably with `compareValues` of the sort column,
+ * which orders NULL cells first; for descending order the comparison is
+ * reversed. Each column is then rebuilt with `TableColumn::permute`.
+ *
+ * @param table The table to sort.
+ * @return The columns of the sorted table. The caller owns them.
+ */
+std::vector<TableColumn*> ExternalSorter::sortInMemory(const Table& table) const {
+    std::vector<int> order(static_cast<size_t>(table.getNumberOfRows()));
+    std::iota(order.begin(), order.end(), 0);
+
+    const TableColumn* key = table.getColumnAtGivenIndex(column);
+    bool reversed = descending;
+    std::stable_sort(order.begin(), order.end(), [key, reversed](int left, int right) {
+        return reversed ? key->compareValues(right, left) < 0 : key->compareValues(left, right) < 0;
+    });
+
+    std::vector<TableColumn*> columns;
+    try {
+        for (const TableColumn* source : table) {
+            columns.push_back(source->permute(order));
+        }
+    }
+    catch (...) {
+        for (TableColumn* created : columns) {
+            delete created;
+        }
+        throw;
+    }
+    return columns;
+}
+
+/**
+ * @brief Sorts the buffer and writes it to a new run file.
+ *
+ * Every row is written as `<length>:<encoded row>`.
+ *
+ * @param buffer The records to spill. It is cleared afterwards.
+ * @param runPaths Receives the path of the new run file.
+ * @param runPrefix The path prefix of the run files.
+ * @throws std::runtime_error If the run file cannot be written.
+ */
+void ExternalSorter::spillRun(std::vector<SortRecord>& buffer, std::vector<std::string>& runPaths, const std::string& runPrefix) const {
+    std::stable_sort(buffer.begin(), buffer.end(), [this](const SortRecord& left, const SortRecord& right) {
+        return orderedBefore(left, right);
+    });
+
+    std::string runPath = runPrefix + std::to_string(runPaths.size()) + ".tmp";
+    runPaths.push_back(runPath);
+
+    std::ofstream run(runPath, std::ios::binary);
+    if (!run.is_open()) {
+        throw std::runtime_error("Unable to open file: " + runPath);
+    }
+    for (const SortRecord& record : buffer) {
+        run << record.line.size() << ':' << record.line;
+    }
+    if (!run) {
+        throw std::runtime_error("Failed to write sort run: " + runPath);
+    }
+
+    buffer.clear();
+}
+
+/**
+ * @brief Merges the sorted run files into the columns of the result.
+ *
+ * A min-heap holds the current row of every run. Ties are resolved by the run
+ * index, so rows with equal keys keep the order in which they were spilled and
+ * the merge stays stable. Every merged row is decoded and added to the
+ * columns with `addCell`, which restores the values exactly.
+ *
+ * @param runPaths The run files in creation order.
+ * @param columns The empty columns receiving the merged rows.
+ * @throws std::runtime_error If a run file cannot be opened or is malformed.
+ */
+void ExternalSorter::mergeRuns(const std::vector<std::string>& runPaths, std::vector<TableColumn*>& columns) const {
+    std::vector<std::ifstream> runs(runPaths.size());
+    std::vector<SortRecord> heads(runPaths.size());
+
+    auto comesLater = [this, &heads](size_t left, size_t right) {
+        if (orderedBefore(heads[right], heads[left])) {
+            return true;
+        }
+        if (orderedBefore(heads[left], heads[right])) {
+            return false;
+        }
+        return left > right;
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(comesLater)> heap(comesLater);
+
+    std::string line;
+    for (size_t i = 0; i < runPaths.size(); ++i) {
+        runs[i].open(runPaths[i], std::ios::binary);
+        if (!runs[i].is_open()) {
+            throw std::runtime_error("Failed to open file: " + runPaths[i]);
+        }
+        if (readRecord(runs[i], line)) {
+            heads[i] = makeRecord(std::move(line));
+            heap.push(i);
+        }
+    }
+
+    std::string cell;
+    while (!heap.empty()) {
+        size_t run = heap.top();
+        heap.pop();
+
+        size_t position = 0;
+        for (TableColumn* target : columns) {
+            decodeCell(heads[run].line, position, cell);
+            target->addCell(cell);
+        }
+
+        if (readRecord(runs[run], line)) {
+            heads[run] = makeRecord(std::move(line));
+            heap.push(run);
+        }
+    }
+}
+
+/**
+ * @brief Sorts the rows through runs spilled to temporary files.
+ *
+ * Rows are encoded one by one and buffered until `memoryBudget` is reached;
+ * each full buffer becomes a sorted run. The last buffer is spilled too, and
+ * all runs are merged into new, empty columns of the same types and names,
+ * whose statistics are completed at the end. The run files are named
+ * `<table>.sort<id>.run<n>.tmp` with an id unique to the sort, since a sort
+ * inside a transaction holds no lock and may run next to another sort of
+ * the same table.
+ *
+ * @param table The table to sort.
+ * @param columns Receives the columns of the sorted table. The caller owns them, also on failure.
+ * @throws std::runtime_error If a run file cannot be written or read.
+ */
+void ExternalSorter::sortWithRuns(const Table& table, std::vector<TableColumn*>& columns) {
+    std::string runPrefix = tempDirectory + "/" + table.getName() + ".sort" + std::to_string(nextSortId++) + ".run";
+    std::vector<std::string> runPaths;
+    std::vector<SortRecord> buffer;
+    size_t bufferedBytes = 0;
+
+    try {
+        int numRows = table.getNumberOfRows();
+        const TableColumn* keyColumn = table.getColumnAtGivenIndex(column);
+
+        for (int i = 0; i < numRows; ++i) {
+            std::string line;
+            for (const TableColumn* source : table) {
+                encodeCell(*source, i, line);
+            }
+
+            buffer.push_back(makeRecord(std::move(line), *keyColumn, i));
+            bufferedBytes += recordSize(buffer.back());
+
+            if (bufferedBytes >= memoryBudget) {
+                spillRun(buffer, runPaths, runPrefix);
+                bufferedBytes = 0;
+            }
+        }
+        if (!buffer.empty()) {
+            spillRun(buffer, runPaths, runPrefix);
+        }
+
+        for (const TableColumn* source : table) {
+            columns.push_back(ColumnFactory::makeColumn(source->getName(), source->getTypeAsString()));
+        }
+        mergeRuns(runPaths, columns);
+
+        for (TableColumn* target : columns) {
+            target->finishStatistics();
+        }
+    }
+    catch (...) {
+        for (const std::string& runPath : runPaths) {
+            std::remove(runPath.c_str());
+        }
+        throw;
+    }
+
+    for (const std::string& runPath : runPaths) {
+        std::remove(runPath.c_str());
+    }
+    spilledRuns = runPaths.size();
+}
+
+/**
+ * @brief Returns the rows of `table` sorted by `column` as a new table.
+ *
+ * Tables whose reordered copy fits in `memoryBudget` (see `estimateBytes`)
+ * are sorted in memory; larger ones are sorted through spilled runs.
+ *
+ * @param table The table to sort. It is not modified.
+ * @param column The 0-indexed position of the column to sort by.
+ * @param descending `true` to sort from the largest value to the smallest.
+ * @return The sorted table, with the name and path of `table`.
+ * @throws std::runtime_error If `column` is out of bounds or a run file cannot be written or read.
+ */
+Table ExternalSorter::sort(const Table& table, int column, bool descending) {
+    if (column < 0 || column >= table.getNumberOfColumns()) {
+        throw std::runtime_error("Invalid column index " + std::to_string(column) + " for sort. ");
+    }
+
+    this->column = column;
+    this->keyType = table.getColumnAtGivenIndex(column)->getType();
+    this->descending = descending;
+    this->spilledRuns = 0;
+
+    std::vector<TableColumn*> columns;
+    try {
+        if (estimateBytes(table) <= memoryBudget) {
+            columns = sortInMemory(table);
+        }
+        else {
+            sortWithRuns(table, columns);
+        }
+    }
+    catch (...) {
+        for (TableColumn* created : columns) {
+            delete created;
+        }
+        throw;
+    }
+    return Table(columns, table.getName(), table.getFilename());
+}
+
+/**
+ * @brief Returns the number of runs the last `sort` spilled to disk.
+ * @return The number of runs; 0 if the table was sorted in memory.
+ */
+size_t ExternalSorter::getSpilledRunCount() const {
+    return spilledRuns;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileBeginCommand
+ * @brief Command that starts a transaction in the current session.
+ *
+ * Until `commit` or `rollback`, the commands of the session work on private
+ * copy-on-write snapshots of the tables they use (see `Transaction`); other
+ * sessions keep seeing the committed tables.
+ */
+class FileBeginCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Holds the transaction of the session and the console.
+     */
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs the FileBeginCommand with a given context.
+     *
+     * @param context The shared command context of the session.
+     */
+    FileBeginCommand(CommandContext& context);
+
+    /**
+     * @brief Starts a transaction.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "begin" (command name)
+     *
+     * @throws std::runtime_error If no catalog is loaded or a transaction is already running.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares that starting a transaction uses neither the catalog nor any table; tables join the transaction when first used.
+     *
+     * @param params The parameters of `execute`.
+     * @return An empty lock set.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+     * @brief Controls the transaction itself, so it runs on the live catalog.
+     * @return `false`.
+     */
+    bool runsInsideTransaction() const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
@@ -0,0 +1,62 @@
+#include "FileBeginCommand.hpp"
+#include "CommandContext.hpp"
+#include "Transaction.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Constructs the FileBeginCommand with a reference to the command context.
+ *
+ * @param context The shared context of the session.
+ */
+FileBeginCommand::FileBeginCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Starts a transaction.
+ *
+ * No table is touched yet; each table is snapshotted into the transaction
+ * when a command of the transaction uses it for the first time.
+ *
+ * @param params Unused besides the command name.
+ * @throws std::runtime_error If no catalog is loaded or a transaction is already running.
+ */
+void FileBeginCommand::execute(const std::vector<std::string>& /*params*/) {
+    if (!context.loadedCatalogExists) {
+        throw std::runtime_error("There is no file opened! ");
+    }
+    if (context.transaction != nullptr) {
+        throw std::runtime_error("A transaction is already running. Commit or roll it back first. ");
+    }
+
+    context.transaction = new Transaction(context.loadedCatalog.getPath());
+    context.outputConsoleWritter.printLine("Transaction started.");
+}
+
+/**
+ * @brief Locks nothing, the command does not access any table.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileBeginCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
+/**
+ * @brief Runs on the live catalog, also inside a transaction.
+ * @return `false`.
+ */
+bool FileBeginCommand::runsInsideTransaction() const {
+    return false;
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileBeginCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileBeginCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileBeginCommand::clone(CommandContext& newContext) const {
+    return new FileBeginCommand(newContext);
+}
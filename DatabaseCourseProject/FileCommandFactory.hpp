@@ -6,6 +6,12 @@
 #include "FileSaveAsCommand.hpp"
 #include "FileHelpCommand.hpp"
 #include "FileExitCommand.hpp"
+#include "FileExplainCommand.hpp"
+#include "FileMetricsCommand.hpp"
+#include "FileTraceCommand.hpp"
+#include "FileBeginCommand.hpp"
+#include "FileCommitCommand.hpp"
+#include "FileRollbackCommand.hpp"
 #include <string>
 
 /**
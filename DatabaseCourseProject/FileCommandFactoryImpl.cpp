@@ -22,5 +22,11 @@ Command* FileCommandFactory::createCommand(const std::string& name, CommandConte
     if (name == "saveas") return new FileSaveAsCommand(context);
     if (name == "help") return new FileHelpCommand(context);
     if (name == "exit") return new FileExitCommand(context);
+    if (name == "explain") return new FileExplainCommand(context);
+    if (name == "metrics") return new FileMetricsCommand(context);
+    if (name == "trace") return new FileTraceCommand(context);
+    if (name == "begin") return new FileBeginCommand(context);
+    if (name == "commit") return new FileCommitCommand(context);
+    if (name == "rollback") return new FileRollbackCommand(context);
     throw std::runtime_error("Unknown file command: " + name + "Please type 'help' for a list of supported commands. ");
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileCommitCommand
+ * @brief Command that publishes the changes of the running transaction.
+ *
+ * All tables modified by the transaction replace the live tables at once,
+ * unless another session changed one of them since the transaction read it;
+ * the transaction is then rolled back instead (see `Transaction::commit`).
+ * Either way the transaction ends.
+ */
+class FileCommitCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Holds the transaction of the session and the console.
+     */
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs the FileCommitCommand with a given context.
+     *
+     * @param context The shared command context of the session.
+     */
+    FileCommitCommand(CommandContext& context);
+
+    /**
+     * @brief Commits the running transaction.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "commit" (command name)
+     *
+     * @throws std::runtime_error If no transaction is running, or if it conflicted and was rolled back.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares exclusive locks on the tables the transaction modified.
+     *
+     * @param params The parameters of `execute`.
+     * @return The locks of `Transaction::commitLocks`, or an empty set outside of a transaction.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+     * @brief Controls the transaction itself, so it runs on the live catalog.
+     * @return `false`.
+     */
+    bool runsInsideTransaction() const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
@@ -0,0 +1,80 @@
+#include "FileCommitCommand.hpp"
+#include "CommandContext.hpp"
+#include "Transaction.hpp"
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Constructs the FileCommitCommand with a reference to the command context.
+ *
+ * @param context The shared context of the session.
+ */
+FileCommitCommand::FileCommitCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Commits the running transaction.
+ *
+ * The transaction ends in any case. If publishing fails because another
+ * session changed a table in the meantime, no table is modified and the
+ * error reports that the transaction was rolled back.
+ *
+ * @param params Unused besides the command name.
+ * @throws std::runtime_error If no transaction is running, or if it conflicted and was rolled back.
+ */
+void FileCommitCommand::execute(const std::vector<std::string>& /*params*/) {
+    if (context.transaction == nullptr) {
+        throw std::runtime_error("No transaction is running. ");
+    }
+
+    Transaction* transaction = context.transaction;
+    context.transaction = nullptr;
+    size_t writtenTables = transaction->getWrittenTableCount();
+
+    try {
+        transaction->commit(context.loadedCatalog);
+    }
+    catch (const std::exception& e) {
+        delete transaction;
+        throw std::runtime_error(std::string(e.what()) + "The transaction was rolled back. ");
+    }
+    delete transaction;
+
+    context.outputConsoleWritter.printLine("Transaction committed, " + std::to_string(writtenTables) + " table(s) changed.");
+}
+
+/**
+ * @brief Locks every table the transaction modified exclusively.
+ *
+ * Readers of those tables take their snapshots under shared locks, so they
+ * see either all changes of the transaction or none.
+ *
+ * @param params The parameters of `execute`. Unused.
+ * @return The commit locks of the transaction, or an empty set if none is running.
+ */
+LockSet FileCommitCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    if (context.transaction == nullptr) {
+        return LockSet();
+    }
+    return context.transaction->commitLocks();
+}
+
+/**
+ * @brief Runs on the live catalog, which it publishes the transaction to.
+ * @return `false`.
+ */
+bool FileCommitCommand::runsInsideTransaction() const {
+    return false;
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileCommitCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileCommitCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileCommitCommand::clone(CommandContext& newContext) const {
+    return new FileCommitCommand(newContext);
+}
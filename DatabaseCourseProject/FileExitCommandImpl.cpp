@@ -23,6 +23,15 @@ void FileExitCommand::execute(const std::vector<std::string>& params) {
     context.outputConsoleWritter.printLine("Exiting the program... ");
 }
 
+/**
+ * @brief Locks nothing, the command does not access the catalog.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileExitCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
 /**
  * @brief Creates a deep copy of the current `FileExitCommand` object.
  *
@@ -0,0 +1,83 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileExplainCommand
+ * @brief Command that runs another command and prints where its time went.
+ *
+ * `explain <command> <arguments...>` executes the wrapped command normally,
+ * with an `ExecutionProfile` active, and then prints the breakdown collected
+ * by the instrumented code: time per phase, rows scanned and matched, bytes
+ * read, written and allocated, and the access paths that were used.
+ */
+class FileExplainCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Used to create the wrapped command and to print the report.
+     */
+    CommandContext& context;
+
+    /**
+     * @brief Creates the wrapped command with `FileCommandFactory` or `CatalogCommandFactory`.
+     *
+     * @param name The name of the wrapped command.
+     * @return A new command bound to `context`. The caller is responsible for deleting it.
+     * @throws std::runtime_error If the command is unknown.
+     */
+    Command* createWrappedCommand(const std::string& name) const;
+
+public:
+    /**
+     * @brief Constructs the FileExplainCommand with a given context.
+     *
+     * @param context The shared command context which contains the catalog and I/O interfaces.
+     */
+    FileExplainCommand(CommandContext& context);
+
+    /**
+     * @brief Runs the wrapped command under an `ExecutionProfile` and prints the profile.
+     *
+     * The wrapped command is created with `FileCommandFactory` or `CatalogCommandFactory`
+     * and receives `params[1...]` as its own parameters. Errors of the wrapped command are
+     * printed and the profile is still reported.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "explain" (command name)
+     * - `params[1]`: The name of the command to run, e.g. `select`.
+     * - `params[2...]`: The parameters of that command.
+     *
+     * @throws std::runtime_error If no command is given.
+     * @throws std::runtime_error If the command is unknown, `exit` or `explain` itself.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares the locks of the explained command.
+     *
+     * @param params The parameters of `execute`; `params[1...]` is the explained command.
+     * @return The locks to hold during `execute`.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+     * @brief Asks the `Engine` to start the profile before the locks and the snapshot of the wrapped command.
+     * @return `true`.
+     */
+    bool profilesExecution() const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
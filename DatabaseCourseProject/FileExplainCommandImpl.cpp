@@ -0,0 +1,131 @@
+#include "FileExplainCommand.hpp"
+#include "CommandContext.hpp"
+#include "FileCommandFactory.hpp"
+#include "CatalogCommandFactory.hpp"
+#include "SupportedCommands.hpp"
+#include "ExecutionProfile.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Constructs the FileExplainCommand with a reference to the command context.
+ *
+ * @param context The shared context used to create the wrapped command and print the report.
+ */
+FileExplainCommand::FileExplainCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Runs the wrapped command under an `ExecutionProfile` and prints the profile.
+ *
+ * A fresh instance of the wrapped command is created from the factory that
+ * owns its name. The `Engine` starts the profile (see `CommandContext::profile`)
+ * before it waits for the locks of the wrapped command and takes its
+ * snapshot, so the report covers those phases as well; without one, e.g.
+ * when the command is run directly, the profile is started right before
+ * `execute`. It is stopped right after it. Errors thrown by the command are
+ * printed before the report, like `Engine` would.
+ *
+ * @param params `params[1]` names the command to run, `params[2...]` are its parameters.
+ * @throws std::runtime_error If no command is given, or it is unknown, `exit` or `explain`.
+ */
+void FileExplainCommand::execute(const std::vector<std::string>& params) {
+
+    if (params.size() < 2) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
+    const std::string& name = params[1];
+    if (name == "explain" || name == "exit") {
+        throw std::runtime_error("The command '" + name + "' cannot be explained. ");
+    }
+
+    Command* command = createWrappedCommand(name);
+
+    std::vector<std::string> commandParams(params.begin() + 1, params.end());
+    ExecutionProfile ownProfile;
+    ExecutionProfile& profile = context.profile != nullptr ? *context.profile : ownProfile;
+
+    try {
+        if (context.profile == nullptr) {
+            ownProfile.start();
+        }
+        command->execute(commandParams);
+    }
+    catch (const std::exception& e) {
+        context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
+    }
+    profile.stop();
+
+    delete command;
+
+    context.outputConsoleWritter.printLine("");
+    for (const std::string& line : profile.report()) {
+        context.outputConsoleWritter.printLine(line);
+    }
+}
+
+/**
+ * @brief Creates the command to run under the profile.
+ *
+ * File commands come from `FileCommandFactory`, all other names are passed
+ * to `CatalogCommandFactory`, which rejects unknown ones.
+ *
+ * @param name The name of the wrapped command.
+ * @return A new command bound to the same context. The caller deletes it.
+ * @throws std::runtime_error If the command is unknown.
+ */
+Command* FileExplainCommand::createWrappedCommand(const std::string& name) const {
+    std::vector<std::string> fileCommands = SupportedCommands::returnSupportedFileCommands();
+    return std::find(fileCommands.begin(), fileCommands.end(), name) != fileCommands.end()
+        ? FileCommandFactory::createCommand(name, context)
+        : CatalogCommandFactory::createCommand(name, context);
+}
+
+/**
+ * @brief Returns the locks of the wrapped command for `params[1...]`.
+ *
+ * The wrapped command is created only to ask it for its locks. If it cannot be
+ * created, no locks are needed; `execute` then reports the error.
+ *
+ * @param params The parameters of `execute`.
+ * @return The locks of the wrapped command.
+ */
+LockSet FileExplainCommand::requiredLocks(const std::vector<std::string>& params) const {
+    if (params.size() < 2 || params[1] == "explain" || params[1] == "exit") {
+        return LockSet();
+    }
+
+    Command* command = nullptr;
+    try {
+        command = createWrappedCommand(params[1]);
+    }
+    catch (const std::exception&) {
+        return LockSet();
+    }
+
+    LockSet locks = command->requiredLocks(std::vector<std::string>(params.begin() + 1, params.end()));
+    delete command;
+    return locks;
+}
+
+/**
+ * @brief Asks the `Engine` to start the profile before the locks and the snapshot of the wrapped command.
+ * @return `true`.
+ */
+bool FileExplainCommand::profilesExecution() const {
+    return true;
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileExplainCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileExplainCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileExplainCommand::clone(CommandContext& newContext) const {
+    return new FileExplainCommand(newContext);
+}
@@ -31,6 +31,14 @@ public:
      */
     void execute(const std::vector<std::string>& params) override;
 
+    /**
+     * @brief Declares that the command uses neither the catalog nor any table.
+     *
+     * @param params The parameters of `execute`.
+     * @return An empty lock set.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
     /**
     * @brief Creates a deep copy of the current object.
     *
@@ -25,27 +25,67 @@ void FileHelpCommand::execute(const std::vector<std::string>& params) {
 	context.outputConsoleWritter.printLine("  saveas <file>       - Saves the currently open file in <file>");
 	context.outputConsoleWritter.printLine("  help                - Prints this help information");
 	context.outputConsoleWritter.printLine("  exit                - Exits the program");
+	context.outputConsoleWritter.printLine("  explain <command>   - Runs <command> and prints its time, rows, bytes and access paths");
+	context.outputConsoleWritter.printLine("  metrics [<file>]    - Prints command latencies and counters, optionally exports them in Prometheus format");
+	context.outputConsoleWritter.printLine("  trace start|status  - Starts tracing hot paths or reports whether a trace is running");
+	context.outputConsoleWritter.printLine("  trace stop <file>   - Stops tracing and writes the spans to <file> in Chrome trace format");
+	context.outputConsoleWritter.printLine("  begin               - Starts a transaction; its changes stay private until commit");
+	context.outputConsoleWritter.printLine("  commit              - Publishes the changes of the transaction, all or nothing");
+	context.outputConsoleWritter.printLine("  rollback            - Discards the changes of the transaction");
 	context.outputConsoleWritter.printLine("");
 
 	context.outputConsoleWritter.printLine("Catalog commands:");
 	context.outputConsoleWritter.printLine("  import <file name> - Adds a new table from file (fails if name exists)");
 	context.outputConsoleWritter.printLine("  showtables - Lists all loaded tables");
-	context.outputConsoleWritter.printLine("  describe <table name> - Displays column types of the specified table");
+	context.outputConsoleWritter.printLine("  describe <table name> - Displays column types and statistics of the specified table");
 	context.outputConsoleWritter.printLine("  print <table name> - Shows all table rows with paging (next/prev/exit)");
 	context.outputConsoleWritter.printLine("  export <table name> <file name> - Saves table to file");
-	context.outputConsoleWritter.printLine("  select <column-n> <value> <table> - Shows rows where <column-n> equals <value>");
+	context.outputConsoleWritter.printLine("  select <column-n> <value> <table> [columns <i,j,...>] [orderby <column-n> [asc|desc]] [limit <n>] [offset <m>]");
+	context.outputConsoleWritter.printLine("      - Shows rows where <column-n> equals <value>");
 	context.outputConsoleWritter.printLine("  addcolumn <table> <col name> <type> - Adds a new column with NULLs");
 	context.outputConsoleWritter.printLine("  update <table> <search-col> <search-val> <target-col> <target-val> - Updates values conditionally");
 	context.outputConsoleWritter.printLine("  delete <table> <column-n> <value> - Deletes rows matching value");
 	context.outputConsoleWritter.printLine("  insert <table> <val1> ... <valN> - Inserts a new row");
+	context.outputConsoleWritter.printLine("  bulkinsert <table> values <row1 vals> <row2 vals> ... | file <path> - Inserts many rows, all or nothing");
+	context.outputConsoleWritter.printLine("      a row file has one row per line, values separated by commas");
 	context.outputConsoleWritter.printLine("  innerjoin <table1> <col1> <table2> <col2> - Joins two tables by columns");
 	context.outputConsoleWritter.printLine("  rename <old> <new> - Renames a table (fails if <new> exists)");
 	context.outputConsoleWritter.printLine("  count <table> <column> <value> - Counts rows matching value");
 	context.outputConsoleWritter.printLine("  aggregate <table> <search-col> <val> <target-col> <op> - Applies sum/product/max/min");
+	context.outputConsoleWritter.printLine("  sort <table> <column-n> [asc|desc] [<new table>] - Sorts the table in memory or into a new table");
+	context.outputConsoleWritter.printLine("  query <statement> - Runs a SQL statement (see Queries below)");
+	context.outputConsoleWritter.printLine("  generate <table> <rows> <schema> [<file>] - Creates a table of synthetic data, or streams it to <file>");
+	context.outputConsoleWritter.printLine("      <schema> is <name>:<int|double|string>[:seq|uniform|zipf][:min=|max=|card=|len=|s=|null=]...,...");
+	context.outputConsoleWritter.printLine("");
+
+	context.outputConsoleWritter.printLine("Conditions:");
+	context.outputConsoleWritter.printLine("  In select, update, delete, count and aggregate the <column-n> <value> pair");
+	context.outputConsoleWritter.printLine("  may be replaced by where \"<expression>\", for example:");
+	context.outputConsoleWritter.printLine("      select where \"$0 >= 10 AND ($2 = 'New York' OR $3 IS NULL)\" Cities");
+	context.outputConsoleWritter.printLine("  Columns are written as $n. Supported: = != <> < <= > >=, [NOT] IN (a, b, ...),");
+	context.outputConsoleWritter.printLine("  IS [NOT] NULL, NOT, AND, OR and parentheses. NULL values never match a comparison.");
+	context.outputConsoleWritter.printLine("");
+
+	context.outputConsoleWritter.printLine("Queries:");
+	context.outputConsoleWritter.printLine("  SELECT <items> FROM <table> [[INNER] JOIN <table> ON <column> = <column>]");
+	context.outputConsoleWritter.printLine("      [WHERE <condition>] [GROUP BY <columns>] [ORDER BY <key> [ASC|DESC], ...]");
+	context.outputConsoleWritter.printLine("      [LIMIT <n>] [OFFSET <m>]");
+	context.outputConsoleWritter.printLine("  Items are *, columns (name, $n, table.name) and COUNT/SUM/AVG/MIN/MAX, each with");
+	context.outputConsoleWritter.printLine("  an optional AS <alias>. Strings are written in single quotes, for example:");
+	context.outputConsoleWritter.printLine("      query SELECT city, COUNT(*) AS n FROM People WHERE age >= 18 GROUP BY city ORDER BY n DESC");
 
 	context.outputConsoleWritter.printLine("");
 }
 
+/**
+ * @brief Locks nothing, the command does not access the catalog.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileHelpCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
 /**
  * @brief Creates a deep copy of the current `FileHelpCommand` object.
  *
@@ -0,0 +1,62 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileMetricsCommand
+ * @brief Command that prints the metrics collected since the program started.
+ *
+ * The metrics come from the `MetricsRegistry` of the context: p50/p99/p999
+ * latency, count and rate per command name, and the process-wide counters
+ * with their rates. Optionally the metrics are also exported to a file in
+ * Prometheus text format.
+ */
+class FileMetricsCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Used to access the metrics registry, the console and the file writer.
+     */
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs the FileMetricsCommand with a given context.
+     *
+     * @param context The shared command context which contains the metrics registry and I/O interfaces.
+     */
+    FileMetricsCommand(CommandContext& context);
+
+    /**
+     * @brief Prints the metrics and optionally writes them to a file.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "metrics" (command name)
+     * - `params[1]`: Optional path of a file to write the metrics to in Prometheus text format.
+     *
+     * @throws std::runtime_error If more than one argument is given.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares that the command uses neither the catalog nor any table.
+     *
+     * @param params The parameters of `execute`.
+     * @return An empty lock set.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
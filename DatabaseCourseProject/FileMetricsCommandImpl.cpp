@@ -0,0 +1,63 @@
+#include "FileMetricsCommand.hpp"
+#include "CommandContext.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Constructs the FileMetricsCommand with a reference to the command context.
+ *
+ * @param context The shared context used to access the metrics registry and I/O interfaces.
+ */
+FileMetricsCommand::FileMetricsCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Prints the metrics and optionally writes them to a file.
+ *
+ * The summary is printed first. If a path is given, the metrics are also
+ * written there in Prometheus text format, replacing the file.
+ *
+ * @param params `params[1]`, if present, is the path of the Prometheus export.
+ * @throws std::runtime_error If more than one argument is given.
+ */
+void FileMetricsCommand::execute(const std::vector<std::string>& params) {
+
+    if (params.size() > 2) {
+        throw std::runtime_error("Too many parameters! ");
+    }
+
+    for (const std::string& line : context.metrics.summary()) {
+        context.outputConsoleWritter.printLine(line);
+    }
+
+    if (params.size() == 2) {
+        try {
+            context.outputFileWritter.writeTextToFile(context.metrics.toPrometheus(), params[1]);
+            context.outputConsoleWritter.printLine("Metrics written to: " + params[1]);
+        }
+        catch (const std::exception& e) {
+            context.outputConsoleWritter.printLine(e.what());
+            context.metrics.recordError();
+        }
+    }
+}
+
+/**
+ * @brief Locks nothing, the command does not access the catalog.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileMetricsCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileMetricsCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileMetricsCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileMetricsCommand::clone(CommandContext& newContext) const {
+    return new FileMetricsCommand(newContext);
+}
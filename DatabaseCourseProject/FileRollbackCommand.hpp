@@ -0,0 +1,65 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileRollbackCommand
+ * @brief Command that discards the changes of the running transaction.
+ *
+ * The private tables of the transaction are dropped; the live tables were
+ * never modified, so nothing has to be copied or restored.
+ */
+class FileRollbackCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Holds the transaction of the session and the console.
+     */
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs the FileRollbackCommand with a given context.
+     *
+     * @param context The shared command context of the session.
+     */
+    FileRollbackCommand(CommandContext& context);
+
+    /**
+     * @brief Rolls the running transaction back.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "rollback" (command name)
+     *
+     * @throws std::runtime_error If no transaction is running.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares that the command uses neither the catalog nor any table.
+     *
+     * @param params The parameters of `execute`.
+     * @return An empty lock set.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+     * @brief Controls the transaction itself, so it runs on the live catalog.
+     * @return `false`.
+     */
+    bool runsInsideTransaction() const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
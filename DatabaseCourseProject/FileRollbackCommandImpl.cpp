@@ -0,0 +1,57 @@
+#include "FileRollbackCommand.hpp"
+#include "CommandContext.hpp"
+#include "Transaction.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Constructs the FileRollbackCommand with a reference to the command context.
+ *
+ * @param context The shared context of the session.
+ */
+FileRollbackCommand::FileRollbackCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Rolls the running transaction back by deleting it.
+ *
+ * @param params Unused besides the command name.
+ * @throws std::runtime_error If no transaction is running.
+ */
+void FileRollbackCommand::execute(const std::vector<std::string>& /*params*/) {
+    if (context.transaction == nullptr) {
+        throw std::runtime_error("No transaction is running. ");
+    }
+
+    delete context.transaction;
+    context.transaction = nullptr;
+    context.outputConsoleWritter.printLine("Transaction rolled back.");
+}
+
+/**
+ * @brief Locks nothing, the live tables are not touched.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileRollbackCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
+/**
+ * @brief Runs on the live catalog, also inside a transaction.
+ * @return `false`.
+ */
+bool FileRollbackCommand::runsInsideTransaction() const {
+    return false;
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileRollbackCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileRollbackCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileRollbackCommand::clone(CommandContext& newContext) const {
+    return new FileRollbackCommand(newContext);
+}
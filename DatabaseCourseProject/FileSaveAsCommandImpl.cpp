@@ -6,6 +6,7 @@
 #include <fstream>           
 #include <iostream>          
 #include <stdexcept>          
+#include <utility>
 
 
 /**
@@ -77,10 +78,11 @@ void FileSaveAsCommand::execute(const std::vector<std::string>& params) {
         try {
             Table newTable = table.cloneWithNewNameAndPath(newName, newTablePath);
             context.outputFileWritter.writeTableToFile(newTable, newTablePath);
-            newCatalog.addTable(newTable);
+            newCatalog.addTable(std::move(newTable));
         }
         catch (const std::exception& e) {
             context.outputConsoleWritter.printLine(e.what());
+            context.metrics.recordError();
         }
     }
 
@@ -90,6 +92,7 @@ void FileSaveAsCommand::execute(const std::vector<std::string>& params) {
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
 }
 
@@ -2,6 +2,8 @@
 #include "CommandContext.hpp" 
 #include "Table.hpp"        
 #include "Catalog.hpp"        
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
 #include <stdexcept>
 
 /**
@@ -49,12 +51,16 @@ void FileSaveCommand::execute(const std::vector<std::string>& params) {
         return;
     }
 
+    ProfilePhase io("file I/O");
+    Instrumentation::recordAccessPath("full rewrite of every table file and of the catalog file");
+
     for (auto& table : context.loadedCatalog) {
         try {
             context.outputFileWritter.writeTableToFile(table, table.getFilename());
         }
         catch (const std::exception& e) {
             context.outputConsoleWritter.printLine(e.what());
+            context.metrics.recordError();
         }
     }
 
@@ -66,7 +72,9 @@ void FileSaveCommand::execute(const std::vector<std::string>& params) {
     }
     catch (const std::exception& e) {
         context.outputConsoleWritter.printLine(e.what());
+        context.metrics.recordError();
     }
+    io.stop();
 
     context.outputConsoleWritter.printLine("Saved changes to same files.");
 }
@@ -0,0 +1,63 @@
+#pragma once
+#include "Command.hpp"
+#include "CommandContext.hpp"
+
+/**
+ * @class FileTraceCommand
+ * @brief Command that switches tracing on and off and exports the recorded spans.
+ *
+ * `trace start` starts a new trace, `trace stop <file>` stops it and writes
+ * the spans in Chrome trace-event format (see `TraceRecorder`), and
+ * `trace status` reports whether a trace is running.
+ */
+class FileTraceCommand : public Command {
+private:
+    /**
+     * @brief Reference to the shared command execution context.
+     *
+     * Used to access the console and the file writer.
+     */
+    CommandContext& context;
+
+public:
+    /**
+     * @brief Constructs the FileTraceCommand with a given context.
+     *
+     * @param context The shared command context which contains the I/O interfaces.
+     */
+    FileTraceCommand(CommandContext& context);
+
+    /**
+     * @brief Starts, stops or reports the trace.
+     *
+     * @param params Expected format:
+     * - `params[0]`: "trace" (command name)
+     * - `params[1]`: `start`, `stop` or `status`.
+     * - `params[2]`: For `stop`, the path of the Chrome trace file.
+     *
+     * @throws std::runtime_error If the action is unknown or its parameters are missing.
+     * @throws std::runtime_error If `start` is given while a trace is running, or `stop` while none is.
+     */
+    void execute(const std::vector<std::string>& params) override;
+
+    /**
+     * @brief Declares that the command uses neither the catalog nor any table.
+     *
+     * @param params The parameters of `execute`.
+     * @return An empty lock set.
+     */
+    LockSet requiredLocks(const std::vector<std::string>& params) const override;
+
+    /**
+    * @brief Creates a deep copy of the current object.
+    *
+    * This override implements the polymorphic cloning behavior defined in `Command`.
+    * It constructs a new instance, associating it
+    * with the provided `newContext`.
+    *
+    * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+    * @return A pointer to a newly allocated object, which is a deep copy of this instance.
+    */
+    Command* clone(CommandContext& newContext) const override;
+
+};
@@ -0,0 +1,76 @@
+#include "FileTraceCommand.hpp"
+#include "CommandContext.hpp"
+#include "TraceRecorder.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Constructs the FileTraceCommand with a reference to the command context.
+ *
+ * @param context The shared context used to access the I/O interfaces.
+ */
+FileTraceCommand::FileTraceCommand(CommandContext& context)
+    : context(context) {
+}
+
+/**
+ * @brief Starts, stops or reports the trace.
+ *
+ * `stop` only switches tracing off once the file was written, so a failed
+ * export can be retried with another path without losing the trace.
+ *
+ * @param params `params[1]` is the action, `params[2]` the trace file for `stop`.
+ * @throws std::runtime_error If the action is unknown or its parameters are missing.
+ */
+void FileTraceCommand::execute(const std::vector<std::string>& params) {
+
+    if (params.size() < 2) {
+        throw std::runtime_error("Not enough parameters! ");
+    }
+
+    const std::string& action = params[1];
+
+    if (action == "start") {
+        if (TraceRecorder::isEnabled()) {
+            throw std::runtime_error("A trace is already running. ");
+        }
+        TraceRecorder::enable();
+        context.outputConsoleWritter.printLine("Tracing started.");
+    }
+    else if (action == "stop") {
+        if (params.size() < 3) {
+            throw std::runtime_error("Not enough parameters! ");
+        }
+        if (!TraceRecorder::isEnabled()) {
+            throw std::runtime_error("No trace is running. ");
+        }
+        context.outputFileWritter.writeTextToFile(TraceRecorder::toChromeJson(), params[2]);
+        TraceRecorder::disable();
+        context.outputConsoleWritter.printLine("Trace written to: " + params[2]);
+    }
+    else if (action == "status") {
+        context.outputConsoleWritter.printLine(TraceRecorder::isEnabled() ? "Tracing is on." : "Tracing is off.");
+    }
+    else {
+        throw std::runtime_error("Unknown trace action: " + action + ". Use start, stop or status. ");
+    }
+}
+
+/**
+ * @brief Locks nothing, the command does not access the catalog.
+ * @param params The parameters of `execute`. Unused.
+ * @return An empty lock set.
+ */
+LockSet FileTraceCommand::requiredLocks(const std::vector<std::string>& /*params*/) const {
+    return LockSet();
+}
+
+/**
+ * @brief Creates a deep copy of the current `FileTraceCommand` object.
+ *
+ * @param newContext A reference to the `CommandContext` that the new cloned command should use.
+ * @return A pointer to a newly allocated `FileTraceCommand` object.
+ * @warning The caller is responsible for deleteing the returned pointer.
+ */
+Command* FileTraceCommand::clone(CommandContext& newContext) const {
+    return new FileTraceCommand(newContext);
+}
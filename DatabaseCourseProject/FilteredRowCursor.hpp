@@ -0,0 +1,38 @@
+#pragma once
+#include <vector>
+#include "TableRowCursor.hpp"
+#include "Expression.hpp"
+#include "SelectionBitmap.hpp"
+
+/**
+ * @class FilteredRowCursor
+ * @brief A `TableRowCursor` that only yields the rows satisfying an expression.
+ *
+ * This is the cursor behind the `select` command. Each batch of the scan is
+ * evaluated by the expression into a `SelectionBitmap`, whose set bits become
+ * the selection vector of the batch.
+ */
+class FilteredRowCursor : public TableRowCursor {
+private:
+    const Expression& condition;    ///< The bound filter expression. Not owned.
+    mutable SelectionBitmap bitmap; ///< Scratch bitmap reused for every batch.
+
+protected:
+    /**
+     * @brief Appends the ids of the rows in [begin, end) that satisfy the condition.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param selection The selection vector to append to.
+     * @return `end - begin`, or 0 if the zone maps ruled the batch out.
+     */
+    int selectBatch(int begin, int end, std::vector<int>& selection) const override;
+
+public:
+    /**
+     * @brief Creates a cursor over the rows of `table` that satisfy `condition`.
+     *
+     * @param table The table to scan.
+     * @param condition An expression already bound to `table`. It must outlive the cursor.
+     */
+    FilteredRowCursor(const Table& table, const Expression& condition);
+};
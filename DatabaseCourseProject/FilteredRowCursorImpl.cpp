@@ -0,0 +1,41 @@
+#include "FilteredRowCursor.hpp"
+#include "Instrumentation.hpp"
+
+/**
+ * @brief Creates a cursor over the rows of `table` that satisfy `condition`.
+ *
+ * When the column statistics prove that the condition matches no row, the
+ * cursor starts at the end of the table and the scan is skipped.
+ *
+ * @param table The table to scan.
+ * @param condition An expression already bound to `table`. It must outlive the cursor.
+ */
+FilteredRowCursor::FilteredRowCursor(const Table& table, const Expression& condition)
+    : TableRowCursor(table), condition(condition) {
+    if (condition.isProvablyEmpty()) {
+        Instrumentation::recordAccessPath("scan skipped, statistics prove " + condition.toString() + " matches no row");
+        seek(table.getNumberOfRows());
+    }
+    else {
+        Instrumentation::recordAccessPath("lazy filtered scan of table " + table.getName() + ": " + condition.toString());
+    }
+}
+
+/**
+ * @brief Appends the ids of the rows in [begin, end) that satisfy the condition.
+ *
+ * A batch ruled out by the zone maps of the condition is not evaluated.
+ *
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param selection The selection vector to append to.
+ * @return `end - begin`, or 0 if the batch was skipped.
+ */
+int FilteredRowCursor::selectBatch(int begin, int end, std::vector<int>& selection) const {
+    if (condition.isProvablyEmptyIn(begin, end)) {
+        return 0;
+    }
+    condition.evaluate(begin, end, bitmap);
+    bitmap.appendSetRows(begin, selection);
+    return end - begin;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class FormattedCells
+ * @brief The text of a run of cells of one column, as written to a table file.
+ *
+ * All cells share one buffer and are separated by their end offsets, so
+ * formatting a block of a column allocates no string per cell. A NULL cell
+ * is an empty cell. Writers fill one `FormattedCells` per column with
+ * `TableColumn::appendValues` and then join them row by row with `appendRow`.
+ */
+class FormattedCells {
+private:
+    std::string text;         ///< The text of all cells, back to back.
+    std::vector<size_t> ends; ///< The end offset of every cell in `text`.
+
+public:
+    /// Number of rows writers format per block, bounding the memory of a block.
+    static const int BLOCK_ROWS = 4096;
+
+    /**
+     * @brief Removes all cells, keeping the allocated memory.
+     */
+    void clear() {
+        text.clear();
+        ends.clear();
+    }
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The number of cells.
+     */
+    size_t size() const {
+        return ends.size();
+    }
+
+    /**
+     * @brief Returns the buffer the text of the next cell is appended to; `endCell` completes the cell.
+     * @return The text buffer.
+     */
+    std::string& buffer() {
+        return text;
+    }
+
+    /**
+     * @brief Completes the cell whose text was appended to `buffer()` since the previous cell.
+     */
+    void endCell() {
+        ends.push_back(text.size());
+    }
+
+    /**
+     * @brief Adds a cell that is already formatted.
+     * @param cell The text of the cell; empty for NULL.
+     */
+    void add(const std::string& cell) {
+        text += cell;
+        endCell();
+    }
+
+    /**
+     * @brief Appends the text of a cell to `out`.
+     * @param index The 0-indexed cell.
+     * @param out The string to append to.
+     */
+    void appendCellTo(size_t index, std::string& out) const {
+        size_t begin = index == 0 ? 0 : ends[index - 1];
+        out.append(text, begin, ends[index] - begin);
+    }
+
+    /**
+     * @brief Appends one row in file format, the cells of all columns separated by commas, without a line break.
+     * @param columns The cells of every column; all hold at least `row + 1` cells.
+     * @param row The 0-indexed row within the block.
+     * @param out The string to append to.
+     */
+    static void appendRow(const std::vector<FormattedCells>& columns, size_t row, std::string& out) {
+        for (size_t j = 0; j < columns.size(); ++j) {
+            if (j > 0) {
+                out += ',';
+            }
+            columns[j].appendCellTo(row, out);
+        }
+    }
+};
@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "QueryOperator.hpp"
+#include "TableScan.hpp"
+
+/**
+ * @class HashJoinOperator
+ * @brief Streaming operator implementing an inner equi-join.
+ *
+ * On `open()` the build side (the table with fewer estimated rows, with its
+ * own pushed-down filter) is scanned once into a hash table keyed by the
+ * normalized join value. Each probe row arriving through `consume()` is then
+ * matched in O(1) and every combination is pushed downstream. Joined rows
+ * always list the FROM table's columns first, whichever side was built.
+ * NULL keys never match.
+ */
+class HashJoinOperator : public QueryOperator {
+private:
+    /**
+     * @brief Sink that inserts the rows of the build side into the hash table.
+     */
+    class BuildSink : public QueryOperator {
+    private:
+        HashJoinOperator& join; ///< The join being built.
+
+    public:
+        /**
+         * @brief Creates the sink for `join`.
+         * @param join The join whose hash table is filled.
+         */
+        explicit BuildSink(HashJoinOperator& join);
+
+        /**
+         * @brief Inserts a build row.
+         * @param row The row.
+         * @return Always `true`.
+         */
+        bool consume(const QueryRow& row) override;
+    };
+
+    TableScan* buildSide;  ///< Scan of the build table. Owned.
+    int buildColumn;       ///< Position of the join key in build rows.
+    int probeColumn;       ///< Position of the join key in probe rows.
+    bool numericKeys;      ///< Whether the keys are compared as numbers.
+    bool buildFirst;       ///< Whether build rows come before probe rows in the joined rows.
+    std::unordered_map<std::string, std::vector<QueryRow>> buckets; ///< Build rows by normalized key.
+    QueryRow output;       ///< Buffer reused for every joined row.
+
+public:
+    /**
+     * @brief Constructs the join.
+     * @param buildSide The scan of the build table. Ownership is transferred.
+     * @param buildColumn Position of the join key in build rows.
+     * @param probeColumn Position of the join key in probe rows.
+     * @param numericKeys Whether the keys are compared as numbers.
+     * @param buildFirst Whether build rows come before probe rows in the joined rows.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    HashJoinOperator(TableScan* buildSide, int buildColumn, int probeColumn, bool numericKeys, bool buildFirst, QueryOperator* next);
+
+    /**
+     * @brief Deletes the build scan and the downstream chain.
+     */
+    ~HashJoinOperator() override;
+
+    /**
+     * @brief Builds the hash table from the build side, then forwards `open()`.
+     * @throws std::runtime_error If a numeric key holds a non-numeric value.
+     */
+    void open() override;
+
+    /**
+     * @brief Pushes the combination of a probe row with every matching build row.
+     * @param row The probe row.
+     * @return `false` once the downstream operator stopped.
+     */
+    bool consume(const QueryRow& row) override;
+
+    /**
+     * @brief Releases the hash table and forwards `finish()`.
+     */
+    void finish() override;
+};
@@ -0,0 +1,92 @@
+#include "HashJoinOperator.hpp"
+#include "QueryValueUtils.hpp"
+#include "TraceSpan.hpp"
+
+/**
+ * @brief Creates the sink for `join`. It has no downstream operator.
+ * @param join The join whose hash table is filled.
+ */
+HashJoinOperator::BuildSink::BuildSink(HashJoinOperator& join)
+    : QueryOperator(nullptr), join(join) {
+}
+
+/**
+ * @brief Inserts a build row under its normalized key. Rows with a NULL key are dropped.
+ * @param row The row.
+ * @return Always `true`.
+ */
+bool HashJoinOperator::BuildSink::consume(const QueryRow& row) {
+    const std::string& value = row[join.buildColumn];
+    if (!value.empty()) {
+        join.buckets[QueryValueUtils::normalizeKey(value, join.numericKeys)].push_back(row);
+    }
+    return true;
+}
+
+/**
+ * @brief Constructs the join.
+ * @param buildSide The scan of the build table. Ownership is transferred.
+ * @param buildColumn Position of the join key in build rows.
+ * @param probeColumn Position of the join key in probe rows.
+ * @param numericKeys Whether the keys are compared as numbers.
+ * @param buildFirst Whether build rows come before probe rows in the joined rows.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+HashJoinOperator::HashJoinOperator(TableScan* buildSide, int buildColumn, int probeColumn, bool numericKeys, bool buildFirst, QueryOperator* next)
+    : QueryOperator(next), buildSide(buildSide), buildColumn(buildColumn), probeColumn(probeColumn), numericKeys(numericKeys), buildFirst(buildFirst) {
+}
+
+/**
+ * @brief Deletes the build scan; the base class deletes the downstream chain.
+ */
+HashJoinOperator::~HashJoinOperator() {
+    delete buildSide;
+}
+
+/**
+ * @brief Builds the hash table from the build side, then forwards `open()`.
+ */
+void HashJoinOperator::open() {
+    buckets.clear();
+    {
+        TraceSpan span("join build");
+        BuildSink sink(*this);
+        buildSide->run(sink);
+    }
+
+    QueryOperator::open();
+}
+
+/**
+ * @brief Pushes the combination of a probe row with every matching build row.
+ * @param row The probe row.
+ * @return `false` once the downstream operator stopped.
+ */
+bool HashJoinOperator::consume(const QueryRow& row) {
+    const std::string& value = row[probeColumn];
+    if (value.empty()) {
+        return true;
+    }
+
+    auto found = buckets.find(QueryValueUtils::normalizeKey(value, numericKeys));
+    if (found == buckets.end()) {
+        return true;
+    }
+
+    for (const QueryRow& match : found->second) {
+        output = buildFirst ? match : row;
+        output.insert(output.end(), buildFirst ? row.begin() : match.begin(), buildFirst ? row.end() : match.end());
+        if (!next->consume(output)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Releases the hash table and forwards `finish()`.
+ */
+void HashJoinOperator::finish() {
+    buckets.clear();
+    QueryOperator::finish();
+}
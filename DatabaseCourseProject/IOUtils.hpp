@@ -3,6 +3,7 @@
 #include <string>
 #include "OutputConsoleWritter.hpp"
 #include "InputConsoleReader.hpp"
+#include "RowCursor.hpp"
 
 /**
  * @class IOUtils
@@ -15,19 +16,40 @@
 class IOUtils {
 public:
     /**
-    * @brief Prints a vector of strings to the console in a paginated format.
+    * @brief Prints a vector of records to the console in a paginated format.
     *
     * This method displays the provided `rows` data page by page. It pauses after each page,
     * prompting the user to enter commands like "next", "prev", or "exit" to navigate
     * through the pages. The page size is fixed at 10 rows.
     *
     * @param rows A `std::vector<std::string>` containing the data rows to be displayed.
-    * Each string in the vector is treated as a single line of output.
+    * Each string is one row in the record format (see `RecordFormat`); it is shown
+    * like `Table::getRowAsString` by the pager.
     * @param ocw A constant reference to an `OutputConsoleWritter` object, used for printing messages.
     * @param icr A constant reference to an `InputConsoleReader` object, used for reading user commands.
     */
     static void printInPageFormat(
-        std::vector<std::string> rows,
+        const std::vector<std::string>& rows,
         const OutputConsoleWritter& ocw,
         const InputConsoleReader& icr);
-};
\ No newline at end of file
+
+    /**
+    * @brief Prints the rows produced by a cursor to the console in a paginated format.
+    *
+    * Rows are pulled from `cursor` one page at a time and only the rows of the
+    * displayed page are formatted, so the first page appears without scanning the
+    * whole result and memory stays proportional to the page size. Navigation works
+    * like the vector overload ("next", "prev", "exit"). Because the total number of
+    * rows is unknown until the cursor is exhausted, the page count is only shown
+    * once the last page has been reached. If `icr` is not interactive, all rows
+    * are printed at once in the record format instead.
+    *
+    * @param cursor The cursor supplying the rows. It is left at an unspecified position.
+    * @param ocw A constant reference to an `OutputConsoleWritter` object, used for printing messages.
+    * @param icr A constant reference to an `InputConsoleReader` object, used for reading user commands.
+    */
+    static void printInPageFormat(
+        RowCursor& cursor,
+        const OutputConsoleWritter& ocw,
+        const InputConsoleReader& icr);
+};
@@ -1,31 +1,112 @@
 #include "IOUtils.hpp"
+#include "Instrumentation.hpp"
+#include "RecordFormat.hpp"
+
+namespace {
+    /**
+     * @brief A `RowCursor` over rows that are already formatted as records.
+     *
+     * Lets the vector overload of `IOUtils::printInPageFormat` share the cursor-based pager.
+     */
+    class RecordRowCursor : public RowCursor {
+    private:
+        const std::vector<std::string>& rows;
+        int current;
+    public:
+        explicit RecordRowCursor(const std::vector<std::string>& rows)
+            : rows(rows), current(0) {
+        }
+
+        bool next(int& rowId) override {
+            if (current >= static_cast<int>(rows.size())) {
+                return false;
+            }
+            rowId = current++;
+            return true;
+        }
+
+        int position() const override {
+            return current;
+        }
+
+        void seek(int position) override {
+            current = position;
+        }
+
+        std::string formatRow(int rowId) const override {
+            return RecordFormat::toDisplayRow(rows[rowId]);
+        }
+
+        std::string formatRecord(int rowId) const override {
+            return rows[rowId];
+        }
+    };
+}
 
 /**
- * @brief Prints a vector of strings to the console in a paginated format.
+ * @brief Prints a vector of records to the console in a paginated format.
  *
- * This function iterates through the `rows` data, displaying them in chunks
- * defined by `pageSize`. It then prompts the user for navigation commands
- * ("next", "prev", "exit") using the provided `InputConsoleReader` and
- * prints output using the `OutputConsoleWritter`.
+ * The rows are wrapped in a cursor and handed to the cursor-based overload,
+ * so both overloads behave identically.
  *
- * @param rows The data rows to display.
+ * @param rows The data rows to display, as records (see `RecordFormat`).
  * @param ocw An `OutputConsoleWritter` instance for output.
  * @param icr An `InputConsoleReader` instance for input.
  */
 void IOUtils::printInPageFormat(
-    std::vector<std::string> rows,
+    const std::vector<std::string>& rows,
     const OutputConsoleWritter& ocw,
     const InputConsoleReader& icr) {
 
-    const size_t pageSize = 10;
-    size_t currentPage = 0;
-    size_t totalPages = (rows.size() + pageSize - 1) / pageSize;
+    RecordRowCursor cursor(rows);
+    printInPageFormat(cursor, ocw, icr);
+}
+
+/**
+ * @brief Prints the rows produced by a cursor to the console in a paginated format.
+ *
+ * The pager remembers only the cursor position at the start of every page it
+ * has visited. To display a page it seeks to that position, pulls up to
+ * `pageSize` row ids and formats just those rows. One extra row is pulled
+ * afterwards to find out whether another page exists; once it does not, the
+ * total page count is known and shown as well.
+ *
+ * When nobody can answer the prompt (`icr.isInteractive()` is `false`), all
+ * rows are printed at once as records (see `RecordFormat`), without page
+ * headers, prompts or a message for an empty result, so the output can be
+ * consumed by another program.
+ *
+ * @param cursor The cursor supplying the rows.
+ * @param ocw An `OutputConsoleWritter` instance for output.
+ * @param icr An `InputConsoleReader` instance for input.
+ */
+void IOUtils::printInPageFormat(
+    RowCursor& cursor,
+    const OutputConsoleWritter& ocw,
+    const InputConsoleReader& icr) {
 
-    if (rows.empty()) {
-        ocw.printLine("No rows to display.");
+    if (!icr.isInteractive()) {
+        long long printed = 0;
+        int rowId;
+        while (cursor.next(rowId)) {
+            ocw.printLine(cursor.formatRecord(rowId));
+            ++printed;
+        }
+        Instrumentation::recordRowsReturned(printed);
         return;
     }
 
+    const size_t pageSize = 10;
+    size_t currentPage = 0;
+
+    std::vector<int> pageStarts;
+    pageStarts.push_back(cursor.position());
+
+    bool lastPageKnown = false;
+
+    std::vector<int> page;
+    page.reserve(pageSize);
+
     std::string command;
 
 	bool validCommand = true;
@@ -33,15 +114,39 @@ void IOUtils::printInPageFormat(
     while (true) {
         if (validCommand) {
 
-            int start = currentPage * pageSize;
-            int end = std::min(start + pageSize, rows.size());
+            cursor.seek(pageStarts[currentPage]);
+            page.clear();
+
+            int rowId;
+            while (page.size() < pageSize && cursor.next(rowId)) {
+                page.push_back(rowId);
+            }
+
+            if (page.empty() && currentPage == 0) {
+                ocw.printLine("No rows to display.");
+                return;
+            }
+
+            int nextPageStart = cursor.position();
+            if (cursor.next(rowId)) {
+                if (pageStarts.size() == currentPage + 1) {
+                    pageStarts.push_back(nextPageStart);
+                }
+            }
+            else {
+                lastPageKnown = true;
+            }
 
-            for (int i = start; i < end; ++i) {
-                ocw.printLine(rows[i]);
+            for (int id : page) {
+                ocw.printLine(cursor.formatRow(id));
             }
+            Instrumentation::recordRowsReturned(static_cast<long long>(page.size()));
 
-            ocw.printLine("Page " + std::to_string(currentPage + 1) + " of "
-                + std::to_string(totalPages));
+            std::string pageInfo = "Page " + std::to_string(currentPage + 1);
+            if (lastPageKnown) {
+                pageInfo += " of " + std::to_string(pageStarts.size());
+            }
+            ocw.printLine(pageInfo);
 
             ocw.printLine("\nCommands: next, prev, exit\n");
         }
@@ -49,7 +154,7 @@ void IOUtils::printInPageFormat(
         command = icr.readLineAsString();
 
         if (command == "next") {
-            if (currentPage + 1 < totalPages) {
+            if (currentPage + 1 < pageStarts.size()) {
                 ++currentPage;
                 validCommand = true;
             }
@@ -77,4 +182,4 @@ void IOUtils::printInPageFormat(
             validCommand = false;
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "ColumnExpression.hpp"
+
+/**
+ * @class InExpression
+ * @brief Leaf testing whether a column value is one of a list of literals: `$n IN (a, b, c)`.
+ *
+ * During `bind()` numeric literals are converted and sorted for binary search;
+ * string literals are put into a hash set. NULL cells never match.
+ */
+class InExpression : public ColumnExpression {
+private:
+    std::vector<std::string> literals;          ///< The literals as written in the expression.
+    std::vector<double> numericValues;          ///< Sorted numeric literals, filled by `bind()`.
+    std::unordered_set<std::string> textValues; ///< String literals, filled by `bind()`.
+
+public:
+    /**
+     * @brief Creates the test `$columnIndex IN (literals...)`.
+     * @param columnIndex The 0-indexed position of the tested column.
+     * @param literals The accepted values.
+     */
+    InExpression(int columnIndex, const std::vector<std::string>& literals);
+
+    /**
+     * @brief Resolves the column and converts the literals to its type.
+     * @param table The table the expression will be evaluated on.
+     * @throws std::runtime_error If the column index is invalid or a literal is not a number for a numeric column.
+     */
+    void bind(const Table& table) override;
+
+    /**
+     * @brief Tests the cells of [begin, end) for membership in the list.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch.
+     */
+    void evaluate(int begin, int end, SelectionBitmap& result) const override;
+
+    /**
+     * @brief Returns the test as text, e.g. `$2 IN ('a', 'b')`.
+     * @return The expression as text.
+     */
+    std::string toString() const override;
+
+    /**
+     * @brief Estimates the selectivity as the sum of the equality estimates of the literals.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity() const override;
+
+    /**
+     * @brief Checks whether every literal lies outside the bounds of the column.
+     * @return `true` if no row can match.
+     */
+    bool isProvablyEmpty() const override;
+
+    /**
+     * @brief Checks whether every literal lies outside the zone maps of a numeric column over [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `true` if no row of the batch can match; always `false` for String columns.
+     */
+    bool isProvablyEmptyIn(int begin, int end) const override;
+};
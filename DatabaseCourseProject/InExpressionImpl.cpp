@@ -0,0 +1,141 @@
+#include "InExpression.hpp"
+#include "IntegerColumn.hpp"
+#include "DoubleColumn.hpp"
+#include "StringColumn.hpp"
+#include <algorithm>
+
+/**
+ * @brief Creates the test `$columnIndex IN (literals...)`.
+ * @param columnIndex The 0-indexed position of the tested column.
+ * @param literals The accepted values.
+ */
+InExpression::InExpression(int columnIndex, const std::vector<std::string>& literals)
+    : ColumnExpression(columnIndex), literals(literals) {
+}
+
+/**
+ * @brief Resolves the column and converts the literals to its type.
+ * @param table The table the expression will be evaluated on.
+ * @throws std::runtime_error If the column index is invalid or a literal is not a number for a numeric column.
+ */
+void InExpression::bind(const Table& table) {
+    ColumnExpression::bind(table);
+
+    numericValues.clear();
+    textValues.clear();
+
+    if (column->getType() == ColumnType::STRING) {
+        textValues.insert(literals.begin(), literals.end());
+        return;
+    }
+
+    for (const std::string& literal : literals) {
+        numericValues.push_back(parseNumericLiteral(literal));
+    }
+    std::sort(numericValues.begin(), numericValues.end());
+}
+
+/**
+ * @brief Tests the cells of [begin, end) for membership in the list.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch.
+ */
+void InExpression::evaluate(int begin, int end, SelectionBitmap& result) const {
+    const std::vector<double>& numbers = numericValues;
+
+    switch (column->getType()) {
+    case ColumnType::INTEGER: {
+        const IntegerColumn* integers = static_cast<const IntegerColumn*>(column);
+        scanColumn(integers->getSegments(), begin, end, [&numbers](int cell) {
+            return std::binary_search(numbers.begin(), numbers.end(), static_cast<double>(cell));
+        }, result);
+        break;
+    }
+    case ColumnType::DOUBLE: {
+        const DoubleColumn* doubles = static_cast<const DoubleColumn*>(column);
+        scanColumn(doubles->getSegments(), begin, end, [&numbers](double cell) {
+            return std::binary_search(numbers.begin(), numbers.end(), cell);
+        }, result);
+        break;
+    }
+    case ColumnType::STRING: {
+        const StringColumn* strings = static_cast<const StringColumn*>(column);
+        const std::unordered_set<std::string>& texts = textValues;
+        scanColumn(strings->getSegments(), begin, end, [&texts](const std::string& cell) {
+            return texts.count(cell) != 0;
+        }, result);
+        break;
+    }
+    }
+}
+
+/**
+ * @brief Returns the test as text, e.g. `$2 IN ('a', 'b')`.
+ * @return The expression as text.
+ */
+std::string InExpression::toString() const {
+    std::string text = "$" + std::to_string(columnIndex) + " IN (";
+    for (size_t i = 0; i < literals.size(); ++i) {
+        text += (i > 0 ? ", '" : "'") + literals[i] + "'";
+    }
+    return text + ")";
+}
+
+/**
+ * @brief Estimates the selectivity as the sum of the equality estimates of the literals.
+ * @return A fraction in [0, 1].
+ */
+double InExpression::estimateSelectivity() const {
+    if (column == nullptr) {
+        return 1.0;
+    }
+
+    const ColumnStatistics& statistics = column->getStatistics();
+    double total = 0.0;
+    for (const std::string& value : literals) {
+        total += statistics.estimateSelectivity(ComparisonOperator::EQUAL, value);
+    }
+    return std::min(1.0, total);
+}
+
+/**
+ * @brief Checks whether every literal lies outside the bounds of the column.
+ * @return `true` if no row can match.
+ */
+bool InExpression::isProvablyEmpty() const {
+    if (column == nullptr) {
+        return false;
+    }
+
+    const ColumnStatistics& statistics = column->getStatistics();
+    for (const std::string& value : literals) {
+        if (!statistics.excludes(ComparisonOperator::EQUAL, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks whether every literal lies outside the zone maps of a numeric column over [begin, end).
+ *
+ * The literals are sorted, so a binary search finds the smallest one not
+ * below the minimum of the batch; the batch is skipped if it exceeds the maximum.
+ *
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @return `true` if no row of the batch can match.
+ */
+bool InExpression::isProvablyEmptyIn(int begin, int end) const {
+    ColumnSegments<double>::Zone zone;
+    if (!summarizeZones(begin, end, zone)) {
+        return false;
+    }
+    if (zone.allNull()) {
+        return true;
+    }
+
+    std::vector<double>::const_iterator candidate = std::lower_bound(numericValues.begin(), numericValues.end(), zone.min);
+    return candidate == numericValues.end() || zone.max < *candidate;
+}
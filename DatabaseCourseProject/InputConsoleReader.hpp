@@ -11,9 +11,13 @@
  * This class provides utility methods to read lines of text from standard
  * input (`std::cin`), either as a single string or parsed into a vector of strings
  * based on whitespace or a specified delimiter. It's designed to abstract
- * the console input mechanism.
+ * the console input mechanism: the reading methods are virtual, so that the
+ * sessions of the server read their commands from a socket instead (see `InputSocketReader`).
  */
 class InputConsoleReader {
+private:
+	bool interactive; ///< Whether a user answers prompts; `false` while commands run unattended, e.g. during a replay.
+
 public:
 
 	/**
@@ -29,7 +33,7 @@ public:
 	* Cleans up any resources held by the reader. As this class currently
 	* doesn't manage dynamic memory, the default destructor is sufficient.
 	*/
-	~InputConsoleReader();
+	virtual ~InputConsoleReader();
 
 	/**
 	* @brief Reads a line of input from the console and parses it into words.
@@ -40,7 +44,7 @@ public:
 	*
 	* @return A `std::vector<std::string>` containing the words from the input line.
 	*/
-	std::vector<std::string> readLine() const;
+	virtual std::vector<std::string> readLine() const;
 
 	/**
 	* @brief Reads an entire line of input from the console as a single string.
@@ -50,5 +54,32 @@ public:
 	*
 	* @return A `std::string` containing the entire line of input.
 	*/
-	std::string readLineAsString() const;
+	virtual std::string readLineAsString() const;
+
+	/**
+	* @brief Reads the next line of input, reporting the end of the input.
+	*
+	* Unlike `readLineAsString`, an empty line can be told apart from the end of
+	* the input, which is what a script read from standard input needs.
+	*
+	* @param line Receives the line without its line break.
+	* @return `false` if the input is exhausted and no line was read.
+	*/
+	virtual bool readNextLine(std::string& line) const;
+
+	/**
+	* @brief Switches between interactive and unattended input.
+	*
+	* While the reader is not interactive, code that would prompt the user
+	* (e.g. the pager of `IOUtils::printInPageFormat`) must not read from it.
+	*
+	* @param interactive `true` if a user answers prompts.
+	*/
+	void setInteractive(bool interactive);
+
+	/**
+	* @brief Checks whether a user answers prompts.
+	* @return `true` by default; `false` while commands run unattended.
+	*/
+	bool isInteractive() const;
 };
\ No newline at end of file
@@ -7,10 +7,10 @@
 /**
  * @brief Constructs a new `InputConsoleReader` instance.
  *
- * This constructor performs no specific initialization beyond default-constructing
- * member variables (of which there are none in this class).
+ * The reader starts interactive.
  */
-InputConsoleReader::InputConsoleReader() {
+InputConsoleReader::InputConsoleReader()
+	: interactive(true) {
 
 }
 
@@ -54,4 +54,37 @@ std::string InputConsoleReader::readLineAsString() const {
 	std::string input;
 	std::getline(std::cin, input);
 	return input;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Reads the next line of input, reporting the end of the input.
+ *
+ * A trailing carriage return is removed, so scripts with Windows line endings can be piped in.
+ *
+ * @param line Receives the line without its line break.
+ * @return `false` if the input is exhausted and no line was read.
+ */
+bool InputConsoleReader::readNextLine(std::string& line) const {
+	if (!std::getline(std::cin, line)) {
+		return false;
+	}
+	if (!line.empty() && line.back() == '\r') {
+		line.pop_back();
+	}
+	return true;
+}
+/**
+ * @brief Switches between interactive and unattended input.
+ * @param interactive `true` if a user answers prompts.
+ */
+void InputConsoleReader::setInteractive(bool interactive) {
+	this->interactive = interactive;
+}
+
+/**
+ * @brief Checks whether a user answers prompts.
+ * @return `true` if a user answers prompts.
+ */
+bool InputConsoleReader::isInteractive() const {
+	return interactive;
+}
@@ -9,6 +9,8 @@
 #include "CommandParser.hpp" 
 #include "Catalog.hpp"   
 #include "OutputConsoleWritter.hpp"
+#include "WorkloadEntry.hpp"
+#include "TableAppender.hpp"
 
 /**
  * @class InputFileReader
@@ -69,4 +71,41 @@ public:
      * in the catalog file has an invalid format.
      */
     Catalog readCatalogFromFile(const std::string& filepath);
+
+    /**
+     * @brief Reads a workload captured by `WorkloadRecorder`.
+     *
+     * Every non-empty line that does not start with `#` must have the form
+     * `<offset in microseconds>\t<session>\t<command line>`. Lines of version 1
+     * captures have no session field and belong to session 0.
+     *
+     * @param filepath The full path to the workload file.
+     * @return The entries in file order.
+     * @throws std::runtime_error If the file cannot be opened or a line is malformed.
+     */
+    std::vector<WorkloadEntry> readWorkloadFromFile(const std::string& filepath);
+
+    /**
+     * @brief Reads a text file line by line, e.g. a batch script.
+     *
+     * @param filepath The full path to the file.
+     * @return The lines in file order, without line breaks.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    std::vector<std::string> readLinesFromFile(const std::string& filepath);
+
+    /**
+     * @brief Stages the rows of a row file in a `TableAppender`.
+     *
+     * A row file contains one row per line with the values separated by
+     * commas, like the rows of a table file but without its three header lines.
+     * Empty lines are skipped. The rows are only staged; the caller commits them.
+     *
+     * @param filepath The full path to the row file.
+     * @param appender The appender the rows are staged in.
+     * @return The number of rows read.
+     * @throws std::runtime_error If the file cannot be opened or a row does not fit the table.
+     * The message names the offending line.
+     */
+    int readRowsFromFile(const std::string& filepath, TableAppender& appender);
 };
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include "ColumnFactory.hpp"
 #include <stdexcept>
 #include "ColumnType.hpp"
+#include "Instrumentation.hpp"
+#include "TraceSpan.hpp"
 
 
 /**
@@ -40,6 +42,8 @@ InputFileReader::~InputFileReader() {
  * This function parses a `.db` file line by line to reconstruct a `Table`.
  * It reads the table name, column types, column names, and then iterates
  * through subsequent lines to add rows of data to the respective columns.
+ * The statistics of the columns are completed once all rows are read, so
+ * the first read of the table does not have to build them.
  * It uses `ColumnFactory` to create column instances and `CommandParser` to tokenize lines.
  *
  * @param filepath The full path to the table data file.
@@ -50,6 +54,7 @@ InputFileReader::~InputFileReader() {
  * is found in the file's header.
  */
 Table InputFileReader::readTableFromFile(const std::string& filepath) {
+    TraceSpan span("readTableFromFile", filepath);
     std::ifstream file(filepath);
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open file: " + filepath);
@@ -98,6 +103,12 @@ Table InputFileReader::readTableFromFile(const std::string& filepath) {
 
 
     }
+    for (TableColumn* column : columns) {
+        column->finishStatistics();
+    }
+
+    file.clear();
+    Instrumentation::recordBytesRead(static_cast<long long>(file.seekg(0, std::ios::end).tellg()));
     file.close();
 
     Table resTable(columns, tableName, filepath);
@@ -121,6 +132,7 @@ Table InputFileReader::readTableFromFile(const std::string& filepath) {
  * @throws std::runtime_error If a line in the catalog file has an invalid format (not 2 tokens).
  */
 Catalog InputFileReader::readCatalogFromFile(const std::string& filepath) {
+    TraceSpan span("readCatalogFromFile", filepath);
     std::ifstream file(filepath);
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open file: " + filepath);
@@ -153,3 +165,144 @@ Catalog InputFileReader::readCatalogFromFile(const std::string& filepath) {
     
     return catalog;
 }
+
+/**
+ * @brief Reads a workload captured by `WorkloadRecorder`.
+ *
+ * Empty lines and comment lines (starting with `#`) are skipped. The session
+ * is the number between the first and the second tab; the command line is
+ * everything after it, so it may contain any character except a line break.
+ * Since no command name starts with a digit, a line whose second field is not
+ * a number followed by a tab is a version 1 line without a session and
+ * belongs to session 0.
+ *
+ * @param filepath The full path to the workload file.
+ * @return The entries in file order.
+ * @throws std::runtime_error If the file cannot be opened or a line is malformed.
+ */
+std::vector<WorkloadEntry> InputFileReader::readWorkloadFromFile(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + filepath);
+    }
+
+    std::vector<WorkloadEntry> entries;
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        size_t tab = line.find('\t');
+        WorkloadEntry entry;
+        try {
+            size_t parsed = 0;
+            entry.offsetMicroseconds = std::stoll(line.substr(0, tab), &parsed);
+            if (tab == std::string::npos || parsed != tab || entry.offsetMicroseconds < 0) {
+                throw std::invalid_argument("offset");
+            }
+        }
+        catch (const std::exception&) {
+            throw std::runtime_error("Invalid line " + std::to_string(lineNumber) + " in workload file " + filepath
+                + ". Expected <offset in microseconds><tab><session><tab><command>. ");
+        }
+
+        size_t sessionEnd = line.find('\t', tab + 1);
+        size_t digits = line.find_first_not_of("0123456789", tab + 1);
+        if (sessionEnd != std::string::npos && sessionEnd > tab + 1 && digits == sessionEnd
+            && sessionEnd - tab - 1 <= 9) {
+            entry.sessionNumber = std::stoi(line.substr(tab + 1, sessionEnd - tab - 1));
+            entry.commandLine = line.substr(sessionEnd + 1);
+        }
+        else {
+            entry.sessionNumber = 0;
+            entry.commandLine = line.substr(tab + 1);
+        }
+        entries.push_back(entry);
+    }
+
+    file.clear();
+    Instrumentation::recordBytesRead(static_cast<long long>(file.seekg(0, std::ios::end).tellg()));
+    return entries;
+}
+
+/**
+ * @brief Reads a text file line by line.
+ *
+ * A trailing carriage return is removed from every line, so files with
+ * Windows line endings are read like any other file.
+ *
+ * @param filepath The full path to the file.
+ * @return The lines in file order, without line breaks.
+ * @throws std::runtime_error If the file cannot be opened.
+ */
+std::vector<std::string> InputFileReader::readLinesFromFile(const std::string& filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + filepath);
+    }
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        lines.push_back(line);
+    }
+
+    file.clear();
+    Instrumentation::recordBytesRead(static_cast<long long>(file.seekg(0, std::ios::end).tellg()));
+    return lines;
+}
+
+/**
+ * @brief Stages the rows of a row file in a `TableAppender`.
+ *
+ * Every line is split on commas with `CommandParser::parseCommand` and handed
+ * to `TableAppender::appendRow`. A trailing carriage return is removed first.
+ *
+ * @param filepath The full path to the row file.
+ * @param appender The appender the rows are staged in.
+ * @return The number of rows read.
+ * @throws std::runtime_error If the file cannot be opened or a row does not fit the table.
+ */
+int InputFileReader::readRowsFromFile(const std::string& filepath, TableAppender& appender) {
+    TraceSpan span("readRowsFromFile", filepath);
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open file: " + filepath);
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    int rows = 0;
+
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty()) {
+            continue;
+        }
+
+        try {
+            appender.appendRow(CommandParser::parseCommand(line, ','));
+        }
+        catch (const std::exception& e) {
+            throw std::runtime_error("Line " + std::to_string(lineNumber) + " of " + filepath + ": " + e.what());
+        }
+        ++rows;
+    }
+
+    file.clear();
+    Instrumentation::recordBytesRead(static_cast<long long>(file.seekg(0, std::ios::end).tellg()));
+    return rows;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "InputConsoleReader.hpp"
+#include "Socket.hpp"
+
+/**
+ * @class InputSocketReader
+ * @brief Reads the commands of a server session from its client connection.
+ *
+ * Plugged into the `CommandContext` of a session in place of the console
+ * reader. The reader is never interactive: the client only sends command
+ * lines, so the pager prints whole results instead of prompting for `next`.
+ *
+ * @note The reader keeps a reference to the socket, which must outlive it.
+ */
+class InputSocketReader : public InputConsoleReader {
+private:
+	Socket& socket; ///< The client connection.
+
+public:
+	/**
+	* @brief Constructs a reader for a client connection.
+	* @param socket The connection the commands arrive on.
+	*/
+	explicit InputSocketReader(Socket& socket);
+
+	/**
+	* @brief Reads the next command line and splits it at spaces.
+	* @return The words of the line; an empty vector once the client disconnected.
+	*/
+	std::vector<std::string> readLine() const override;
+
+	/**
+	* @brief Reads the next command line.
+	* @return The line; an empty string once the client disconnected.
+	*/
+	std::string readLineAsString() const override;
+
+	/**
+	* @brief Reads the next command line, reporting a disconnected client.
+	* @param line Receives the line without its line break.
+	* @return `false` once the client disconnected.
+	*/
+	bool readNextLine(std::string& line) const override;
+};
@@ -0,0 +1,44 @@
+#include "InputSocketReader.hpp"
+
+/**
+ * @brief Constructs a reader for a client connection.
+ *
+ * The reader is switched to non-interactive mode right away.
+ *
+ * @param socket The connection the commands arrive on.
+ */
+InputSocketReader::InputSocketReader(Socket& socket)
+	: socket(socket) {
+	setInteractive(false);
+}
+
+/**
+ * @brief Reads the next command line and splits it at spaces.
+ * @return The words of the line; an empty vector once the client disconnected.
+ */
+std::vector<std::string> InputSocketReader::readLine() const {
+	std::string line;
+	if (!readNextLine(line)) {
+		return std::vector<std::string>();
+	}
+	return CommandParser::parseCommand(line, ' ');
+}
+
+/**
+ * @brief Reads the next command line.
+ * @return The line; an empty string once the client disconnected.
+ */
+std::string InputSocketReader::readLineAsString() const {
+	std::string line;
+	readNextLine(line);
+	return line;
+}
+
+/**
+ * @brief Reads the next command line, reporting a disconnected client.
+ * @param line Receives the line without its line break.
+ * @return `false` once the client disconnected.
+ */
+bool InputSocketReader::readNextLine(std::string& line) const {
+	return socket.readLine(line);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <string>
+
+/**
+ * @class Instrumentation
+ * @brief Entry point for code that reports what it did while executing a command.
+ *
+ * Every method forwards to the active `ExecutionProfile` (while `explain`
+ * runs) and to the installed `MetricsRegistry`. Either may be absent, in which
+ * case it is skipped, so the calls are safe from any code and any thread.
+ */
+class Instrumentation {
+public:
+    /**
+     * @brief Reports rows examined by a scan and how many of them qualified.
+     * @param scanned The number of rows examined.
+     * @param matched The number of them that qualified.
+     */
+    static void recordRows(long long scanned, long long matched);
+
+    /**
+     * @brief Reports rows returned as the result of a command.
+     * @param rows The number of rows shown to the user or written as the result.
+     */
+    static void recordRowsReturned(long long rows);
+
+    /**
+     * @brief Reports bytes read from a file.
+     * @param bytes The number of bytes.
+     */
+    static void recordBytesRead(long long bytes);
+
+    /**
+     * @brief Reports bytes written to a file.
+     * @param bytes The number of bytes.
+     */
+    static void recordBytesWritten(long long bytes);
+
+    /**
+     * @brief Reports columns cloned with `TableColumn::clone()`.
+     *
+     * Loading and importing tables move them and should report none.
+     *
+     * @param columns The number of columns.
+     */
+    static void recordColumnClones(long long columns);
+
+    /**
+     * @brief Reports the access path chosen by the running command.
+     *
+     * Only the profile of `explain` keeps access paths, and only when they are
+     * reported from the thread running the command.
+     *
+     * @param path A short description, e.g. `hash join, build side A, probe side B`.
+     */
+    static void recordAccessPath(const std::string& path);
+};
@@ -0,0 +1,77 @@
+#include "Instrumentation.hpp"
+#include "ExecutionProfile.hpp"
+#include "MetricsRegistry.hpp"
+
+/**
+ * @brief Reports rows examined by a scan and how many of them qualified.
+ * @param scanned The number of rows examined.
+ * @param matched The number of them that qualified.
+ */
+void Instrumentation::recordRows(long long scanned, long long matched) {
+    if (ExecutionProfile* profile = ExecutionProfile::current()) {
+        profile->addRows(scanned, matched);
+    }
+    if (MetricsRegistry* metrics = MetricsRegistry::current()) {
+        metrics->addRowsScanned(static_cast<uint64_t>(scanned));
+    }
+}
+
+/**
+ * @brief Reports rows returned as the result of a command.
+ * @param rows The number of rows shown to the user or written as the result.
+ */
+void Instrumentation::recordRowsReturned(long long rows) {
+    if (MetricsRegistry* metrics = MetricsRegistry::current()) {
+        metrics->addRowsReturned(static_cast<uint64_t>(rows));
+    }
+}
+
+/**
+ * @brief Reports bytes read from a file.
+ * @param bytes The number of bytes.
+ */
+void Instrumentation::recordBytesRead(long long bytes) {
+    if (ExecutionProfile* profile = ExecutionProfile::current()) {
+        profile->addBytesRead(bytes);
+    }
+    if (MetricsRegistry* metrics = MetricsRegistry::current()) {
+        metrics->addBytesRead(static_cast<uint64_t>(bytes));
+    }
+}
+
+/**
+ * @brief Reports bytes written to a file.
+ * @param bytes The number of bytes.
+ */
+void Instrumentation::recordBytesWritten(long long bytes) {
+    if (ExecutionProfile* profile = ExecutionProfile::current()) {
+        profile->addBytesWritten(bytes);
+    }
+    if (MetricsRegistry* metrics = MetricsRegistry::current()) {
+        metrics->addBytesWritten(static_cast<uint64_t>(bytes));
+    }
+}
+
+/**
+ * @brief Reports columns cloned with `TableColumn::clone()`.
+ * @param columns The number of columns.
+ */
+void Instrumentation::recordColumnClones(long long columns) {
+    if (ExecutionProfile* profile = ExecutionProfile::current()) {
+        profile->addColumnClones(columns);
+    }
+    if (MetricsRegistry* metrics = MetricsRegistry::current()) {
+        metrics->addColumnClones(static_cast<uint64_t>(columns));
+    }
+}
+
+/**
+ * @brief Reports the access path chosen by the running command.
+ * @param path A short description of the access path.
+ */
+void Instrumentation::recordAccessPath(const std::string& path) {
+    ExecutionProfile* profile = ExecutionProfile::current();
+    if (profile != nullptr && profile->ownsCallingThread()) {
+        profile->addAccessPath(path);
+    }
+}
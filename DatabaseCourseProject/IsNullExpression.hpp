@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include "ColumnExpression.hpp"
+
+/**
+ * @class IsNullExpression
+ * @brief Leaf testing a column for NULL: `$n IS NULL` or `$n IS NOT NULL`.
+ */
+class IsNullExpression : public ColumnExpression {
+private:
+    bool negated; ///< `true` for `IS NOT NULL`.
+
+public:
+    /**
+     * @brief Creates the test `$columnIndex IS [NOT] NULL`.
+     * @param columnIndex The 0-indexed position of the tested column.
+     * @param negated `true` to select the non-NULL cells instead.
+     */
+    IsNullExpression(int columnIndex, bool negated);
+
+    /**
+     * @brief Tests the NULL flags of [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch.
+     */
+    void evaluate(int begin, int end, SelectionBitmap& result) const override;
+
+    /**
+     * @brief Returns the test as text, e.g. `$0 IS NULL`.
+     * @return The expression as text.
+     */
+    std::string toString() const override;
+
+    /**
+     * @brief Estimates the selectivity from the NULL count of the column.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity() const override;
+
+    /**
+     * @brief Checks whether the column has no NULL cell (or, for `IS NOT NULL`, only NULL cells).
+     * @return `true` if no row can match.
+     */
+    bool isProvablyEmpty() const override;
+
+    /**
+     * @brief Checks the NULL counts of the zone maps of a numeric column over [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `true` if no row of the batch can match; always `false` for String columns.
+     */
+    bool isProvablyEmptyIn(int begin, int end) const override;
+};
@@ -0,0 +1,82 @@
+#include "IsNullExpression.hpp"
+
+/**
+ * @brief Creates the test `$columnIndex IS [NOT] NULL`.
+ * @param columnIndex The 0-indexed position of the tested column.
+ * @param negated `true` to select the non-NULL cells instead.
+ */
+IsNullExpression::IsNullExpression(int columnIndex, bool negated)
+    : ColumnExpression(columnIndex), negated(negated) {
+}
+
+/**
+ * @brief Tests the NULL flags of [begin, end).
+ *
+ * The flags are packed into bitmap words segment by segment; `IS NOT NULL`
+ * inverts the finished bitmap instead of testing each cell twice.
+ *
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch.
+ */
+void IsNullExpression::evaluate(int begin, int end, SelectionBitmap& result) const {
+    scanNullFlags(begin, end, result);
+
+    if (negated) {
+        result.invert();
+    }
+}
+
+/**
+ * @brief Returns the test as text, e.g. `$0 IS NULL`.
+ * @return The expression as text.
+ */
+std::string IsNullExpression::toString() const {
+    return "$" + std::to_string(columnIndex) + (negated ? " IS NOT NULL" : " IS NULL");
+}
+
+/**
+ * @brief Estimates the selectivity from the NULL count of the column.
+ * @return A fraction in [0, 1].
+ */
+double IsNullExpression::estimateSelectivity() const {
+    if (column == nullptr) {
+        return 1.0;
+    }
+
+    const ColumnStatistics& statistics = column->getStatistics();
+    if (statistics.getRowCount() == 0) {
+        return 0.0;
+    }
+    double nulls = static_cast<double>(statistics.getNullCount()) / statistics.getRowCount();
+    return negated ? 1.0 - nulls : nulls;
+}
+
+/**
+ * @brief Checks whether the column has no NULL cell (or, for `IS NOT NULL`, only NULL cells).
+ * @return `true` if no row can match.
+ */
+bool IsNullExpression::isProvablyEmpty() const {
+    if (column == nullptr) {
+        return false;
+    }
+
+    const ColumnStatistics& statistics = column->getStatistics();
+    return negated
+        ? statistics.getNullCount() == statistics.getRowCount()
+        : statistics.getNullCount() == 0;
+}
+
+/**
+ * @brief Checks the NULL counts of the zone maps of a numeric column over [begin, end).
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @return `true` if the batch has no NULL cell (or, for `IS NOT NULL`, only NULL cells).
+ */
+bool IsNullExpression::isProvablyEmptyIn(int begin, int end) const {
+    ColumnSegments<double>::Zone zone;
+    if (!summarizeZones(begin, end, zone)) {
+        return false;
+    }
+    return negated ? zone.allNull() : zone.nullCount == 0;
+}
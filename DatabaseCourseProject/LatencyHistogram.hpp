@@ -0,0 +1,95 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class LatencyHistogram
+ * @brief Lock-free HDR-style histogram of durations in microseconds.
+ *
+ * Values below 64 us get a bucket each. Above that, every power-of-two range
+ * is split into 32 linear sub-buckets, so any recorded value is reported with
+ * a relative error of at most 1/32 (about 3%) while the whole range up to
+ * several days fits into `BUCKET_COUNT` fixed counters. Recording is a few
+ * relaxed atomic increments; percentiles are computed by walking the buckets.
+ */
+class LatencyHistogram {
+public:
+    /// Number of values below which every value has its own bucket.
+    static const int LINEAR_LIMIT = 64;
+
+    /// Number of sub-buckets per power-of-two range above `LINEAR_LIMIT`.
+    static const int SUB_BUCKETS = 32;
+
+    /// Number of power-of-two ranges above `LINEAR_LIMIT` that are tracked.
+    static const int RANGES = 36;
+
+    /// Total number of buckets.
+    static const int BUCKET_COUNT = LINEAR_LIMIT + RANGES * SUB_BUCKETS;
+
+private:
+    std::atomic<uint64_t> buckets[BUCKET_COUNT]; ///< Number of values per bucket.
+    std::atomic<uint64_t> count;                 ///< Number of recorded values.
+    std::atomic<uint64_t> sum;                   ///< Sum of the recorded values.
+    std::atomic<uint64_t> maximum;               ///< Largest recorded value.
+
+    /**
+     * @brief Maps a value to its bucket.
+     * @param value The value in microseconds.
+     * @return The bucket index; values beyond the tracked range go to the last bucket.
+     */
+    static int bucketOf(uint64_t value);
+
+    /**
+     * @brief Returns the largest value that maps to a bucket.
+     * @param bucket The bucket index.
+     * @return The upper bound of the bucket, in microseconds.
+     */
+    static uint64_t upperBoundOf(int bucket);
+
+public:
+    /**
+     * @brief Constructs an empty histogram.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Deleted copy constructor; the counters are shared by concurrent recorders.
+     */
+    LatencyHistogram(const LatencyHistogram& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; the counters are shared by concurrent recorders.
+     */
+    LatencyHistogram& operator=(const LatencyHistogram& other) = delete;
+
+    /**
+     * @brief Records one duration.
+     * @param microseconds The duration.
+     */
+    void record(uint64_t microseconds);
+
+    /**
+     * @brief Returns the number of recorded durations.
+     * @return The count.
+     */
+    uint64_t getCount() const;
+
+    /**
+     * @brief Returns the sum of the recorded durations.
+     * @return The sum in microseconds.
+     */
+    uint64_t getSum() const;
+
+    /**
+     * @brief Returns the longest recorded duration.
+     * @return The maximum in microseconds, 0 if nothing was recorded.
+     */
+    uint64_t getMax() const;
+
+    /**
+     * @brief Returns the duration below or at which `percentile` percent of the values lie.
+     * @param percentile The percentile in [0, 100], e.g. 99.9.
+     * @return The duration in microseconds (accurate to about 3%), 0 if nothing was recorded.
+     */
+    uint64_t valueAtPercentile(double percentile) const;
+};
@@ -0,0 +1,125 @@
+#include "LatencyHistogram.hpp"
+#include <cmath>
+#include <algorithm>
+
+/**
+ * @brief Constructs an empty histogram.
+ */
+LatencyHistogram::LatencyHistogram()
+    : count(0), sum(0), maximum(0) {
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Maps a value to its bucket.
+ *
+ * For a value with its highest set bit at position `b` (b >= 6) the range
+ * index is `b - 6` and the sub-bucket is given by the 5 bits below the
+ * highest one.
+ *
+ * @param value The value in microseconds.
+ * @return The bucket index; values beyond the tracked range go to the last bucket.
+ */
+int LatencyHistogram::bucketOf(uint64_t value) {
+    if (value < LINEAR_LIMIT) {
+        return static_cast<int>(value);
+    }
+
+    int highestBit = 63;
+    while (!(value >> highestBit)) {
+        --highestBit;
+    }
+
+    int range = highestBit - 6;
+    if (range >= RANGES) {
+        return BUCKET_COUNT - 1;
+    }
+    int shift = highestBit - 5;
+    int subBucket = static_cast<int>((value >> shift) - SUB_BUCKETS);
+    return LINEAR_LIMIT + range * SUB_BUCKETS + subBucket;
+}
+
+/**
+ * @brief Returns the largest value that maps to a bucket.
+ * @param bucket The bucket index.
+ * @return The upper bound of the bucket, in microseconds.
+ */
+uint64_t LatencyHistogram::upperBoundOf(int bucket) {
+    if (bucket < LINEAR_LIMIT) {
+        return static_cast<uint64_t>(bucket);
+    }
+
+    int range = (bucket - LINEAR_LIMIT) / SUB_BUCKETS;
+    int subBucket = (bucket - LINEAR_LIMIT) % SUB_BUCKETS;
+    int shift = range + 1;
+    return ((static_cast<uint64_t>(SUB_BUCKETS + subBucket + 1)) << shift) - 1;
+}
+
+/**
+ * @brief Records one duration.
+ * @param microseconds The duration.
+ */
+void LatencyHistogram::record(uint64_t microseconds) {
+    buckets[bucketOf(microseconds)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(microseconds, std::memory_order_relaxed);
+
+    uint64_t current = maximum.load(std::memory_order_relaxed);
+    while (microseconds > current && !maximum.compare_exchange_weak(current, microseconds, std::memory_order_relaxed)) {
+    }
+}
+
+/**
+ * @brief Returns the number of recorded durations.
+ * @return The count.
+ */
+uint64_t LatencyHistogram::getCount() const {
+    return count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the sum of the recorded durations.
+ * @return The sum in microseconds.
+ */
+uint64_t LatencyHistogram::getSum() const {
+    return sum.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the longest recorded duration.
+ * @return The maximum in microseconds, 0 if nothing was recorded.
+ */
+uint64_t LatencyHistogram::getMax() const {
+    return maximum.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the duration below or at which `percentile` percent of the values lie.
+ *
+ * The buckets are walked in ascending order until the running count reaches
+ * the rank of the percentile; the upper bound of that bucket, capped at the
+ * recorded maximum, is returned.
+ *
+ * @param percentile The percentile in [0, 100], e.g. 99.9.
+ * @return The duration in microseconds, 0 if nothing was recorded.
+ */
+uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+    uint64_t total = getCount();
+    if (total == 0) {
+        return 0;
+    }
+
+    double clamped = std::min(100.0, std::max(0.0, percentile));
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * total)));
+
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(upperBoundOf(i), getMax());
+        }
+    }
+    return getMax();
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include "QueryOperator.hpp"
+
+/**
+ * @class LimitOperator
+ * @brief Streaming operator implementing LIMIT and OFFSET.
+ *
+ * Once the limit is reached it returns `false`, which stops the scan (or the
+ * output loop of a blocking operator) upstream.
+ */
+class LimitOperator : public QueryOperator {
+private:
+    size_t offset;  ///< Number of leading rows to drop.
+    bool limited;   ///< Whether `limit` applies.
+    size_t limit;   ///< Maximum number of rows to pass on.
+    size_t seen;    ///< Rows received so far.
+    size_t passed;  ///< Rows passed on so far.
+
+public:
+    /**
+     * @brief Constructs the operator.
+     * @param offset Number of leading rows to drop.
+     * @param limited Whether `limit` applies.
+     * @param limit Maximum number of rows to pass on.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    LimitOperator(size_t offset, bool limited, size_t limit, QueryOperator* next);
+
+    /**
+     * @brief Drops the row, passes it on, or stops the input.
+     * @param row The input row.
+     * @return `false` once the limit has been reached.
+     */
+    bool consume(const QueryRow& row) override;
+};
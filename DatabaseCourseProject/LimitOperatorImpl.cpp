@@ -0,0 +1,30 @@
+#include "LimitOperator.hpp"
+
+/**
+ * @brief Constructs the operator.
+ * @param offset Number of leading rows to drop.
+ * @param limited Whether `limit` applies.
+ * @param limit Maximum number of rows to pass on.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+LimitOperator::LimitOperator(size_t offset, bool limited, size_t limit, QueryOperator* next)
+    : QueryOperator(next), offset(offset), limited(limited), limit(limit), seen(0), passed(0) {
+}
+
+/**
+ * @brief Drops the first `offset` rows and passes on at most `limit` rows.
+ * @param row The input row.
+ * @return `false` once the limit has been reached or the downstream operator stopped.
+ */
+bool LimitOperator::consume(const QueryRow& row) {
+    if (limited && passed >= limit) {
+        return false;
+    }
+    if (seen++ < offset) {
+        return true;
+    }
+
+    ++passed;
+    bool more = next->consume(row);
+    return more && (!limited || passed < limit);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "LockSet.hpp"
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+/**
+ * @class LockManager
+ * @brief Reader/writer locks for the catalog and for each of its tables.
+ *
+ * The manager is owned by the `Engine`, which acquires the `LockSet` of a
+ * command before executing it. Readers of a table run in parallel, writers of
+ * a table exclude everything else on that table only, and commands that
+ * change the set of tables exclude every other command.
+ *
+ * Deadlocks are avoided by a fixed acquisition order: the catalog lock is
+ * always taken first, then the table locks in ascending order of the table
+ * name. Every command acquires all its locks at once, before it starts, and
+ * releases them in reverse order when it ends.
+ *
+ * Table locks are created on first use and kept until the manager is
+ * destroyed, so renaming or removing a table never frees a lock that another
+ * thread is waiting for.
+ */
+class LockManager {
+private:
+    std::shared_timed_mutex catalogLock;                       ///< Protects the set of tables.
+    std::mutex tableLocksMutex;                                ///< Guards the structure of `tableLocks`.
+    std::map<std::string, std::shared_timed_mutex*> tableLocks; ///< Lock per table name. Owned.
+
+    /**
+     * @brief Returns the lock of a table, creating it on first use.
+     * @param name The name of the table.
+     * @return The lock, valid until the manager is destroyed.
+     */
+    std::shared_timed_mutex& tableLock(const std::string& name);
+
+public:
+    /**
+     * @brief Constructs a manager without any table locks.
+     */
+    LockManager();
+
+    /**
+     * @brief Deletes the table locks. No lock may be held anymore.
+     */
+    ~LockManager();
+
+    /**
+     * @brief Copying is not supported; every engine has its own locks.
+     */
+    LockManager(const LockManager& other) = delete;
+
+    /**
+     * @brief Copying is not supported; every engine has its own locks.
+     */
+    LockManager& operator=(const LockManager& other) = delete;
+
+    /**
+     * @brief Blocks until all locks of the set are held by the calling thread.
+     *
+     * With the catalog held exclusively, the table locks are skipped, since
+     * no other command can run at the same time.
+     *
+     * @param locks The locks to acquire.
+     */
+    void acquire(const LockSet& locks);
+
+    /**
+     * @brief Releases the locks previously acquired with `acquire` for the same set.
+     * @param locks The locks to release.
+     */
+    void release(const LockSet& locks);
+};
@@ -0,0 +1,89 @@
+#include "LockManager.hpp"
+
+/**
+ * @brief Constructs a manager without any table locks.
+ */
+LockManager::LockManager() {
+}
+
+/**
+ * @brief Deletes the table locks.
+ */
+LockManager::~LockManager() {
+    for (auto& pair : tableLocks) {
+        delete pair.second;
+    }
+    tableLocks.clear();
+}
+
+/**
+ * @brief Returns the lock of a table, creating it on first use.
+ *
+ * Only the lookup runs under `tableLocksMutex`; the returned lock is
+ * acquired afterwards, so waiting for a busy table does not block other
+ * threads from looking up theirs.
+ *
+ * @param name The name of the table.
+ * @return The lock of the table.
+ */
+std::shared_timed_mutex& LockManager::tableLock(const std::string& name) {
+    std::lock_guard<std::mutex> lock(tableLocksMutex);
+
+    std::shared_timed_mutex*& tableMutex = tableLocks[name];
+    if (tableMutex == nullptr) {
+        tableMutex = new std::shared_timed_mutex();
+    }
+    return *tableMutex;
+}
+
+/**
+ * @brief Blocks until all locks of the set are held by the calling thread.
+ *
+ * The catalog lock is taken first, then the table locks in the (sorted)
+ * order of `locks.tables`. Since every thread follows the same order, two
+ * commands can never wait for each other in a cycle.
+ *
+ * @param locks The locks to acquire.
+ */
+void LockManager::acquire(const LockSet& locks) {
+    if (locks.catalogMode == LockMode::EXCLUSIVE) {
+        catalogLock.lock();
+        return;
+    }
+    if (locks.catalogMode == LockMode::SHARED) {
+        catalogLock.lock_shared();
+    }
+
+    for (const auto& pair : locks.tables) {
+        if (pair.second == LockMode::EXCLUSIVE) {
+            tableLock(pair.first).lock();
+        }
+        else if (pair.second == LockMode::SHARED) {
+            tableLock(pair.first).lock_shared();
+        }
+    }
+}
+
+/**
+ * @brief Releases the locks of the set in the reverse order of `acquire`.
+ * @param locks The locks to release; the same set that was acquired.
+ */
+void LockManager::release(const LockSet& locks) {
+    if (locks.catalogMode == LockMode::EXCLUSIVE) {
+        catalogLock.unlock();
+        return;
+    }
+
+    for (auto pair = locks.tables.rbegin(); pair != locks.tables.rend(); ++pair) {
+        if (pair->second == LockMode::EXCLUSIVE) {
+            tableLock(pair->first).unlock();
+        }
+        else if (pair->second == LockMode::SHARED) {
+            tableLock(pair->first).unlock_shared();
+        }
+    }
+
+    if (locks.catalogMode == LockMode::SHARED) {
+        catalogLock.unlock_shared();
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+/**
+ * @enum LockMode
+ * @brief Enumerates how a command accesses the catalog or a table while it runs.
+ *
+ * The modes are ordered by strength, so the stronger of two requests for the
+ * same object can be chosen with a plain comparison.
+ */
+enum class LockMode {
+    /**
+     * @brief The object is not accessed.
+     */
+    NONE,
+
+    /**
+     * @brief The object is only read. Any number of readers can hold it at the same time.
+     */
+    SHARED,
+
+    /**
+     * @brief The object is modified. The holder excludes every other reader and writer.
+     */
+    EXCLUSIVE
+};
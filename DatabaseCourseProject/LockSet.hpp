@@ -0,0 +1,65 @@
+#pragma once
+#include "LockMode.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @struct LockSet
+ * @brief The locks a command needs while it executes.
+ *
+ * Every command declares its locks before it runs (see `Command::requiredLocks`)
+ * and the `Engine` holds them for the whole execution through `ScopedLocks`.
+ *
+ * The catalog lock protects the set of tables: commands that add, remove or
+ * rename tables, or replace the whole catalog, need it exclusively. Table
+ * locks protect the rows and columns of one table. A table lock always
+ * implies the catalog lock in shared mode, so the table cannot disappear
+ * while it is used.
+ */
+struct LockSet {
+    LockMode catalogMode;                   ///< How the catalog is accessed.
+    std::map<std::string, LockMode> tables; ///< How each table is accessed, by table name. Sorted, which fixes the acquisition order.
+
+    /**
+     * @brief Constructs an empty set: the command neither reads nor writes shared data.
+     */
+    LockSet();
+
+    /**
+     * @brief Creates a set that only locks the catalog.
+     * @param mode How the catalog is accessed.
+     * @return The lock set.
+     */
+    static LockSet catalog(LockMode mode);
+
+    /**
+     * @brief Creates a set that reads the given tables.
+     * @param names The names of the tables. Duplicates are allowed.
+     * @return The lock set.
+     */
+    static LockSet readTables(const std::vector<std::string>& names);
+
+    /**
+     * @brief Creates a set that modifies one table.
+     * @param name The name of the table.
+     * @return The lock set.
+     */
+    static LockSet writeTable(const std::string& name);
+
+    /**
+     * @brief Adds a table lock, keeping the stronger mode if the table is already in the set.
+     *
+     * The catalog mode is raised to at least `LockMode::SHARED`.
+     *
+     * @param name The name of the table.
+     * @param mode How the table is accessed.
+     */
+    void addTable(const std::string& name, LockMode mode);
+
+    /**
+     * @brief Checks whether the set only reads, i.e. neither the catalog nor any table is held exclusively.
+     * @return `true` if no lock of the set is exclusive.
+     */
+    bool isReadOnly() const;
+};
@@ -0,0 +1,82 @@
+#include "LockSet.hpp"
+
+/**
+ * @brief Constructs an empty set without catalog or table locks.
+ */
+LockSet::LockSet()
+    : catalogMode(LockMode::NONE) {
+}
+
+/**
+ * @brief Creates a set that only locks the catalog.
+ * @param mode How the catalog is accessed.
+ * @return The lock set.
+ */
+LockSet LockSet::catalog(LockMode mode) {
+    LockSet locks;
+    locks.catalogMode = mode;
+    return locks;
+}
+
+/**
+ * @brief Creates a set that reads the given tables.
+ * @param names The names of the tables.
+ * @return The lock set, with the catalog held shared.
+ */
+LockSet LockSet::readTables(const std::vector<std::string>& names) {
+    LockSet locks;
+    for (const std::string& name : names) {
+        locks.addTable(name, LockMode::SHARED);
+    }
+    return locks;
+}
+
+/**
+ * @brief Creates a set that modifies one table.
+ * @param name The name of the table.
+ * @return The lock set, with the catalog held shared.
+ */
+LockSet LockSet::writeTable(const std::string& name) {
+    LockSet locks;
+    locks.addTable(name, LockMode::EXCLUSIVE);
+    return locks;
+}
+
+/**
+ * @brief Adds a table lock, keeping the stronger mode if the table is already in the set.
+ *
+ * A command that reads and writes the same table (or names it twice, like a
+ * self-join) therefore locks it only once.
+ *
+ * @param name The name of the table.
+ * @param mode How the table is accessed.
+ */
+void LockSet::addTable(const std::string& name, LockMode mode) {
+    if (mode == LockMode::NONE) {
+        return;
+    }
+
+    LockMode& current = tables[name];
+    if (mode > current) {
+        current = mode;
+    }
+    if (catalogMode < LockMode::SHARED) {
+        catalogMode = LockMode::SHARED;
+    }
+}
+
+/**
+ * @brief Checks whether the set only reads.
+ * @return `true` if neither the catalog nor any table is locked exclusively.
+ */
+bool LockSet::isReadOnly() const {
+    if (catalogMode == LockMode::EXCLUSIVE) {
+        return false;
+    }
+    for (const auto& pair : tables) {
+        if (pair.second == LockMode::EXCLUSIVE) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <string>
+#include "Expression.hpp"
+#include "LogicalOperator.hpp"
+
+/**
+ * @class LogicalExpression
+ * @brief Inner node combining two expressions with AND or OR.
+ *
+ * The node owns both operands. The bitmaps of the operands are combined word
+ * by word; the right operand is skipped for a batch when the left one already
+ * decides the result (nothing selected for AND, everything selected for OR).
+ */
+class LogicalExpression : public Expression {
+private:
+    LogicalOperator op; ///< The connective.
+    Expression* left;   ///< The left operand. Owned by this node.
+    Expression* right;  ///< The right operand. Owned by this node.
+
+public:
+    /**
+     * @brief Creates the node `left op right`, taking ownership of both operands.
+     * @param op The connective.
+     * @param left The left operand.
+     * @param right The right operand.
+     */
+    LogicalExpression(LogicalOperator op, Expression* left, Expression* right);
+
+    /**
+     * @brief Deletes both operands.
+     */
+    ~LogicalExpression() override;
+
+    /**
+     * @brief Expression trees own their nodes and are not copied.
+     */
+    LogicalExpression(const LogicalExpression& other) = delete;
+
+    /**
+     * @brief Expression trees own their nodes and are not copied.
+     */
+    LogicalExpression& operator=(const LogicalExpression& other) = delete;
+
+    /**
+     * @brief Binds both operands to `table`.
+     * @param table The table the expression will be evaluated on.
+     * @throws std::runtime_error If an operand cannot be bound.
+     */
+    void bind(const Table& table) override;
+
+    /**
+     * @brief Evaluates both operands for [begin, end) and combines their bitmaps.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch.
+     */
+    void evaluate(int begin, int end, SelectionBitmap& result) const override;
+
+    /**
+     * @brief Returns the node as text, e.g. `($0 = '1' AND $1 > '2')`.
+     * @return The expression as text.
+     */
+    std::string toString() const override;
+
+    /**
+     * @brief Combines the estimates of the operands, assuming they are independent.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity() const override;
+
+    /**
+     * @brief Checks whether one operand of `AND`, or both operands of `OR`, provably match nothing.
+     * @return `true` if no row can match.
+     */
+    bool isProvablyEmpty() const override;
+
+    /**
+     * @brief Checks whether one operand of `AND`, or both operands of `OR`, provably match nothing in [begin, end).
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `true` if no row of the batch can match.
+     */
+    bool isProvablyEmptyIn(int begin, int end) const override;
+};
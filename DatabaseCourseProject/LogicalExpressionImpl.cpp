@@ -0,0 +1,93 @@
+#include "LogicalExpression.hpp"
+
+/**
+ * @brief Creates the node `left op right`, taking ownership of both operands.
+ * @param op The connective.
+ * @param left The left operand.
+ * @param right The right operand.
+ */
+LogicalExpression::LogicalExpression(LogicalOperator op, Expression* left, Expression* right)
+    : op(op), left(left), right(right) {
+}
+
+/**
+ * @brief Deletes both operands.
+ */
+LogicalExpression::~LogicalExpression() {
+    delete left;
+    delete right;
+}
+
+/**
+ * @brief Binds both operands to `table`.
+ * @param table The table the expression will be evaluated on.
+ * @throws std::runtime_error If an operand cannot be bound.
+ */
+void LogicalExpression::bind(const Table& table) {
+    left->bind(table);
+    right->bind(table);
+}
+
+/**
+ * @brief Evaluates both operands for [begin, end) and combines their bitmaps.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch.
+ */
+void LogicalExpression::evaluate(int begin, int end, SelectionBitmap& result) const {
+    left->evaluate(begin, end, result);
+
+    if (op == LogicalOperator::AND ? result.none() : result.all()) {
+        return;
+    }
+
+    SelectionBitmap other;
+    right->evaluate(begin, end, other);
+
+    if (op == LogicalOperator::AND) {
+        result.andWith(other);
+    }
+    else {
+        result.orWith(other);
+    }
+}
+
+/**
+ * @brief Returns the node as text, e.g. `($0 = '1' AND $1 > '2')`.
+ * @return The expression as text.
+ */
+std::string LogicalExpression::toString() const {
+    return "(" + left->toString() + (op == LogicalOperator::AND ? " AND " : " OR ") + right->toString() + ")";
+}
+
+/**
+ * @brief Combines the estimates of the operands, assuming they are independent.
+ * @return A fraction in [0, 1].
+ */
+double LogicalExpression::estimateSelectivity() const {
+    double a = left->estimateSelectivity();
+    double b = right->estimateSelectivity();
+    return op == LogicalOperator::AND ? a * b : a + b - a * b;
+}
+
+/**
+ * @brief Checks whether one operand of `AND`, or both operands of `OR`, provably match nothing.
+ * @return `true` if no row can match.
+ */
+bool LogicalExpression::isProvablyEmpty() const {
+    return op == LogicalOperator::AND
+        ? left->isProvablyEmpty() || right->isProvablyEmpty()
+        : left->isProvablyEmpty() && right->isProvablyEmpty();
+}
+
+/**
+ * @brief Checks whether one operand of `AND`, or both operands of `OR`, provably match nothing in [begin, end).
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @return `true` if no row of the batch can match.
+ */
+bool LogicalExpression::isProvablyEmptyIn(int begin, int end) const {
+    return op == LogicalOperator::AND
+        ? left->isProvablyEmptyIn(begin, end) || right->isProvablyEmptyIn(begin, end)
+        : left->isProvablyEmptyIn(begin, end) && right->isProvablyEmptyIn(begin, end);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+/**
+ * @enum LogicalOperator
+ * @brief Enumerates the binary connectives supported in WHERE expressions.
+ */
+enum class LogicalOperator {
+    /**
+     * @brief Both operands must hold.
+     */
+    AND,
+
+    /**
+     * @brief At least one operand must hold.
+     */
+    OR
+};
@@ -1,36 +1,72 @@
 #include "Engine.hpp"
+#include "StartupOptions.hpp"
+#include "RemoteClient.hpp"
 #include <iostream>
 
 /**
  * @brief The entry point of the Database Course Project application.
  *
- * This `main` function initializes all necessary core components of the program,
+ * This `main` function first parses the startup options (see `StartupOptions`),
+ * then initializes all necessary core components of the program,
  * including readers and writers for console and file I/O. It then instantiates
  * the `Engine` class, which contains the main logic, and starts
  * the command-line interface.
  *
  * The `main` function is responsible for setting up the environment and
  * initiating the application, after which control is handed over
- * to the `Engine::run()` method.
+ * to the `Engine::run()` method, to `Engine::replay()` when a workload
+ * file was given with `--replay`, to `Engine::runScript()` in batch mode (`--script`)
+ * or to `Engine::serve()` in server mode (`--serve`). With `--connect` no engine
+ * is created; the program runs as a `RemoteClient` of a server instead.
  *
- * @return 0 upon successful execution and program termination.
+ * @param argc The number of program arguments.
+ * @param argv The program arguments, e.g. `--threads 4`.
+ * @return 0 upon successful execution and program termination, 1 if the arguments are invalid
+ * or a batch script or a command sent with `--connect` failed.
  */
-int main() {
+int main(int argc, char* argv[]) {
 
 	OutputConsoleWritter outputConsoleWriter;
 
-	OutputFileWritter outputFileWritter;
+	StartupOptions options;
+	try {
+		options = StartupOptions::fromArguments(argc, argv);
+	}
+	catch (const std::exception& e) {
+		outputConsoleWriter.printLine(e.what());
+		outputConsoleWriter.printLine(StartupOptions::usage());
+		return 1;
+	}
 
 	InputConsoleReader inputConsoleReader;
 
+	if (options.connectPort != 0) {
+		return RemoteClient::run(options.connectPort, outputConsoleWriter, inputConsoleReader);
+	}
+
+	OutputFileWritter outputFileWritter;
+
 	InputFileReader fileReader(outputConsoleWriter);
 
 	Engine engine(outputConsoleWriter,
 		inputConsoleReader,
 		outputFileWritter,
-		fileReader);
+		fileReader,
+		options);
 
-	engine.run();
+	if (!options.scriptFile.empty()) {
+		return engine.runScript(options.scriptFile, options.continueOnError) ? 0 : 1;
+	}
+	if (options.servePort != 0) {
+		engine.serve(options.servePort);
+		return 0;
+	}
+	if (!options.replayFile.empty()) {
+		engine.replay(options.replayFile, options.replayPaced);
+	}
+	else {
+		engine.run();
+	}
 
 	return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "LatencyHistogram.hpp"
+
+/**
+ * @class MetricsRegistry
+ * @brief Always-on metrics of the running program.
+ *
+ * The registry is owned by the `Engine` and shared with the commands through
+ * the `CommandContext`. It keeps:
+ * - a `LatencyHistogram` per command name, fed by `Engine::dispatchCommand`,
+ * - process-wide counters of rows scanned and returned, bytes read and
+ *   written and errors.
+ *
+ * While the registry is installed (see `install()`), low-level code without
+ * access to the context reports the counters through `Instrumentation`.
+ * All updates are relaxed atomic increments; only the first execution of a
+ * command name takes a lock to create its histogram.
+ *
+ * The metrics can be printed with the `metrics` command and exported in the
+ * Prometheus text exposition format.
+ */
+class MetricsRegistry {
+private:
+    static std::atomic<MetricsRegistry*> installed; ///< The registry reported to by `Instrumentation`, or nullptr.
+
+    std::chrono::steady_clock::time_point startTime;      ///< Creation time, the base of the rates.
+    mutable std::mutex histogramsMutex;                   ///< Guards the structure of `histograms`.
+    std::map<std::string, LatencyHistogram*> histograms;  ///< Latency per command name. Owned.
+
+    std::atomic<uint64_t> rowsScanned;   ///< Rows examined by scans.
+    std::atomic<uint64_t> rowsReturned;  ///< Rows shown to the user or written as a result.
+    std::atomic<uint64_t> bytesRead;     ///< Bytes read from files.
+    std::atomic<uint64_t> bytesWritten;  ///< Bytes written to files.
+    std::atomic<uint64_t> columnClones;  ///< Columns cloned with `TableColumn::clone()`.
+    std::atomic<uint64_t> errors;        ///< Failed commands and reported errors.
+
+    /**
+     * @brief Returns the seconds elapsed since the registry was created.
+     * @return The uptime, at least one microsecond.
+     */
+    double uptimeSeconds() const;
+
+public:
+    /**
+     * @brief Constructs an empty registry. It is not installed.
+     */
+    MetricsRegistry();
+
+    /**
+     * @brief Uninstalls the registry if needed and deletes the histograms.
+     */
+    ~MetricsRegistry();
+
+    /**
+     * @brief Deleted copy constructor; the registry is shared by reference.
+     */
+    MetricsRegistry(const MetricsRegistry& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; the registry is shared by reference.
+     */
+    MetricsRegistry& operator=(const MetricsRegistry& other) = delete;
+
+    /**
+     * @brief Makes this the registry that `Instrumentation` reports to.
+     */
+    void install();
+
+    /**
+     * @brief Returns the installed registry.
+     * @return The registry, or nullptr if none is installed.
+     */
+    static MetricsRegistry* current();
+
+    /**
+     * @brief Records the execution time of a command.
+     * @param command The command name.
+     * @param microseconds The execution time.
+     */
+    void recordLatency(const std::string& command, uint64_t microseconds);
+
+    /**
+     * @brief Adds scanned rows.
+     * @param rows The number of rows.
+     */
+    void addRowsScanned(uint64_t rows);
+
+    /**
+     * @brief Adds returned rows.
+     * @param rows The number of rows.
+     */
+    void addRowsReturned(uint64_t rows);
+
+    /**
+     * @brief Adds bytes read from files.
+     * @param bytes The number of bytes.
+     */
+    void addBytesRead(uint64_t bytes);
+
+    /**
+     * @brief Adds bytes written to files.
+     * @param bytes The number of bytes.
+     */
+    void addBytesWritten(uint64_t bytes);
+
+    /**
+     * @brief Adds cloned columns.
+     * @param columns The number of columns.
+     */
+    void addColumnClones(uint64_t columns);
+
+    /**
+     * @brief Counts one error.
+     */
+    void recordError();
+
+    /**
+     * @brief Returns the number of errors counted so far.
+     * @return The error count.
+     */
+    uint64_t getErrorCount() const;
+
+    /**
+     * @brief Returns the number of errors counted so far by the calling thread.
+     *
+     * Lets a server session tell whether its own command failed while other
+     * sessions run commands at the same time.
+     *
+     * @return The error count of the calling thread.
+     */
+    static uint64_t getErrorCountOfCurrentThread();
+
+    /**
+     * @brief Formats the metrics for the console.
+     * @return One line per command with count, p50/p99/p999/max latency and rate,
+     * followed by the counters and their rates.
+     */
+    std::vector<std::string> summary() const;
+
+    /**
+     * @brief Formats the metrics in the Prometheus text exposition format.
+     * @return The exposition text, one sample per line.
+     */
+    std::string toPrometheus() const;
+};
@@ -0,0 +1,296 @@
+#include "MetricsRegistry.hpp"
+#include <cstdio>
+
+std::atomic<MetricsRegistry*> MetricsRegistry::installed(nullptr);
+
+namespace {
+    /// Errors counted by the calling thread, over all registries.
+    thread_local uint64_t errorsOfCurrentThread = 0;
+
+    /**
+     * @brief Formats a number with a fixed number of decimals.
+     * @param value The number.
+     * @param decimals The number of decimals.
+     * @return The number as text.
+     */
+    std::string formatNumber(double value, int decimals) {
+        char buffer[64];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        return buffer;
+    }
+
+    /**
+     * @brief Formats a duration given in microseconds as milliseconds.
+     * @param microseconds The duration.
+     * @return The duration as text, e.g. `1.250ms`.
+     */
+    std::string formatMilliseconds(uint64_t microseconds) {
+        return formatNumber(microseconds / 1000.0, 3) + "ms";
+    }
+
+    /**
+     * @brief Formats a duration given in microseconds as seconds, the Prometheus base unit.
+     * @param microseconds The duration.
+     * @return The duration in seconds as text.
+     */
+    std::string formatSeconds(uint64_t microseconds) {
+        return formatNumber(microseconds / 1000000.0, 6);
+    }
+
+    /**
+     * @brief Escapes a Prometheus label value.
+     * @param value The raw value.
+     * @return The value with backslashes, quotes and newlines escaped.
+     */
+    std::string escapeLabel(const std::string& value) {
+        std::string escaped;
+        for (char c : value) {
+            if (c == '\\' || c == '"') {
+                escaped += '\\';
+                escaped += c;
+            }
+            else if (c == '\n') {
+                escaped += "\\n";
+            }
+            else {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+}
+
+/**
+ * @brief Constructs an empty registry. It is not installed.
+ */
+MetricsRegistry::MetricsRegistry()
+    : startTime(std::chrono::steady_clock::now()),
+    rowsScanned(0), rowsReturned(0), bytesRead(0), bytesWritten(0), columnClones(0), errors(0) {
+}
+
+/**
+ * @brief Uninstalls the registry if needed and deletes the histograms.
+ */
+MetricsRegistry::~MetricsRegistry() {
+    MetricsRegistry* expected = this;
+    installed.compare_exchange_strong(expected, nullptr);
+
+    for (auto& entry : histograms) {
+        delete entry.second;
+    }
+    histograms.clear();
+}
+
+/**
+ * @brief Makes this the registry that `Instrumentation` reports to.
+ */
+void MetricsRegistry::install() {
+    installed.store(this, std::memory_order_release);
+}
+
+/**
+ * @brief Returns the installed registry.
+ * @return The registry, or nullptr if none is installed.
+ */
+MetricsRegistry* MetricsRegistry::current() {
+    return installed.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Returns the seconds elapsed since the registry was created.
+ * @return The uptime, at least one microsecond.
+ */
+double MetricsRegistry::uptimeSeconds() const {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    return elapsed.count() > 1e-6 ? elapsed.count() : 1e-6;
+}
+
+/**
+ * @brief Records the execution time of a command.
+ *
+ * The histogram of a command name is created on its first execution; later
+ * recordings only take the lock for the lookup.
+ *
+ * @param command The command name.
+ * @param microseconds The execution time.
+ */
+void MetricsRegistry::recordLatency(const std::string& command, uint64_t microseconds) {
+    LatencyHistogram* histogram;
+    {
+        std::lock_guard<std::mutex> lock(histogramsMutex);
+        LatencyHistogram*& slot = histograms[command];
+        if (slot == nullptr) {
+            slot = new LatencyHistogram();
+        }
+        histogram = slot;
+    }
+    histogram->record(microseconds);
+}
+
+/**
+ * @brief Adds scanned rows.
+ * @param rows The number of rows.
+ */
+void MetricsRegistry::addRowsScanned(uint64_t rows) {
+    rowsScanned.fetch_add(rows, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds returned rows.
+ * @param rows The number of rows.
+ */
+void MetricsRegistry::addRowsReturned(uint64_t rows) {
+    rowsReturned.fetch_add(rows, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds bytes read from files.
+ * @param bytes The number of bytes.
+ */
+void MetricsRegistry::addBytesRead(uint64_t bytes) {
+    bytesRead.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds bytes written to files.
+ * @param bytes The number of bytes.
+ */
+void MetricsRegistry::addBytesWritten(uint64_t bytes) {
+    bytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds cloned columns.
+ * @param columns The number of columns.
+ */
+void MetricsRegistry::addColumnClones(uint64_t columns) {
+    columnClones.fetch_add(columns, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Counts one error, in the registry and for the calling thread.
+ */
+void MetricsRegistry::recordError() {
+    errors.fetch_add(1, std::memory_order_relaxed);
+    ++errorsOfCurrentThread;
+}
+
+/**
+ * @brief Returns the number of errors counted so far.
+ * @return The error count.
+ */
+uint64_t MetricsRegistry::getErrorCount() const {
+    return errors.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the number of errors counted so far by the calling thread.
+ * @return The error count of the calling thread.
+ */
+uint64_t MetricsRegistry::getErrorCountOfCurrentThread() {
+    return errorsOfCurrentThread;
+}
+
+/**
+ * @brief Formats the metrics for the console.
+ *
+ * Rates are averages over the lifetime of the registry.
+ *
+ * @return One line per command, followed by the counters and their rates.
+ */
+std::vector<std::string> MetricsRegistry::summary() const {
+    double uptime = uptimeSeconds();
+    std::vector<std::string> lines;
+
+    lines.push_back("Uptime: " + formatNumber(uptime, 1) + "s");
+    lines.push_back("Command latencies:");
+
+    {
+        std::lock_guard<std::mutex> lock(histogramsMutex);
+        if (histograms.empty()) {
+            lines.push_back("  (no commands executed)");
+        }
+        for (const auto& entry : histograms) {
+            const LatencyHistogram& histogram = *entry.second;
+            lines.push_back("  " + entry.first
+                + ": count=" + std::to_string(histogram.getCount())
+                + " p50=" + formatMilliseconds(histogram.valueAtPercentile(50.0))
+                + " p99=" + formatMilliseconds(histogram.valueAtPercentile(99.0))
+                + " p999=" + formatMilliseconds(histogram.valueAtPercentile(99.9))
+                + " max=" + formatMilliseconds(histogram.getMax())
+                + " rate=" + formatNumber(histogram.getCount() / uptime, 3) + "/s");
+        }
+    }
+
+    struct Counter {
+        const char* name;
+        uint64_t value;
+    };
+    const Counter counters[] = {
+        { "Rows scanned", rowsScanned.load() },
+        { "Rows returned", rowsReturned.load() },
+        { "Bytes read", bytesRead.load() },
+        { "Bytes written", bytesWritten.load() },
+        { "Columns cloned", columnClones.load() },
+        { "Errors", errors.load() }
+    };
+
+    lines.push_back("Counters:");
+    for (const Counter& counter : counters) {
+        lines.push_back(std::string("  ") + counter.name + ": " + std::to_string(counter.value)
+            + " (" + formatNumber(counter.value / uptime, 1) + "/s)");
+    }
+    return lines;
+}
+
+/**
+ * @brief Formats the metrics in the Prometheus text exposition format.
+ *
+ * Command latencies are exported as a summary with the 0.5, 0.99 and 0.999
+ * quantiles in seconds; the counters are exported with the `_total` suffix.
+ *
+ * @return The exposition text, one sample per line.
+ */
+std::string MetricsRegistry::toPrometheus() const {
+    std::string text;
+
+    text += "# HELP dbcp_command_duration_seconds Execution time of the commands.\n";
+    text += "# TYPE dbcp_command_duration_seconds summary\n";
+    {
+        std::lock_guard<std::mutex> lock(histogramsMutex);
+        for (const auto& entry : histograms) {
+            const LatencyHistogram& histogram = *entry.second;
+            std::string label = "command=\"" + escapeLabel(entry.first) + "\"";
+
+            const char* quantiles[] = { "0.5", "0.99", "0.999" };
+            const double percentiles[] = { 50.0, 99.0, 99.9 };
+            for (int i = 0; i < 3; ++i) {
+                text += "dbcp_command_duration_seconds{" + label + ",quantile=\"" + quantiles[i] + "\"} "
+                    + formatSeconds(histogram.valueAtPercentile(percentiles[i])) + "\n";
+            }
+            text += "dbcp_command_duration_seconds_sum{" + label + "} " + formatSeconds(histogram.getSum()) + "\n";
+            text += "dbcp_command_duration_seconds_count{" + label + "} " + std::to_string(histogram.getCount()) + "\n";
+        }
+    }
+
+    struct Counter {
+        const char* name;
+        const char* help;
+        uint64_t value;
+    };
+    const Counter counters[] = {
+        { "dbcp_rows_scanned_total", "Rows examined by scans.", rowsScanned.load() },
+        { "dbcp_rows_returned_total", "Rows shown to the user or written as a result.", rowsReturned.load() },
+        { "dbcp_bytes_read_total", "Bytes read from files.", bytesRead.load() },
+        { "dbcp_bytes_written_total", "Bytes written to files.", bytesWritten.load() },
+        { "dbcp_column_clones_total", "Columns cloned, e.g. by copying a table.", columnClones.load() },
+        { "dbcp_errors_total", "Failed commands and reported errors.", errors.load() }
+    };
+
+    for (const Counter& counter : counters) {
+        text += std::string("# HELP ") + counter.name + " " + counter.help + "\n";
+        text += std::string("# TYPE ") + counter.name + " counter\n";
+        text += std::string(counter.name) + " " + std::to_string(counter.value) + "\n";
+    }
+    return text;
+}
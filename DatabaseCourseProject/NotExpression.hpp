@@ -0,0 +1,75 @@
+#pragma once
+#include <string>
+#include "Expression.hpp"
+
+/**
+ * @class NotExpression
+ * @brief Inner node inverting the selection of its operand.
+ */
+class NotExpression : public Expression {
+private:
+    Expression* operand; ///< The negated expression. Owned by this node.
+
+public:
+    /**
+     * @brief Creates the node `NOT operand`, taking ownership of the operand.
+     * @param operand The expression to negate.
+     */
+    explicit NotExpression(Expression* operand);
+
+    /**
+     * @brief Deletes the operand.
+     */
+    ~NotExpression() override;
+
+    /**
+     * @brief Expression trees own their nodes and are not copied.
+     */
+    NotExpression(const NotExpression& other) = delete;
+
+    /**
+     * @brief Expression trees own their nodes and are not copied.
+     */
+    NotExpression& operator=(const NotExpression& other) = delete;
+
+    /**
+     * @brief Binds the operand to `table`.
+     * @param table The table the expression will be evaluated on.
+     * @throws std::runtime_error If the operand cannot be bound.
+     */
+    void bind(const Table& table) override;
+
+    /**
+     * @brief Evaluates the operand for [begin, end) and inverts the bitmap.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param result Receives one bit per row of the batch.
+     */
+    void evaluate(int begin, int end, SelectionBitmap& result) const override;
+
+    /**
+     * @brief Returns the node as text, e.g. `NOT $0 IS NULL`.
+     * @return The expression as text.
+     */
+    std::string toString() const override;
+
+    /**
+     * @brief Estimates the selectivity as the complement of the operand's estimate.
+     * @return A fraction in [0, 1].
+     */
+    double estimateSelectivity() const override;
+
+    /**
+     * @brief Always returns `false`: the bounds cannot prove that a negation matches nothing.
+     * @return `false`.
+     */
+    bool isProvablyEmpty() const override;
+
+    /**
+     * @brief Always returns `false`: the zone maps cannot prove that a negation matches nothing.
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @return `false`.
+     */
+    bool isProvablyEmptyIn(int begin, int end) const override;
+};
@@ -0,0 +1,70 @@
+#include "NotExpression.hpp"
+
+/**
+ * @brief Creates the node `NOT operand`, taking ownership of the operand.
+ * @param operand The expression to negate.
+ */
+NotExpression::NotExpression(Expression* operand)
+    : operand(operand) {
+}
+
+/**
+ * @brief Deletes the operand.
+ */
+NotExpression::~NotExpression() {
+    delete operand;
+}
+
+/**
+ * @brief Binds the operand to `table`.
+ * @param table The table the expression will be evaluated on.
+ * @throws std::runtime_error If the operand cannot be bound.
+ */
+void NotExpression::bind(const Table& table) {
+    operand->bind(table);
+}
+
+/**
+ * @brief Evaluates the operand for [begin, end) and inverts the bitmap.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param result Receives one bit per row of the batch.
+ */
+void NotExpression::evaluate(int begin, int end, SelectionBitmap& result) const {
+    operand->evaluate(begin, end, result);
+    result.invert();
+}
+
+/**
+ * @brief Returns the node as text, e.g. `NOT $0 IS NULL`.
+ * @return The expression as text.
+ */
+std::string NotExpression::toString() const {
+    return "NOT " + operand->toString();
+}
+
+/**
+ * @brief Estimates the selectivity as the complement of the operand's estimate.
+ * @return A fraction in [0, 1].
+ */
+double NotExpression::estimateSelectivity() const {
+    return 1.0 - operand->estimateSelectivity();
+}
+
+/**
+ * @brief Always returns `false`: the bounds cannot prove that a negation matches nothing.
+ * @return `false`.
+ */
+bool NotExpression::isProvablyEmpty() const {
+    return false;
+}
+
+/**
+ * @brief Always returns `false`: the zone maps cannot prove that a negation matches nothing.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @return `false`.
+ */
+bool NotExpression::isProvablyEmptyIn(int /*begin*/, int /*end*/) const {
+    return false;
+}
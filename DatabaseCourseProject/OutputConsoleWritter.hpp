@@ -3,6 +3,10 @@
 #include <string>
 
 class OutputConsoleWritter {
+private:
+	bool silent; ///< Whether output is discarded, e.g. while a workload is replayed.
+	bool buffered; ///< Whether lines are left in the stream buffer instead of being flushed one by one, e.g. in batch mode.
+
 public:
 	/**
 	* @brief Constructs a new `OutputConsoleWritter` instance.
@@ -17,7 +21,7 @@ public:
 	* Cleans up any resources held by the writer. As this class currently
 	* doesn't manage dynamic memory, the default destructor is sufficient.
 	*/
-	~OutputConsoleWritter();
+	virtual ~OutputConsoleWritter();
 	/**
 	* @brief Prints a message to the console followed by a newline character.
 	*
@@ -26,7 +30,7 @@ public:
 	*
 	* @param messsage The string to be printed.
 	*/
-	void printLine(const std::string& messsage) const;
+	virtual void printLine(const std::string& messsage) const;
 
 	/**
 	* @brief Prints a message to the console without a trailing newline character.
@@ -36,5 +40,33 @@ public:
 	*
 	* @param message The string to be printed.
 	*/
-	void print(const std::string& message) const;
+	virtual void print(const std::string& message) const;
+
+	/**
+	* @brief Discards or restores console output.
+	*
+	* @param silent `true` to discard everything printed until the next call with `false`.
+	*/
+	void setSilent(bool silent);
+
+	/**
+	* @brief Switches between flushing every line and buffering the output.
+	*
+	* Flushing after every line keeps an interactive session responsive but
+	* dominates the cost of printing large results to a pipe. Switching
+	* buffering off flushes what is still buffered.
+	*
+	* @param buffered `true` to let the stream decide when to flush.
+	*/
+	void setBuffered(bool buffered);
+
+	/**
+	* @brief Prints an error message to the standard error stream followed by a newline character.
+	*
+	* The standard output is flushed first, so the message appears after the
+	* output that preceded it. Error messages are printed even while the writer is silent.
+	*
+	* @param message The string to be printed.
+	*/
+	virtual void printError(const std::string& message) const;
 };
\ No newline at end of file
@@ -5,10 +5,10 @@
 /**
  * @brief Constructs a new `OutputConsoleWritter` instance.
  *
- * This constructor performs no specific initialization beyond default-constructing
- * member variables (of which there are none in this class).
+ * The writer starts printing, i.e. not silent, and flushes every line.
  */
-OutputConsoleWritter::OutputConsoleWritter() {
+OutputConsoleWritter::OutputConsoleWritter()
+	: silent(false), buffered(false) {
 
 }
 
@@ -27,7 +27,12 @@ OutputConsoleWritter::~OutputConsoleWritter() {
  * @param messsage The string to be printed.
  */
 void OutputConsoleWritter::printLine(const std::string& messsage) const {
-	std::cout << messsage << std::endl;
+	if (!silent) {
+		std::cout << messsage << '\n';
+		if (!buffered) {
+			std::cout.flush();
+		}
+	}
 }
 
 /**
@@ -35,5 +40,34 @@ void OutputConsoleWritter::printLine(const std::string& messsage) const {
  * @param message The string to be printed.
  */
 void OutputConsoleWritter::print(const std::string& message) const {
-	std::cout << message;
-}
\ No newline at end of file
+	if (!silent) {
+		std::cout << message;
+	}
+}
+/**
+ * @brief Discards or restores console output.
+ * @param silent `true` to discard everything printed until the next call with `false`.
+ */
+void OutputConsoleWritter::setSilent(bool silent) {
+	this->silent = silent;
+}
+
+/**
+ * @brief Switches between flushing every line and buffering the output.
+ * @param buffered `true` to let the stream decide when to flush.
+ */
+void OutputConsoleWritter::setBuffered(bool buffered) {
+	this->buffered = buffered;
+	if (!buffered) {
+		std::cout.flush();
+	}
+}
+
+/**
+ * @brief Prints an error message to the standard error stream followed by a newline character.
+ * @param message The string to be printed.
+ */
+void OutputConsoleWritter::printError(const std::string& message) const {
+	std::cout.flush();
+	std::cerr << message << std::endl;
+}
@@ -1,8 +1,10 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include <vector>
 #include "Table.hpp"
 #include "Catalog.hpp"
+#include "FormattedCells.hpp"
 
 /**
  * @class OutputFileWritter
@@ -60,4 +62,48 @@ public:
 	* @throws std::runtime_error If the file cannot be opened for writing.
 	*/
 	void writeCatalogToFile(Catalog& catalog, std::string filepath);
+
+	/**
+	* @brief Writes a block of text to a specified file, replacing its content.
+	*
+	* Used for exports that are not tables, e.g. the metrics in Prometheus format.
+	*
+	* @param text The text to write, written as is.
+	* @param filepath The full path to the file.
+	* @throws std::runtime_error If the file cannot be opened for writing.
+	*/
+	void writeTextToFile(const std::string& text, std::string filepath);
+
+	/**
+	* @brief Starts a table file without rows, replacing its content.
+	*
+	* Writes the first three lines of the format of `writeTableToFile`. Rows
+	* can then be added in blocks with `appendRowsToFile`, so tables that do
+	* not fit into memory can be written while they are produced.
+	*
+	* @param name The table name.
+	* @param types The column types, e.g. "Integer".
+	* @param names The column names.
+	* @param filepath The full path to the file.
+	* @throws std::runtime_error If the file cannot be opened for writing.
+	*/
+	void writeTableHeaderToFile(const std::string& name, const std::vector<std::string>& types,
+		const std::vector<std::string>& names, std::string filepath);
+
+	/**
+	* @brief Appends a block of rows to a table file started with `writeTableHeaderToFile`.
+	*
+	* @param columns The cells of the block, one `FormattedCells` per column; all have the same size.
+	* @param filepath The full path to the file.
+	* @throws std::runtime_error If the file cannot be opened for writing.
+	*/
+	void appendRowsToFile(const std::vector<FormattedCells>& columns, std::string filepath);
+
+private:
+	/**
+	* @brief Joins blocks of formatted cells into rows in file format.
+	* @param columns The cells of the block, one `FormattedCells` per column; all have the same size.
+	* @param block The string the rows are appended to, each followed by a line break.
+	*/
+	static void appendRows(const std::vector<FormattedCells>& columns, std::string& block);
 };
\ No newline at end of file
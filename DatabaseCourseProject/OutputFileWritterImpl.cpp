@@ -1,7 +1,11 @@
 #include "OutputFileWritter.hpp"
+#include "Instrumentation.hpp"
+#include "TraceSpan.hpp"
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <algorithm>
 
 /**
  * @brief Constructs a new `OutputFileWritter` instance.
@@ -22,6 +26,19 @@ OutputFileWritter::~OutputFileWritter() {
 
 }
 
+/**
+ * @brief Joins blocks of formatted cells into rows in file format.
+ * @param columns The cells of the block, one `FormattedCells` per column, all of the same size.
+ * @param block The string the rows are appended to, each followed by a line break.
+ */
+void OutputFileWritter::appendRows(const std::vector<FormattedCells>& columns, std::string& block) {
+	size_t rows = columns.empty() ? 0 : columns[0].size();
+	for (size_t i = 0; i < rows; ++i) {
+		FormattedCells::appendRow(columns, i, block);
+		block += '\n';
+	}
+}
+
 /**
  * @brief Writes a `Table` object's data to a specified file.
  *
@@ -29,11 +46,16 @@ OutputFileWritter::~OutputFileWritter() {
  * (name, column types, column names) and all its data rows in a CSV-like format.
  * Each piece of data (type, name, cell value) is separated by commas.
  *
+ * The rows are written in blocks of `FormattedCells::BLOCK_ROWS`: every column
+ * formats its cells of a block with one `TableColumn::appendValues` call, and
+ * the block is joined into rows and written at once.
+ *
  * @param table A reference to the `Table` object to be written.
  * @param filepath The path to the output file.
  * @throws std::runtime_error If the file cannot be opened for writing.
  */
 void OutputFileWritter::writeTableToFile(Table& table, std::string filepath) {
+	TraceSpan span("writeTableToFile", filepath);
 	std::ofstream out(filepath);
 	if (!out.is_open()) {
 		throw std::runtime_error("Unable to open file: " + filepath);
@@ -64,20 +86,22 @@ void OutputFileWritter::writeTableToFile(Table& table, std::string filepath) {
 	}
 	out << "\n"; 
 
-	int numRows = 0;
-	if (numCols > 0) {
-		numRows = table.getColumnAtGivenIndex(0)->getSize();
-	}
+	int numRows = table.getColumnAtGivenIndex(0)->getSize();
 
-	for (int i = 0; i < numRows; ++i) { 
-		for (int j = 0; j < numCols; ++j) { 
-			out << table.getColumnAtGivenIndex(j)->returnValueAtGivenIndexAsString(i);
-			if (j < numCols - 1) {
-				out << ","; 
-			}
+	std::vector<FormattedCells> columns(numCols);
+	std::string block;
+	for (int first = 0; first < numRows; first += FormattedCells::BLOCK_ROWS) {
+		int last = std::min(numRows, first + FormattedCells::BLOCK_ROWS);
+		for (int j = 0; j < numCols; ++j) {
+			columns[j].clear();
+			table.getColumnAtGivenIndex(j)->appendValues(first, last, columns[j]);
 		}
-		out << "\n"; 
+
+		block.clear();
+		appendRows(columns, block);
+		out << block;
 	}
+	Instrumentation::recordBytesWritten(static_cast<long long>(out.tellp()));
 	out.close();
 
 }
@@ -101,7 +125,80 @@ void OutputFileWritter::writeCatalogToFile(Catalog& catalog, std::string filepat
 	for (const Table& table : catalog) {
 		out << table.getName() << "," << table.getFilename() << "\n";
 	}
+	Instrumentation::recordBytesWritten(static_cast<long long>(out.tellp()));
+
+	out.close();
+
+}
+
+/**
+ * @brief Writes a block of text to a specified file, replacing its content.
+ *
+ * @param text The text to write, written as is.
+ * @param filepath The path to the output file.
+ * @throws std::runtime_error If the file cannot be opened for writing.
+ */
+void OutputFileWritter::writeTextToFile(const std::string& text, std::string filepath) {
+	std::ofstream out(filepath);
+	if (!out.is_open()) {
+		throw std::runtime_error("Unable to open file: " + filepath);
+	}
+
+	out << text;
+	Instrumentation::recordBytesWritten(static_cast<long long>(text.size()));
+	out.close();
+}
+
+/**
+ * @brief Starts a table file without rows, replacing its content.
+ *
+ * @param name The table name.
+ * @param types The column types.
+ * @param names The column names.
+ * @param filepath The path to the output file.
+ * @throws std::runtime_error If the file cannot be opened for writing.
+ */
+void OutputFileWritter::writeTableHeaderToFile(const std::string& name, const std::vector<std::string>& types,
+	const std::vector<std::string>& names, std::string filepath) {
+	std::ofstream out(filepath);
+	if (!out.is_open()) {
+		throw std::runtime_error("Unable to open file: " + filepath);
+	}
 
+	out << name << "\n";
+	for (size_t i = 0; i < types.size(); ++i) {
+		out << (i > 0 ? "," : "") << types[i];
+	}
+	out << "\n";
+	for (size_t i = 0; i < names.size(); ++i) {
+		out << (i > 0 ? "," : "") << names[i];
+	}
+	out << "\n";
+
+	Instrumentation::recordBytesWritten(static_cast<long long>(out.tellp()));
 	out.close();
+}
 
-}
\ No newline at end of file
+/**
+ * @brief Appends a block of rows to a table file started with `writeTableHeaderToFile`.
+ *
+ * The block is formatted into one buffer first and written with a single call.
+ *
+ * @param columns The cells of the block, one `FormattedCells` per column.
+ * @param filepath The path to the output file.
+ * @throws std::runtime_error If the file cannot be opened for writing.
+ */
+void OutputFileWritter::appendRowsToFile(const std::vector<FormattedCells>& columns, std::string filepath) {
+	TraceSpan span("appendRowsToFile", filepath);
+	std::ofstream out(filepath, std::ios::app);
+	if (!out.is_open()) {
+		throw std::runtime_error("Unable to open file: " + filepath);
+	}
+
+	std::string block;
+	appendRows(columns, block);
+
+	out << block;
+	Instrumentation::recordBytesWritten(static_cast<long long>(block.size()));
+	out.close();
+}
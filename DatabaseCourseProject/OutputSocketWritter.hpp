@@ -0,0 +1,80 @@
+#pragma once
+#include "OutputConsoleWritter.hpp"
+#include "Socket.hpp"
+#include <string>
+
+/**
+ * @class OutputSocketWritter
+ * @brief Sends the output of a server session to its client connection.
+ *
+ * Plugged into the `CommandContext` of a session in place of the console
+ * writer. Output is framed with the session protocol:
+ * - every output line is sent as a line; a line that starts with `.` gets an
+ *   additional leading `.`, so no output line can be mistaken for the end marker,
+ * - the response to a command ends with the line `.ok` or `.error`.
+ *
+ * Output is collected in a buffer and sent in chunks, when the buffer grows
+ * large and at the end of every response. A broken connection never throws
+ * into the command that is printing; the output is dropped instead and
+ * `isBroken()` reports it.
+ *
+ * @note The writer keeps a reference to the socket, which must outlive it.
+ */
+class OutputSocketWritter : public OutputConsoleWritter {
+private:
+	/// Size at which the buffered output is sent before the response is complete.
+	static const size_t SEND_THRESHOLD = 64 * 1024;
+
+	Socket& socket;              ///< The client connection.
+	mutable std::string pending; ///< Framed output that has not been sent yet.
+	mutable bool atLineStart;    ///< Whether the next character starts a new line.
+	mutable bool broken;         ///< Whether sending failed; further output is dropped.
+
+	/**
+	* @brief Frames `text` and appends it to the pending output.
+	* @param text The text to send.
+	*/
+	void write(const std::string& text) const;
+
+	/**
+	* @brief Sends the pending output.
+	*/
+	void send() const;
+
+public:
+	/**
+	* @brief Constructs a writer for a client connection.
+	* @param socket The connection the output is sent to.
+	*/
+	explicit OutputSocketWritter(Socket& socket);
+
+	/**
+	* @brief Sends a message followed by a line break.
+	* @param messsage The string to be sent.
+	*/
+	void printLine(const std::string& messsage) const override;
+
+	/**
+	* @brief Sends a message without a line break.
+	* @param message The string to be sent.
+	*/
+	void print(const std::string& message) const override;
+
+	/**
+	* @brief Sends an error message like any other line; the client sees it in the response.
+	* @param message The string to be sent.
+	*/
+	void printError(const std::string& message) const override;
+
+	/**
+	* @brief Completes the response to a command with its end marker and sends it.
+	* @param succeeded Whether the command succeeded (`.ok`) or failed (`.error`).
+	*/
+	void endResponse(bool succeeded);
+
+	/**
+	* @brief Checks whether the connection broke while sending.
+	* @return `true` if output had to be dropped.
+	*/
+	bool isBroken() const;
+};
@@ -0,0 +1,94 @@
+#include "OutputSocketWritter.hpp"
+
+/**
+ * @brief Constructs a writer for a client connection.
+ * @param socket The connection the output is sent to.
+ */
+OutputSocketWritter::OutputSocketWritter(Socket& socket)
+	: socket(socket), atLineStart(true), broken(false) {
+}
+
+/**
+ * @brief Frames `text` and appends it to the pending output.
+ *
+ * A `.` at the start of a line is doubled. Once the pending output exceeds
+ * `SEND_THRESHOLD` it is sent, so printing a large result needs bounded memory.
+ *
+ * @param text The text to send.
+ */
+void OutputSocketWritter::write(const std::string& text) const {
+	if (broken) {
+		return;
+	}
+	for (char c : text) {
+		if (atLineStart && c == '.') {
+			pending += '.';
+		}
+		pending += c;
+		atLineStart = c == '\n';
+	}
+	if (pending.size() >= SEND_THRESHOLD) {
+		send();
+	}
+}
+
+/**
+ * @brief Sends the pending output.
+ */
+void OutputSocketWritter::send() const {
+	if (!broken && !socket.writeAll(pending)) {
+		broken = true;
+	}
+	pending.clear();
+}
+
+/**
+ * @brief Sends a message followed by a line break.
+ * @param messsage The string to be sent.
+ */
+void OutputSocketWritter::printLine(const std::string& messsage) const {
+	write(messsage + "\n");
+}
+
+/**
+ * @brief Sends a message without a line break.
+ * @param message The string to be sent.
+ */
+void OutputSocketWritter::print(const std::string& message) const {
+	write(message);
+}
+
+/**
+ * @brief Sends an error message like any other line.
+ * @param message The string to be sent.
+ */
+void OutputSocketWritter::printError(const std::string& message) const {
+	write(message + "\n");
+}
+
+/**
+ * @brief Completes the response to a command with its end marker and sends it.
+ *
+ * An unterminated last line (e.g. after `print`) is terminated first, so the
+ * marker always starts a line of its own.
+ *
+ * @param succeeded Whether the command succeeded (`.ok`) or failed (`.error`).
+ */
+void OutputSocketWritter::endResponse(bool succeeded) {
+	if (!atLineStart) {
+		write("\n");
+	}
+	if (!broken) {
+		pending += succeeded ? ".ok\n" : ".error\n";
+	}
+	send();
+	atLineStart = true;
+}
+
+/**
+ * @brief Checks whether the connection broke while sending.
+ * @return `true` if output had to be dropped.
+ */
+bool OutputSocketWritter::isBroken() const {
+	return broken;
+}
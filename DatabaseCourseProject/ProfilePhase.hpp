@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <chrono>
+#include "ExecutionProfile.hpp"
+
+/**
+ * @class ProfilePhase
+ * @brief Scoped timer that charges a block of code to a phase of the active `ExecutionProfile`.
+ *
+ * @code
+ * ProfilePhase phase("scan");
+ * // ... work ...
+ * phase.stop(); // optional, the destructor stops it otherwise
+ * @endcode
+ *
+ * When no profile is active, or the phase runs on a thread other than the one
+ * that started the profile, the timer does nothing.
+ */
+class ProfilePhase {
+private:
+    ExecutionProfile* profile;                          ///< The profile charged, or nullptr.
+    std::string name;                                   ///< The phase name.
+    std::chrono::steady_clock::time_point startTime;    ///< When the phase started.
+
+public:
+    /**
+     * @brief Starts timing the phase `name`.
+     * @param name The phase name, e.g. `table resolution`.
+     */
+    explicit ProfilePhase(const char* name);
+
+    /**
+     * @brief Stops the phase if `stop()` was not called.
+     */
+    ~ProfilePhase();
+
+    /**
+     * @brief Deleted copy constructor; a phase is charged exactly once.
+     */
+    ProfilePhase(const ProfilePhase& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; a phase is charged exactly once.
+     */
+    ProfilePhase& operator=(const ProfilePhase& other) = delete;
+
+    /**
+     * @brief Ends the phase before the end of the scope. Later calls have no effect.
+     */
+    void stop();
+};
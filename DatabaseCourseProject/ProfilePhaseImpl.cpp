@@ -0,0 +1,42 @@
+#include "ProfilePhase.hpp"
+
+/**
+ * @brief Starts timing the phase `name`.
+ *
+ * The name is only copied when a profile is active, so an idle phase costs a
+ * pointer check.
+ *
+ * @param name The phase name, e.g. `table resolution`.
+ */
+ProfilePhase::ProfilePhase(const char* name)
+    : profile(ExecutionProfile::current()) {
+
+    if (profile != nullptr && !profile->ownsCallingThread()) {
+        profile = nullptr;
+    }
+    if (profile != nullptr) {
+        this->name = name;
+        profile->enterPhase();
+        startTime = std::chrono::steady_clock::now();
+    }
+}
+
+/**
+ * @brief Stops the phase if `stop()` was not called.
+ */
+ProfilePhase::~ProfilePhase() {
+    stop();
+}
+
+/**
+ * @brief Ends the phase and charges its time to the profile. Later calls have no effect.
+ */
+void ProfilePhase::stop() {
+    if (profile == nullptr) {
+        return;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+    profile->leavePhase(name, elapsed.count());
+    profile = nullptr;
+}
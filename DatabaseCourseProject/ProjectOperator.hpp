@@ -0,0 +1,28 @@
+#pragma once
+#include <vector>
+#include "QueryOperator.hpp"
+
+/**
+ * @class ProjectOperator
+ * @brief Streaming operator that keeps and reorders the columns of each row.
+ */
+class ProjectOperator : public QueryOperator {
+private:
+    std::vector<int> columns; ///< Input positions of the output columns, in output order.
+    QueryRow output;          ///< Buffer reused for every output row.
+
+public:
+    /**
+     * @brief Constructs the projection.
+     * @param columns The input positions of the output columns, in output order.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    ProjectOperator(const std::vector<int>& columns, QueryOperator* next);
+
+    /**
+     * @brief Pushes the projected row downstream.
+     * @param row The input row.
+     * @return The result of the downstream operator.
+     */
+    bool consume(const QueryRow& row) override;
+};
@@ -0,0 +1,22 @@
+#include "ProjectOperator.hpp"
+
+/**
+ * @brief Constructs the projection.
+ * @param columns The input positions of the output columns, in output order.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+ProjectOperator::ProjectOperator(const std::vector<int>& columns, QueryOperator* next)
+    : QueryOperator(next), columns(columns), output(columns.size()) {
+}
+
+/**
+ * @brief Copies the selected cells into the output buffer and pushes it downstream.
+ * @param row The input row.
+ * @return The result of the downstream operator.
+ */
+bool ProjectOperator::consume(const QueryRow& row) {
+    for (size_t i = 0; i < columns.size(); ++i) {
+        output[i] = row[columns[i]];
+    }
+    return next->consume(output);
+}
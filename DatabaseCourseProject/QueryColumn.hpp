@@ -0,0 +1,22 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "ColumnType.hpp"
+
+/**
+ * @brief A row flowing through a query pipeline.
+ *
+ * Cells are kept in the same string form `TableColumn::returnValueAtGivenIndexAsString`
+ * produces, so an empty string is a NULL value.
+ */
+using QueryRow = std::vector<std::string>;
+
+/**
+ * @struct QueryColumn
+ * @brief Describes one column of the rows produced by a query operator.
+ */
+struct QueryColumn {
+    std::string table; ///< The table the column comes from; empty for computed columns.
+    std::string name;  ///< The column name shown in the result header.
+    ColumnType type;   ///< The type of the values, used for comparisons and arithmetic.
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "QueryColumn.hpp"
+
+/**
+ * @class QueryOperator
+ * @brief Abstract base class for the operators of a push-based query pipeline.
+ *
+ * Operators are chained from the source towards the result: every operator
+ * owns the operator it pushes its output rows to. A run calls `open()` once,
+ * then `consume()` for every input row, then `finish()` once. Both `open()`
+ * and `finish()` are forwarded down the chain.
+ *
+ * Streaming operators (projection, limit, join probe) push each row on as
+ * soon as it arrives. Blocking operators (sort, aggregate) buffer their
+ * input and push their output from `finish()`.
+ */
+class QueryOperator {
+protected:
+    QueryOperator* next; ///< The operator receiving this operator's output. Owned; nullptr for the final sink.
+
+public:
+    /**
+     * @brief Constructs an operator that pushes its output into `next`.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    explicit QueryOperator(QueryOperator* next);
+
+    /**
+     * @brief Deletes the downstream chain.
+     */
+    virtual ~QueryOperator();
+
+    QueryOperator(const QueryOperator& other) = delete;
+    QueryOperator& operator=(const QueryOperator& other) = delete;
+
+    /**
+     * @brief Prepares the operator before the first row arrives.
+     *
+     * The default implementation forwards to `next`.
+     */
+    virtual void open();
+
+    /**
+     * @brief Receives one input row.
+     *
+     * @param row The row. It is only valid during the call.
+     * @return `false` if no more input is needed, so the producer may stop early.
+     */
+    virtual bool consume(const QueryRow& row) = 0;
+
+    /**
+     * @brief Signals that the input is complete.
+     *
+     * The default implementation forwards to `next`.
+     */
+    virtual void finish();
+};
@@ -0,0 +1,34 @@
+#include "QueryOperator.hpp"
+
+/**
+ * @brief Constructs an operator that pushes its output into `next`.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+QueryOperator::QueryOperator(QueryOperator* next)
+    : next(next) {
+}
+
+/**
+ * @brief Deletes the downstream chain.
+ */
+QueryOperator::~QueryOperator() {
+    delete next;
+}
+
+/**
+ * @brief Prepares the operator before the first row arrives by forwarding to `next`.
+ */
+void QueryOperator::open() {
+    if (next) {
+        next->open();
+    }
+}
+
+/**
+ * @brief Signals the end of the input by forwarding to `next`.
+ */
+void QueryOperator::finish() {
+    if (next) {
+        next->finish();
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <string>
+#include "SelectStatement.hpp"
+
+/**
+ * @class QueryParser
+ * @brief A static utility class that parses the SQL subset of the `query` command.
+ *
+ * Supported grammar (keywords are case-insensitive):
+ * @code
+ * SELECT <item> [, <item> ...]
+ * FROM <table>
+ * [[INNER] JOIN <table> ON <column> = <column>]
+ * [WHERE <condition>]
+ * [GROUP BY <column> [, <column> ...]]
+ * [ORDER BY <key> [ASC|DESC] [, <key> [ASC|DESC] ...]]
+ * [LIMIT <n>] [OFFSET <m>] [;]
+ *
+ * <item>   ::= * | <column> [AS <name>] | <func>(* | <column>) [AS <name>]
+ * <func>   ::= COUNT | SUM | AVG | MIN | MAX
+ * <column> ::= <name> | $<n> | <table>.<name> | <table>.$<n>
+ * <key>    ::= <column> | <func>(...) | <alias> | <position in the SELECT list>
+ * @endcode
+ *
+ * The WHERE condition uses the operators of `CommandParser::parseExpression`
+ * with SQL literals: strings are single-quoted, bare words are column names.
+ * Its tokens are stored unparsed, because the column names can only be
+ * resolved once the tables are known.
+ */
+class QueryParser {
+public:
+    /**
+     * @brief Parses a statement.
+     *
+     * @param sql The statement text.
+     * @return The parsed statement.
+     * @throws std::runtime_error If the text is not a valid statement of the supported subset.
+     */
+    static SelectStatement parse(const std::string& sql);
+};
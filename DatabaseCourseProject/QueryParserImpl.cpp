@@ -0,0 +1,374 @@
+#include "QueryParser.hpp"
+#include <cctype>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Checks whether `ch` may appear inside a name.
+     * @param ch The character to check.
+     * @return `true` for letters, digits, `_`, `$` and `.`.
+     */
+    bool isNameCharacter(char ch) {
+        return std::isalnum(static_cast<unsigned char>(ch)) || ch == '_' || ch == '$' || ch == '.';
+    }
+
+    /**
+     * @brief Splits a statement into tokens.
+     * @param sql The statement text.
+     * @return The tokens, terminated by an `END` token.
+     * @throws std::runtime_error On an unterminated string or an unexpected character.
+     */
+    std::vector<QueryToken> tokenize(const std::string& sql) {
+        std::vector<QueryToken> tokens;
+        size_t i = 0;
+
+        while (i < sql.size()) {
+            char ch = sql[i];
+            char following = i + 1 < sql.size() ? sql[i + 1] : '\0';
+
+            if (std::isspace(static_cast<unsigned char>(ch))) {
+                ++i;
+            }
+            else if (ch == '\'') {
+                size_t close = sql.find('\'', i + 1);
+                if (close == std::string::npos) {
+                    throw std::runtime_error("Invalid query: unterminated string literal. ");
+                }
+                tokens.push_back({ QueryToken::STRING, sql.substr(i + 1, close - i - 1) });
+                i = close + 1;
+            }
+            else if (std::isdigit(static_cast<unsigned char>(ch))
+                || ((ch == '-' || ch == '.') && std::isdigit(static_cast<unsigned char>(following)))) {
+                size_t start = i++;
+                while (i < sql.size() && (std::isdigit(static_cast<unsigned char>(sql[i])) || sql[i] == '.')) {
+                    ++i;
+                }
+                tokens.push_back({ QueryToken::NUMBER, sql.substr(start, i - start) });
+            }
+            else if (std::isalpha(static_cast<unsigned char>(ch)) || ch == '_' || ch == '$') {
+                size_t start = i;
+                while (i < sql.size() && isNameCharacter(sql[i])) {
+                    ++i;
+                }
+                tokens.push_back({ QueryToken::IDENTIFIER, sql.substr(start, i - start) });
+            }
+            else if (ch == '!' || ch == '<' || ch == '>') {
+                std::string symbol(1, ch);
+                if (following == '=' || (ch == '<' && following == '>')) {
+                    symbol += following;
+                }
+                if (symbol == "!") {
+                    throw std::runtime_error("Invalid query: '!' must be followed by '='. ");
+                }
+                tokens.push_back({ QueryToken::SYMBOL, symbol });
+                i += symbol.size();
+            }
+            else if (std::string("(),*;=").find(ch) != std::string::npos) {
+                tokens.push_back({ QueryToken::SYMBOL, std::string(1, ch) });
+                ++i;
+            }
+            else {
+                throw std::runtime_error("Invalid query: unexpected character '" + std::string(1, ch) + "'. ");
+            }
+        }
+
+        tokens.push_back({ QueryToken::END, "" });
+        return tokens;
+    }
+
+    /**
+     * @brief Recursive descent parser over the tokens of a statement.
+     */
+    class StatementParser {
+    private:
+        std::vector<QueryToken> tokens;
+        size_t position;
+
+        const QueryToken& peek(size_t ahead = 0) const {
+            size_t index = position + ahead;
+            return index < tokens.size() ? tokens[index] : tokens.back();
+        }
+
+        static std::string upper(const std::string& text) {
+            std::string result = text;
+            for (char& ch : result) {
+                ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+            }
+            return result;
+        }
+
+        static bool isReserved(const std::string& word) {
+            static const std::vector<std::string> reserved = {
+                "SELECT", "FROM", "WHERE", "GROUP", "ORDER", "BY", "LIMIT", "OFFSET",
+                "JOIN", "INNER", "ON", "AS", "ASC", "DESC", "AND", "OR", "NOT", "IN", "IS", "NULL"
+            };
+            std::string key = upper(word);
+            for (const std::string& keyword : reserved) {
+                if (keyword == key) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool isKeyword(const QueryToken& token, const std::string& keyword) const {
+            return token.kind == QueryToken::IDENTIFIER && upper(token.text) == keyword;
+        }
+
+        bool acceptKeyword(const std::string& keyword) {
+            if (isKeyword(peek(), keyword)) {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        void expectKeyword(const std::string& keyword) {
+            if (!acceptKeyword(keyword)) {
+                throw std::runtime_error("Invalid query: expected " + keyword + " near '" + peek().text + "'. ");
+            }
+        }
+
+        bool acceptSymbol(const std::string& symbol) {
+            if (peek().kind == QueryToken::SYMBOL && peek().text == symbol) {
+                ++position;
+                return true;
+            }
+            return false;
+        }
+
+        void expectSymbol(const std::string& symbol) {
+            if (!acceptSymbol(symbol)) {
+                throw std::runtime_error("Invalid query: expected '" + symbol + "' near '" + peek().text + "'. ");
+            }
+        }
+
+        std::string parseName(const std::string& description) {
+            const QueryToken& token = peek();
+            if (token.kind != QueryToken::IDENTIFIER || isReserved(token.text)
+                || token.text.find('.') != std::string::npos) {
+                throw std::runtime_error("Invalid query: expected " + description + " near '" + token.text + "'. ");
+            }
+            ++position;
+            return token.text;
+        }
+
+        size_t parseCount(const std::string& clause) {
+            const QueryToken& token = peek();
+            if (token.kind != QueryToken::NUMBER || token.text.find_first_not_of("0123456789") != std::string::npos) {
+                throw std::runtime_error("Invalid query: " + clause + " expects a non-negative integer. ");
+            }
+            ++position;
+            return static_cast<size_t>(std::stoull(token.text));
+        }
+
+        ColumnReference parseColumn() {
+            const QueryToken& token = peek();
+            if (token.kind != QueryToken::IDENTIFIER || isReserved(token.text)) {
+                throw std::runtime_error("Invalid query: expected a column near '" + token.text + "'. ");
+            }
+
+            ColumnReference reference;
+            size_t dot = token.text.find('.');
+            if (dot == std::string::npos) {
+                reference.column = token.text;
+            }
+            else {
+                reference.table = token.text.substr(0, dot);
+                reference.column = token.text.substr(dot + 1);
+            }
+            if (reference.column.empty() || reference.column.find('.') != std::string::npos
+                || (dot != std::string::npos && reference.table.empty())) {
+                throw std::runtime_error("Invalid query: bad column reference '" + token.text + "'. ");
+            }
+            ++position;
+            return reference;
+        }
+
+        bool isAggregateCall() const {
+            if (peek().kind != QueryToken::IDENTIFIER || peek(1).kind != QueryToken::SYMBOL || peek(1).text != "(") {
+                return false;
+            }
+            std::string name = upper(peek().text);
+            return name == "COUNT" || name == "SUM" || name == "AVG" || name == "MIN" || name == "MAX";
+        }
+
+        SelectItem parseValue(bool allowStar) {
+            SelectItem item;
+
+            if (allowStar && acceptSymbol("*")) {
+                return item;
+            }
+
+            if (isAggregateCall()) {
+                std::string name = upper(peek().text);
+                position += 2;
+
+                item.kind = SelectItem::AGGREGATE;
+                if (name == "COUNT") item.function = AggregateFunction::COUNT;
+                else if (name == "SUM") item.function = AggregateFunction::SUM;
+                else if (name == "AVG") item.function = AggregateFunction::AVG;
+                else if (name == "MIN") item.function = AggregateFunction::MIN;
+                else item.function = AggregateFunction::MAX;
+
+                if (acceptSymbol("*")) {
+                    if (item.function != AggregateFunction::COUNT) {
+                        throw std::runtime_error("Invalid query: only COUNT accepts '*'. ");
+                    }
+                    item.countAll = true;
+                }
+                else {
+                    item.column = parseColumn();
+                }
+                expectSymbol(")");
+                return item;
+            }
+
+            item.kind = SelectItem::COLUMN;
+            item.column = parseColumn();
+            return item;
+        }
+
+        void parseSelectList(SelectStatement& statement) {
+            do {
+                SelectItem item = parseValue(true);
+                if (item.kind != SelectItem::ALL && acceptKeyword("AS")) {
+                    item.alias = parseName("an alias");
+                }
+                statement.items.push_back(item);
+            } while (acceptSymbol(","));
+        }
+
+        void parseJoin(SelectStatement& statement) {
+            if (acceptKeyword("INNER")) {
+                expectKeyword("JOIN");
+            }
+            else if (!acceptKeyword("JOIN")) {
+                return;
+            }
+
+            statement.joined = true;
+            statement.joinTable = parseName("a table name");
+            expectKeyword("ON");
+            statement.joinLeft = parseColumn();
+            expectSymbol("=");
+            statement.joinRight = parseColumn();
+        }
+
+        void parseWhere(SelectStatement& statement) {
+            if (!acceptKeyword("WHERE")) {
+                return;
+            }
+
+            int depth = 0;
+            while (peek().kind != QueryToken::END) {
+                const QueryToken& token = peek();
+                if (depth == 0 && (isKeyword(token, "GROUP") || isKeyword(token, "ORDER")
+                    || isKeyword(token, "LIMIT") || isKeyword(token, "OFFSET")
+                    || (token.kind == QueryToken::SYMBOL && token.text == ";"))) {
+                    break;
+                }
+                if (token.kind == QueryToken::SYMBOL && token.text == "(") {
+                    ++depth;
+                }
+                else if (token.kind == QueryToken::SYMBOL && token.text == ")") {
+                    --depth;
+                }
+                statement.where.push_back(token);
+                ++position;
+            }
+
+            if (statement.where.empty()) {
+                throw std::runtime_error("Invalid query: WHERE needs a condition. ");
+            }
+        }
+
+        void parseGroupBy(SelectStatement& statement) {
+            if (!acceptKeyword("GROUP")) {
+                return;
+            }
+            expectKeyword("BY");
+            do {
+                statement.groupBy.push_back(parseColumn());
+            } while (acceptSymbol(","));
+        }
+
+        void parseOrderBy(SelectStatement& statement) {
+            if (!acceptKeyword("ORDER")) {
+                return;
+            }
+            expectKeyword("BY");
+            do {
+                OrderItem order;
+                order.ordinal = 0;
+                if (peek().kind == QueryToken::NUMBER) {
+                    order.ordinal = parseCount("ORDER BY");
+                    if (order.ordinal == 0) {
+                        throw std::runtime_error("Invalid query: ORDER BY positions start at 1. ");
+                    }
+                }
+                else {
+                    order.key = parseValue(false);
+                }
+
+                order.descending = false;
+                if (acceptKeyword("DESC")) {
+                    order.descending = true;
+                }
+                else {
+                    acceptKeyword("ASC");
+                }
+                statement.orderBy.push_back(order);
+            } while (acceptSymbol(","));
+        }
+
+    public:
+        explicit StatementParser(const std::string& sql)
+            : tokens(tokenize(sql)), position(0) {
+        }
+
+        SelectStatement parse() {
+            SelectStatement statement;
+
+            expectKeyword("SELECT");
+            parseSelectList(statement);
+            expectKeyword("FROM");
+            statement.fromTable = parseName("a table name");
+            parseJoin(statement);
+            parseWhere(statement);
+            parseGroupBy(statement);
+            parseOrderBy(statement);
+
+            if (acceptKeyword("LIMIT")) {
+                statement.limited = true;
+                statement.limit = parseCount("LIMIT");
+            }
+            if (acceptKeyword("OFFSET")) {
+                statement.offset = parseCount("OFFSET");
+            }
+            acceptSymbol(";");
+
+            if (peek().kind != QueryToken::END) {
+                throw std::runtime_error("Invalid query: unexpected '" + peek().text + "'. ");
+            }
+            return statement;
+        }
+    };
+}
+
+/**
+ * @brief Parses a statement.
+ *
+ * The text is tokenized first and then parsed clause by clause in the fixed
+ * order of the grammar. The WHERE clause extends up to the next top-level
+ * GROUP, ORDER, LIMIT or OFFSET keyword.
+ *
+ * @param sql The statement text.
+ * @return The parsed statement.
+ * @throws std::runtime_error If the text is not a valid statement of the supported subset.
+ */
+SelectStatement QueryParser::parse(const std::string& sql) {
+    StatementParser parser(sql);
+    return parser.parse();
+}
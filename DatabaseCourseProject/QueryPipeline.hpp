@@ -0,0 +1,60 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "TableScan.hpp"
+#include "QueryOperator.hpp"
+#include "ResultCollector.hpp"
+
+/**
+ * @class QueryPipeline
+ * @brief A compiled query: a table scan pushing into a chain of operators ending in a `ResultCollector`.
+ *
+ * Pipelines are built by `QueryPlanner::compile`. Executing one opens the
+ * chain (hash joins build their tables here), lets the scan push every
+ * qualifying row through the chain and finally flushes the blocking
+ * operators with `finish()`.
+ */
+class QueryPipeline {
+private:
+    TableScan* source;                     ///< The driving scan. Owned.
+    QueryOperator* root;                   ///< The first operator of the chain. Owned.
+    const ResultCollector* collector;      ///< The sink at the end of the chain. Owned through `root`.
+    std::vector<std::string> columnNames;  ///< Names of the result columns.
+
+public:
+    /**
+     * @brief Assembles a pipeline.
+     * @param source The driving scan. Ownership is transferred.
+     * @param root The first operator of the chain. Ownership is transferred.
+     * @param collector The sink at the end of the chain starting at `root`.
+     * @param columnNames Names of the result columns.
+     */
+    QueryPipeline(TableScan* source, QueryOperator* root, const ResultCollector* collector,
+        const std::vector<std::string>& columnNames);
+
+    /**
+     * @brief Deletes the scan and the operator chain.
+     */
+    ~QueryPipeline();
+
+    QueryPipeline(const QueryPipeline& other) = delete;
+    QueryPipeline& operator=(const QueryPipeline& other) = delete;
+
+    /**
+     * @brief Runs the query.
+     * @throws std::runtime_error If an operator fails, e.g. on a non-numeric value in a numeric column.
+     */
+    void execute();
+
+    /**
+     * @brief Returns the names of the result columns.
+     * @return The names, in output order.
+     */
+    const std::vector<std::string>& getColumnNames() const;
+
+    /**
+     * @brief Returns the result rows of the last `execute()`.
+     * @return The rows as records (see `RecordFormat`).
+     */
+    const std::vector<std::string>& getRows() const;
+};
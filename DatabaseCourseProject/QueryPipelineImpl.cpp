@@ -0,0 +1,47 @@
+#include "QueryPipeline.hpp"
+
+/**
+ * @brief Assembles a pipeline.
+ * @param source The driving scan. Ownership is transferred.
+ * @param root The first operator of the chain. Ownership is transferred.
+ * @param collector The sink at the end of the chain starting at `root`.
+ * @param columnNames Names of the result columns.
+ */
+QueryPipeline::QueryPipeline(TableScan* source, QueryOperator* root, const ResultCollector* collector,
+    const std::vector<std::string>& columnNames)
+    : source(source), root(root), collector(collector), columnNames(columnNames) {
+}
+
+/**
+ * @brief Deletes the scan and the operator chain.
+ */
+QueryPipeline::~QueryPipeline() {
+    delete source;
+    delete root;
+}
+
+/**
+ * @brief Runs the query: `open()`, push all rows from the scan, `finish()`.
+ * @throws std::runtime_error If an operator fails.
+ */
+void QueryPipeline::execute() {
+    root->open();
+    source->run(*root);
+    root->finish();
+}
+
+/**
+ * @brief Returns the names of the result columns.
+ * @return The names, in output order.
+ */
+const std::vector<std::string>& QueryPipeline::getColumnNames() const {
+    return columnNames;
+}
+
+/**
+ * @brief Returns the result rows of the last `execute()`.
+ * @return The formatted rows.
+ */
+const std::vector<std::string>& QueryPipeline::getRows() const {
+    return collector->getLines();
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "SelectStatement.hpp"
+#include "QueryPipeline.hpp"
+#include "Catalog.hpp"
+
+/**
+ * @class QueryPlanner
+ * @brief Compiles a parsed `SelectStatement` into an executable `QueryPipeline`.
+ *
+ * The planner resolves table and column names against the catalog, checks
+ * types and chains the operators in this order:
+ * @code
+ * TableScan(FROM, filter) -> [HashJoin(build: TableScan(JOIN, filter))] -> [Aggregate]
+ *     -> [Sort] -> [Limit] -> Project -> ResultCollector
+ * @endcode
+ *
+ * The WHERE condition is split into its top-level AND terms. Every term must
+ * reference the columns of a single table and is pushed down into that
+ * table's scan, where it is evaluated with the vectorized `Expression` of the
+ * filtering commands. A condition with a top-level OR is kept as one term.
+ *
+ * The column statistics drive the physical plan: the hash table of a join is
+ * built on the side with fewer estimated rows (row count times the estimated
+ * selectivity of its filter) while the other side drives the pipeline, and
+ * the result buffer is pre-sized from the estimated result size. Scans whose
+ * filter is provably empty according to the statistics read no rows.
+ */
+class QueryPlanner {
+public:
+    /**
+     * @brief Compiles a statement.
+     *
+     * @param statement The parsed statement.
+     * @param catalog The catalog whose tables are queried. The tables must not change while the pipeline exists.
+     * @return The pipeline, ready to be executed.
+     * @throws std::runtime_error If a table or column does not exist or is ambiguous, a WHERE term mixes
+     * both tables, the join columns have incompatible types, a non-aggregated column is missing from
+     * GROUP BY, or an aggregate is applied to a column of the wrong type.
+     * @warning The caller is responsible for deleting the returned pointer.
+     */
+    static QueryPipeline* compile(const SelectStatement& statement, Catalog& catalog);
+};
@@ -0,0 +1,396 @@
+#include "QueryPlanner.hpp"
+#include "CommandParser.hpp"
+#include "QueryValueUtils.hpp"
+#include "AggregateOperator.hpp"
+#include "HashJoinOperator.hpp"
+#include "SortOperator.hpp"
+#include "LimitOperator.hpp"
+#include "ProjectOperator.hpp"
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Resolves the names of one statement and assembles its pipeline.
+     *
+     * All names are resolved and all checks are done before the first
+     * operator is allocated, so a failing statement allocates nothing.
+     */
+    class PlanBuilder {
+    private:
+        const SelectStatement& statement;
+        Table* left;
+        Table* right;
+        int leftWidth;
+        std::vector<QueryColumn> input;
+
+        bool aggregating;
+        std::vector<int> groupColumns;
+        std::vector<AggregateOperator::AggregateSpec> aggregates;
+        std::vector<QueryColumn> beforeProjection;
+        std::vector<int> projection;
+        std::vector<std::string> columnNames;
+        std::vector<SortOperator::SortKey> sortKeys;
+
+        static bool isWord(const QueryToken& token, const std::string& keyword) {
+            if (token.kind != QueryToken::IDENTIFIER || token.text.size() != keyword.size()) {
+                return false;
+            }
+            for (size_t i = 0; i < keyword.size(); ++i) {
+                if (std::toupper(static_cast<unsigned char>(token.text[i])) != keyword[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool isConditionKeyword(const QueryToken& token) {
+            return isWord(token, "AND") || isWord(token, "OR") || isWord(token, "NOT")
+                || isWord(token, "IN") || isWord(token, "IS") || isWord(token, "NULL");
+        }
+
+        int resolve(const ColumnReference& reference) const {
+            bool inLeft = reference.table.empty() || reference.table == left->getName();
+            bool inRight = right && (reference.table.empty() || reference.table == right->getName());
+            if (!inLeft && !inRight) {
+                throw std::runtime_error("Unknown table '" + reference.table + "' in column " + reference.toString() + ". ");
+            }
+
+            if (reference.column[0] == '$') {
+                std::string digits = reference.column.substr(1);
+                if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos) {
+                    throw std::runtime_error("Invalid column reference " + reference.toString() + ". ");
+                }
+                int position = std::stoi(digits);
+                int offset = reference.table.empty() || inLeft ? 0 : leftWidth;
+                int width = reference.table.empty() ? static_cast<int>(input.size())
+                    : (inLeft ? leftWidth : static_cast<int>(input.size()) - leftWidth);
+                if (position >= width) {
+                    throw std::runtime_error("Invalid column reference " + reference.toString() + ". ");
+                }
+                return offset + position;
+            }
+
+            int found = -1;
+            for (int i = 0; i < static_cast<int>(input.size()); ++i) {
+                bool tableMatches = reference.table.empty() || input[i].table == reference.table;
+                if (tableMatches && input[i].name == reference.column) {
+                    if (found >= 0) {
+                        throw std::runtime_error("Ambiguous column " + reference.toString() + ". ");
+                    }
+                    found = i;
+                }
+            }
+            if (found < 0) {
+                throw std::runtime_error("Unknown column " + reference.toString() + ". ");
+            }
+            return found;
+        }
+
+        std::vector<std::vector<QueryToken>> splitConjuncts() const {
+            const std::vector<QueryToken>& tokens = statement.where;
+            std::vector<std::vector<QueryToken>> terms(1);
+
+            int depth = 0;
+            bool topLevelOr = false;
+            for (const QueryToken& token : tokens) {
+                if (token.kind == QueryToken::SYMBOL && token.text == "(") ++depth;
+                if (token.kind == QueryToken::SYMBOL && token.text == ")") --depth;
+                if (depth == 0 && isWord(token, "OR")) {
+                    topLevelOr = true;
+                }
+            }
+            if (topLevelOr) {
+                terms[0] = tokens;
+                return terms;
+            }
+
+            depth = 0;
+            for (const QueryToken& token : tokens) {
+                if (token.kind == QueryToken::SYMBOL && token.text == "(") ++depth;
+                if (token.kind == QueryToken::SYMBOL && token.text == ")") --depth;
+
+                if (depth == 0 && isWord(token, "AND")) {
+                    terms.emplace_back();
+                }
+                else {
+                    terms.back().push_back(token);
+                }
+            }
+            return terms;
+        }
+
+        void translateWhere(std::string& leftCondition, std::string& rightCondition) const {
+            for (const std::vector<QueryToken>& term : splitConjuncts()) {
+                std::string text;
+                bool usesLeft = false;
+                bool usesRight = false;
+
+                for (const QueryToken& token : term) {
+                    if (token.kind == QueryToken::IDENTIFIER && !isConditionKeyword(token)) {
+                        ColumnReference reference;
+                        size_t dot = token.text.find('.');
+                        reference.table = dot == std::string::npos ? "" : token.text.substr(0, dot);
+                        reference.column = dot == std::string::npos ? token.text : token.text.substr(dot + 1);
+
+                        int position = resolve(reference);
+                        if (position < leftWidth) {
+                            usesLeft = true;
+                            text += "$" + std::to_string(position) + " ";
+                        }
+                        else {
+                            usesRight = true;
+                            text += "$" + std::to_string(position - leftWidth) + " ";
+                        }
+                    }
+                    else if (token.kind == QueryToken::STRING) {
+                        text += "'" + token.text + "' ";
+                    }
+                    else {
+                        text += token.text + " ";
+                    }
+                }
+
+                if (usesLeft && usesRight) {
+                    throw std::runtime_error("Each WHERE condition joined by AND must reference a single table. ");
+                }
+                std::string& target = usesRight ? rightCondition : leftCondition;
+                target += (target.empty() ? "(" : " AND (") + text + ")";
+            }
+        }
+
+        void planAggregation() {
+            for (const ColumnReference& reference : statement.groupBy) {
+                groupColumns.push_back(resolve(reference));
+                beforeProjection.push_back(input[groupColumns.back()]);
+            }
+
+            for (const SelectItem& item : statement.items) {
+                if (item.kind == SelectItem::ALL) {
+                    throw std::runtime_error("SELECT * cannot be combined with GROUP BY or aggregates. ");
+                }
+                if (item.kind == SelectItem::COLUMN) {
+                    projection.push_back(groupPosition(resolve(item.column), item.column));
+                    columnNames.push_back(item.alias.empty() ? input[resolve(item.column)].name : item.alias);
+                    continue;
+                }
+
+                AggregateOperator::AggregateSpec spec;
+                spec.function = item.function;
+                spec.column = item.countAll ? -1 : resolve(item.column);
+                spec.type = item.countAll ? ColumnType::INTEGER : input[spec.column].type;
+                if ((spec.function == AggregateFunction::SUM || spec.function == AggregateFunction::AVG)
+                    && !QueryValueUtils::isNumeric(spec.type)) {
+                    throw std::runtime_error(item.toString() + " needs a numeric column. ");
+                }
+
+                aggregates.push_back(spec);
+                std::string name = item.alias.empty() ? item.toString() : item.alias;
+                beforeProjection.push_back({ "", name, AggregateOperator::resultType(spec) });
+                projection.push_back(static_cast<int>(beforeProjection.size()) - 1);
+                columnNames.push_back(name);
+            }
+        }
+
+        int groupPosition(int column, const ColumnReference& reference) const {
+            for (size_t i = 0; i < groupColumns.size(); ++i) {
+                if (groupColumns[i] == column) {
+                    return static_cast<int>(i);
+                }
+            }
+            throw std::runtime_error("Column " + reference.toString() + " must appear in GROUP BY or be aggregated. ");
+        }
+
+        void planProjection() {
+            beforeProjection = input;
+            for (const SelectItem& item : statement.items) {
+                if (item.kind == SelectItem::ALL) {
+                    for (int i = 0; i < static_cast<int>(input.size()); ++i) {
+                        projection.push_back(i);
+                        columnNames.push_back(input[i].name);
+                    }
+                }
+                else {
+                    int position = resolve(item.column);
+                    projection.push_back(position);
+                    columnNames.push_back(item.alias.empty() ? input[position].name : item.alias);
+                }
+            }
+        }
+
+        int resolveOrderKey(const OrderItem& order) const {
+            if (order.ordinal > 0) {
+                if (order.ordinal > projection.size()) {
+                    throw std::runtime_error("ORDER BY position " + std::to_string(order.ordinal) + " is not in the SELECT list. ");
+                }
+                return projection[order.ordinal - 1];
+            }
+
+            const SelectItem& key = order.key;
+            if (key.kind == SelectItem::COLUMN && key.column.table.empty()) {
+                for (size_t i = 0; i < statement.items.size(); ++i) {
+                    if (!statement.items[i].alias.empty() && statement.items[i].alias == key.column.column) {
+                        return projection[i];
+                    }
+                }
+            }
+
+            if (key.kind == SelectItem::AGGREGATE) {
+                int column = key.countAll ? -1 : resolve(key.column);
+                for (size_t i = 0; i < aggregates.size(); ++i) {
+                    if (aggregates[i].function == key.function && aggregates[i].column == column) {
+                        return static_cast<int>(groupColumns.size() + i);
+                    }
+                }
+                throw std::runtime_error("ORDER BY " + key.toString() + " must also appear in the SELECT list. ");
+            }
+
+            int column = resolve(key.column);
+            return aggregating ? groupPosition(column, key.column) : column;
+        }
+
+        static double estimateRows(const Table& table, const Expression* filter) {
+            double rows = table.getNumberOfRows();
+            return filter ? rows * filter->estimateSelectivity() : rows;
+        }
+
+        static double estimateDistinct(const Table& table, int column) {
+            return static_cast<double>(std::max<size_t>(1, table.getColumnAtGivenIndex(column)->getStatistics().estimateDistinctCount()));
+        }
+
+    public:
+        PlanBuilder(const SelectStatement& statement, Catalog& catalog)
+            : statement(statement), left(&catalog.returnTableByName(statement.fromTable)), right(nullptr), aggregating(false) {
+
+            if (statement.joined) {
+                if (statement.joinTable == statement.fromTable) {
+                    throw std::runtime_error("Joining a table with itself is not supported. ");
+                }
+                right = &catalog.returnTableByName(statement.joinTable);
+            }
+
+            input = TableScan::schemaOf(*left);
+            leftWidth = static_cast<int>(input.size());
+            if (right) {
+                std::vector<QueryColumn> rightSchema = TableScan::schemaOf(*right);
+                input.insert(input.end(), rightSchema.begin(), rightSchema.end());
+            }
+
+            for (const SelectItem& item : statement.items) {
+                aggregating = aggregating || item.kind == SelectItem::AGGREGATE;
+            }
+            aggregating = aggregating || !statement.groupBy.empty();
+
+            if (aggregating) {
+                planAggregation();
+            }
+            else {
+                planProjection();
+            }
+
+            for (const OrderItem& order : statement.orderBy) {
+                int column = resolveOrderKey(order);
+                sortKeys.push_back({ column, beforeProjection[column].type, order.descending });
+            }
+        }
+
+        QueryPipeline* build() const {
+            int probeKey = -1;
+            int buildKey = -1;
+            bool numericKeys = false;
+
+            if (right) {
+                int a = resolve(statement.joinLeft);
+                int b = resolve(statement.joinRight);
+                if ((a < leftWidth) == (b < leftWidth)) {
+                    throw std::runtime_error("The ON condition must compare a column of each table. ");
+                }
+                probeKey = a < leftWidth ? a : b;
+                buildKey = (a < leftWidth ? b : a) - leftWidth;
+
+                numericKeys = QueryValueUtils::isNumeric(input[probeKey].type);
+                if (numericKeys != QueryValueUtils::isNumeric(input[leftWidth + buildKey].type)) {
+                    throw std::runtime_error("Incompatible column types. ");
+                }
+            }
+
+            std::string leftCondition;
+            std::string rightCondition;
+            if (!statement.where.empty()) {
+                translateWhere(leftCondition, rightCondition);
+            }
+
+            Expression* leftFilter = nullptr;
+            Expression* rightFilter = nullptr;
+            try {
+                if (!leftCondition.empty()) {
+                    leftFilter = CommandParser::parseExpression(leftCondition);
+                    leftFilter->bind(*left);
+                }
+                if (!rightCondition.empty()) {
+                    rightFilter = CommandParser::parseExpression(rightCondition);
+                    rightFilter->bind(*right);
+                }
+            }
+            catch (...) {
+                delete leftFilter;
+                delete rightFilter;
+                throw;
+            }
+
+            double leftRows = estimateRows(*left, leftFilter);
+            double rightRows = right ? estimateRows(*right, rightFilter) : 0.0;
+            bool buildOnLeft = right && leftRows < rightRows;
+
+            double expectedRows = leftRows;
+            if (right) {
+                expectedRows = leftRows * rightRows / std::max(estimateDistinct(*left, probeKey), estimateDistinct(*right, buildKey));
+            }
+            if (statement.limited) {
+                expectedRows = std::min(expectedRows, static_cast<double>(statement.limit));
+            }
+
+            ResultCollector* collector = new ResultCollector(aggregating ? 0 : static_cast<size_t>(expectedRows));
+            QueryOperator* chain = new ProjectOperator(projection, collector);
+
+            if (statement.limited || statement.offset > 0) {
+                chain = new LimitOperator(statement.offset, statement.limited, statement.limit, chain);
+            }
+            if (!sortKeys.empty()) {
+                size_t bound = statement.limited ? statement.offset + statement.limit : 0;
+                chain = new SortOperator(sortKeys, bound, chain);
+            }
+            if (aggregating) {
+                std::vector<ColumnType> groupTypes;
+                for (int column : groupColumns) {
+                    groupTypes.push_back(input[column].type);
+                }
+                chain = new AggregateOperator(groupColumns, groupTypes, aggregates, chain);
+            }
+            if (buildOnLeft) {
+                chain = new HashJoinOperator(new TableScan(*left, leftFilter), probeKey, buildKey, numericKeys, true, chain);
+                return new QueryPipeline(new TableScan(*right, rightFilter), chain, collector, columnNames);
+            }
+            if (right) {
+                chain = new HashJoinOperator(new TableScan(*right, rightFilter), buildKey, probeKey, numericKeys, false, chain);
+            }
+
+            return new QueryPipeline(new TableScan(*left, leftFilter), chain, collector, columnNames);
+        }
+    };
+}
+
+/**
+ * @brief Compiles a statement.
+ *
+ * @param statement The parsed statement.
+ * @param catalog The catalog whose tables are queried.
+ * @return The pipeline, ready to be executed.
+ * @throws std::runtime_error If the statement cannot be resolved against the catalog.
+ * @warning The caller is responsible for deleting the returned pointer.
+ */
+QueryPipeline* QueryPlanner::compile(const SelectStatement& statement, Catalog& catalog) {
+    PlanBuilder builder(statement, catalog);
+    return builder.build();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <string>
+#include "ColumnType.hpp"
+
+/**
+ * @class QueryValueUtils
+ * @brief A static utility class for working with the string cells of query rows.
+ *
+ * Query pipelines carry cells in their display form (an empty string is NULL).
+ * These helpers interpret a cell according to its column type, so that every
+ * operator orders, groups and joins values the same way.
+ */
+class QueryValueUtils {
+public:
+    /**
+     * @brief Checks whether `type` holds numbers.
+     * @param type The column type.
+     * @return `true` for `ColumnType::INTEGER` and `ColumnType::DOUBLE`.
+     */
+    static bool isNumeric(ColumnType type);
+
+    /**
+     * @brief Converts a non-NULL cell of a numeric column to a number.
+     * @param value The cell.
+     * @return The numeric value.
+     * @throws std::runtime_error If `value` is not a number.
+     */
+    static double toNumber(const std::string& value);
+
+    /**
+     * @brief Compares two cells of the same column type.
+     *
+     * NULL orders before every other value, numbers are compared numerically
+     * and strings lexicographically, like `TableColumn::compareValues`.
+     *
+     * @param left The first cell.
+     * @param right The second cell.
+     * @param type The type of both cells.
+     * @return A negative value, zero or a positive value if `left` is smaller, equal or greater.
+     */
+    static int compare(const std::string& left, const std::string& right, ColumnType type);
+
+    /**
+     * @brief Returns a key under which equal values of numeric or string columns coincide.
+     *
+     * Numbers are printed with full precision, so `5` and `5.000000` map to the same key.
+     *
+     * @param value A non-NULL cell.
+     * @param numeric Whether the cell belongs to a numeric column.
+     * @return The normalized key.
+     */
+    static std::string normalizeKey(const std::string& value, bool numeric);
+};
@@ -0,0 +1,63 @@
+#include "QueryValueUtils.hpp"
+#include <cstdio>
+#include <stdexcept>
+
+/**
+ * @brief Checks whether `type` holds numbers.
+ * @param type The column type.
+ * @return `true` for Integer and Double columns.
+ */
+bool QueryValueUtils::isNumeric(ColumnType type) {
+    return type == ColumnType::INTEGER || type == ColumnType::DOUBLE;
+}
+
+/**
+ * @brief Converts a non-NULL cell of a numeric column to a number.
+ * @param value The cell.
+ * @return The numeric value.
+ * @throws std::runtime_error If `value` is not a number.
+ */
+double QueryValueUtils::toNumber(const std::string& value) {
+    try {
+        return std::stod(value);
+    }
+    catch (const std::exception&) {
+        throw std::runtime_error("Non-numeric value '" + value + "' found in a numeric column. ");
+    }
+}
+
+/**
+ * @brief Compares two cells of the same column type.
+ * @param left The first cell.
+ * @param right The second cell.
+ * @param type The type of both cells.
+ * @return A negative value, zero or a positive value if `left` is smaller, equal or greater.
+ */
+int QueryValueUtils::compare(const std::string& left, const std::string& right, ColumnType type) {
+    if (left.empty() || right.empty()) {
+        return (left.empty() ? 0 : 1) - (right.empty() ? 0 : 1);
+    }
+
+    if (isNumeric(type)) {
+        double a = toNumber(left);
+        double b = toNumber(right);
+        return a < b ? -1 : (b < a ? 1 : 0);
+    }
+    return left.compare(right);
+}
+
+/**
+ * @brief Returns a key under which equal values coincide.
+ * @param value A non-NULL cell.
+ * @param numeric Whether the cell belongs to a numeric column.
+ * @return The normalized key.
+ */
+std::string QueryValueUtils::normalizeKey(const std::string& value, bool numeric) {
+    if (!numeric) {
+        return value;
+    }
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.17g", toNumber(value));
+    return buffer;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <string>
+#include <vector>
+
+/**
+ * @class RecordFormat
+ * @brief A static utility class for the machine-readable row format.
+ *
+ * A record is one result row written as tab-separated fields. Backslashes,
+ * tabs, carriage returns and newlines inside a cell are escaped as `\\`,
+ * `\t`, `\r` and `\n`, so every record is exactly one line and splitting on
+ * tabs always yields the original cells. An empty field is a NULL cell.
+ *
+ * Unattended runs (batch scripts, replays) print records instead of the
+ * space-separated display rows of the interactive pager.
+ */
+class RecordFormat {
+public:
+    /**
+     * @brief Joins the cells of a row into a record.
+     * @param cells The cells of the row, in output order.
+     * @return The record, without a trailing newline.
+     */
+    static std::string formatRecord(const std::vector<std::string>& cells);
+
+    /**
+     * @brief Appends a single escaped field to a record that is being built.
+     *
+     * A tab is inserted before every field except the first one.
+     *
+     * @param record The record to append to.
+     * @param cell The cell value.
+     * @param first Whether the cell is the first field of the record.
+     */
+    static void appendField(std::string& record, const std::string& cell, bool first);
+
+    /**
+     * @brief Converts a record into the display form used by the interactive pager.
+     *
+     * The fields are unescaped and each of them is followed by a space, which
+     * matches `Table::getRowAsString`.
+     *
+     * @param record A record produced by `formatRecord`.
+     * @return The row as it is shown to the user.
+     */
+    static std::string toDisplayRow(const std::string& record);
+};
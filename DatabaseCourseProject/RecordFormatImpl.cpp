@@ -0,0 +1,65 @@
+#include "RecordFormat.hpp"
+
+/**
+ * @brief Joins the cells of a row into a record.
+ * @param cells The cells of the row, in output order.
+ * @return The record, without a trailing newline.
+ */
+std::string RecordFormat::formatRecord(const std::vector<std::string>& cells) {
+    std::string record;
+    for (size_t i = 0; i < cells.size(); ++i) {
+        appendField(record, cells[i], i == 0);
+    }
+    return record;
+}
+
+/**
+ * @brief Appends a single escaped field to a record that is being built.
+ * @param record The record to append to.
+ * @param cell The cell value.
+ * @param first Whether the cell is the first field of the record.
+ */
+void RecordFormat::appendField(std::string& record, const std::string& cell, bool first) {
+    if (!first) {
+        record += '\t';
+    }
+    for (char c : cell) {
+        switch (c) {
+        case '\\': record += "\\\\"; break;
+        case '\t': record += "\\t"; break;
+        case '\r': record += "\\r"; break;
+        case '\n': record += "\\n"; break;
+        default: record += c; break;
+        }
+    }
+}
+
+/**
+ * @brief Converts a record into the display form used by the interactive pager.
+ *
+ * Every tab ends a field and is replaced by a space; a space is also appended
+ * after the last field. Escape sequences are turned back into the characters they stand for.
+ *
+ * @param record A record produced by `formatRecord`.
+ * @return The row as it is shown to the user.
+ */
+std::string RecordFormat::toDisplayRow(const std::string& record) {
+    std::string row;
+    row.reserve(record.size() + 1);
+
+    for (size_t i = 0; i < record.size(); ++i) {
+        char c = record[i];
+        if (c == '\t') {
+            row += ' ';
+        }
+        else if (c == '\\' && i + 1 < record.size()) {
+            char escaped = record[++i];
+            row += escaped == 't' ? '\t' : escaped == 'r' ? '\r' : escaped == 'n' ? '\n' : escaped;
+        }
+        else {
+            row += c;
+        }
+    }
+    row += ' ';
+    return row;
+}
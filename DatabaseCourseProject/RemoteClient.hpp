@@ -0,0 +1,25 @@
+#pragma once
+#include "OutputConsoleWritter.hpp"
+#include "InputConsoleReader.hpp"
+
+/**
+ * @class RemoteClient
+ * @brief A thin command-line client of the server mode (see `Engine::serve`).
+ *
+ * The client does not load any data. It forwards every line read from the
+ * console to the server and prints the response until the `.ok` or `.error`
+ * end marker, removing the extra `.` the server puts in front of output lines
+ * that start with a dot. Results arrive unpaginated, as records (see `RecordFormat`).
+ */
+class RemoteClient {
+public:
+    /**
+     * @brief Connects to the server and forwards commands until the input ends or the session is left.
+     *
+     * @param port The port of the server on `127.0.0.1`.
+     * @param ocw The console writer the responses are printed to.
+     * @param icr The console reader the commands are read from.
+     * @return 0 if every command succeeded, 1 if a command failed or the connection could not be used.
+     */
+    static int run(int port, const OutputConsoleWritter& ocw, const InputConsoleReader& icr);
+};
@@ -0,0 +1,69 @@
+#include "RemoteClient.hpp"
+#include "Socket.hpp"
+#include "CommandParser.hpp"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Connects to the server and forwards commands until the input ends or the session is left.
+ *
+ * Each command is answered before the next one is sent, so the responses
+ * appear in the order of the commands. The client stops after `exit` and
+ * `shutdown`, which end the session on the server, and when the server closes
+ * the connection without completing a response.
+ *
+ * @param port The port of the server on `127.0.0.1`.
+ * @param ocw The console writer the responses are printed to.
+ * @param icr The console reader the commands are read from.
+ * @return 0 if every command succeeded, 1 if a command failed or the connection could not be used.
+ */
+int RemoteClient::run(int port, const OutputConsoleWritter& ocw, const InputConsoleReader& icr) {
+    Socket* server = nullptr;
+    try {
+        server = Socket::connectToLocalhost(port);
+    }
+    catch (const std::exception& e) {
+        ocw.printError(e.what());
+        return 1;
+    }
+
+    bool succeeded = true;
+    std::string command;
+
+    while (icr.readNextLine(command)) {
+        if (!server->writeAll(command + "\n")) {
+            ocw.printError("Lost the connection to the server. ");
+            succeeded = false;
+            break;
+        }
+
+        bool complete = false;
+        std::string line;
+        while (server->readLine(line)) {
+            if (line == ".ok" || line == ".error") {
+                complete = true;
+                succeeded = succeeded && line == ".ok";
+                break;
+            }
+            if (!line.empty() && line[0] == '.') {
+                line.erase(0, 1);
+            }
+            ocw.printLine(line);
+        }
+
+        if (!complete) {
+            ocw.printError("Lost the connection to the server. ");
+            succeeded = false;
+            break;
+        }
+
+        std::vector<std::string> args = CommandParser::parseRawCommand(command);
+        if (!args.empty() && (args[0] == "exit" || args[0] == "shutdown")) {
+            break;
+        }
+    }
+
+    delete server;
+    return succeeded ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "LatencyHistogram.hpp"
+
+/**
+ * @class ReplayReport
+ * @brief Collects the per-command latencies of one workload replay.
+ *
+ * Unlike the `MetricsRegistry`, which covers the whole process, the report
+ * only contains the replayed commands, so two replays of the same workload
+ * can be compared directly.
+ */
+class ReplayReport {
+private:
+    std::map<std::string, LatencyHistogram*> histograms; ///< Latencies per command name. Owned.
+    uint64_t failedCommands;                             ///< Commands that reported an error.
+    uint64_t totalMicroseconds;                          ///< Wall-clock time of the whole replay.
+
+public:
+    /**
+     * @brief Creates an empty report.
+     */
+    ReplayReport();
+
+    /**
+     * @brief Deletes the histograms.
+     */
+    ~ReplayReport();
+
+    /**
+     * @brief Deleted copy constructor; the report owns its histograms.
+     */
+    ReplayReport(const ReplayReport& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; the report owns its histograms.
+     */
+    ReplayReport& operator=(const ReplayReport& other) = delete;
+
+    /**
+     * @brief Records one replayed command.
+     * @param command The command name.
+     * @param microseconds The execution time.
+     * @param failed Whether the command reported an error.
+     */
+    void record(const std::string& command, uint64_t microseconds, bool failed);
+
+    /**
+     * @brief Sets the wall-clock time of the whole replay, including pauses of a paced replay.
+     * @param microseconds The duration.
+     */
+    void setTotalTime(uint64_t microseconds);
+
+    /**
+     * @brief Formats the report.
+     *
+     * @param source The replayed workload file, shown in the header.
+     * @param paced Whether the original pacing was kept.
+     * @return The lines: a header with totals, then count, p50/p90/p99, max and total time per command.
+     */
+    std::vector<std::string> toLines(const std::string& source, bool paced) const;
+};
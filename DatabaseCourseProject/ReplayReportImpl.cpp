@@ -0,0 +1,93 @@
+#include "ReplayReport.hpp"
+#include <cstdio>
+
+namespace {
+    /**
+     * @brief Formats a duration given in microseconds as milliseconds.
+     * @param microseconds The duration.
+     * @return The duration with three decimals and the `ms` unit.
+     */
+    std::string formatMilliseconds(uint64_t microseconds) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3fms", microseconds / 1000.0);
+        return buffer;
+    }
+}
+
+/**
+ * @brief Creates an empty report.
+ */
+ReplayReport::ReplayReport()
+    : failedCommands(0), totalMicroseconds(0) {
+}
+
+/**
+ * @brief Deletes the histograms.
+ */
+ReplayReport::~ReplayReport() {
+    for (auto& entry : histograms) {
+        delete entry.second;
+    }
+    histograms.clear();
+}
+
+/**
+ * @brief Records one replayed command.
+ * @param command The command name.
+ * @param microseconds The execution time.
+ * @param failed Whether the command reported an error.
+ */
+void ReplayReport::record(const std::string& command, uint64_t microseconds, bool failed) {
+    LatencyHistogram*& histogram = histograms[command];
+    if (histogram == nullptr) {
+        histogram = new LatencyHistogram();
+    }
+    histogram->record(microseconds);
+
+    if (failed) {
+        ++failedCommands;
+    }
+}
+
+/**
+ * @brief Sets the wall-clock time of the whole replay.
+ * @param microseconds The duration.
+ */
+void ReplayReport::setTotalTime(uint64_t microseconds) {
+    totalMicroseconds = microseconds;
+}
+
+/**
+ * @brief Formats the report.
+ * @param source The replayed workload file, shown in the header.
+ * @param paced Whether the original pacing was kept.
+ * @return The report lines.
+ */
+std::vector<std::string> ReplayReport::toLines(const std::string& source, bool paced) const {
+    uint64_t commands = 0;
+    for (const auto& entry : histograms) {
+        commands += entry.second->getCount();
+    }
+
+    char rate[32];
+    std::snprintf(rate, sizeof(rate), "%.1f", totalMicroseconds > 0 ? commands * 1000000.0 / totalMicroseconds : 0.0);
+
+    std::vector<std::string> lines;
+    lines.push_back("Replayed " + std::to_string(commands) + " command(s) from " + source
+        + (paced ? " at the original pacing" : " as fast as possible")
+        + " in " + formatMilliseconds(totalMicroseconds) + " (" + rate + " commands/s), "
+        + std::to_string(failedCommands) + " failed.");
+    lines.push_back("Command latencies:");
+
+    for (const auto& entry : histograms) {
+        const LatencyHistogram& histogram = *entry.second;
+        lines.push_back("  " + entry.first
+            + ": count=" + std::to_string(histogram.getCount())
+            + " p50=" + formatMilliseconds(histogram.valueAtPercentile(50.0))
+            + " p90=" + formatMilliseconds(histogram.valueAtPercentile(90.0))
+            + " p99=" + formatMilliseconds(histogram.valueAtPercentile(99.0))
+            + " max=" + formatMilliseconds(histogram.getMax())
+            + " total=" + formatMilliseconds(histogram.getSum()));
+    }
+    return lines;
+}
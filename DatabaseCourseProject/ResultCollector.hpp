@@ -0,0 +1,38 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "QueryOperator.hpp"
+
+/**
+ * @class ResultCollector
+ * @brief The sink of a query pipeline: formats the final rows for display.
+ *
+ * Rows are stored as records (see `RecordFormat`), which keeps the cell
+ * boundaries: the pager shows them like `Table::getRowAsString`, while
+ * unattended runs print them unchanged.
+ */
+class ResultCollector : public QueryOperator {
+private:
+    std::vector<std::string> lines; ///< The result rows as records.
+
+public:
+    /**
+     * @brief Constructs an empty collector.
+     * @param expectedRows Estimated number of result rows, used to pre-size the buffer (0 if unknown).
+     */
+    explicit ResultCollector(size_t expectedRows = 0);
+
+    /**
+     * @brief Formats and stores a result row.
+     * @param row The row.
+     * @return Always `true`.
+     */
+    bool consume(const QueryRow& row) override;
+
+    /**
+     * @brief Returns the collected rows.
+     * @return The rows as records, in arrival order.
+     */
+    const std::vector<std::string>& getLines() const;
+};
@@ -0,0 +1,29 @@
+#include "ResultCollector.hpp"
+#include "RecordFormat.hpp"
+
+/**
+ * @brief Constructs an empty collector.
+ * @param expectedRows Estimated number of result rows, used to pre-size the buffer (0 if unknown).
+ */
+ResultCollector::ResultCollector(size_t expectedRows)
+    : QueryOperator(nullptr) {
+    lines.reserve(expectedRows);
+}
+
+/**
+ * @brief Formats and stores a result row.
+ * @param row The row.
+ * @return Always `true`.
+ */
+bool ResultCollector::consume(const QueryRow& row) {
+    lines.push_back(RecordFormat::formatRecord(row));
+    return true;
+}
+
+/**
+ * @brief Returns the collected rows.
+ * @return The rows as records, in arrival order.
+ */
+const std::vector<std::string>& ResultCollector::getLines() const {
+    return lines;
+}
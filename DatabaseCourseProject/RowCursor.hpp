@@ -0,0 +1,69 @@
+#pragma once
+#include <string>
+
+/**
+ * @class RowCursor
+ * @brief Abstract base class for a forward cursor over the row ids of a result.
+ *
+ * A cursor hands out row ids one at a time instead of materializing the whole
+ * result up front. Rows are only turned into strings through `formatRow()`
+ * when they are actually displayed, so consumers such as the pager in
+ * `IOUtils` need memory proportional to what they show, not to the result size.
+ *
+ * The cursor position is an opaque value obtained from `position()`. Passing
+ * it back to `seek()` resumes the cursor at exactly the same place, which lets
+ * the pager move backwards without remembering the rows it has already shown.
+ */
+class RowCursor {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~RowCursor() = default;
+
+    /**
+     * @brief Advances the cursor to the next row of the result.
+     *
+     * @param rowId Receives the id of the next row when one exists.
+     * @return `true` if a row was produced; `false` once the result is exhausted.
+     */
+    virtual bool next(int& rowId) = 0;
+
+    /**
+     * @brief Returns the current position of the cursor.
+     *
+     * The returned value is only meaningful to the same cursor's `seek()`.
+     *
+     * @return An opaque position from which `next()` would continue.
+     */
+    virtual int position() const = 0;
+
+    /**
+     * @brief Moves the cursor back (or forward) to a position returned by `position()`.
+     * @param position A value previously obtained from `position()`.
+     */
+    virtual void seek(int position) = 0;
+
+    /**
+     * @brief Materializes a single row of the result for display.
+     *
+     * @param rowId A row id produced by `next()`.
+     * @return The row formatted as a string.
+     * @throws std::runtime_error If `rowId` does not identify a row.
+     */
+    virtual std::string formatRow(int rowId) const = 0;
+
+    /**
+     * @brief Materializes a single row of the result in the record format (see `RecordFormat`).
+     *
+     * Used instead of `formatRow()` when the output is read by a program.
+     * The default implementation returns `formatRow()` unchanged.
+     *
+     * @param rowId A row id produced by `next()`.
+     * @return The row as a tab-separated record.
+     * @throws std::runtime_error If `rowId` does not identify a row.
+     */
+    virtual std::string formatRecord(int rowId) const {
+        return formatRow(rowId);
+    }
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "RowCursor.hpp"
+#include "Table.hpp"
+
+/**
+ * @class RowIdListCursor
+ * @brief A `RowCursor` over an explicit list of row ids of a table.
+ *
+ * Used when the result order differs from storage order (e.g. after
+ * `orderby`) or when the result was cut down by `limit`. Only the row ids are
+ * kept; the rows themselves are still formatted lazily, page by page.
+ *
+ * @note The cursor keeps a reference to the table, which must outlive it.
+ */
+class RowIdListCursor : public RowCursor {
+private:
+    const Table& table;          ///< The table the row ids refer to.
+    std::vector<int> rowIds;     ///< The rows of the result, in output order.
+    std::vector<int> projection; ///< Columns included by `formatRow()` and `formatRecord()`; empty means all columns.
+    int current;                 ///< Index of the next entry of `rowIds` to return.
+
+public:
+    /**
+     * @brief Creates a cursor over the given rows.
+     *
+     * @param table The table the row ids refer to.
+     * @param rowIds The row ids in the order in which they are returned.
+     * @param projection The 0-indexed positions of the columns to show. Empty shows all columns.
+     */
+    RowIdListCursor(const Table& table, std::vector<int> rowIds, const std::vector<int>& projection);
+
+    /**
+     * @brief Returns the next row id of the list.
+     * @param rowId Receives the row id.
+     * @return `true` if a row was produced.
+     */
+    bool next(int& rowId) override;
+
+    /**
+     * @brief Returns the index into the list of the next row id.
+     * @return The current position of the cursor.
+     */
+    int position() const override;
+
+    /**
+     * @brief Moves the cursor to a position returned by `position()`.
+     * @param position The list index to continue from.
+     */
+    void seek(int position) override;
+
+    /**
+     * @brief Formats a row of the table, applying the projection.
+     * @param rowId The row to format.
+     * @return The row as a string.
+     * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+     */
+    std::string formatRow(int rowId) const override;
+
+    /**
+     * @brief Formats a row of the table using `Table::getRowAsRecord`, applying the projection.
+     * @param rowId The row to format.
+     * @return The row as a tab-separated record.
+     * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+     */
+    std::string formatRecord(int rowId) const override;
+};
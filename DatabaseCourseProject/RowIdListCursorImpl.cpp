@@ -0,0 +1,68 @@
+#include "RowIdListCursor.hpp"
+#include "ProfilePhase.hpp"
+#include <utility>
+
+/**
+ * @brief Creates a cursor over the given rows.
+ *
+ * @param table The table the row ids refer to.
+ * @param rowIds The row ids in the order in which they are returned. The vector is moved into the cursor.
+ * @param projection The 0-indexed positions of the columns to show. Empty shows all columns.
+ */
+RowIdListCursor::RowIdListCursor(const Table& table, std::vector<int> rowIds, const std::vector<int>& projection)
+    : table(table), rowIds(std::move(rowIds)), projection(projection), current(0) {
+}
+
+/**
+ * @brief Returns the next row id of the list.
+ * @param rowId Receives the row id.
+ * @return `true` if a row was produced; `false` at the end of the list.
+ */
+bool RowIdListCursor::next(int& rowId) {
+    if (current >= static_cast<int>(rowIds.size())) {
+        return false;
+    }
+    rowId = rowIds[current++];
+    return true;
+}
+
+/**
+ * @brief Returns the index into the list of the next row id.
+ * @return The current position of the cursor.
+ */
+int RowIdListCursor::position() const {
+    return current;
+}
+
+/**
+ * @brief Moves the cursor to a position returned by `position()`.
+ * @param position The list index to continue from.
+ */
+void RowIdListCursor::seek(int position) {
+    current = position;
+}
+
+/**
+ * @brief Formats a row of the table, applying the projection.
+ * @param rowId The row to format.
+ * @return The row as a string.
+ * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+ */
+std::string RowIdListCursor::formatRow(int rowId) const {
+    ProfilePhase phase("output formatting");
+    if (projection.empty()) {
+        return table.getRowAsString(rowId);
+    }
+    return table.getRowAsString(rowId, projection);
+}
+
+/**
+ * @brief Formats a row of the table using `Table::getRowAsRecord`, applying the projection.
+ * @param rowId The row to format.
+ * @return The row as a tab-separated record.
+ * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+ */
+std::string RowIdListCursor::formatRecord(int rowId) const {
+    ProfilePhase phase("output formatting");
+    return table.getRowAsRecord(rowId, projection);
+}
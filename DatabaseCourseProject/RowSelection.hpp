@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "RowCursor.hpp"
+#include "TableColumn.hpp"
+
+/**
+ * @class RowSelection
+ * @brief A static utility class that turns a `RowCursor` into an explicit list of row ids.
+ *
+ * The helpers implement the `limit`, `offset` and `orderby` clauses of `select`.
+ * They work on row ids only; no row is formatted here.
+ */
+class RowSelection {
+public:
+    /**
+     * @brief Skips `count` rows of the cursor.
+     * @param cursor The cursor to advance.
+     * @param count The number of rows to skip.
+     */
+    static void skip(RowCursor& cursor, size_t count);
+
+    /**
+     * @brief Collects at most `limit` row ids from the cursor.
+     *
+     * The cursor is not advanced past the last collected row, so the underlying
+     * scan stops as soon as the limit is reached.
+     *
+     * @param cursor The cursor supplying the rows.
+     * @param limit The maximum number of row ids to collect.
+     * @return The collected row ids in cursor order.
+     */
+    static std::vector<int> take(RowCursor& cursor, size_t limit);
+
+    /**
+     * @brief Collects all row ids of the cursor, ordered by a column.
+     *
+     * The sort is stable, so rows with equal keys keep their storage order.
+     *
+     * @param cursor The cursor supplying the rows.
+     * @param column The column to order by.
+     * @param descending `true` to order from the largest value to the smallest.
+     * @return The ordered row ids.
+     */
+    static std::vector<int> sortAll(RowCursor& cursor, const TableColumn& column, bool descending);
+
+    /**
+     * @brief Returns the first `k` row ids of the cursor in column order, without sorting all rows.
+     *
+     * A bounded max-heap of `k` entries keeps the best rows seen so far, so the
+     * cost is O(n log k) time and O(k) memory. Ties are broken by row id, which
+     * makes the result identical to the first `k` rows of `sortAll`.
+     *
+     * @param cursor The cursor supplying the rows.
+     * @param column The column to order by.
+     * @param descending `true` to order from the largest value to the smallest.
+     * @param k The number of rows to keep.
+     * @param maxRows An upper bound of the rows the cursor produces, e.g. the table size;
+     * the heap reserves at most this many entries, whatever `k` is.
+     * @return The first `k` (or fewer) ordered row ids.
+     */
+    static std::vector<int> topK(RowCursor& cursor, const TableColumn& column, bool descending, size_t k, size_t maxRows);
+};
@@ -0,0 +1,104 @@
+#include "RowSelection.hpp"
+#include <algorithm>
+
+namespace {
+    /**
+     * @brief Strict weak ordering of row ids by a column, with the row id as tie-breaker.
+     */
+    struct RowOrder {
+        const TableColumn& column;
+        bool descending;
+
+        bool operator()(int left, int right) const {
+            int comparison = column.compareValues(left, right);
+            if (comparison != 0) {
+                return descending ? comparison > 0 : comparison < 0;
+            }
+            return left < right;
+        }
+    };
+}
+
+/**
+ * @brief Skips `count` rows of the cursor.
+ * @param cursor The cursor to advance.
+ * @param count The number of rows to skip.
+ */
+void RowSelection::skip(RowCursor& cursor, size_t count) {
+    int rowId;
+    for (size_t i = 0; i < count && cursor.next(rowId); ++i) {
+    }
+}
+
+/**
+ * @brief Collects at most `limit` row ids from the cursor.
+ * @param cursor The cursor supplying the rows.
+ * @param limit The maximum number of row ids to collect.
+ * @return The collected row ids in cursor order.
+ */
+std::vector<int> RowSelection::take(RowCursor& cursor, size_t limit) {
+    std::vector<int> rowIds;
+    int rowId;
+    while (rowIds.size() < limit && cursor.next(rowId)) {
+        rowIds.push_back(rowId);
+    }
+    return rowIds;
+}
+
+/**
+ * @brief Collects all row ids of the cursor, ordered by a column.
+ * @param cursor The cursor supplying the rows.
+ * @param column The column to order by.
+ * @param descending `true` to order from the largest value to the smallest.
+ * @return The ordered row ids.
+ */
+std::vector<int> RowSelection::sortAll(RowCursor& cursor, const TableColumn& column, bool descending) {
+    std::vector<int> rowIds;
+    int rowId;
+    while (cursor.next(rowId)) {
+        rowIds.push_back(rowId);
+    }
+    std::sort(rowIds.begin(), rowIds.end(), RowOrder{ column, descending });
+    return rowIds;
+}
+
+/**
+ * @brief Returns the first `k` row ids of the cursor in column order, without sorting all rows.
+ *
+ * The heap top is always the worst of the kept rows. A new row only enters the
+ * heap if it orders before that row, which for large inputs rejects almost
+ * every row with a single comparison. `k` comes from the user and may be far
+ * larger than the input, so only the smaller of `k` and `maxRows` is reserved.
+ *
+ * @param cursor The cursor supplying the rows.
+ * @param column The column to order by.
+ * @param descending `true` to order from the largest value to the smallest.
+ * @param k The number of rows to keep.
+ * @param maxRows An upper bound of the rows the cursor produces.
+ * @return The first `k` (or fewer) ordered row ids.
+ */
+std::vector<int> RowSelection::topK(RowCursor& cursor, const TableColumn& column, bool descending, size_t k, size_t maxRows) {
+    std::vector<int> heap;
+    if (k == 0) {
+        return heap;
+    }
+
+    RowOrder order{ column, descending };
+    heap.reserve(std::min(k, maxRows));
+
+    int rowId;
+    while (cursor.next(rowId)) {
+        if (heap.size() < k) {
+            heap.push_back(rowId);
+            std::push_heap(heap.begin(), heap.end(), order);
+        }
+        else if (order(rowId, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), order);
+            heap.back() = rowId;
+            std::push_heap(heap.begin(), heap.end(), order);
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), order);
+    return heap;
+}
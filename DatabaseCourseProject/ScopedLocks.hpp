@@ -0,0 +1,44 @@
+#pragma once
+#include "LockManager.hpp"
+#include "LockSet.hpp"
+
+/**
+ * @class ScopedLocks
+ * @brief Holds the locks of a command for the lifetime of the object.
+ *
+ * @code
+ * ScopedLocks held(lockManager, command->requiredLocks(params));
+ * command->execute(params);
+ * @endcode
+ *
+ * The locks are acquired in the constructor and released when the object is
+ * destroyed, also when the command throws.
+ */
+class ScopedLocks {
+private:
+    LockManager& manager; ///< The manager the locks belong to.
+    LockSet locks;        ///< The held locks.
+
+public:
+    /**
+     * @brief Blocks until all locks of the set are held.
+     * @param manager The manager the locks belong to.
+     * @param locks The locks to acquire.
+     */
+    ScopedLocks(LockManager& manager, const LockSet& locks);
+
+    /**
+     * @brief Releases the held locks.
+     */
+    ~ScopedLocks();
+
+    /**
+     * @brief Deleted copy constructor; the locks are released exactly once.
+     */
+    ScopedLocks(const ScopedLocks& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; the locks are released exactly once.
+     */
+    ScopedLocks& operator=(const ScopedLocks& other) = delete;
+};
@@ -0,0 +1,18 @@
+#include "ScopedLocks.hpp"
+
+/**
+ * @brief Blocks until all locks of the set are held.
+ * @param manager The manager the locks belong to.
+ * @param locks The locks to acquire.
+ */
+ScopedLocks::ScopedLocks(LockManager& manager, const LockSet& locks)
+    : manager(manager), locks(locks) {
+    manager.acquire(this->locks);
+}
+
+/**
+ * @brief Releases the held locks.
+ */
+ScopedLocks::~ScopedLocks() {
+    manager.release(locks);
+}
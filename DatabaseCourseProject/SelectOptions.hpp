@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @struct SelectOptions
+ * @brief The optional clauses that may follow the mandatory arguments of `select`.
+ *
+ * Supported clauses, in any order:
+ * - `columns <i,j,...>`: show only the listed columns, in the listed order.
+ * - `orderby <column-n> [asc|desc]`: order the result by a column (ascending by default).
+ * - `limit <n>`: show at most `n` rows.
+ * - `offset <m>`: skip the first `m` rows of the result.
+ */
+struct SelectOptions {
+    std::vector<int> projection; ///< Columns to show; empty means all columns.
+
+    bool ordered;     ///< Whether an `orderby` clause was given.
+    int orderColumn;  ///< The column to order by (only meaningful if `ordered`).
+    bool descending;  ///< `true` for `desc` ordering.
+
+    bool limited;     ///< Whether a `limit` clause was given.
+    size_t limit;     ///< Maximum number of rows to show (only meaningful if `limited`).
+    size_t offset;    ///< Number of leading result rows to skip.
+
+    /**
+     * @brief Constructs options that show every column and every row in storage order.
+     */
+    SelectOptions();
+
+    /**
+     * @brief Parses the optional clauses of a `select` command.
+     *
+     * @param params The full command parameters.
+     * @param firstOption The index of the first parameter that belongs to the optional clauses.
+     * @return The parsed options.
+     * @throws std::runtime_error If a clause is unknown, misses its value or a value is not a valid non-negative number.
+     * @throws std::runtime_error If `offset + limit` exceeds `INT_MAX`.
+     */
+    static SelectOptions fromParameters(const std::vector<std::string>& params, size_t firstOption);
+};
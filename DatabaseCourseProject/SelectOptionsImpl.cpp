@@ -0,0 +1,89 @@
+#include "SelectOptions.hpp"
+#include "CommandParser.hpp"
+#include <climits>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Parses a non-negative integer argument of a `select` clause.
+     * @param value The text to parse.
+     * @param clause The clause name used in the error message.
+     * @return The parsed number.
+     * @throws std::runtime_error If `value` is not a non-negative integer.
+     */
+    int parseNonNegative(const std::string& value, const std::string& clause) {
+        size_t parsed = 0;
+        int number = -1;
+        try {
+            number = std::stoi(value, &parsed);
+        }
+        catch (const std::exception&) {
+        }
+        if (number < 0 || parsed != value.size()) {
+            throw std::runtime_error("Invalid value for " + clause + ": " + value);
+        }
+        return number;
+    }
+}
+
+/**
+ * @brief Constructs options that show every column and every row in storage order.
+ */
+SelectOptions::SelectOptions()
+    : ordered(false), orderColumn(0), descending(false),
+    limited(false), limit(0), offset(0) {
+}
+
+/**
+ * @brief Parses the optional clauses of a `select` command.
+ *
+ * Every clause keyword consumes the parameter after it. `orderby` additionally
+ * consumes a following `asc` or `desc`, if present.
+ *
+ * @param params The full command parameters.
+ * @param firstOption The index of the first parameter that belongs to the optional clauses.
+ * @return The parsed options.
+ * @throws std::runtime_error If a clause is unknown, misses its value or a value is not a valid non-negative number.
+ * @throws std::runtime_error If `offset + limit` exceeds the largest possible row count, `INT_MAX`.
+ */
+SelectOptions SelectOptions::fromParameters(const std::vector<std::string>& params, size_t firstOption) {
+    SelectOptions options;
+
+    for (size_t i = firstOption; i < params.size(); ++i) {
+        const std::string& clause = params[i];
+
+        if (i + 1 >= params.size()) {
+            throw std::runtime_error("Missing value for " + clause + ". ");
+        }
+        const std::string& value = params[++i];
+
+        if (clause == "columns") {
+            options.projection.clear();
+            for (const std::string& column : CommandParser::parseCommand(value, ',')) {
+                options.projection.push_back(parseNonNegative(column, clause));
+            }
+        }
+        else if (clause == "orderby") {
+            options.ordered = true;
+            options.orderColumn = parseNonNegative(value, clause);
+            if (i + 1 < params.size() && (params[i + 1] == "asc" || params[i + 1] == "desc")) {
+                options.descending = params[++i] == "desc";
+            }
+        }
+        else if (clause == "limit") {
+            options.limited = true;
+            options.limit = parseNonNegative(value, clause);
+        }
+        else if (clause == "offset") {
+            options.offset = parseNonNegative(value, clause);
+        }
+        else {
+            throw std::runtime_error("Unknown select clause: " + clause);
+        }
+    }
+
+    if (options.limited && options.limit > static_cast<size_t>(INT_MAX) - options.offset) {
+        throw std::runtime_error("offset + limit must not exceed " + std::to_string(INT_MAX) + ". ");
+    }
+    return options;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "AggregateFunction.hpp"
+
+/**
+ * @struct QueryToken
+ * @brief A lexical token of a SQL statement.
+ */
+struct QueryToken {
+    enum Kind {
+        IDENTIFIER, ///< A keyword or a (possibly qualified) column or table name, e.g. `Orders.price` or `$2`.
+        NUMBER,     ///< A numeric literal.
+        STRING,     ///< A single-quoted string literal, stored without the quotes.
+        SYMBOL,     ///< Punctuation or an operator: `( ) , * ; = != <> < <= > >=`.
+        END         ///< End of the statement.
+    };
+
+    Kind kind;        ///< The kind of the token.
+    std::string text; ///< The text of the token.
+};
+
+/**
+ * @struct ColumnReference
+ * @brief A column as written in a statement, before it is resolved against the tables.
+ */
+struct ColumnReference {
+    std::string table;  ///< The qualifying table name, or empty.
+    std::string column; ///< The column name, or `$n` for a position.
+
+    /**
+     * @brief Returns the reference as it was written.
+     * @return `table.column` or just `column`.
+     */
+    std::string toString() const;
+};
+
+/**
+ * @struct SelectItem
+ * @brief One entry of the SELECT list.
+ */
+struct SelectItem {
+    enum Kind {
+        ALL,      ///< `*`, every column of the input.
+        COLUMN,   ///< A plain column reference.
+        AGGREGATE ///< An aggregate function call.
+    };
+
+    Kind kind;                   ///< The kind of the item.
+    AggregateFunction function;  ///< The function (only meaningful for `AGGREGATE`).
+    bool countAll;               ///< `true` for `COUNT(*)`.
+    ColumnReference column;      ///< The referenced column (not used by `ALL` and `COUNT(*)`).
+    std::string alias;           ///< The name given with `AS`, or empty.
+
+    /**
+     * @brief Constructs a `*` item.
+     */
+    SelectItem();
+
+    /**
+     * @brief Returns the item as it was written, without the alias.
+     * @return For example `price` or `SUM(price)`.
+     */
+    std::string toString() const;
+};
+
+/**
+ * @struct OrderItem
+ * @brief One key of the ORDER BY clause.
+ */
+struct OrderItem {
+    SelectItem key;    ///< The key, written like a SELECT item (column or aggregate).
+    size_t ordinal;    ///< 1-based position in the SELECT list when the key was a number, otherwise 0.
+    bool descending;   ///< `true` for `DESC`.
+};
+
+/**
+ * @struct SelectStatement
+ * @brief The parsed form of a statement accepted by the `query` command.
+ *
+ * The statement only describes what was written; names are resolved
+ * against the catalog by `QueryPlanner`.
+ */
+struct SelectStatement {
+    std::vector<SelectItem> items; ///< The SELECT list.
+    std::string fromTable;         ///< The table after FROM.
+
+    bool joined;               ///< Whether a JOIN clause was given.
+    std::string joinTable;     ///< The joined table.
+    ColumnReference joinLeft;  ///< Left side of the ON equality.
+    ColumnReference joinRight; ///< Right side of the ON equality.
+
+    std::vector<QueryToken> where;         ///< Tokens of the WHERE condition; empty without WHERE.
+    std::vector<ColumnReference> groupBy;  ///< The GROUP BY columns.
+    std::vector<OrderItem> orderBy;        ///< The ORDER BY keys.
+
+    bool limited;  ///< Whether a LIMIT clause was given.
+    size_t limit;  ///< Maximum number of result rows (only meaningful if `limited`).
+    size_t offset; ///< Number of leading result rows to skip.
+
+    /**
+     * @brief Constructs an empty statement without join, filter, grouping, ordering or limit.
+     */
+    SelectStatement();
+};
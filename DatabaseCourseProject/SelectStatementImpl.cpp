@@ -0,0 +1,46 @@
+#include "SelectStatement.hpp"
+
+/**
+ * @brief Returns the reference as it was written.
+ * @return `table.column` or just `column`.
+ */
+std::string ColumnReference::toString() const {
+    return table.empty() ? column : table + "." + column;
+}
+
+/**
+ * @brief Constructs a `*` item.
+ */
+SelectItem::SelectItem()
+    : kind(ALL), function(AggregateFunction::COUNT), countAll(false) {
+}
+
+/**
+ * @brief Returns the item as it was written, without the alias.
+ * @return For example `*`, `price` or `SUM(price)`.
+ */
+std::string SelectItem::toString() const {
+    if (kind == ALL) {
+        return "*";
+    }
+    if (kind == COLUMN) {
+        return column.toString();
+    }
+
+    std::string name;
+    switch (function) {
+    case AggregateFunction::COUNT: name = "COUNT"; break;
+    case AggregateFunction::SUM:   name = "SUM"; break;
+    case AggregateFunction::AVG:   name = "AVG"; break;
+    case AggregateFunction::MIN:   name = "MIN"; break;
+    case AggregateFunction::MAX:   name = "MAX"; break;
+    }
+    return name + "(" + (countAll ? std::string("*") : column.toString()) + ")";
+}
+
+/**
+ * @brief Constructs an empty statement without join, filter, grouping, ordering or limit.
+ */
+SelectStatement::SelectStatement()
+    : joined(false), limited(false), limit(0), offset(0) {
+}
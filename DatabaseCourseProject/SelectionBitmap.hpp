@@ -0,0 +1,124 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+/**
+ * @class SelectionBitmap
+ * @brief A fixed-size set of row positions stored as 64-bit words.
+ *
+ * Expressions are evaluated one batch of rows at a time; the result of each
+ * node is a bitmap in which bit `i` stands for the `i`-th row of the batch.
+ * Combining conditions (AND, OR, NOT) then works on whole words instead of
+ * single rows. Bits beyond `size()` are always kept at zero.
+ */
+class SelectionBitmap {
+private:
+    std::vector<uint64_t> words; ///< The bits, 64 per word, lowest bit first.
+    int bitCount;                ///< The number of valid bits.
+
+    /**
+     * @brief Clears the unused bits of the last word.
+     */
+    void clearTail();
+
+public:
+    /// Number of bits per storage word.
+    static const int WORD_BITS = 64;
+
+    /**
+     * @brief Constructs an empty bitmap with no bits.
+     */
+    SelectionBitmap();
+
+    /**
+     * @brief Resizes the bitmap to `size` bits and clears all of them.
+     * @param size The new number of bits.
+     */
+    void reset(int size);
+
+    /**
+     * @brief Returns the number of valid bits.
+     * @return The size of the bitmap.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of storage words.
+     * @return The word count.
+     */
+    int wordCount() const;
+
+    /**
+     * @brief Returns a storage word.
+     * @param index The index of the word.
+     * @return The 64 bits of the word.
+     */
+    uint64_t getWord(int index) const;
+
+    /**
+     * @brief Replaces a storage word. Bits beyond `size()` are masked off.
+     * @param index The index of the word.
+     * @param word The new bits.
+     */
+    void setWord(int index, uint64_t word);
+
+    /**
+     * @brief Sets a single bit.
+     * @param index The bit to set.
+     */
+    void set(int index);
+
+    /**
+     * @brief Tests a single bit.
+     * @param index The bit to test.
+     * @return `true` if the bit is set.
+     */
+    bool test(int index) const;
+
+    /**
+     * @brief Keeps only the bits that are also set in `other` (logical AND).
+     * @param other A bitmap of the same size.
+     */
+    void andWith(const SelectionBitmap& other);
+
+    /**
+     * @brief Adds the bits that are set in `other` (logical OR).
+     * @param other A bitmap of the same size.
+     */
+    void orWith(const SelectionBitmap& other);
+
+    /**
+     * @brief Flips every valid bit (logical NOT).
+     */
+    void invert();
+
+    /**
+     * @brief Sets every valid bit.
+     */
+    void setAll();
+
+    /**
+     * @brief Counts the set bits.
+     * @return The number of set bits.
+     */
+    int count() const;
+
+    /**
+     * @brief Checks whether no bit is set.
+     * @return `true` if the bitmap is empty.
+     */
+    bool none() const;
+
+    /**
+     * @brief Checks whether every valid bit is set.
+     * @return `true` if all bits are set.
+     */
+    bool all() const;
+
+    /**
+     * @brief Appends the positions of all set bits, shifted by `offset`, to `rows`.
+     * @param offset The row id of bit 0.
+     * @param rows The vector receiving the row ids, in ascending order.
+     */
+    void appendSetRows(int offset, std::vector<int>& rows) const;
+};
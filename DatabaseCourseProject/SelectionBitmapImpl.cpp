@@ -0,0 +1,178 @@
+#include "SelectionBitmap.hpp"
+#include <bitset>
+
+/**
+ * @brief Constructs an empty bitmap with no bits.
+ */
+SelectionBitmap::SelectionBitmap()
+    : bitCount(0) {
+}
+
+/**
+ * @brief Clears the unused bits of the last word.
+ *
+ * Keeping the tail at zero lets `count()`, `none()` and `all()` work on whole words.
+ */
+void SelectionBitmap::clearTail() {
+    int used = bitCount % WORD_BITS;
+    if (used != 0) {
+        words.back() &= (uint64_t(1) << used) - 1;
+    }
+}
+
+/**
+ * @brief Resizes the bitmap to `size` bits and clears all of them.
+ * @param size The new number of bits.
+ */
+void SelectionBitmap::reset(int size) {
+    bitCount = size;
+    words.assign((size + WORD_BITS - 1) / WORD_BITS, 0);
+}
+
+/**
+ * @brief Returns the number of valid bits.
+ * @return The size of the bitmap.
+ */
+int SelectionBitmap::size() const {
+    return bitCount;
+}
+
+/**
+ * @brief Returns the number of storage words.
+ * @return The word count.
+ */
+int SelectionBitmap::wordCount() const {
+    return static_cast<int>(words.size());
+}
+
+/**
+ * @brief Returns a storage word.
+ * @param index The index of the word.
+ * @return The 64 bits of the word.
+ */
+uint64_t SelectionBitmap::getWord(int index) const {
+    return words[index];
+}
+
+/**
+ * @brief Replaces a storage word. Bits beyond `size()` are masked off.
+ * @param index The index of the word.
+ * @param word The new bits.
+ */
+void SelectionBitmap::setWord(int index, uint64_t word) {
+    words[index] = word;
+    if (index == wordCount() - 1) {
+        clearTail();
+    }
+}
+
+/**
+ * @brief Sets a single bit.
+ * @param index The bit to set.
+ */
+void SelectionBitmap::set(int index) {
+    words[index / WORD_BITS] |= uint64_t(1) << (index % WORD_BITS);
+}
+
+/**
+ * @brief Tests a single bit.
+ * @param index The bit to test.
+ * @return `true` if the bit is set.
+ */
+bool SelectionBitmap::test(int index) const {
+    return (words[index / WORD_BITS] >> (index % WORD_BITS)) & 1;
+}
+
+/**
+ * @brief Keeps only the bits that are also set in `other` (logical AND).
+ * @param other A bitmap of the same size.
+ */
+void SelectionBitmap::andWith(const SelectionBitmap& other) {
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] &= other.words[i];
+    }
+}
+
+/**
+ * @brief Adds the bits that are set in `other` (logical OR).
+ * @param other A bitmap of the same size.
+ */
+void SelectionBitmap::orWith(const SelectionBitmap& other) {
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] |= other.words[i];
+    }
+}
+
+/**
+ * @brief Flips every valid bit (logical NOT).
+ */
+void SelectionBitmap::invert() {
+    for (uint64_t& word : words) {
+        word = ~word;
+    }
+    clearTail();
+}
+
+/**
+ * @brief Sets every valid bit.
+ */
+void SelectionBitmap::setAll() {
+    for (uint64_t& word : words) {
+        word = ~uint64_t(0);
+    }
+    clearTail();
+}
+
+/**
+ * @brief Counts the set bits.
+ * @return The number of set bits.
+ */
+int SelectionBitmap::count() const {
+    int total = 0;
+    for (uint64_t word : words) {
+        total += static_cast<int>(std::bitset<WORD_BITS>(word).count());
+    }
+    return total;
+}
+
+/**
+ * @brief Checks whether no bit is set.
+ * @return `true` if the bitmap is empty.
+ */
+bool SelectionBitmap::none() const {
+    for (uint64_t word : words) {
+        if (word != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks whether every valid bit is set.
+ * @return `true` if all bits are set.
+ */
+bool SelectionBitmap::all() const {
+    return count() == bitCount;
+}
+
+/**
+ * @brief Appends the positions of all set bits, shifted by `offset`, to `rows`.
+ *
+ * Empty words are skipped entirely; within a word the lowest set bit is
+ * isolated and cleared until the word is exhausted.
+ *
+ * @param offset The row id of bit 0.
+ * @param rows The vector receiving the row ids, in ascending order.
+ */
+void SelectionBitmap::appendSetRows(int offset, std::vector<int>& rows) const {
+    for (size_t i = 0; i < words.size(); ++i) {
+        uint64_t word = words[i];
+        while (word != 0) {
+            uint64_t lowest = word & (~word + 1);
+            int bit = static_cast<int>(std::bitset<WORD_BITS>(lowest - 1).count());
+            rows.push_back(offset + static_cast<int>(i) * WORD_BITS + bit);
+            word ^= lowest;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <string>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * @class Socket
+ * @brief A minimal, blocking TCP socket bound to the loopback interface.
+ *
+ * Wraps the handful of BSD socket calls the server mode needs behind one
+ * interface that compiles against Winsock on Windows and POSIX sockets
+ * elsewhere. Only `127.0.0.1` is used, so the server is never reachable from
+ * other machines. Received bytes are buffered, which lets `readLine` hand out
+ * one line at a time.
+ *
+ * Sockets are created by the static factories and by `accept`; the caller
+ * owns the returned objects.
+ */
+class Socket {
+public:
+#ifdef _WIN32
+    using Handle = uintptr_t; ///< Winsock `SOCKET`.
+#else
+    using Handle = int;       ///< POSIX file descriptor.
+#endif
+
+private:
+    Handle handle;       ///< The native socket.
+    bool listening;      ///< Whether this is a listening socket created by `listenOnLocalhost`.
+    bool closed;         ///< Whether the native socket has already been closed.
+    std::atomic<bool> stopped; ///< Whether `shutdown` was called, possibly from another thread.
+    std::string received; ///< Bytes received but not yet returned by `readLine`.
+
+    /**
+     * @brief Wraps an already created native socket.
+     * @param handle The native socket. The new object takes ownership.
+     * @param listening Whether the socket listens for connections.
+     */
+    Socket(Handle handle, bool listening);
+
+public:
+    /**
+     * @brief Closes the native socket.
+     */
+    ~Socket();
+
+    /**
+     * @brief Copying is disabled; a socket has exactly one owner.
+     */
+    Socket(const Socket& other) = delete;
+
+    /**
+     * @brief Copying is disabled; a socket has exactly one owner.
+     */
+    Socket& operator=(const Socket& other) = delete;
+
+    /**
+     * @brief Starts listening for connections on `127.0.0.1:port`.
+     * @param port The TCP port.
+     * @return The listening socket. The caller owns it.
+     * @throws std::runtime_error If the port cannot be bound.
+     */
+    static Socket* listenOnLocalhost(int port);
+
+    /**
+     * @brief Connects to `127.0.0.1:port`.
+     * @param port The TCP port.
+     * @return The connected socket. The caller owns it.
+     * @throws std::runtime_error If no server accepts the connection.
+     */
+    static Socket* connectToLocalhost(int port);
+
+    /**
+     * @brief Waits for the next connection on a listening socket.
+     * @return The connected socket, owned by the caller, or `nullptr` once the listener was shut down.
+     */
+    Socket* accept();
+
+    /**
+     * @brief Reads the next line, blocking until it is complete.
+     *
+     * The line break (`\n`, optionally preceded by `\r`) is removed. An
+     * unterminated last line before the peer closes the connection is returned as well.
+     *
+     * @param line Receives the line.
+     * @return `false` once the connection is closed and no more data is buffered.
+     */
+    bool readLine(std::string& line);
+
+    /**
+     * @brief Sends all bytes of `data`.
+     * @param data The bytes to send.
+     * @return `false` if the connection is broken; the peer has then received only a part of `data`.
+     */
+    bool writeAll(const std::string& data);
+
+    /**
+     * @brief Stops all traffic on the socket.
+     *
+     * Threads blocked in `readLine` or `accept` on this socket return. The
+     * object itself stays valid until it is deleted.
+     */
+    void shutdown();
+};
@@ -0,0 +1,247 @@
+#include "Socket.hpp"
+#include <stdexcept>
+#include <mutex>
+#include <cerrno>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "Ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    const Socket::Handle INVALID_HANDLE = static_cast<Socket::Handle>(INVALID_SOCKET);
+
+    /**
+     * @brief Initializes Winsock once per process.
+     * @throws std::runtime_error If Winsock cannot be initialized.
+     */
+    void initializeSockets() {
+        static std::once_flag once;
+        static bool initialized = false;
+        std::call_once(once, []() {
+            WSADATA data;
+            initialized = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+        });
+        if (!initialized) {
+            throw std::runtime_error("Failed to initialize Winsock. ");
+        }
+    }
+
+    void closeHandle(Socket::Handle handle) {
+        closesocket(static_cast<SOCKET>(handle));
+    }
+#else
+    const Socket::Handle INVALID_HANDLE = -1;
+
+    void initializeSockets() {
+    }
+
+    void closeHandle(Socket::Handle handle) {
+        ::close(handle);
+    }
+#endif
+
+    /**
+     * @brief Builds the address `127.0.0.1:port`.
+     * @param port The TCP port.
+     * @return The address.
+     * @throws std::runtime_error If the port is out of range.
+     */
+    sockaddr_in loopbackAddress(int port) {
+        if (port <= 0 || port > 65535) {
+            throw std::runtime_error("Invalid port: " + std::to_string(port));
+        }
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<unsigned short>(port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        return address;
+    }
+
+    /**
+     * @brief Creates a native TCP socket.
+     * @return The socket.
+     * @throws std::runtime_error If the socket cannot be created.
+     */
+    Socket::Handle createHandle() {
+        initializeSockets();
+        Socket::Handle handle = static_cast<Socket::Handle>(::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+        if (handle == INVALID_HANDLE) {
+            throw std::runtime_error("Failed to create a socket. ");
+        }
+        return handle;
+    }
+}
+
+/**
+ * @brief Wraps an already created native socket.
+ * @param handle The native socket. The new object takes ownership.
+ * @param listening Whether the socket listens for connections.
+ */
+Socket::Socket(Handle handle, bool listening)
+    : handle(handle), listening(listening), closed(false), stopped(false) {
+}
+
+/**
+ * @brief Closes the native socket.
+ */
+Socket::~Socket() {
+    if (!closed) {
+        closeHandle(handle);
+    }
+}
+
+/**
+ * @brief Starts listening for connections on `127.0.0.1:port`.
+ *
+ * `SO_REUSEADDR` is set so that a restarted server can bind the port again
+ * while connections of the previous run are still in `TIME_WAIT`.
+ *
+ * @param port The TCP port.
+ * @return The listening socket. The caller owns it.
+ * @throws std::runtime_error If the port cannot be bound.
+ */
+Socket* Socket::listenOnLocalhost(int port) {
+    sockaddr_in address = loopbackAddress(port);
+    Handle handle = createHandle();
+
+    int reuse = 1;
+    setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    if (::bind(handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || ::listen(handle, SOMAXCONN) != 0) {
+        closeHandle(handle);
+        throw std::runtime_error("Failed to listen on 127.0.0.1:" + std::to_string(port) + ". ");
+    }
+    return new Socket(handle, true);
+}
+
+/**
+ * @brief Connects to `127.0.0.1:port`.
+ * @param port The TCP port.
+ * @return The connected socket. The caller owns it.
+ * @throws std::runtime_error If no server accepts the connection.
+ */
+Socket* Socket::connectToLocalhost(int port) {
+    sockaddr_in address = loopbackAddress(port);
+    Handle handle = createHandle();
+
+    if (::connect(handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        closeHandle(handle);
+        throw std::runtime_error("Failed to connect to 127.0.0.1:" + std::to_string(port) + ". ");
+    }
+    return new Socket(handle, false);
+}
+
+/**
+ * @brief Waits for the next connection on a listening socket.
+ * @return The connected socket, owned by the caller, or `nullptr` once the listener was shut down.
+ */
+Socket* Socket::accept() {
+    while (!stopped) {
+        Handle client = static_cast<Handle>(::accept(handle, nullptr, nullptr));
+        if (client != INVALID_HANDLE) {
+            return new Socket(client, false);
+        }
+        if (stopped) {
+            break;
+        }
+#ifndef _WIN32
+        if (errno == EINTR || errno == ECONNABORTED) {
+            continue;
+        }
+#endif
+        break;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Reads the next line, blocking until it is complete.
+ *
+ * Data is received in chunks of 4 KiB and kept in `received` until a line
+ * break arrives, so long lines and several lines per chunk are both handled.
+ *
+ * @param line Receives the line.
+ * @return `false` once the connection is closed and no more data is buffered.
+ */
+bool Socket::readLine(std::string& line) {
+    size_t lineEnd;
+    while ((lineEnd = received.find('\n')) == std::string::npos) {
+        char chunk[4096];
+        int count = stopped ? 0 : static_cast<int>(::recv(handle, chunk, sizeof(chunk), 0));
+        if (count <= 0) {
+            if (received.empty()) {
+                return false;
+            }
+            line.swap(received);
+            received.clear();
+            return true;
+        }
+        received.append(chunk, static_cast<size_t>(count));
+    }
+
+    line.assign(received, 0, lineEnd);
+    received.erase(0, lineEnd + 1);
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    return true;
+}
+
+/**
+ * @brief Sends all bytes of `data`.
+ *
+ * On Linux `MSG_NOSIGNAL` keeps a vanished peer from raising `SIGPIPE`,
+ * which would otherwise terminate the whole server.
+ *
+ * @param data The bytes to send.
+ * @return `false` if the connection is broken.
+ */
+bool Socket::writeAll(const std::string& data) {
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    size_t sent = 0;
+    while (sent < data.size() && !stopped) {
+        int count = static_cast<int>(::send(handle, data.data() + sent, static_cast<int>(data.size() - sent), flags));
+        if (count <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(count);
+    }
+    return sent == data.size();
+}
+
+/**
+ * @brief Stops all traffic on the socket.
+ *
+ * Connected sockets are shut down in both directions, which wakes up a
+ * blocked `recv`. Winsock does not wake up `accept` that way, so a listening
+ * socket is closed there instead; POSIX shuts it down like any other socket.
+ */
+void Socket::shutdown() {
+    if (stopped.exchange(true)) {
+        return;
+    }
+#ifdef _WIN32
+    if (listening) {
+        closed = true;
+        closeHandle(handle);
+        return;
+    }
+    ::shutdown(handle, SD_BOTH);
+#else
+    ::shutdown(handle, SHUT_RDWR);
+#endif
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include "QueryOperator.hpp"
+
+/**
+ * @class SortOperator
+ * @brief Blocking operator implementing ORDER BY.
+ *
+ * Rows are buffered together with their parsed numeric keys, so every value is
+ * converted once instead of in every comparison. When a row bound is given
+ * (`OFFSET + LIMIT` of the query), only that many leading rows are ordered with
+ * a partial sort. Ties keep the input order.
+ */
+class SortOperator : public QueryOperator {
+public:
+    /**
+     * @brief One sort key.
+     */
+    struct SortKey {
+        int column;       ///< Input position of the key.
+        ColumnType type;  ///< Type of the key values.
+        bool descending;  ///< `true` for descending order.
+    };
+
+private:
+    /**
+     * @brief A buffered row with its parsed numeric keys.
+     */
+    struct SortEntry {
+        QueryRow row;                ///< The row.
+        std::vector<double> numbers; ///< Parsed value of each numeric key (unused for strings and NULL).
+        size_t sequence;             ///< Arrival order, used to break ties.
+    };
+
+    std::vector<SortKey> keys;     ///< The keys, most significant first.
+    size_t bound;                  ///< Number of leading rows needed downstream; 0 for all.
+    std::vector<SortEntry> entries; ///< The buffered rows.
+
+    /**
+     * @brief Checks whether `left` orders strictly before `right`.
+     * @param left The first entry.
+     * @param right The second entry.
+     * @return `true` if `left` comes first.
+     */
+    bool less(const SortEntry& left, const SortEntry& right) const;
+
+public:
+    /**
+     * @brief Constructs the operator.
+     * @param keys The sort keys, most significant first.
+     * @param bound Number of leading rows needed downstream, or 0 to order all rows.
+     * @param next The downstream operator. Ownership is transferred.
+     */
+    SortOperator(const std::vector<SortKey>& keys, size_t bound, QueryOperator* next);
+
+    /**
+     * @brief Buffers a row.
+     * @param row The input row.
+     * @return Always `true`; the whole input is needed.
+     * @throws std::runtime_error If a numeric key holds a non-numeric value.
+     */
+    bool consume(const QueryRow& row) override;
+
+    /**
+     * @brief Orders the buffered rows, pushes them downstream and forwards `finish()`.
+     */
+    void finish() override;
+};
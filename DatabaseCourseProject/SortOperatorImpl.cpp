@@ -0,0 +1,99 @@
+#include "SortOperator.hpp"
+#include "QueryValueUtils.hpp"
+#include <algorithm>
+
+/**
+ * @brief Constructs the operator.
+ * @param keys The sort keys, most significant first.
+ * @param bound Number of leading rows needed downstream, or 0 to order all rows.
+ * @param next The downstream operator. Ownership is transferred.
+ */
+SortOperator::SortOperator(const std::vector<SortKey>& keys, size_t bound, QueryOperator* next)
+    : QueryOperator(next), keys(keys), bound(bound) {
+}
+
+/**
+ * @brief Checks whether `left` orders strictly before `right`.
+ *
+ * NULL comes first in ascending and last in descending order. Equal keys are
+ * ordered by arrival, which makes the result independent of the sort algorithm.
+ *
+ * @param left The first entry.
+ * @param right The second entry.
+ * @return `true` if `left` comes first.
+ */
+bool SortOperator::less(const SortEntry& left, const SortEntry& right) const {
+    for (size_t k = 0; k < keys.size(); ++k) {
+        const std::string& a = left.row[keys[k].column];
+        const std::string& b = right.row[keys[k].column];
+
+        int order;
+        if (a.empty() || b.empty()) {
+            order = (a.empty() ? 0 : 1) - (b.empty() ? 0 : 1);
+        }
+        else if (QueryValueUtils::isNumeric(keys[k].type)) {
+            order = left.numbers[k] < right.numbers[k] ? -1 : (right.numbers[k] < left.numbers[k] ? 1 : 0);
+        }
+        else {
+            order = a.compare(b);
+        }
+
+        if (order != 0) {
+            return keys[k].descending ? order > 0 : order < 0;
+        }
+    }
+    return left.sequence < right.sequence;
+}
+
+/**
+ * @brief Buffers a row and parses its numeric keys.
+ * @param row The input row.
+ * @return Always `true`.
+ * @throws std::runtime_error If a numeric key holds a non-numeric value.
+ */
+bool SortOperator::consume(const QueryRow& row) {
+    SortEntry entry;
+    entry.row = row;
+    entry.numbers.resize(keys.size(), 0.0);
+    entry.sequence = entries.size();
+
+    for (size_t k = 0; k < keys.size(); ++k) {
+        const std::string& value = row[keys[k].column];
+        if (!value.empty() && QueryValueUtils::isNumeric(keys[k].type)) {
+            entry.numbers[k] = QueryValueUtils::toNumber(value);
+        }
+    }
+
+    entries.push_back(std::move(entry));
+    return true;
+}
+
+/**
+ * @brief Orders the buffered rows, pushes them downstream and forwards `finish()`.
+ *
+ * With a bound smaller than the input only the leading rows are ordered,
+ * which costs O(n log bound) instead of O(n log n).
+ */
+void SortOperator::finish() {
+    auto comparator = [this](const SortEntry& left, const SortEntry& right) {
+        return less(left, right);
+    };
+
+    size_t count = entries.size();
+    if (bound > 0 && bound < count) {
+        std::partial_sort(entries.begin(), entries.begin() + bound, entries.end(), comparator);
+        count = bound;
+    }
+    else {
+        std::sort(entries.begin(), entries.end(), comparator);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!next->consume(entries[i].row)) {
+            break;
+        }
+    }
+    entries.clear();
+
+    QueryOperator::finish();
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+/**
+ * @struct StartupOptions
+ * @brief Settings chosen on the command line when the program starts.
+ *
+ * The options are parsed once in `main` and handed to the `Engine`, which
+ * uses them to size and configure the shared services it owns.
+ *
+ * Supported arguments:
+ * - `--threads <n>`: number of worker threads of the shared `TaskScheduler`
+ *   (0 or omitted uses the hardware concurrency).
+ * - `--sort-memory <MiB>`: memory budget of the `sort` command before it
+ *   spills sorted runs to disk (64 MiB by default).
+ * - `--metrics-file <path>`: file the metrics are written to in Prometheus
+ *   text format when the program exits (not written by default).
+ * - `--trace-file <path>`: traces the whole session (see `TraceRecorder`) and
+ *   writes the Chrome trace to `path` when the program exits.
+ * - `--capture-file <path>`: records every dispatched command with its time
+ *   offset into a workload file (see `WorkloadRecorder`).
+ * - `--replay <path>`: instead of the interactive loop, re-executes a captured
+ *   workload and prints per-command latency distributions (see `Engine::replay`).
+ * - `--replay-paced`: keeps the original pauses between the replayed commands
+ *   instead of replaying as fast as possible.
+ * - `--script <path>`: instead of the interactive loop, executes the commands
+ *   of a script file (`-` reads standard input) without prompts and prints
+ *   results in a machine-readable format (see `Engine::runScript`).
+ * - `--continue-on-error`: lets a script continue after a failed command
+ *   instead of stopping at the first one.
+ * - `--catalog <path>`: opens the catalog at startup, like the `open` command.
+ * - `--serve <port>`: instead of the interactive loop, serves the catalog to
+ *   concurrent client sessions on `127.0.0.1:port` (see `Engine::serve`).
+ * - `--connect <port>`: runs as a thin client of a server on `127.0.0.1:port`
+ *   (see `RemoteClient`).
+ */
+struct StartupOptions {
+
+    /**
+     * @brief Number of worker threads of the engine's `TaskScheduler`. 0 means "use all hardware threads".
+     */
+    unsigned int workerThreadCount;
+
+    /**
+     * @brief Maximum number of bytes `sort` keeps in memory before spilling a sorted run to disk.
+     */
+    size_t sortMemoryBudget;
+
+    /**
+     * @brief File the metrics are dumped to on exit, in Prometheus text format. Empty disables the dump.
+     */
+    std::string metricsFile;
+
+    /**
+     * @brief File the session trace is written to on exit, in Chrome trace-event format. Empty disables session tracing.
+     */
+    std::string traceFile;
+
+    /**
+     * @brief Workload file the dispatched commands are captured to. Empty disables the capture.
+     */
+    std::string captureFile;
+
+    /**
+     * @brief Workload file to replay instead of running the interactive loop. Empty runs interactively.
+     */
+    std::string replayFile;
+
+    /**
+     * @brief Whether a replay keeps the original pacing of the captured commands.
+     */
+    bool replayPaced;
+
+    /**
+     * @brief Script to execute in batch mode instead of running the interactive loop; `-` is standard input. Empty runs interactively.
+     */
+    std::string scriptFile;
+
+    /**
+     * @brief Whether a script continues after a failed command.
+     */
+    bool continueOnError;
+
+    /**
+     * @brief Catalog opened at startup. Empty opens none.
+     */
+    std::string catalogFile;
+
+    /**
+     * @brief Port the server listens on. 0 runs without a server.
+     */
+    int servePort;
+
+    /**
+     * @brief Port of the server to connect to as a client. 0 runs the engine locally.
+     */
+    int connectPort;
+
+    /**
+     * @brief Constructs the default options.
+     */
+    StartupOptions();
+
+    /**
+     * @brief Parses the program arguments into a `StartupOptions` instance.
+     *
+     * @param argc The argument count as received by `main`.
+     * @param argv The argument vector as received by `main`.
+     * @return The parsed options. Arguments that are not given keep their defaults.
+     * @throws std::runtime_error If an argument is unknown, misses its value or the value is invalid,
+     * or if more than one of replay, script, server and client mode is requested.
+     */
+    static StartupOptions fromArguments(int argc, char* argv[]);
+
+    /**
+     * @brief Returns a short description of the supported arguments.
+     * @return A multi-line usage string suitable for printing to the console.
+     */
+    static std::string usage();
+};
@@ -0,0 +1,152 @@
+#include "StartupOptions.hpp"
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /**
+     * @brief Parses the non-negative integer value of a command line option.
+     * @param option The option name used in the error message.
+     * @param value The text to parse.
+     * @return The parsed value.
+     * @throws std::runtime_error If `value` is not a non-negative integer.
+     */
+    unsigned long long parseCount(const std::string& option, const std::string& value) {
+        try {
+            size_t parsed = 0;
+            long long number = std::stoll(value, &parsed);
+            if (number < 0 || parsed != value.size()) {
+                throw std::out_of_range("negative");
+            }
+            return static_cast<unsigned long long>(number);
+        }
+        catch (const std::exception&) {
+            throw std::runtime_error("Invalid value for " + option + ": " + value);
+        }
+    }
+}
+
+/**
+ * @brief Constructs the default options.
+ *
+ * By default the task scheduler uses one worker per hardware thread,
+ * `sort` may use 64 MiB of memory, neither a metrics file nor a trace is written,
+ * no workload is captured, no catalog is opened and the interactive loop runs.
+ * Scripts stop at the first failed command.
+ */
+StartupOptions::StartupOptions()
+    : workerThreadCount(0), sortMemoryBudget(64 * 1024 * 1024), replayPaced(false), continueOnError(false),
+    servePort(0), connectPort(0) {
+}
+
+/**
+ * @brief Parses the program arguments into a `StartupOptions` instance.
+ *
+ * Arguments are processed left to right. Every option that expects a value
+ * consumes the following argument.
+ *
+ * @param argc The argument count as received by `main`.
+ * @param argv The argument vector as received by `main`.
+ * @return The parsed options.
+ * @throws std::runtime_error If an argument is unknown, misses its value or the value is invalid,
+ * or if more than one of replay, script, server and client mode is requested.
+ */
+StartupOptions StartupOptions::fromArguments(int argc, char* argv[]) {
+    StartupOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+
+        if (argument == "--threads" || argument == "--sort-memory"
+            || argument == "--serve" || argument == "--connect") {
+            if (i + 1 >= argc) {
+                throw std::runtime_error("Missing value for " + argument + ". ");
+            }
+            unsigned long long value = parseCount(argument, argv[++i]);
+
+            if (argument == "--threads") {
+                options.workerThreadCount = static_cast<unsigned int>(value);
+            }
+            else if (argument == "--serve" || argument == "--connect") {
+                if (value == 0 || value > 65535) {
+                    throw std::runtime_error("Invalid port for " + argument + ": " + std::to_string(value));
+                }
+                if (argument == "--serve") {
+                    options.servePort = static_cast<int>(value);
+                }
+                else {
+                    options.connectPort = static_cast<int>(value);
+                }
+            }
+            else {
+                if (value == 0) {
+                    throw std::runtime_error("The sort memory budget must be at least 1 MiB. ");
+                }
+                options.sortMemoryBudget = static_cast<size_t>(value) * 1024 * 1024;
+            }
+        }
+        else if (argument == "--metrics-file" || argument == "--trace-file"
+            || argument == "--capture-file" || argument == "--replay" || argument == "--script"
+            || argument == "--catalog") {
+            if (i + 1 >= argc) {
+                throw std::runtime_error("Missing value for " + argument + ". ");
+            }
+            std::string value = argv[++i];
+
+            if (argument == "--metrics-file") {
+                options.metricsFile = value;
+            }
+            else if (argument == "--trace-file") {
+                options.traceFile = value;
+            }
+            else if (argument == "--capture-file") {
+                options.captureFile = value;
+            }
+            else if (argument == "--replay") {
+                options.replayFile = value;
+            }
+            else if (argument == "--catalog") {
+                options.catalogFile = value;
+            }
+            else {
+                options.scriptFile = value;
+            }
+        }
+        else if (argument == "--replay-paced") {
+            options.replayPaced = true;
+        }
+        else if (argument == "--continue-on-error") {
+            options.continueOnError = true;
+        }
+        else {
+            throw std::runtime_error("Unknown argument: " + argument);
+        }
+    }
+
+    int modes = (options.replayFile.empty() ? 0 : 1) + (options.scriptFile.empty() ? 0 : 1)
+        + (options.servePort == 0 ? 0 : 1) + (options.connectPort == 0 ? 0 : 1);
+    if (modes > 1) {
+        throw std::runtime_error("Only one of --replay, --script, --serve and --connect can be given. ");
+    }
+
+    return options;
+}
+
+/**
+ * @brief Returns a short description of the supported arguments.
+ * @return A multi-line usage string.
+ */
+std::string StartupOptions::usage() {
+    return "Usage: DatabaseCourseProject [options]\n"
+        "  --threads <n>         Number of worker threads (0 = all hardware threads)\n"
+        "  --sort-memory <MiB>   Memory budget of the sort command (default 64)\n"
+        "  --metrics-file <path> Write the metrics in Prometheus format to <path> on exit\n"
+        "  --trace-file <path>   Trace the whole session and write a Chrome trace to <path> on exit\n"
+        "  --capture-file <path> Record every command with its timestamp into the workload file <path>\n"
+        "  --replay <path>       Re-execute the workload file <path> and report per-command latencies\n"
+        "  --replay-paced        Keep the original pauses between replayed commands\n"
+        "  --script <path>       Run the commands of <path> (- for stdin) without prompts, printing tab-separated rows\n"
+        "  --continue-on-error   Keep running a script after a failed command instead of stopping\n"
+        "  --catalog <path>      Open the catalog <path> at startup\n"
+        "  --serve <port>        Serve the catalog to concurrent clients on 127.0.0.1:<port>\n"
+        "  --connect <port>      Send commands from stdin to the server on 127.0.0.1:<port>";
+}
@@ -1,7 +1,10 @@
 #pragma once
 #include "TableColumn.hpp"
+#include "ColumnStatistics.hpp"
+#include "ColumnSegments.hpp"
 #include <vector>
 #include <string>
+#include <mutex>
 
 /**
  * @class StringColumn
@@ -10,14 +13,15 @@
  * This class manages a column of string values, including support for NULL values.
  * It provides methods for accessing, modifying, adding, and deleting string cells,
  * and adheres to the polymorphic interface defined by the `TableColumn` base class.
- * NULL values are represented internally by an empty string in `content` and
- * a corresponding `true` in the `isNull` boolean vector.
+ * NULL values are represented internally by an empty string in `cells` and
+ * a corresponding NULL flag.
  */
 class StringColumn : public TableColumn {
 private:
-    std::vector<std::string> content; ///< Stores the actual string values of the column. Empty string for NULL.
-    std::vector<bool> isNull;        ///< Stores a boolean flag for each cell, indicating if it's a NULL value.
+    ColumnSegments<std::string> cells; ///< The values and NULL flags in 64K-row segments, shared with copies and snapshots segment by segment.
     std::string name;                ///< The name of this column.
+    mutable ColumnStatistics statistics; ///< Statistics of the values, rebuilt lazily by `getStatistics()` when stale.
+    mutable std::mutex statisticsMutex; ///< Serializes the lazy rebuild of `statistics` between concurrent readers.
 
 public:
     /**
@@ -32,7 +36,8 @@ public:
     /**
      * @brief Copy constructor for StringColumn.
      *
-     * Performs a deep copy of the `content`, `isNull`, and `name` from another StringColumn instance.
+     * Shares the values and NULL flags of `other` copy-on-write: the first
+     * write to either column copies the segments it touches. Costs O(segments).
      *
      * @param other The StringColumn object to copy from.
      */
@@ -49,8 +54,8 @@ public:
     /**
      * @brief Copy assignment operator for StringColumn.
      *
-     * Performs a deep copy of the `content`, `isNull`, and `name` from another
-     * StringColumn instance to this object. Handles self-assignment correctly.
+     * Shares the values and NULL flags of `other` copy-on-write, like the copy
+     * constructor. Handles self-assignment correctly.
      *
      * @param other The StringColumn object to assign from.
      * @return A reference to this StringColumn object after assignment.
@@ -70,11 +75,11 @@ public:
     ColumnType getType() const override;
 
     /**
-     * @brief Retrieves a constant reference to the underlying vector of string content.
-     * @return A constant reference to the `std::vector<std::string>` containing the column's data.
-     * @note This method is specific to `StringColumn` and not part of the `TableColumn` interface.
+     * @brief Retrieves the segments holding the cells of the column.
+     * @return A constant reference to the segmented storage of the values and NULL flags.
+     * @note This allows batch kernels to scan the column piece by piece without virtual calls per cell.
      */
-    const std::vector<std::string>& getContent() const; // Changed return to const& for efficiency
+    const ColumnSegments<std::string>& getSegments() const;
 
     /**
      * @brief Retrieves the value of a cell at a specific index.
@@ -140,6 +145,15 @@ public:
      */
     std::string returnValueAtGivenIndexAsString(int index) const override;
 
+    /**
+     * @brief Adds the cells of [begin, end) to `out`, segment by segment.
+     * @param begin First row of the range.
+     * @param end One past the last row of the range.
+     * @param out Receives one cell per row, empty for NULL.
+     * @throws std::runtime_error If the range is not within the column's bounds.
+     */
+    void appendValues(int begin, int end, FormattedCells& out) const override;
+
     /**
      * @brief Retrieves the name of the column's data type as a human-readable string.
      * @return The string "String".
@@ -158,6 +172,33 @@ public:
      */
     bool matchesValues(int rowIndex, const std::string& value) const override;
 
+    /**
+     * @brief Compares the string values of two cells. NULL cells order first.
+     *
+     * @param leftRow The 0-indexed position of the first cell.
+     * @param rightRow The 0-indexed position of the second cell.
+     * @return A negative value, 0 or a positive value if the first cell orders before, equal to or after the second.
+     * @throws std::runtime_error If either index is out of the column's bounds.
+     */
+    int compareValues(int leftRow, int rightRow) const override;
+
+    /**
+     * @brief Returns the statistics of the column, rebuilding them first if they are stale.
+     * @return The up-to-date statistics.
+     */
+    const ColumnStatistics& getStatistics() const override;
+
+    /**
+     * @brief Completes the statistics of a freshly filled column without feeding the cells again.
+     */
+    void finishStatistics() override;
+
+    /**
+     * @brief Tells whether the column holds no NULL cell.
+     * @return `true` if no cell of the column is NULL.
+     */
+    bool hasNoNulls() const override;
+
     /**
      * @brief Fills the column with a specified number of NULL (empty) values.
      *
@@ -170,12 +211,51 @@ public:
     void fillColumnWithNULL(int size) override;
 
     /**
-     * @brief Creates a deep copy of the current `StringColumn` object.
+     * @brief Reserves storage for at least `capacity` cells.
+     * @param capacity The number of cells the column should be able to hold without reallocating.
+     */
+    void reserve(int capacity) override;
+
+    /**
+     * @brief Moves all cells of another `StringColumn` to the end of this column.
+     * @param staged The column whose cells are appended. It is left empty.
+     * @throws std::runtime_error If `staged` is not a `StringColumn`.
+     */
+    void appendColumn(TableColumn& staged) override;
+
+    /**
+     * @brief Creates a column holding the cells of this column in the order of `order`.
+     * @param order The rows of this column in their new order; every row appears exactly once.
+     * @return A pointer to a newly allocated `StringColumn` with the reordered values and the same statistics.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    TableColumn* permute(const std::vector<int>& order) const override;
+
+    /**
+     * @brief Creates a column that shares the current version of the values.
+     *
+     * Costs O(segments) regardless of the number of rows. Later writes to this column
+     * copy the segments they touch first (see `ColumnSegments`), so the snapshot keeps seeing them unchanged.
+     *
+     * @return A pointer to a newly allocated `StringColumn` with the same name, values and statistics.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    TableColumn* snapshot() const override;
+
+    /**
+     * @brief Checks whether another column shares the current values of this column.
+     * @param other The column to compare with.
+     * @return `true` if `other` is a `StringColumn` holding the same version of the values and NULL flags.
+     */
+    bool sharesValuesWith(const TableColumn& other) const override;
+
+    /**
+     * @brief Creates a copy of the current `StringColumn` object that shares its values copy-on-write.
      *
-     * This method ensures that a new, independent `StringColumn` instance,
-     * containing a full copy of its content and null flags, is created.
+     * The new `StringColumn` behaves like an independent copy, but shares the
+     * segments with this column until either of them modifies them, so it costs O(segments).
      *
-     * @return A pointer to a newly allocated `StringColumn` object, which is a deep copy of this instance.
+     * @return A pointer to a newly allocated `StringColumn` object sharing the values of this instance.
      * @warning The caller is responsible for `delete`ing the returned pointer to prevent memory leaks.
      */
     TableColumn* clone() const override;
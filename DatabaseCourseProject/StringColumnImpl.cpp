@@ -1,4 +1,6 @@
 #include "StringColumn.hpp"
+#include "Instrumentation.hpp"
+#include "ProfilePhase.hpp"
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -6,28 +8,32 @@
 /**
  * @brief Constructs a new StringColumn with a specified name.
  *
- * Initializes the column with an empty content vector and an empty `isNull` vector,
- * indicating that it contains no rows initially.
+ * Initializes the column without any segments, indicating that it contains
+ * no rows initially.
  *
  * @param name The name to assign to this column.
  */
-StringColumn::StringColumn(std::string name) : name(name) {
+StringColumn::StringColumn(std::string name)
+    : name(name), statistics(ColumnType::STRING) {
 }
 
 /**
  * @brief Copy constructor for StringColumn.
  *
- * Performs a member-wise copy of the `content`, `isNull` vectors, and the `name` string.
- * This results in a deep copy because `std::vector` and `std::string` handle their
- * memory dynamically and have their own deep copy semantics.
+ * The copy shares the values and NULL flags with `other` instead of copying
+ * them, so it costs O(segments) regardless of the number of rows. A write to
+ * either column copies only the segment it touches (see `ColumnSegments`), so
+ * the copy still behaves like an independent deep copy.
  *
  * @param other The StringColumn object to copy from.
  */
 StringColumn::StringColumn(const StringColumn& other)
-    : content(other.content), 
-    isNull(other.isNull),   
-    name(other.name)        
+    : cells(other.cells),
+    name(other.name),
+    statistics(ColumnType::STRING)
 {
+    std::lock_guard<std::mutex> lock(other.statisticsMutex);
+    statistics = other.statistics;
 }
 
 /**
@@ -37,24 +43,27 @@ StringColumn::StringColumn(const StringColumn& other)
  * and `std::string` automatically manage their own memory.
  */
 StringColumn::~StringColumn() {
-    // No manual memory deallocation is needed here, as 'content' and 'isNull'
-    // are std::vector and std::string, which manage their own memory.
+    // No manual memory deallocation is needed here, as the segments in 'cells'
+    // are shared pointers to std::vectors, which manage their own memory.
 }
 
 /**
  * @brief Copy assignment operator for StringColumn.
  *
- * Ensures proper deep copying from `other` to this object.
- * It prevents self-assignment to avoid accidental data corruption.
+ * Shares the values and NULL flags of `other` like the copy constructor.
+ * Replaced segments stay alive while a snapshot still holds them.
+ * Self-assignment is a no-op.
  *
  * @param other The StringColumn object to assign from.
  * @return A reference to this StringColumn object, allowing for chaining assignments.
  */
 StringColumn& StringColumn::operator=(const StringColumn& other) {
     if (this != &other) { 
-        content = other.content; 
-        isNull = other.isNull;   
-        name = other.name;       
+        cells = other.cells;
+        name = other.name;
+
+        std::lock_guard<std::mutex> lock(other.statisticsMutex);
+        statistics = other.statistics;
     }
     return *this;
 }
@@ -76,12 +85,12 @@ ColumnType StringColumn::getType() const {
 }
 
 /**
- * @brief Retrieves a constant reference to the internal content vector.
- * @return A constant reference to the `std::vector<std::string>` that stores the column's data.
- * @note This method exposes the internal data structure and is not part of the `TableColumn` interface.
+ * @brief Retrieves the segments holding the cells of the column.
+ * @return A constant reference to the segmented storage of the values and NULL flags.
+ * @note Batch kernels scan the column piece by piece through it, without virtual calls per cell.
  */
-const std::vector<std::string>& StringColumn::getContent() const {
-    return content;
+const ColumnSegments<std::string>& StringColumn::getSegments() const {
+    return cells;
 }
 
 /**
@@ -90,19 +99,21 @@ const std::vector<std::string>& StringColumn::getContent() const {
  * This method directly returns the string value if the cell is not NULL.
  * If the cell is marked as NULL, it returns an empty string `""`.
  *
+ * The NULL flag is only looked up when the column holds NULL cells.
+ *
  * @param index The 0-indexed position of the cell.
  * @return The string value of the cell, or `""` if NULL.
  * @throws std::runtime_error If the `index` is negative or greater than or equal to the column's size.
  * @note This method is not part of the `TableColumn` interface, and is a concrete implementation detail.
  */
 std::string StringColumn::getValueAtGivenIndex(int index) const {
-    if (index < 0 || index >= content.size()) {
-        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(content.size()) + ".");
+    if (index < 0 || index >= cells.size()) {
+        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
     }
-    if (isNull[index]) { 
+    if (!cells.hasNoNulls() && cells.isNull(index)) {
         return "";
     }
-    return content[index];
+    return cells.value(index);
 }
 
 /**
@@ -116,17 +127,25 @@ std::string StringColumn::getValueAtGivenIndex(int index) const {
  * @throws std::runtime_error If the `index` is negative or greater than or equal to the column's size.
  */
 void StringColumn::changeValueAtIndex(int index, std::string val) {
-    if (index < 0 || index >= content.size()) {
-        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(content.size()) + ".");
+    if (index < 0 || index >= cells.size()) {
+        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
     }
 
+    bool wasNull = cells.isNull(index);
+
     if (val.empty()) { 
-        content[index] = "";
-        isNull[index] = true;
+        cells.set(index, "", true);
     }
     else {
-        content[index] = val;
-        isNull[index] = false;
+        cells.set(index, val, false);
+    }
+
+    statistics.remove(wasNull);
+    if (cells.isNull(index)) {
+        statistics.addNull();
+    }
+    else {
+        statistics.addText(cells.value(index));
     }
 }
 
@@ -140,31 +159,37 @@ void StringColumn::changeValueAtIndex(int index, std::string val) {
  */
 void StringColumn::addCell(std::string cell) {
     if (cell.empty()) { 
-        content.push_back("");
-        isNull.push_back(true);
+        cells.push_back("", true);
+    }
+    else {
+        cells.push_back(cell, false);
+    }
+
+    if (cells.isNull(cells.size() - 1)) {
+        statistics.addNull();
     }
     else {
-        content.push_back(cell);
-        isNull.push_back(false);
+        statistics.addText(cells.value(cells.size() - 1));
     }
 }
 
 /**
  * @brief Deletes a cell at the specified index.
  *
- * This function removes the element at `index` from both the `content` vector
- * and the `isNull` vector, effectively removing a row entry from this column.
+ * This function removes the value and the NULL flag at `index`, effectively
+ * removing a row entry from this column. Only the cells after it in the same
+ * segment are shifted.
  *
  * @param index The 0-indexed position of the cell to delete.
  * @throws std::runtime_error If the `index` is negative or greater than or equal to the column's size.
  */
 void StringColumn::deleteCell(int index) {
-    if (index < 0 || index >= content.size()) {
-        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(content.size()) + ".");
+    if (index < 0 || index >= cells.size()) {
+        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
     }
 
-    content.erase(content.begin() + index);
-    isNull.erase(isNull.begin() + index);
+    statistics.remove(cells.isNull(index));
+    cells.erase(index);
 }
 
 /**
@@ -172,7 +197,7 @@ void StringColumn::deleteCell(int index) {
  * @return The size of the column.
  */
 int StringColumn::getSize() {
-    return content.size();
+    return cells.size();
 }
 
 /**
@@ -189,6 +214,34 @@ std::string StringColumn::returnValueAtGivenIndexAsString(int index) const {
     return getValueAtGivenIndex(index);
 }
 
+/**
+ * @brief Adds the cells of [begin, end) to `out`, segment by segment.
+ *
+ * Segments without NULL cells skip the NULL flags. The values are copied
+ * straight into the shared buffer of `out`.
+ *
+ * @param begin First row of the range.
+ * @param end One past the last row of the range.
+ * @param out Receives one cell per row, empty for NULL.
+ * @throws std::runtime_error If the range is not within the column's bounds.
+ */
+void StringColumn::appendValues(int begin, int end, FormattedCells& out) const {
+    if (begin < 0 || begin > end || end > cells.size()) {
+        int index = begin < 0 || begin > end ? begin : end;
+        throw std::runtime_error("Invalid index " + std::to_string(index) + " for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
+    }
+
+    cells.forEachPiece(begin, end, [&out](const ColumnSegments<std::string>::Segment& segment, int offset, int count) {
+        std::string& text = out.buffer();
+        for (int i = offset; i < offset + count; ++i) {
+            if (segment.nullCount == 0 || !segment.validity.isNull(i)) {
+                text += segment.values[i];
+            }
+            out.endCell();
+        }
+    });
+}
+
 /**
  * @brief Retrieves the string representation of the column's type.
  * @return The string "String".
@@ -210,44 +263,217 @@ std::string StringColumn::getTypeAsString() const {
  * @throws std::runtime_error If the `rowIndex` is negative or greater than or equal to the column's size.
  */
 bool StringColumn::matchesValues(int rowIndex, const std::string& value) const {
-    if (rowIndex < 0 || rowIndex >= content.size()) {
-        throw std::runtime_error("Invalid index " + std::to_string(rowIndex) + " for StringColumn '" + name + "'. Column size is " + std::to_string(content.size()) + ".");
+    if (rowIndex < 0 || rowIndex >= cells.size()) {
+        throw std::runtime_error("Invalid index " + std::to_string(rowIndex) + " for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
     }
 
-    if (isNull[rowIndex] && value.empty()) {
+    if (cells.isNull(rowIndex) && value.empty()) {
         return true;
     }
-    if (!isNull[rowIndex]) {
-        return content[rowIndex] == value;
+    if (!cells.isNull(rowIndex)) {
+        return cells.value(rowIndex) == value;
     }
     return false;
 }
 
+/**
+ * @brief Compares the string values of two cells. NULL cells order first.
+ *
+ * @param leftRow The 0-indexed position of the first cell.
+ * @param rightRow The 0-indexed position of the second cell.
+ * @return A negative value, 0 or a positive value if the first cell orders before, equal to or after the second.
+ * @throws std::runtime_error If either index is out of the column's bounds.
+ */
+int StringColumn::compareValues(int leftRow, int rightRow) const {
+    if (leftRow < 0 || leftRow >= cells.size() || rightRow < 0 || rightRow >= cells.size()) {
+        throw std::runtime_error("Invalid index for StringColumn '" + name + "'. Column size is " + std::to_string(cells.size()) + ".");
+    }
+
+    if (cells.isNull(leftRow) || cells.isNull(rightRow)) {
+        return (cells.isNull(leftRow) ? 0 : 1) - (cells.isNull(rightRow) ? 0 : 1);
+    }
+
+    return cells.value(leftRow).compare(cells.value(rightRow));
+}
+
+/**
+ * @brief Returns the statistics of the column, rebuilding them first if they are stale.
+ *
+ * A rebuild feeds every cell into freshly cleared statistics. String columns have no histogram.
+ *
+ * The rebuild runs under `statisticsMutex`, since several readers holding a
+ * shared table lock may ask for the statistics at the same time. Its time
+ * is charged to the `statistics` phase of an active profile.
+ *
+ * @return The up-to-date statistics.
+ */
+const ColumnStatistics& StringColumn::getStatistics() const {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    if (statistics.isStale()) {
+        ProfilePhase phase("statistics");
+        statistics.clear();
+        for (int s = 0; s < cells.segmentCount(); ++s) {
+            const ColumnSegments<std::string>::Segment& segment = cells.segment(s);
+            for (int i = 0; i < segment.size(); ++i) {
+                if (segment.nullCount > 0 && segment.validity.isNull(i)) {
+                    statistics.addNull();
+                }
+                else {
+                    statistics.addText(segment.values[i]);
+                }
+            }
+        }
+        statistics.finishBuild(std::vector<double>());
+    }
+    return statistics;
+}
+
+/**
+ * @brief Completes the statistics of a freshly filled column.
+ *
+ * String columns have no histogram, so only the build is marked as done;
+ * the cells already entered the statistics as they were added.
+ */
+void StringColumn::finishStatistics() {
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    statistics.finishBuild(std::vector<double>());
+}
+
+/**
+ * @brief Tells whether the column holds no NULL cell, from the NULL count kept by the segments.
+ * @return `true` if no cell of the column is NULL.
+ */
+bool StringColumn::hasNoNulls() const {
+    return cells.hasNoNulls();
+}
+
 /**
  * @brief Fills the column with a specified number of NULL (empty string) values.
  *
  * This method appends `size` number of new cells to the column. Each new cell
  * will have an empty string `""` as its content and its `isNull` flag set to `true`.
- * This is useful for initializing new columns in existing tables.
+ * This is useful for initializing new columns in existing tables. The NULL
+ * flags are filled a word at a time rather than cell by cell.
  *
  * @param size The number of NULL values to add to the column.
  */
 void StringColumn::fillColumnWithNULL(int size) {
-    for (int i = 0; i < size; ++i) {
-        content.push_back("");
-        isNull.push_back(true);
+    if (size <= 0) {
+        return;
+    }
+    cells.appendNulls(size);
+    statistics.addNulls(size);
+}
+
+/**
+ * @brief Creates a column holding the cells of this column in the order of `order`.
+ *
+ * The NULL flags are only looked up when the column holds NULL cells.
+ *
+ * @param order The rows of this column in their new order; every row appears exactly once.
+ * @return A pointer to a newly allocated `StringColumn` with the reordered values and the same statistics.
+ */
+TableColumn* StringColumn::permute(const std::vector<int>& order) const {
+    StringColumn* copy = new StringColumn(name);
+    copy->cells.reserve(static_cast<int>(order.size()));
+
+    bool noNulls = cells.hasNoNulls();
+    for (int row : order) {
+        copy->cells.push_back(cells.value(row), !noNulls && cells.isNull(row));
+    }
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    copy->statistics = statistics;
+    return copy;
+}
+
+/**
+ * @brief Creates a column that shares the current version of the values.
+ *
+ * The statistics are brought up to date on this column first, so that the
+ * snapshot does not rebuild them again for every reader.
+ *
+ * @return A pointer to a newly allocated `StringColumn` sharing the values.
+ */
+TableColumn* StringColumn::snapshot() const {
+    getStatistics();
+
+    StringColumn* copy = new StringColumn(name);
+    copy->cells = cells;
+
+    std::lock_guard<std::mutex> lock(statisticsMutex);
+    copy->statistics = statistics;
+    return copy;
+}
+
+/**
+ * @brief Checks whether another column shares the current values of this column.
+ *
+ * Compares the versions themselves, not the values: two columns with equal
+ * but separately stored values do not share them.
+ *
+ * @param other The column to compare with.
+ * @return `true` if both columns point to the same values and NULL flags.
+ */
+bool StringColumn::sharesValuesWith(const TableColumn& other) const {
+    if (other.getType() != ColumnType::STRING) {
+        return false;
     }
+    const StringColumn& column = static_cast<const StringColumn&>(other);
+    return column.cells.sharesWith(cells);
 }
 
 /**
- * @brief Creates a deep copy of the current StringColumn object.
+ * @brief Creates a copy of the current StringColumn object that shares its values copy-on-write.
  *
- * This method ensures that a new, independent `StringColumn` instance is created,
- * copying all its internal data (content vector, isNull vector, and name).
+ * The copy shares the segments with this column until either of them
+ * modifies one (see the copy constructor), so cloning costs O(segments).
  *
- * @return A pointer to a newly allocated `StringColumn` object, which is a deep copy of this instance.
+ * @return A pointer to a newly allocated `StringColumn` object sharing the values of this instance.
  * @warning The caller is responsible for `delete`ing the returned pointer to prevent memory leaks.
  */
 TableColumn* StringColumn::clone() const {
+    Instrumentation::recordColumnClones(1);
     return new StringColumn(*this); 
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Reserves storage for at least `capacity` cells.
+ * @param capacity The number of cells the column should be able to hold without reallocating.
+ */
+void StringColumn::reserve(int capacity) {
+    cells.reserve(capacity);
+}
+
+/**
+ * @brief Moves all cells of another `StringColumn` to the end of this column.
+ *
+ * The storage is reserved first, so a failing allocation leaves the column
+ * unchanged. The statistics are updated incrementally with the appended cells.
+ *
+ * @param staged The column whose cells are appended. It is left empty.
+ * @throws std::runtime_error If `staged` is not a `StringColumn`.
+ */
+void StringColumn::appendColumn(TableColumn& staged) {
+    if (staged.getType() != ColumnType::STRING || &staged == this) {
+        throw std::runtime_error("Cannot append column '" + staged.getName() + "' of type " + staged.getTypeAsString()
+            + " to StringColumn '" + name + "'. ");
+    }
+    StringColumn* other = static_cast<StringColumn*>(&staged);
+
+    reserve(cells.size() + other->cells.size());
+
+    for (int s = 0; s < other->cells.segmentCount(); ++s) {
+        const ColumnSegments<std::string>::Segment& segment = other->cells.segment(s);
+        for (int i = 0; i < segment.size(); ++i) {
+            if (segment.nullCount > 0 && segment.validity.isNull(i)) {
+                statistics.addNull();
+            }
+            else {
+                statistics.addText(segment.values[i]);
+            }
+        }
+    }
+    cells.append(other->cells);
+    other->statistics.clear();
+}
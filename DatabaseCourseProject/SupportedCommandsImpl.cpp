@@ -2,7 +2,7 @@
 
 /**
  * @brief Returns a list of supported file-related commands.
- * @return A `std::vector<std::string>` containing: "open", "close", "save", "saveas", "help", "exit".
+ * @return A `std::vector<std::string>` containing: "open", "close", "save", "saveas", "help", "exit", "explain", "metrics", "trace", "begin", "commit", "rollback".
  */
 std::vector<std::string> SupportedCommands::returnSupportedFileCommands() {
 	return {
@@ -11,31 +11,41 @@ std::vector<std::string> SupportedCommands::returnSupportedFileCommands() {
 		"save",
 		"saveas",
 		"help",
-		"exit"
+		"exit",
+		"explain",
+		"metrics",
+		"trace",
+		"begin",
+		"commit",
+		"rollback"
 	};
 }
 
 /**
  * @brief Returns a list of supported catalog-related commands.
- * @return A `std::vector<std::string>` containing: "addcolumn", "aggregate", "count", "delete",
- * "decribe", "export", "import",
- * "innerjoin", "insert", "print", "rename", "select", "showtables", "update".
+ * @return A `std::vector<std::string>` containing: "addcolumn", "aggregate", "bulkinsert", "count", "delete",
+ * "decribe", "export", "generate", "import",
+ * "innerjoin", "insert", "print", "query", "rename", "select", "showtables", "sort", "update".
  */
 std::vector<std::string> SupportedCommands::returnSupportedCatalogCommands() {
 	return {
 		"addcolumn",
 		"aggregate",
+		"bulkinsert",
 		"count",
 		"delete",
 		"describe",
 		"export",
+		"generate",
 		"import",
 		"innerjoin",
 		"insert",
 		"print",
+		"query",
 		"rename",
 		"select",
 		"showtables",
+		"sort",
 		"update"
 	};
 }
\ No newline at end of file
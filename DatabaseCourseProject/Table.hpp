@@ -10,7 +10,7 @@
  * The `Table` class manages the structure and data of a database table. It
  * internally holds a collection of polymorphic `TableColumn` pointers,
  * effectively owning the column objects and being responsible for their
- * memory management (deep copying on copy/assignment, deletion on destruction).
+ * memory management (copy-on-write sharing on copy/assignment, deletion on destruction).
  * It provides functionalities for accessing column and row data, modifying
  * the table structure, and iterating over its columns.
  */
@@ -50,9 +50,11 @@ public:
 	/**
 	* @brief Copy constructor for Table.
 	*
-	* Performs a deep copy of all `TableColumn` objects contained in the `other` table's
-	* `columns` vector by calling `TableColumn::clone()` for each, ensuring
-	* independent copies.
+	* Creates a new `TableColumn` object for every column of `other` by calling
+	* `TableColumn::clone()`. The new columns share their value segments with
+	* the columns of `other` copy-on-write, so the copy costs O(columns) and
+	* copies no rows; a later write to either table copies only the segment it
+	* touches, and the tables behave as independent afterwards.
 	*
 	* @param other The Table object to copy from.
 	*/
@@ -90,8 +92,10 @@ public:
 	/**
 	 * @brief Copy assignment operator for Table.
 	 *
-	 * Handles deep copying of the `columns` vector and updates the `name` and `filename`.
-	 * It correctly manages existing column memory (deletes old columns before copying new ones)
+	 * Replaces the columns by clones of the columns of `other`, which share their
+	 * values copy-on-write (O(columns), no rows are copied, see the copy
+	 * constructor), and updates the `name` and `filename`.
+	 * It correctly manages existing column memory (deletes old columns before cloning new ones)
 	 * and protects against self-assignment.
 	 *
 	 * @param other The Table object to assign from.
@@ -174,6 +178,30 @@ public:
      */
     std::string getRowAsString(int index) const;
 
+    /**
+     * @brief Retrieves the selected cells of a row as a formatted string.
+     *
+     * Works like `getRowAsString(int)`, but only the cells of the given columns
+     * are included, in the order in which the column indexes are listed.
+     *
+     * @param index The 0-indexed position of the row to retrieve.
+     * @param columnIndexes The 0-indexed positions of the columns to include.
+     * @return A string representing the projected row.
+     * @throws std::runtime_error If the row index or one of the column indexes is out of bounds.
+     */
+    std::string getRowAsString(int index, const std::vector<int>& columnIndexes) const;
+
+    /**
+     * @brief Retrieves a row in the machine-readable record format (see `RecordFormat`).
+     *
+     * @param index The 0-indexed position of the row to retrieve.
+     * @param columnIndexes The 0-indexed positions of the columns to include. Empty includes all columns.
+     * @return The row as a tab-separated record.
+     * @throws std::runtime_error If the table has no columns.
+     * @throws std::runtime_error If the row index or one of the column indexes is out of bounds.
+     */
+    std::string getRowAsRecord(int index, const std::vector<int>& columnIndexes) const;
+
     /**
      * @brief Deletes a row at a specified index from all columns in the table.
      *
@@ -204,6 +232,16 @@ public:
      */
     int getNumberOfColumns() const;
 
+    /**
+     * @brief Returns the number of rows in the table.
+     *
+     * All columns hold the same number of cells, so the size of the first
+     * column is used.
+     *
+     * @return The row count, or 0 if the table has no columns.
+     */
+    int getNumberOfRows() const;
+
     /**
      * @brief Sets or updates the file path associated with this table.
      * @param filename The new file path for the table.
@@ -240,17 +278,43 @@ public:
     std::string toString() const;
 
     /**
-     * @brief Creates a deep copy of the current Table object with a new name and path.
+     * @brief Creates a copy of the current Table object with a new name and path.
      *
      * This method is essential for operations like "saveas" where the table
-     * structure and data need to be duplicated to a new location without
-     * affecting the original table in memory. It performs a deep copy of all
-     * `TableColumn` objects by calling `TableColumn::clone()` for each.
+     * needs to be saved to a new location without affecting the original table
+     * in memory. Every column is cloned with `TableColumn::clone()`, which
+     * shares the values copy-on-write, so the copy costs O(columns) and no
+     * rows are duplicated until one of the tables is modified.
      *
      * @param newName The name to assign to the cloned table.
      * @param newPath The file path to associate with the cloned table.
-     * @return A new `Table` object that is a deep copy of the current instance,
+     * @return A new `Table` object sharing the values of the current instance,
      * but with the specified new name and file path.
      */
     Table cloneWithNewNameAndPath(const std::string& newName, const std::string& newPath) const;
+
+    /**
+     * @brief Creates a point-in-time snapshot of the table for a read command.
+     *
+     * The snapshot has the same name, path and rows, but its columns share the
+     * values with this table (see `TableColumn::snapshot`), so creating it costs
+     * O(columns). Later changes to this table are not visible in the snapshot,
+     * which lets a long read run without holding the table lock.
+     *
+     * @return A new `Table` object sharing the current values of this table.
+     */
+    Table snapshot() const;
+
+    /**
+     * @brief Checks whether the table still holds the very rows of an earlier snapshot.
+     *
+     * True if both tables have the same number of columns and every column
+     * shares its values with the column of `other` at the same position (see
+     * `TableColumn::sharesValuesWith`). Any insert, update, delete, sort or
+     * added column since the snapshot makes it false.
+     *
+     * @param other A snapshot taken from this table.
+     * @return `true` if the table is unchanged since `other` was taken.
+     */
+    bool sharesValuesWith(const Table& other) const;
 };
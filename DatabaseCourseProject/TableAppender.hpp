@@ -0,0 +1,81 @@
+#pragma once
+#include "Table.hpp"
+#include "TableColumn.hpp"
+#include <vector>
+#include <string>
+
+/**
+ * @class TableAppender
+ * @brief Appends many rows to a table at once, all or nothing.
+ *
+ * Rows are first converted into typed staging columns, one per column of the
+ * table, so every value is parsed and validated exactly once and a bad value
+ * is reported before the table is touched. `commit()` then reserves the
+ * storage of every table column and moves the staged cells over column by
+ * column. Until `commit()` the table is unchanged; a failed row is removed
+ * from the staging columns again, so all staged rows stay complete.
+ *
+ * @note The appender keeps a reference to the table, which must outlive it,
+ * and assumes the columns of the table do not change while rows are staged.
+ */
+class TableAppender {
+private:
+    Table& table;                     ///< The table the rows are appended to.
+    std::vector<TableColumn*> staged; ///< Typed staging columns, one per column of `table`. Owned.
+    int rowCount;                     ///< Number of staged rows.
+
+    /**
+     * @brief Deletes the staging columns.
+     */
+    void clearMemory();
+
+public:
+    /**
+     * @brief Creates an appender with an empty staging column for every column of `table`.
+     * @param table The table the rows will be appended to.
+     * @throws std::runtime_error If a staging column cannot be created for a column type.
+     */
+    explicit TableAppender(Table& table);
+
+    /**
+     * @brief Discards the rows that were not committed.
+     */
+    ~TableAppender();
+
+    /**
+     * @brief Copying is disabled; the appender owns its staging columns.
+     */
+    TableAppender(const TableAppender& other) = delete;
+
+    /**
+     * @brief Copying is disabled; the appender owns its staging columns.
+     */
+    TableAppender& operator=(const TableAppender& other) = delete;
+
+    /**
+     * @brief Converts a row and adds it to the staged rows.
+     *
+     * @param values One value per column of the table, in column order. An empty value is NULL.
+     * @throws std::runtime_error If the number of values does not match the number of columns,
+     * or a value cannot be converted to the type of its column. Nothing is staged in that case.
+     */
+    void appendRow(const std::vector<std::string>& values);
+
+    /**
+     * @brief Returns the number of rows staged since the last commit.
+     * @return The staged row count.
+     */
+    int getRowCount() const;
+
+    /**
+     * @brief Appends all staged rows to the table.
+     *
+     * The storage of every table column is reserved before the first cell is
+     * moved, so the table either receives all staged rows or none of them.
+     * Afterwards the appender is empty and can stage the next batch.
+     *
+     * @throws std::runtime_error If the columns of the table changed since the appender was created.
+     * @throws std::bad_alloc If the storage cannot be reserved; the table is unchanged.
+     */
+    void commit();
+};
@@ -0,0 +1,117 @@
+#include "TableAppender.hpp"
+#include "ColumnFactory.hpp"
+#include "TraceSpan.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Creates an appender with an empty staging column for every column of `table`.
+ *
+ * The staging columns are created through `ColumnFactory` with the name and
+ * type of the table columns, so they convert values exactly like `addCell`
+ * on the table would.
+ *
+ * @param table The table the rows will be appended to.
+ * @throws std::runtime_error If a staging column cannot be created for a column type.
+ */
+TableAppender::TableAppender(Table& table)
+    : table(table), rowCount(0) {
+    try {
+        for (const TableColumn* column : table) {
+            staged.push_back(ColumnFactory::makeColumn(column->getName(), column->getTypeAsString()));
+        }
+    }
+    catch (...) {
+        clearMemory();
+        throw;
+    }
+}
+
+/**
+ * @brief Discards the rows that were not committed.
+ */
+TableAppender::~TableAppender() {
+    clearMemory();
+}
+
+/**
+ * @brief Deletes the staging columns.
+ */
+void TableAppender::clearMemory() {
+    for (TableColumn* column : staged) {
+        delete column;
+    }
+    staged.clear();
+}
+
+/**
+ * @brief Converts a row and adds it to the staged rows.
+ *
+ * The values are added to the staging columns one by one. If a value cannot
+ * be converted, the cells of this row that were already staged are deleted
+ * again before the error is rethrown, so the staged rows stay complete.
+ *
+ * @param values One value per column of the table, in column order. An empty value is NULL.
+ * @throws std::runtime_error If the number of values does not match the number of columns,
+ * or a value cannot be converted to the type of its column. Nothing is staged in that case.
+ */
+void TableAppender::appendRow(const std::vector<std::string>& values) {
+    if (values.size() != staged.size()) {
+        throw std::runtime_error("Number of values is not equal to number of column. ");
+    }
+
+    size_t column = 0;
+    try {
+        for (; column < staged.size(); ++column) {
+            staged[column]->addCell(values[column]);
+        }
+    }
+    catch (...) {
+        for (size_t i = 0; i < column; ++i) {
+            staged[i]->deleteCell(rowCount);
+        }
+        throw;
+    }
+    ++rowCount;
+}
+
+/**
+ * @brief Returns the number of rows staged since the last commit.
+ * @return The staged row count.
+ */
+int TableAppender::getRowCount() const {
+    return rowCount;
+}
+
+/**
+ * @brief Appends all staged rows to the table.
+ *
+ * Every table column first reserves room for its current cells plus the
+ * staged ones. Only then are the staged cells moved over with
+ * `TableColumn::appendColumn`, which no longer allocates and therefore cannot
+ * leave the columns with different lengths.
+ *
+ * @throws std::runtime_error If the columns of the table changed since the appender was created.
+ * @throws std::bad_alloc If the storage cannot be reserved; the table is unchanged.
+ */
+void TableAppender::commit() {
+    if (rowCount == 0) {
+        return;
+    }
+    if (table.getNumberOfColumns() != static_cast<int>(staged.size())) {
+        throw std::runtime_error("The columns of table '" + table.getName() + "' changed while rows were being appended. ");
+    }
+
+    TraceSpan span("append rows", table.getName());
+
+    int newSize = table.getNumberOfRows() + rowCount;
+    for (TableColumn* column : table) {
+        column->reserve(newSize);
+    }
+
+    size_t i = 0;
+    for (TableColumn* column : table) {
+        column->appendColumn(*staged[i]);
+        ++i;
+    }
+    rowCount = 0;
+}
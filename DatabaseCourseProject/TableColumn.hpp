@@ -2,6 +2,8 @@
 #include <vector>
 #include <string>
 #include "ColumnType.hpp"
+#include "ColumnStatistics.hpp"
+#include "FormattedCells.hpp"
 
 /**
  * @class TableColumn
@@ -10,7 +12,9 @@
  * This abstract class defines the common interface and fundamental operations
  * that all column implementations (e.g., `IntegerColumn`, `DoubleColumn`,
  * `StringColumn`) must provide. It ensures polymorphic behavior, allowing
- * tables to manage columns of various data types uniformly.
+ * tables to manage columns of various data types uniformly. The numeric
+ * columns share one implementation, `TypedColumn<T>`, and the interface is
+ * the string-based adapter between it and the commands.
  */
 class TableColumn {
 public:
@@ -64,6 +68,19 @@ public:
      */
     virtual std::string returnValueAtGivenIndexAsString(int index) const = 0;
 
+    /**
+     * @brief Formats the cells of [begin, end) as they are written to a table file and adds them to `out`.
+     *
+     * Writers format a block of every column with one call each, instead of
+     * one `returnValueAtGivenIndexAsString` call and string per cell.
+     *
+     * @param begin First row of the range.
+     * @param end One past the last row of the range.
+     * @param out Receives one cell per row, empty for NULL.
+     * @throws std::runtime_error If the range is not within the column's bounds.
+     */
+    virtual void appendValues(int begin, int end, FormattedCells& out) const = 0;
+
     /**
      * @brief Changes the value of a cell at a specific index.
      *
@@ -107,6 +124,55 @@ public:
      */
     virtual bool matchesValues(int rowIndex, const std::string& value) const = 0;
 
+    /**
+     * @brief Compares the values of two cells of the column.
+     *
+     * Values are compared in their native type (numerically for numbers,
+     * lexicographically for strings). NULL cells are ordered before every
+     * non-NULL value and are equal to each other. This is the ordering used by
+     * `select ... orderby`.
+     *
+     * @param leftRow The 0-indexed position of the first cell.
+     * @param rightRow The 0-indexed position of the second cell.
+     * @return A negative value if the first cell orders before the second, 0 if they are equal,
+     * a positive value otherwise.
+     * @throws std::runtime_error If either index is out of the column's bounds.
+     */
+    virtual int compareValues(int leftRow, int rightRow) const = 0;
+
+    /**
+     * @brief Returns the statistics of the column's values.
+     *
+     * The statistics are maintained incrementally as cells are added, changed
+     * and deleted. When too many changes have accumulated since the last full
+     * build (or no build has happened yet, e.g. for a column filled without
+     * `finishStatistics`), they are rebuilt from the column data before being returned.
+     *
+     * @return A reference to the up-to-date statistics, valid while the column exists.
+     */
+    virtual const ColumnStatistics& getStatistics() const = 0;
+
+    /**
+     * @brief Completes the statistics of a column that was just filled row by row.
+     *
+     * Every added cell already entered the statistics incrementally; this
+     * only builds the histogram and marks the statistics as up to date.
+     * Loaders (`InputFileReader`, `generate`) call it once after the last row,
+     * so the first read does not rebuild the statistics under a table lock.
+     * Only valid while no cell of the column was changed or deleted.
+     */
+    virtual void finishStatistics() = 0;
+
+    /**
+     * @brief Tells whether the column holds no NULL cell.
+     *
+     * Kept up to date on every change at no extra cost, so scans, aggregates
+     * and writers can check it once and then skip the NULL handling per cell.
+     *
+     * @return `true` if no cell of the column is NULL.
+     */
+    virtual bool hasNoNulls() const = 0;
+
     /**
      * @brief Fills the column with a specified number of NULL (empty) values.
      *
@@ -118,14 +184,76 @@ public:
     virtual void fillColumnWithNULL(int size) = 0;
 
     /**
-     * @brief Creates a deep copy of the current `TableColumn` object.
+     * @brief Reserves storage for at least `capacity` cells.
+     *
+     * Lets bulk appends allocate once up front instead of growing the storage row by row.
+     *
+     * @param capacity The number of cells the column should be able to hold without reallocating.
+     */
+    virtual void reserve(int capacity) = 0;
+
+    /**
+     * @brief Moves all cells of another column of the same type to the end of this column.
+     *
+     * This is the commit step of a bulk append (see `TableAppender`): the
+     * values were already converted and validated while they were added to
+     * `staged`, so nothing is parsed here. Once the storage is reserved the
+     * append cannot fail. `staged` is left empty.
+     *
+     * @param staged The column whose cells are appended.
+     * @throws std::runtime_error If `staged` has a different type; the column is left unchanged.
+     */
+    virtual void appendColumn(TableColumn& staged) = 0;
+
+    /**
+     * @brief Creates a column holding the cells of this column in another order.
+     *
+     * The values are copied in their native type, so nothing is formatted or
+     * parsed on the way. Since the new column holds the same values, it takes
+     * over the statistics of this column. `sort` uses it to rebuild a table
+     * from a sorted row-id permutation.
+     *
+     * @param order The 0-indexed rows of this column in their new order; every row appears exactly once.
+     * @return A pointer to a newly allocated column of the same type and name.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    virtual TableColumn* permute(const std::vector<int>& order) const = 0;
+
+    /**
+     * @brief Creates a column that shares the current values of this column instead of copying them.
+     *
+     * The result is a consistent, point-in-time view used by read commands
+     * (see `Table::snapshot`): writes to this column after the call copy the
+     * values first, so they are never visible through the snapshot.
+     *
+     * @return A pointer to a newly allocated column of the same type, name and values.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    virtual TableColumn* snapshot() const = 0;
+
+    /**
+     * @brief Checks whether this column still holds the very values of another column.
+     *
+     * Holds right after `snapshot()` and stays true until either column is
+     * modified, since a write to shared values copies them first. A
+     * transaction uses it to detect that a table changed after it read it.
+     *
+     * @param other The column to compare with.
+     * @return `true` if both columns share their current values.
+     */
+    virtual bool sharesValuesWith(const TableColumn& other) const = 0;
+
+    /**
+     * @brief Creates a copy of the current `TableColumn` object that shares its values copy-on-write.
      *
-     * This method ensures that a new, independent instance of the concrete column type
-     * (and all its internal data) is created, allowing for safe copying of tables
-     * without shallow copy issues. The caller is responsible for managing the
+     * This method creates a new instance of the concrete column type that
+     * behaves like an independent copy. The values are copied on write: the
+     * clone shares the segments with this column until either of them
+     * modifies one, so cloning costs O(segments) pointer copies regardless of
+     * the number of rows. The caller is responsible for managing the
      * memory of the returned pointer.
      *
-     * @return A pointer to a newly allocated `TableColumn` object which is a deep copy of the current instance.
+     * @return A pointer to a newly allocated `TableColumn` object sharing the values of the current instance.
      * @warning The caller is responsible for `delete`ing the returned pointer to prevent memory leaks.
      */
     virtual TableColumn* clone() const = 0;
@@ -4,6 +4,7 @@
 #include <vector>
 #include <stdexcept>
 #include "FileUtils.hpp"
+#include "RecordFormat.hpp"
 
 /**
  * @brief Constructs a new Table instance.
@@ -26,10 +27,11 @@ Table::Table(const std::vector<TableColumn*> columns, const std::string name, co
 /**
  * @brief Copy constructor for Table.
  *
- * Performs a deep copy of all `TableColumn` objects from the `other` table.
  * For each column in `other.columns`, `TableColumn::clone()` is called to
- * create a new, independent copy of the column, which is then added to `this->columns`.
- * This ensures that changes to the copied table do not affect the original.
+ * create a new column object, which is then added to `this->columns`. The
+ * clones share their value segments with the original columns copy-on-write,
+ * so the copy costs O(columns) and copies no rows. Changes to either table
+ * copy only the segments they touch and do not affect the other.
  *
  * @param other The Table object to copy from.
  */
@@ -55,7 +57,8 @@ Table::~Table() {
  * @brief Copy assignment operator for Table.
  *
  * Provides strong exception safety using the copy-and-swap idiom (implicitly, as it uses the copy constructor).
- * It first clears existing columns and then performs a deep copy of the columns from `other`.
+ * It first clears existing columns and then clones the columns of `other`,
+ * sharing their values copy-on-write (O(columns), see the copy constructor).
  * It also handles self-assignment correctly.
  *
  * @param other The Table object to assign from.
@@ -158,6 +161,66 @@ std::string Table::getRowAsString(int index) const {
     return result;
 }
 
+/**
+ * @brief Retrieves the selected cells of a row as a formatted string.
+ *
+ * The cells of the listed columns are concatenated in the given order, each
+ * followed by a space, exactly like the full-row overload does.
+ *
+ * @param index The 0-indexed position of the row to retrieve.
+ * @param columnIndexes The 0-indexed positions of the columns to include.
+ * @return A string representing the projected row.
+ * @throws std::runtime_error If the table has no columns.
+ * @throws std::runtime_error If the row index or one of the column indexes is out of bounds.
+ */
+std::string Table::getRowAsString(int index, const std::vector<int>& columnIndexes) const {
+    if (columns.empty()) {
+        throw std::runtime_error("Table '" + name + "' has no columns.");
+    }
+    if (index < 0 || index >= columns[0]->getSize()) {
+        throw std::runtime_error("Invalid row index " + std::to_string(index) + ". Table '" + name + "' has " + std::to_string(columns[0]->getSize()) + " rows.");
+    }
+    std::string result = "";
+
+    for (int columnIndex : columnIndexes) {
+        result += getColumnAtGivenIndex(columnIndex)->returnValueAtGivenIndexAsString(index) + " ";
+    }
+    return result;
+}
+
+/**
+ * @brief Retrieves a row in the machine-readable record format.
+ *
+ * The cells are escaped and appended one by one, so no intermediate vector of cells is built.
+ *
+ * @param index The 0-indexed position of the row to retrieve.
+ * @param columnIndexes The 0-indexed positions of the columns to include. Empty includes all columns.
+ * @return The row as a tab-separated record.
+ * @throws std::runtime_error If the table has no columns.
+ * @throws std::runtime_error If the row index or one of the column indexes is out of bounds.
+ */
+std::string Table::getRowAsRecord(int index, const std::vector<int>& columnIndexes) const {
+    if (columns.empty()) {
+        throw std::runtime_error("Table '" + name + "' has no columns.");
+    }
+    if (index < 0 || index >= columns[0]->getSize()) {
+        throw std::runtime_error("Invalid row index " + std::to_string(index) + ". Table '" + name + "' has " + std::to_string(columns[0]->getSize()) + " rows.");
+    }
+    std::string record;
+
+    if (columnIndexes.empty()) {
+        for (size_t i = 0; i < columns.size(); ++i) {
+            RecordFormat::appendField(record, columns[i]->returnValueAtGivenIndexAsString(index), i == 0);
+        }
+    }
+    else {
+        for (size_t i = 0; i < columnIndexes.size(); ++i) {
+            RecordFormat::appendField(record, getColumnAtGivenIndex(columnIndexes[i])->returnValueAtGivenIndexAsString(index), i == 0);
+        }
+    }
+    return record;
+}
+
 /**
  * @brief Deletes a row at a specified index from all columns in the table.
  *
@@ -207,6 +270,17 @@ int Table::getNumberOfColumns() const {
     return columns.size();
 }
 
+/**
+ * @brief Returns the number of rows in the table.
+ * @return The size of the first column, or 0 if the table has no columns.
+ */
+int Table::getNumberOfRows() const {
+    if (columns.empty()) {
+        return 0;
+    }
+    return columns[0]->getSize();
+}
+
 /**
  * @brief Sets or updates the file path associated with this table.
  * @param filename The new file path for the table.
@@ -271,17 +345,17 @@ std::string Table::toString() const {
 }
 
 /**
- * @brief Creates a deep copy of the current Table object with a new name and path.
+ * @brief Creates a copy of the current Table object with a new name and path.
  *
  * This method is essential for operations like "saveas" where the table
- * structure and data need to be duplicated to a new location without
- * affecting the original table in memory. It performs a deep copy of all
- * `TableColumn` objects by calling `TableColumn::clone()` for each, ensuring
- * that the new table has independent copies of all data.
+ * needs to be saved to a new location without affecting the original table
+ * in memory. Every column is cloned with `TableColumn::clone()`; the clones
+ * share the values copy-on-write, so this costs O(columns) and a later write
+ * to either table copies only the segments it touches.
  *
  * @param newName The name to assign to the cloned table.
  * @param newPath The file path to associate with the cloned table.
- * @return A new `Table` object that is a deep copy of the current instance,
+ * @return A new `Table` object sharing the values of the current instance,
  * but with the specified new name and file path.
  */
 Table Table::cloneWithNewNameAndPath(const std::string& newName, const std::string& newPath) const {
@@ -292,6 +366,39 @@ Table Table::cloneWithNewNameAndPath(const std::string& newName, const std::stri
     return Table(clonedCols, newName, newPath);
 }
 
+/**
+ * @brief Creates a point-in-time snapshot of the table.
+ *
+ * Every column is replaced by `TableColumn::snapshot()`, which shares the
+ * current values instead of copying them.
+ *
+ * @return A new `Table` object sharing the current values of this table.
+ */
+Table Table::snapshot() const {
+    std::vector<TableColumn*> sharedCols;
+    for (TableColumn* col : this->columns) {
+        sharedCols.push_back(col->snapshot());
+    }
+    return Table(sharedCols, name, filename);
+}
+
+/**
+ * @brief Checks whether the table still holds the very rows of an earlier snapshot.
+ * @param other A snapshot taken from this table.
+ * @return `true` if every column still shares its values with the column of `other` at the same position.
+ */
+bool Table::sharesValuesWith(const Table& other) const {
+    if (columns.size() != other.columns.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (!columns[i]->sharesValuesWith(*other.columns[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Helper function to clean up dynamically allocated column pointers.
  * Iterates through `columns` and `delete`s each `TableColumn*`, then clears the vector.
@@ -0,0 +1,107 @@
+#pragma once
+#include <vector>
+#include <string>
+#include "RowCursor.hpp"
+#include "Table.hpp"
+
+/**
+ * @class TableRowCursor
+ * @brief A `RowCursor` that scans a table in storage order, one batch at a time.
+ *
+ * The cursor scans `BATCH_SIZE` rows at once and stores the ids of the rows that
+ * qualify in a selection vector. `next()` serves ids from that vector and only
+ * scans the following batch once it is used up. A consumer that stops after a
+ * page therefore touches at most one batch beyond the rows it shows, no matter
+ * how many rows the table has.
+ *
+ * This base class selects every row. Derived cursors restrict the result by
+ * overriding `selectBatch()`.
+ *
+ * @note The cursor keeps a reference to the table, which must outlive it and
+ * must not change while the cursor is in use.
+ */
+class TableRowCursor : public RowCursor {
+protected:
+    /// The table being scanned.
+    const Table& table;
+
+    /**
+     * @brief Appends the ids of all qualifying rows in [begin, end) to `selection`.
+     *
+     * The default implementation selects every row of the range.
+     *
+     * @param begin First row of the batch.
+     * @param end One past the last row of the batch.
+     * @param selection The selection vector to append to, in ascending row order.
+     * @return The number of rows actually examined; 0 if the batch was skipped without reading it.
+     */
+    virtual int selectBatch(int begin, int end, std::vector<int>& selection) const;
+
+private:
+    /// Number of rows scanned per batch.
+    static const int BATCH_SIZE = 1024;
+
+    std::vector<int> selection; ///< Qualifying row ids of the current batch.
+    size_t selectionIndex;      ///< Index of the next id to return from `selection`.
+    int scanPosition;           ///< First row that has not been scanned yet.
+    int rowCount;               ///< Number of rows of the table when the cursor was created.
+    std::vector<int> projection; ///< Columns included by `formatRow()` and `formatRecord()`; empty means all columns.
+
+    /**
+     * @brief Scans batches until at least one qualifying row is found or the table ends.
+     * @return `true` if the selection vector holds a row to return.
+     */
+    bool fetchNextBatch();
+
+public:
+    /**
+     * @brief Creates a cursor positioned before the first row of `table`.
+     * @param table The table to scan.
+     */
+    explicit TableRowCursor(const Table& table);
+
+    /**
+     * @brief Advances the cursor to the next qualifying row.
+     * @param rowId Receives the id of the row.
+     * @return `true` if a row was produced.
+     */
+    bool next(int& rowId) override;
+
+    /**
+     * @brief Returns the id of the first row that `next()` may still return.
+     *
+     * Since row ids are produced in ascending order, this single number is
+     * enough to resume the scan.
+     *
+     * @return The current position of the cursor.
+     */
+    int position() const override;
+
+    /**
+     * @brief Resumes the scan at the given position.
+     * @param position A value previously obtained from `position()`.
+     */
+    void seek(int position) override;
+
+    /**
+     * @brief Restricts the columns included when a row is formatted.
+     * @param columnIndexes The 0-indexed positions of the columns to show, in display order. Empty shows all columns.
+     */
+    void setProjection(const std::vector<int>& columnIndexes);
+
+    /**
+     * @brief Formats a row of the table using `Table::getRowAsString`, applying the projection.
+     * @param rowId The row to format.
+     * @return The row as a string.
+     * @throws std::runtime_error If `rowId` is out of bounds.
+     */
+    std::string formatRow(int rowId) const override;
+
+    /**
+     * @brief Formats a row of the table using `Table::getRowAsRecord`, applying the projection.
+     * @param rowId The row to format.
+     * @return The row as a tab-separated record.
+     * @throws std::runtime_error If `rowId` is out of bounds.
+     */
+    std::string formatRecord(int rowId) const override;
+};
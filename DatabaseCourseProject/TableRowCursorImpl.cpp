@@ -0,0 +1,126 @@
+#include "TableRowCursor.hpp"
+#include "ProfilePhase.hpp"
+#include "Instrumentation.hpp"
+#include "TraceSpan.hpp"
+#include <algorithm>
+
+/**
+ * @brief Creates a cursor positioned before the first row of `table`.
+ *
+ * No rows are scanned here; the first batch is read on the first call to `next()`.
+ *
+ * @param table The table to scan.
+ */
+TableRowCursor::TableRowCursor(const Table& table)
+    : table(table), selectionIndex(0), scanPosition(0), rowCount(table.getNumberOfRows()) {
+}
+
+/**
+ * @brief Selects every row of the batch.
+ * @param begin First row of the batch.
+ * @param end One past the last row of the batch.
+ * @param selection The selection vector to append to.
+ * @return The number of rows of the batch.
+ */
+int TableRowCursor::selectBatch(int begin, int end, std::vector<int>& selection) const {
+    for (int i = begin; i < end; ++i) {
+        selection.push_back(i);
+    }
+    return end - begin;
+}
+
+/**
+ * @brief Scans batches until at least one qualifying row is found or the table ends.
+ *
+ * The selection vector is reused between batches, so its capacity never exceeds
+ * `BATCH_SIZE` entries.
+ *
+ * @return `true` if the selection vector holds a row to return.
+ */
+bool TableRowCursor::fetchNextBatch() {
+    ProfilePhase phase("scan");
+    TraceSpan span("scan batch");
+    int scannedRows = 0;
+
+    selection.clear();
+    selectionIndex = 0;
+
+    while (selection.empty() && scanPosition < rowCount) {
+        int batchEnd = std::min(rowCount, scanPosition + BATCH_SIZE);
+        scannedRows += selectBatch(scanPosition, batchEnd, selection);
+        scanPosition = batchEnd;
+    }
+
+    Instrumentation::recordRows(scannedRows, static_cast<long long>(selection.size()));
+    return !selection.empty();
+}
+
+/**
+ * @brief Advances the cursor to the next qualifying row.
+ * @param rowId Receives the id of the row.
+ * @return `true` if a row was produced; `false` once the table is exhausted.
+ */
+bool TableRowCursor::next(int& rowId) {
+    if (selectionIndex >= selection.size() && !fetchNextBatch()) {
+        return false;
+    }
+    rowId = selection[selectionIndex++];
+    return true;
+}
+
+/**
+ * @brief Returns the id of the first row that `next()` may still return.
+ * @return The next selected row id if the current batch is not used up, otherwise the scan position.
+ */
+int TableRowCursor::position() const {
+    if (selectionIndex < selection.size()) {
+        return selection[selectionIndex];
+    }
+    return scanPosition;
+}
+
+/**
+ * @brief Resumes the scan at the given position.
+ *
+ * The current batch is discarded and the scan restarts at `position`.
+ *
+ * @param position A value previously obtained from `position()`.
+ */
+void TableRowCursor::seek(int position) {
+    selection.clear();
+    selectionIndex = 0;
+    scanPosition = std::max(0, std::min(position, rowCount));
+}
+
+/**
+ * @brief Restricts the columns included when a row is formatted.
+ * @param columnIndexes The 0-indexed positions of the columns to show. Empty shows all columns.
+ */
+void TableRowCursor::setProjection(const std::vector<int>& columnIndexes) {
+    projection = columnIndexes;
+}
+
+/**
+ * @brief Formats a row of the table using `Table::getRowAsString`, applying the projection.
+ * @param rowId The row to format.
+ * @return The row as a string.
+ * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+ */
+std::string TableRowCursor::formatRow(int rowId) const {
+    ProfilePhase phase("output formatting");
+    if (projection.empty()) {
+        return table.getRowAsString(rowId);
+    }
+    return table.getRowAsString(rowId, projection);
+}
+
+/**
+ * @brief Formats a row of the table using `Table::getRowAsRecord`, applying the projection.
+ * @param rowId The row to format.
+ * @return The row as a tab-separated record.
+ * @throws std::runtime_error If `rowId` or a projected column index is out of bounds.
+ */
+std::string TableRowCursor::formatRecord(int rowId) const {
+    ProfilePhase phase("output formatting");
+    return table.getRowAsRecord(rowId, projection);
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <vector>
+#include "Table.hpp"
+#include "Expression.hpp"
+#include "QueryOperator.hpp"
+
+/**
+ * @class TableScan
+ * @brief The source of a query pipeline: reads a table and pushes its rows downstream.
+ *
+ * The WHERE conditions that only reference this table are fused into the scan.
+ * They are evaluated batch by batch into selection bitmaps by a
+ * `FilteredRowCursor`, so only qualifying rows are ever converted into
+ * `QueryRow`s.
+ */
+class TableScan {
+private:
+    const Table& table;  ///< The scanned table. Not owned.
+    Expression* filter;  ///< The condition bound to `table`, or nullptr. Owned.
+
+public:
+    /**
+     * @brief Creates a scan over `table`.
+     *
+     * @param table The table to read. It must outlive the scan.
+     * @param filter A condition already bound to `table`, or nullptr to read every row. Ownership is transferred.
+     */
+    TableScan(const Table& table, Expression* filter);
+
+    /**
+     * @brief Deletes the filter.
+     */
+    ~TableScan();
+
+    TableScan(const TableScan& other) = delete;
+    TableScan& operator=(const TableScan& other) = delete;
+
+    /**
+     * @brief Returns the scanned table.
+     * @return The table.
+     */
+    const Table& getTable() const;
+
+    /**
+     * @brief Describes the columns of the rows a scan of `table` produces.
+     * @param table The table.
+     * @return One entry per table column, in table order.
+     */
+    static std::vector<QueryColumn> schemaOf(const Table& table);
+
+    /**
+     * @brief Pushes every qualifying row into `consumer`.
+     *
+     * Neither `open()` nor `finish()` of the consumer is called.
+     *
+     * @param consumer The operator receiving the rows.
+     * @return The number of rows pushed. The scan stops as soon as `consumer` returns `false`.
+     */
+    size_t run(QueryOperator& consumer) const;
+};
@@ -0,0 +1,89 @@
+#include "TableScan.hpp"
+#include "TableColumn.hpp"
+#include "TableRowCursor.hpp"
+#include "FilteredRowCursor.hpp"
+#include "TraceSpan.hpp"
+
+/**
+ * @brief Creates a scan over `table`.
+ *
+ * @param table The table to read.
+ * @param filter A condition already bound to `table`, or nullptr. Ownership is transferred.
+ */
+TableScan::TableScan(const Table& table, Expression* filter)
+    : table(table), filter(filter) {
+}
+
+/**
+ * @brief Deletes the filter.
+ */
+TableScan::~TableScan() {
+    delete filter;
+}
+
+/**
+ * @brief Returns the scanned table.
+ * @return The table.
+ */
+const Table& TableScan::getTable() const {
+    return table;
+}
+
+/**
+ * @brief Describes the columns of the rows a scan of `table` produces.
+ * @param table The table.
+ * @return One entry per table column, holding the table name, column name and type.
+ */
+std::vector<QueryColumn> TableScan::schemaOf(const Table& table) {
+    std::vector<QueryColumn> schema;
+    for (int i = 0; i < table.getNumberOfColumns(); ++i) {
+        const TableColumn* column = table.getColumnAtGivenIndex(i);
+        schema.push_back({ table.getName(), column->getName(), column->getType() });
+    }
+    return schema;
+}
+
+/**
+ * @brief Pushes every qualifying row into `consumer`.
+ *
+ * Row ids come from a batched cursor; one `QueryRow` buffer is reused for
+ * every row, so the scan allocates only when a cell is longer than before.
+ *
+ * @param consumer The operator receiving the rows.
+ * @return The number of rows pushed.
+ */
+size_t TableScan::run(QueryOperator& consumer) const {
+    TraceSpan span("table scan", table.getName());
+    TableRowCursor* cursor = filter
+        ? new FilteredRowCursor(table, *filter)
+        : new TableRowCursor(table);
+
+    int columnCount = table.getNumberOfColumns();
+    std::vector<const TableColumn*> columns;
+    for (int i = 0; i < columnCount; ++i) {
+        columns.push_back(table.getColumnAtGivenIndex(i));
+    }
+
+    QueryRow row(columnCount);
+    size_t produced = 0;
+    int rowId;
+
+    try {
+        while (cursor->next(rowId)) {
+            for (int i = 0; i < columnCount; ++i) {
+                row[i] = columns[i]->returnValueAtGivenIndexAsString(rowId);
+            }
+            ++produced;
+            if (!consumer.consume(row)) {
+                break;
+            }
+        }
+    }
+    catch (...) {
+        delete cursor;
+        throw;
+    }
+
+    delete cursor;
+    return produced;
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include "TaskScheduler.hpp"
+#include "CancellationToken.hpp"
+
+/**
+ * @class TaskGroup
+ * @brief Fork/join helper that runs a set of tasks on a `TaskScheduler` and waits for all of them.
+ *
+ * Tasks are forked with `run()` and joined with `wait()`. While waiting, the calling
+ * thread executes pending tasks itself, so groups can be nested freely (a task may
+ * create its own group and wait for it).
+ *
+ * If a task throws, the exception is captured, the group is marked as failed and
+ * tasks that have not started yet are skipped. The first captured exception is
+ * rethrown from `wait()`. The group can also be stopped cooperatively through
+ * `cancel()` or through the `CancellationToken` it was created with.
+ */
+class TaskGroup {
+private:
+    /**
+     * @brief State shared between the group and the tasks it forked.
+     *
+     * Kept in a `shared_ptr` so that a finishing task never touches memory
+     * that the waiting thread may already have released.
+     */
+    struct State {
+        std::atomic<int> pending;            ///< Number of forked tasks that have not finished yet.
+        std::atomic<bool> failed;            ///< Set when a task threw or `cancel()` was called.
+        std::mutex exceptionMutex;           ///< Guards `firstException`.
+        std::exception_ptr firstException;   ///< The first exception thrown by a task.
+
+        State() : pending(0), failed(false) {}
+    };
+
+    TaskScheduler& scheduler;                ///< The pool that executes the tasks.
+    CancellationToken token;                 ///< External token observed by the tasks of this group.
+    std::shared_ptr<State> state;            ///< State shared with the forked tasks.
+
+public:
+    /**
+     * @brief Creates an empty group bound to the given scheduler.
+     * @param scheduler The scheduler that will execute the forked tasks.
+     */
+    explicit TaskGroup(TaskScheduler& scheduler);
+
+    /**
+     * @brief Creates an empty group that also stops when `token` is cancelled.
+     * @param scheduler The scheduler that will execute the forked tasks.
+     * @param token External cancellation token observed by the group.
+     */
+    TaskGroup(TaskScheduler& scheduler, const CancellationToken& token);
+
+    /**
+     * @brief Waits for all forked tasks before the group goes away.
+     *
+     * Exceptions are not rethrown from the destructor; call `wait()` explicitly
+     * to observe them.
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Forks a task into the group.
+     *
+     * The task is skipped (but still accounted for) if the group is cancelled
+     * before it starts.
+     *
+     * @param task The work to execute.
+     */
+    void run(std::function<void()> task);
+
+    /**
+     * @brief Joins all tasks forked so far.
+     *
+     * The calling thread helps executing pending tasks until the group is empty.
+     *
+     * @throws Any exception thrown by one of the tasks (the first one captured).
+     */
+    void wait();
+
+    /**
+     * @brief Cooperatively cancels the group: tasks that did not start yet are skipped.
+     */
+    void cancel();
+
+    /**
+     * @brief Checks whether the group was cancelled, failed or its external token was cancelled.
+     * @return `true` if remaining work should be abandoned.
+     */
+    bool isCancelled() const;
+};
@@ -0,0 +1,122 @@
+#include "TaskGroup.hpp"
+#include "ExecutionProfile.hpp"
+#include <thread>
+
+/**
+ * @brief Creates an empty group bound to the given scheduler.
+ *
+ * The group gets its own, never cancelled external token.
+ *
+ * @param scheduler The scheduler that will execute the forked tasks.
+ */
+TaskGroup::TaskGroup(TaskScheduler& scheduler)
+    : scheduler(scheduler), state(std::make_shared<State>()) {
+}
+
+/**
+ * @brief Creates an empty group that also stops when `token` is cancelled.
+ * @param scheduler The scheduler that will execute the forked tasks.
+ * @param token External cancellation token observed by the group.
+ */
+TaskGroup::TaskGroup(TaskScheduler& scheduler, const CancellationToken& token)
+    : scheduler(scheduler), token(token), state(std::make_shared<State>()) {
+}
+
+/**
+ * @brief Waits for all forked tasks before the group goes away.
+ *
+ * Any exception captured from the tasks is dropped here, because throwing
+ * from a destructor would terminate the program.
+ */
+TaskGroup::~TaskGroup() {
+    try {
+        wait();
+    }
+    catch (...) {
+    }
+}
+
+/**
+ * @brief Forks a task into the group.
+ *
+ * The pending counter is incremented before the task is queued so that a
+ * concurrent `wait()` can never observe an empty group while work is still in
+ * flight. The wrapper checks for cancellation before running the task, captures
+ * the first exception and decrements the counter as its very last action.
+ * The task works for the profile of the submitting thread (see
+ * `ExecutionProfile::switchCallingThread`), so `explain` counts the
+ * allocations of its tasks but not those of other sessions' tasks that run
+ * on the same workers or are stolen by the profiled thread.
+ *
+ * @param task The work to execute.
+ */
+void TaskGroup::run(std::function<void()> task) {
+    state->pending.fetch_add(1, std::memory_order_relaxed);
+
+    std::shared_ptr<State> shared = state;
+    CancellationToken external = token;
+    ExecutionProfile* profile = ExecutionProfile::ofCallingThread();
+
+    scheduler.submit([shared, external, task, profile]() {
+        ExecutionProfile* previous = ExecutionProfile::switchCallingThread(profile);
+        if (!shared->failed.load(std::memory_order_acquire) && !external.isCancelled()) {
+            try {
+                task();
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(shared->exceptionMutex);
+                if (!shared->firstException) {
+                    shared->firstException = std::current_exception();
+                }
+                shared->failed.store(true, std::memory_order_release);
+            }
+        }
+        ExecutionProfile::switchCallingThread(previous);
+        shared->pending.fetch_sub(1, std::memory_order_acq_rel);
+    });
+}
+
+/**
+ * @brief Joins all tasks forked so far.
+ *
+ * Instead of sleeping, the waiting thread keeps executing pending tasks from
+ * the scheduler. Only when no task is available does it yield its time slice.
+ * Once the group is empty, the first captured exception (if any) is rethrown.
+ * It is cleared first, so the destructor's implicit `wait()` does not see it again.
+ *
+ * @throws Any exception thrown by one of the tasks.
+ */
+void TaskGroup::wait() {
+    while (state->pending.load(std::memory_order_acquire) > 0) {
+        if (!scheduler.runPendingTask()) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(state->exceptionMutex);
+        error = state->firstException;
+        state->firstException = nullptr;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Cooperatively cancels the group.
+ *
+ * Running tasks finish normally; tasks that have not started yet are skipped.
+ */
+void TaskGroup::cancel() {
+    state->failed.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Checks whether the group was cancelled, failed or its external token was cancelled.
+ * @return `true` if remaining work should be abandoned.
+ */
+bool TaskGroup::isCancelled() const {
+    return state->failed.load(std::memory_order_acquire) || token.isCancelled();
+}
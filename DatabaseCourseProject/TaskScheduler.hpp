@@ -0,0 +1,142 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include "CancellationToken.hpp"
+
+/**
+ * @class TaskScheduler
+ * @brief A work-stealing thread pool shared by all commands through the `CommandContext`.
+ *
+ * Every worker thread owns a double-ended task queue. A worker pushes the tasks it
+ * spawns to the back of its own queue and pops from the back as well, which keeps
+ * recently produced (and cache-warm) work on the same thread. When its own queue
+ * is empty, a worker steals the oldest task from the front of another worker's queue.
+ * Tasks submitted from outside the pool are distributed round-robin between the queues.
+ *
+ * Threads that wait for a group of tasks (see `TaskGroup::wait`) do not block: they
+ * execute pending tasks themselves, which makes nested fork/join safe even when all
+ * workers are busy.
+ *
+ * The scheduler is owned by the `Engine` and its size is fixed at construction.
+ */
+class TaskScheduler {
+private:
+    /**
+     * @brief A single worker's task queue.
+     *
+     * The owner works on the back of the deque, thieves take from the front.
+     * A plain mutex per queue keeps the implementation simple; contention is low
+     * because every worker mostly touches its own queue.
+     */
+    struct WorkerQueue {
+        std::mutex mutex;                             ///< Guards `tasks`.
+        std::deque<std::function<void()>> tasks;      ///< Pending tasks of this worker.
+    };
+
+    std::vector<WorkerQueue*> queues;      ///< One queue per worker thread. Owned by the scheduler.
+    std::vector<std::thread> workers;      ///< The worker threads.
+    std::atomic<size_t> pendingTasks;      ///< Number of tasks queued but not yet started.
+    std::atomic<size_t> nextQueue;         ///< Round-robin cursor for tasks submitted from outside the pool.
+
+    std::mutex sleepMutex;                 ///< Guards `stopping` and is used to park idle workers.
+    std::condition_variable wakeUp;        ///< Signalled when new work arrives or the pool shuts down.
+    bool stopping;                         ///< Set by the destructor to let the workers exit.
+
+    /**
+     * @brief Main loop executed by each worker thread.
+     * @param index The index of the worker, which is also the index of its queue.
+     */
+    void workerLoop(unsigned int index);
+
+    /**
+     * @brief Removes the next task the calling thread should run.
+     *
+     * Worker threads first look at the back of their own queue, then try to steal
+     * from the front of the other queues. Threads outside the pool only steal.
+     *
+     * @param task Receives the task when one is found.
+     * @return `true` if a task was found.
+     */
+    bool takeTask(std::function<void()>& task);
+
+    /**
+     * @brief Returns the index of the calling thread inside this pool.
+     * @return The worker index, or -1 if the calling thread is not one of this pool's workers.
+     */
+    int currentWorkerIndex() const;
+
+public:
+    /**
+     * @brief Creates the pool and starts its worker threads.
+     *
+     * @param threadCount Number of worker threads. A value of 0 selects
+     * `std::thread::hardware_concurrency()` (or 1 if that is unknown).
+     */
+    explicit TaskScheduler(unsigned int threadCount = 0);
+
+    /**
+     * @brief Drains the remaining tasks and joins all worker threads.
+     */
+    ~TaskScheduler();
+
+    /**
+     * @brief The scheduler owns running threads and therefore cannot be copied.
+     */
+    TaskScheduler(const TaskScheduler&) = delete;
+
+    /**
+     * @brief The scheduler owns running threads and therefore cannot be copied.
+     */
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads in the pool.
+     * @return The worker thread count.
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief Queues a task for asynchronous execution.
+     *
+     * The task must not throw; use `TaskGroup` when exceptions have to be
+     * propagated back to the caller.
+     *
+     * @param task The work to run on one of the worker threads.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Runs one pending task on the calling thread, if there is any.
+     *
+     * Used by threads that wait for other tasks so that they contribute work
+     * instead of blocking.
+     *
+     * @return `true` if a task was executed, `false` if no task was available.
+     */
+    bool runPendingTask();
+
+    /**
+     * @brief Executes `body` over the half-open row range [begin, end) in parallel.
+     *
+     * The range is split into chunks of at most `grainSize` rows and every chunk
+     * is passed to `body` as a [chunkBegin, chunkEnd) pair. Small ranges are run
+     * directly on the calling thread. Chunks that have not started yet are skipped
+     * once `token` is cancelled or another chunk has thrown. The first exception
+     * thrown by `body` is rethrown to the caller after all started chunks finish.
+     *
+     * @param begin First row of the range.
+     * @param end One past the last row of the range.
+     * @param grainSize Maximum number of rows per chunk. A value <= 0 picks a size
+     * that gives every worker a few chunks.
+     * @param body The work to run for each chunk.
+     * @param token Token that can be used to stop the loop early.
+     */
+    void parallelFor(int begin, int end, int grainSize,
+        const std::function<void(int, int)>& body,
+        const CancellationToken& token = CancellationToken());
+};
@@ -0,0 +1,237 @@
+#include "TaskScheduler.hpp"
+#include "TaskGroup.hpp"
+#include "TraceSpan.hpp"
+#include <algorithm>
+
+namespace {
+    /// The scheduler the calling thread works for, or nullptr for threads outside any pool.
+    thread_local const TaskScheduler* currentScheduler = nullptr;
+
+    /// The queue index of the calling worker thread inside `currentScheduler`.
+    thread_local int currentWorker = -1;
+}
+
+/**
+ * @brief Creates the pool and starts its worker threads.
+ *
+ * One queue is created per worker before any thread starts, so the workers
+ * can steal from each other as soon as they run.
+ *
+ * @param threadCount Number of worker threads; 0 selects the hardware concurrency.
+ */
+TaskScheduler::TaskScheduler(unsigned int threadCount)
+    : pendingTasks(0), nextQueue(0), stopping(false) {
+
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0) {
+            threadCount = 1;
+        }
+    }
+
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        queues.push_back(new WorkerQueue());
+    }
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&TaskScheduler::workerLoop, this, i);
+    }
+}
+
+/**
+ * @brief Drains the remaining tasks and joins all worker threads.
+ *
+ * Workers only leave their loop once `stopping` is set and no task is left,
+ * so every task submitted before destruction still runs.
+ */
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (WorkerQueue* queue : queues) {
+        delete queue;
+    }
+    queues.clear();
+}
+
+/**
+ * @brief Returns the number of worker threads in the pool.
+ * @return The worker thread count.
+ */
+unsigned int TaskScheduler::getThreadCount() const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+/**
+ * @brief Returns the index of the calling thread inside this pool.
+ * @return The worker index, or -1 for threads that do not belong to this pool.
+ */
+int TaskScheduler::currentWorkerIndex() const {
+    return currentScheduler == this ? currentWorker : -1;
+}
+
+/**
+ * @brief Queues a task for asynchronous execution.
+ *
+ * Tasks spawned by a worker go to the back of that worker's own queue, tasks
+ * from other threads are spread round-robin. The pending counter is raised
+ * before taking `sleepMutex`, which guarantees that a worker about to park
+ * re-checks the counter and does not miss the wake-up.
+ *
+ * @param task The work to run.
+ */
+void TaskScheduler::submit(std::function<void()> task) {
+    int worker = currentWorkerIndex();
+    size_t target = worker >= 0
+        ? static_cast<size_t>(worker)
+        : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+
+    {
+        std::lock_guard<std::mutex> lock(queues[target]->mutex);
+        queues[target]->tasks.push_back(std::move(task));
+    }
+    pendingTasks.fetch_add(1, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wakeUp.notify_one();
+}
+
+/**
+ * @brief Removes the next task the calling thread should run.
+ *
+ * A worker pops the newest task from its own queue (LIFO), which favours
+ * locality for fork/join recursion. Otherwise the oldest task is stolen from
+ * the front of another queue (FIFO), starting with the neighbour of the
+ * calling worker to spread the thieves.
+ *
+ * @param task Receives the task when one is found.
+ * @return `true` if a task was found.
+ */
+bool TaskScheduler::takeTask(std::function<void()>& task) {
+    int worker = currentWorkerIndex();
+
+    if (worker >= 0) {
+        WorkerQueue* own = queues[worker];
+        std::lock_guard<std::mutex> lock(own->mutex);
+        if (!own->tasks.empty()) {
+            task = std::move(own->tasks.back());
+            own->tasks.pop_back();
+            return true;
+        }
+    }
+
+    size_t count = queues.size();
+    size_t start = worker >= 0 ? static_cast<size_t>(worker) + 1 : 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        WorkerQueue* victim = queues[(start + i) % count];
+        std::lock_guard<std::mutex> lock(victim->mutex);
+        if (!victim->tasks.empty()) {
+            task = std::move(victim->tasks.front());
+            victim->tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Runs one pending task on the calling thread, if there is any.
+ * @return `true` if a task was executed.
+ */
+bool TaskScheduler::runPendingTask() {
+    if (pendingTasks.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+
+    std::function<void()> task;
+    if (!takeTask(task)) {
+        return false;
+    }
+    pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    TraceSpan span("task");
+    task();
+    return true;
+}
+
+/**
+ * @brief Main loop executed by each worker thread.
+ *
+ * The worker runs tasks as long as any are available and parks on the
+ * condition variable otherwise. It exits once shutdown was requested and
+ * no queued task is left.
+ *
+ * @param index The index of the worker and of its queue.
+ */
+void TaskScheduler::workerLoop(unsigned int index) {
+    currentScheduler = this;
+    currentWorker = static_cast<int>(index);
+    TraceRecorder::setThreadName("worker " + std::to_string(index));
+
+    while (true) {
+        if (runPendingTask()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeUp.wait(lock, [this]() {
+            return stopping || pendingTasks.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping && pendingTasks.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+    }
+
+    currentScheduler = nullptr;
+    currentWorker = -1;
+}
+
+/**
+ * @brief Executes `body` over the half-open row range [begin, end) in parallel.
+ *
+ * When no grain size is given, the range is cut into roughly four chunks per
+ * worker, which leaves enough slack for stealing to balance uneven chunks.
+ * Ranges that fit into a single chunk run inline without touching the queues.
+ *
+ * @param begin First row of the range.
+ * @param end One past the last row of the range.
+ * @param grainSize Maximum number of rows per chunk (<= 0 for automatic).
+ * @param body The work to run for each chunk.
+ * @param token Token that can be used to stop the loop early.
+ * @throws Any exception thrown by `body`.
+ */
+void TaskScheduler::parallelFor(int begin, int end, int grainSize,
+    const std::function<void(int, int)>& body,
+    const CancellationToken& token) {
+
+    if (end <= begin || token.isCancelled()) {
+        return;
+    }
+
+    int total = end - begin;
+    if (grainSize <= 0) {
+        int chunks = static_cast<int>(getThreadCount()) * 4;
+        grainSize = std::max(1, (total + chunks - 1) / chunks);
+    }
+
+    if (total <= grainSize) {
+        body(begin, end);
+        return;
+    }
+
+    TaskGroup group(*this, token);
+    for (int chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+        int chunkEnd = std::min(end, chunkBegin + grainSize);
+        group.run([&body, chunkBegin, chunkEnd]() {
+            body(chunkBegin, chunkEnd);
+        });
+    }
+    group.wait();
+}
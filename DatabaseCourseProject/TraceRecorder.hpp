@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class TraceRecorder
+ * @brief Collects trace spans into thread-local ring buffers and exports them as a Chrome trace.
+ *
+ * Tracing is switched on and off at runtime (see the `trace` command). While
+ * it is off, `TraceSpan` only performs one relaxed atomic load, so spans can
+ * stay in the hot paths permanently.
+ *
+ * While tracing is on, every thread writes its finished spans into its own
+ * ring buffer of `BUFFER_CAPACITY` events; once a buffer is full the oldest
+ * events are overwritten, so a long trace keeps its most recent part. The
+ * buffers are exported together in the Chrome trace-event JSON format, which
+ * can be opened in `chrome://tracing` or Perfetto, with one track per thread.
+ *
+ * Threads that end before the process, like server sessions, call
+ * `releaseThread`; their buffer is freed once its events have been exported
+ * or discarded, so short-lived threads do not accumulate buffers.
+ */
+class TraceRecorder {
+private:
+    static std::atomic<bool> enabled; ///< Whether spans are recorded.
+
+public:
+    /// Maximum number of events kept per thread.
+    static const size_t BUFFER_CAPACITY = 1 << 16;
+
+    /**
+     * @brief Checks whether spans are recorded.
+     * @return `true` while tracing is on.
+     */
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Discards the events of a previous trace and starts recording.
+     */
+    static void enable();
+
+    /**
+     * @brief Stops recording. The recorded events are kept until the next `enable()`.
+     */
+    static void disable();
+
+    /**
+     * @brief Returns the current trace timestamp.
+     * @return Microseconds since the program started.
+     */
+    static long long now();
+
+    /**
+     * @brief Stores a finished span in the ring buffer of the calling thread.
+     * @param name The span name. Must be a string literal or otherwise outlive the trace.
+     * @param detail Optional detail shown in the span's arguments, e.g. a command or file name.
+     * @param start Start timestamp, from `now()`.
+     * @param end End timestamp, from `now()`.
+     */
+    static void record(const char* name, const std::string& detail, long long start, long long end);
+
+    /**
+     * @brief Names the track of the calling thread in exported traces.
+     * @param name The thread name, e.g. `worker 3`.
+     */
+    static void setThreadName(const std::string& name);
+
+    /**
+     * @brief Marks the calling thread as finished with tracing.
+     *
+     * Its buffer is freed right away if it holds no events, otherwise by the
+     * next `toChromeJson` (after exporting it) or `enable`. A later span of
+     * the thread starts a new buffer.
+     */
+    static void releaseThread();
+
+    /**
+     * @brief Exports the recorded events of all threads and frees the buffers of released threads.
+     * @return A Chrome trace-event JSON document.
+     */
+    static std::string toChromeJson();
+};
@@ -0,0 +1,274 @@
+#include "TraceRecorder.hpp"
+#include <vector>
+#include <mutex>
+#include <chrono>
+
+std::atomic<bool> TraceRecorder::enabled(false);
+
+namespace {
+    /**
+     * @brief One finished span.
+     */
+    struct TraceEvent {
+        const char* name;   ///< The span name.
+        std::string detail; ///< Optional detail, empty if none.
+        long long start;    ///< Start timestamp in microseconds.
+        long long duration; ///< Duration in microseconds.
+    };
+
+    /**
+     * @brief The ring buffer of one thread.
+     *
+     * The mutex is only contended while a trace is exported during recording.
+     */
+    struct TraceBuffer {
+        std::mutex mutex;               ///< Guards all members below.
+        int threadId;                   ///< Track id in the exported trace.
+        std::string threadName;         ///< Track name, empty for the default.
+        std::vector<TraceEvent> events; ///< The ring; allocated on the first recorded event.
+        size_t next;                    ///< Slot the next event is written to.
+        bool wrapped;                   ///< Whether the ring has been filled at least once.
+        bool released;                  ///< Whether the thread called `releaseThread`; the buffer is freed once exported.
+    };
+
+    /**
+     * @brief Owns the buffers of all threads that recorded or were named.
+     *
+     * Buffers outlive their threads so that spans of finished threads can
+     * still be exported; released buffers are removed once that happened.
+     */
+    struct BufferList {
+        std::mutex mutex;                 ///< Guards `buffers` and `nextThreadId`.
+        std::vector<TraceBuffer*> buffers; ///< The buffers, in registration order.
+        int nextThreadId = 1;             ///< Track id of the next registered buffer; ids are never reused.
+
+        ~BufferList() {
+            for (TraceBuffer* buffer : buffers) {
+                delete buffer;
+            }
+        }
+    };
+
+    /// The buffers of all threads.
+    BufferList allBuffers;
+
+    /// The buffer of the calling thread, or nullptr before it is registered.
+    thread_local TraceBuffer* localBuffer = nullptr;
+
+    /// Time origin of the trace timestamps.
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+    /**
+     * @brief Returns the buffer of the calling thread, registering it on first use.
+     * @return The buffer.
+     */
+    TraceBuffer& threadBuffer() {
+        if (localBuffer == nullptr) {
+            TraceBuffer* buffer = new TraceBuffer();
+            buffer->next = 0;
+            buffer->wrapped = false;
+            buffer->released = false;
+
+            std::lock_guard<std::mutex> lock(allBuffers.mutex);
+            buffer->threadId = allBuffers.nextThreadId++;
+            allBuffers.buffers.push_back(buffer);
+            localBuffer = buffer;
+        }
+        return *localBuffer;
+    }
+
+    /**
+     * @brief Escapes a string for a JSON string literal.
+     * @param text The raw text.
+     * @return The escaped text, without the surrounding quotes.
+     */
+    std::string escapeJson(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped += ' ';
+                }
+                else {
+                    escaped += c;
+                }
+            }
+        }
+        return escaped;
+    }
+
+    /**
+     * @brief Frees the buffers of released threads. The caller holds `allBuffers.mutex`.
+     * @param onlyEmpty `true` to keep released buffers that still hold events.
+     */
+    void removeReleasedBuffers(bool onlyEmpty) {
+        std::vector<TraceBuffer*> kept;
+        for (TraceBuffer* buffer : allBuffers.buffers) {
+            bool remove;
+            {
+                std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+                remove = buffer->released && (!onlyEmpty || (buffer->next == 0 && !buffer->wrapped));
+            }
+            if (remove) {
+                delete buffer;
+            }
+            else {
+                kept.push_back(buffer);
+            }
+        }
+        allBuffers.buffers.swap(kept);
+    }
+}
+
+/**
+ * @brief Discards the events of a previous trace and starts recording.
+ *
+ * The buffers of released threads are freed, since their events are discarded anyway.
+ */
+void TraceRecorder::enable() {
+    {
+        std::lock_guard<std::mutex> lock(allBuffers.mutex);
+        removeReleasedBuffers(false);
+        for (TraceBuffer* buffer : allBuffers.buffers) {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            buffer->next = 0;
+            buffer->wrapped = false;
+        }
+    }
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Stops recording. The recorded events are kept until the next `enable()`.
+ */
+void TraceRecorder::disable() {
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the current trace timestamp.
+ * @return Microseconds since the program started.
+ */
+long long TraceRecorder::now() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+/**
+ * @brief Stores a finished span in the ring buffer of the calling thread.
+ *
+ * The ring is allocated on the first event of the thread. When it is full,
+ * the oldest event is overwritten.
+ *
+ * @param name The span name. Must outlive the trace.
+ * @param detail Optional detail, empty if none.
+ * @param start Start timestamp, from `now()`.
+ * @param end End timestamp, from `now()`.
+ */
+void TraceRecorder::record(const char* name, const std::string& detail, long long start, long long end) {
+    TraceBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    if (buffer.events.empty()) {
+        buffer.events.resize(BUFFER_CAPACITY);
+    }
+
+    TraceEvent& event = buffer.events[buffer.next];
+    event.name = name;
+    event.detail = detail;
+    event.start = start;
+    event.duration = end - start;
+
+    if (++buffer.next == BUFFER_CAPACITY) {
+        buffer.next = 0;
+        buffer.wrapped = true;
+    }
+}
+
+/**
+ * @brief Names the track of the calling thread in exported traces.
+ * @param name The thread name, e.g. `worker 3`.
+ */
+void TraceRecorder::setThreadName(const std::string& name) {
+    TraceBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+/**
+ * @brief Marks the calling thread as finished with tracing.
+ *
+ * The thread forgets its buffer; a buffer without events is freed right
+ * away, one with events once it has been exported. Until then a ring that
+ * never wrapped is shrunk to the events it holds.
+ */
+void TraceRecorder::releaseThread() {
+    if (localBuffer == nullptr) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> bufferLock(localBuffer->mutex);
+        localBuffer->released = true;
+        if (!localBuffer->wrapped) {
+            localBuffer->events.resize(localBuffer->next);
+            localBuffer->events.shrink_to_fit();
+        }
+    }
+    localBuffer = nullptr;
+
+    std::lock_guard<std::mutex> lock(allBuffers.mutex);
+    removeReleasedBuffers(true);
+}
+
+/**
+ * @brief Exports the recorded events of all threads.
+ *
+ * Spans become complete events (`"ph":"X"`) with timestamps and durations in
+ * microseconds; every thread with a name gets a `thread_name` metadata event.
+ * The events of each ring are written oldest first. Afterwards the buffers
+ * of released threads are freed.
+ *
+ * @return A Chrome trace-event JSON document.
+ */
+std::string TraceRecorder::toChromeJson() {
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(allBuffers.mutex);
+    for (TraceBuffer* buffer : allBuffers.buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        std::string tid = std::to_string(buffer->threadId);
+
+        if (!buffer->threadName.empty()) {
+            json += first ? "\n" : ",\n";
+            json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid
+                + ",\"args\":{\"name\":\"" + escapeJson(buffer->threadName) + "\"}}";
+            first = false;
+        }
+
+        size_t count = buffer->wrapped ? BUFFER_CAPACITY : buffer->next;
+        size_t begin = buffer->wrapped ? buffer->next : 0;
+        for (size_t i = 0; i < count; ++i) {
+            const TraceEvent& event = buffer->events[(begin + i) % BUFFER_CAPACITY];
+
+            json += first ? "\n" : ",\n";
+            json += "{\"name\":\"" + escapeJson(event.name) + "\",\"ph\":\"X\",\"pid\":1,\"tid\":" + tid
+                + ",\"ts\":" + std::to_string(event.start) + ",\"dur\":" + std::to_string(event.duration);
+            if (!event.detail.empty()) {
+                json += ",\"args\":{\"detail\":\"" + escapeJson(event.detail) + "\"}";
+            }
+            json += "}";
+            first = false;
+        }
+    }
+
+    removeReleasedBuffers(false);
+
+    json += "\n]}\n";
+    return json;
+}
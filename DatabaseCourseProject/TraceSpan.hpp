@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include "TraceRecorder.hpp"
+
+/**
+ * @class TraceSpan
+ * @brief Scoped trace span recorded by the `TraceRecorder`.
+ *
+ * @code
+ * TraceSpan span("readTableFromFile", filepath);
+ * @endcode
+ *
+ * The span starts in the constructor and is recorded when it is destroyed.
+ * When tracing is off the constructor only checks `TraceRecorder::isEnabled()`
+ * and nothing is copied or timed.
+ */
+class TraceSpan {
+private:
+    const char* name;   ///< The span name, or nullptr when tracing was off at construction.
+    std::string detail; ///< The detail, copied only while tracing.
+    long long start;    ///< Start timestamp.
+
+public:
+    /**
+     * @brief Starts a span without detail.
+     * @param name The span name, a string literal.
+     */
+    explicit TraceSpan(const char* name);
+
+    /**
+     * @brief Starts a span with a detail, e.g. the command or file it belongs to.
+     * @param name The span name, a string literal.
+     * @param detail The detail shown in the span's arguments.
+     */
+    TraceSpan(const char* name, const std::string& detail);
+
+    /**
+     * @brief Records the span if it was started while tracing.
+     */
+    ~TraceSpan();
+
+    /**
+     * @brief Deleted copy constructor; a span is recorded exactly once.
+     */
+    TraceSpan(const TraceSpan& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; a span is recorded exactly once.
+     */
+    TraceSpan& operator=(const TraceSpan& other) = delete;
+};
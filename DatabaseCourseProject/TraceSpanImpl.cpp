@@ -0,0 +1,39 @@
+#include "TraceSpan.hpp"
+
+/**
+ * @brief Starts a span without detail.
+ * @param name The span name, a string literal.
+ */
+TraceSpan::TraceSpan(const char* name)
+    : name(nullptr), start(0) {
+    if (TraceRecorder::isEnabled()) {
+        this->name = name;
+        start = TraceRecorder::now();
+    }
+}
+
+/**
+ * @brief Starts a span with a detail.
+ * @param name The span name, a string literal.
+ * @param detail The detail shown in the span's arguments.
+ */
+TraceSpan::TraceSpan(const char* name, const std::string& detail)
+    : name(nullptr), start(0) {
+    if (TraceRecorder::isEnabled()) {
+        this->name = name;
+        this->detail = detail;
+        start = TraceRecorder::now();
+    }
+}
+
+/**
+ * @brief Records the span if it was started while tracing.
+ *
+ * Spans that started before tracing was switched off are still recorded,
+ * so the last command of a trace is complete.
+ */
+TraceSpan::~TraceSpan() {
+    if (name != nullptr) {
+        TraceRecorder::record(name, detail, start, TraceRecorder::now());
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Catalog.hpp"
+#include "LockSet.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @class Transaction
+ * @brief The private tables of a session between `begin` and `commit` or `rollback`.
+ *
+ * The first time a command of the transaction uses a table, the table is
+ * snapshotted into the transaction's workspace (see `Table::snapshot`). The
+ * workspace table shares the values of the live table until the transaction
+ * modifies it; only then are the modified columns copied (copy-on-write), so
+ * other sessions never see uncommitted changes and the live table is never
+ * copied as a whole.
+ *
+ * Next to each workspace table the transaction keeps a second, unmodified
+ * snapshot as the baseline. A workspace table that no longer shares its
+ * values with its baseline was modified by the transaction; a command that
+ * only read a table, or failed before changing it, leaves it unmodified.
+ * `commit` publishes the modified tables only if the live tables still share
+ * their values with the baselines, i.e. no other session changed them in the
+ * meantime (first committer wins). A rollback simply drops the workspace.
+ */
+class Transaction {
+private:
+    Catalog workspace;                  ///< The tables as the transaction sees them, including its own changes.
+    Catalog baselines;                  ///< Unmodified snapshots of the same tables, taken together with the workspace tables.
+
+    /**
+     * @brief Finds the workspace tables the transaction modified.
+     * @return The names of the workspace tables that no longer share their values with their baselines.
+     */
+    std::vector<std::string> findWrittenTables();
+
+public:
+    /**
+     * @brief Starts an empty transaction.
+     * @param catalogPath The path of the loaded catalog, kept by the workspace so that commands see the same path.
+     */
+    explicit Transaction(const std::string& catalogPath);
+
+    /**
+     * @brief Checks whether a table is already part of the transaction.
+     * @param name The name of the table.
+     * @return `true` if the workspace contains the table.
+     */
+    bool contains(const std::string& name);
+
+    /**
+     * @brief Adds a live table to the transaction.
+     *
+     * The caller must hold at least a shared lock on the table.
+     *
+     * @param live The live table. Only snapshotted; costs O(columns).
+     */
+    void addTable(const Table& live);
+
+    /**
+     * @brief Returns the tables the commands of the transaction work on.
+     * @return The workspace catalog.
+     */
+    Catalog& getWorkspace();
+
+    /**
+     * @brief Returns the number of tables the transaction modified.
+     * @return The number of written tables.
+     */
+    size_t getWrittenTableCount();
+
+    /**
+     * @brief Declares the locks `commit` needs: every modified table exclusively.
+     * @return The lock set; empty if the transaction modified nothing.
+     */
+    LockSet commitLocks();
+
+    /**
+     * @brief Publishes the modified tables to the live catalog, all or nothing.
+     *
+     * The caller must hold `commitLocks()`. Every modified table is checked
+     * first; only if none of them changed since the transaction read it are
+     * the live tables replaced by the workspace tables.
+     *
+     * @param live The live catalog.
+     * @throws std::runtime_error If a modified table was changed, renamed or closed by another session. Nothing is published.
+     */
+    void commit(Catalog& live);
+};
@@ -0,0 +1,117 @@
+#include "Transaction.hpp"
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Starts an empty transaction.
+ * @param catalogPath The path of the loaded catalog.
+ */
+Transaction::Transaction(const std::string& catalogPath)
+    : workspace(catalogPath), baselines(catalogPath) {
+}
+
+/**
+ * @brief Checks whether a table is already part of the transaction.
+ * @param name The name of the table.
+ * @return `true` if the workspace contains the table.
+ */
+bool Transaction::contains(const std::string& name) {
+    for (const Table& table : workspace) {
+        if (table.getName() == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Adds a live table to the transaction.
+ *
+ * The workspace table and the baseline are both snapshots of `live`, so
+ * neither copies any values.
+ *
+ * @param live The live table.
+ */
+void Transaction::addTable(const Table& live) {
+    workspace.addTable(live.snapshot());
+    baselines.addTable(live.snapshot());
+}
+
+/**
+ * @brief Finds the workspace tables the transaction modified.
+ *
+ * Every write to a workspace table copies the values it changes first, so a
+ * table that still shares its values with its baseline was not modified,
+ * whatever commands ran on it.
+ *
+ * @return The names of the modified workspace tables.
+ */
+std::vector<std::string> Transaction::findWrittenTables() {
+    std::vector<std::string> written;
+    for (const Table& table : workspace) {
+        if (!table.sharesValuesWith(baselines.returnTableByName(table.getName()))) {
+            written.push_back(table.getName());
+        }
+    }
+    return written;
+}
+
+/**
+ * @brief Returns the tables the commands of the transaction work on.
+ * @return The workspace catalog.
+ */
+Catalog& Transaction::getWorkspace() {
+    return workspace;
+}
+
+/**
+ * @brief Returns the number of tables the transaction modified.
+ * @return The number of written tables.
+ */
+size_t Transaction::getWrittenTableCount() {
+    return findWrittenTables().size();
+}
+
+/**
+ * @brief Declares the locks `commit` needs.
+ * @return Exclusive locks on all modified tables, which also hold the catalog shared.
+ */
+LockSet Transaction::commitLocks() {
+    LockSet locks;
+    for (const std::string& name : findWrittenTables()) {
+        locks.addTable(name, LockMode::EXCLUSIVE);
+    }
+    return locks;
+}
+
+/**
+ * @brief Publishes the modified tables to the live catalog, all or nothing.
+ *
+ * A live table that still shares its values with the baseline was not
+ * modified by anyone else: every write to it would have copied the shared
+ * values first. The workspace tables are moved into the live catalog, so
+ * publishing costs O(columns) per table; read snapshots taken before keep
+ * the old values alive until they end.
+ *
+ * @param live The live catalog.
+ * @throws std::runtime_error If a modified table changed since the transaction read it.
+ */
+void Transaction::commit(Catalog& live) {
+    std::vector<std::string> writtenTables = findWrittenTables();
+    for (const std::string& name : writtenTables) {
+        bool unchanged = false;
+        for (const Table& table : live) {
+            if (table.getName() == name) {
+                unchanged = table.sharesValuesWith(baselines.returnTableByName(name));
+                break;
+            }
+        }
+        if (!unchanged) {
+            throw std::runtime_error("Table " + name + " was changed by another session since the transaction read it. ");
+        }
+    }
+
+    for (const std::string& name : writtenTables) {
+        live.returnTableByName(name) = std::move(workspace.returnTableByName(name));
+    }
+}
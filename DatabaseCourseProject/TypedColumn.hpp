@@ -0,0 +1,568 @@
+#pragma once
+#include "TableColumn.hpp"
+#include "ColumnStatistics.hpp"
+#include "ColumnSegments.hpp"
+#include "Instrumentation.hpp"
+#include "ProfilePhase.hpp"
+#include "FormattedCells.hpp"
+#include <vector>
+#include <string>
+#include <mutex>
+#include <stdexcept>
+
+/**
+ * @struct ColumnTraits
+ * @brief Describes how a native type is stored in a `TypedColumn`.
+ *
+ * Every type used with `TypedColumn` specializes this template next to its
+ * column alias (see `IntegerColumn.hpp`) with the following static members:
+ * - `ColumnType type()`: the type tag returned by `getType()`.
+ * - `const char* className()`: the column class named in error messages, e.g. "IntegerColumn".
+ * - `const char* typeName()`: the name returned by `getTypeAsString()`, e.g. "Integer".
+ * - `const char* valueName()`: the value kind named in error messages, e.g. "integer".
+ * - `T parse(const std::string&)`: converts text to a value, throwing like `std::stoi` on bad input.
+ * - `void append(std::string&, T)`: appends the text form of a value to a string.
+ *
+ * @tparam T The native type of the cells.
+ */
+template <typename T>
+struct ColumnTraits;
+
+/**
+ * @class TypedColumn
+ * @brief Implementation of `TableColumn` for the numeric types, shared by all of them.
+ *
+ * The cells live in a `ColumnSegments<T>`, and every operation on them (scan,
+ * compare, append, delete, statistics and formatting) is written once here
+ * and compiled separately for each type, so the loops over the cells work on
+ * `T` directly and inline completely. `TableColumn` remains the adapter used
+ * by the commands, which exchange values as strings; the only per-type code
+ * is the `ColumnTraits<T>` specialization converting between the two. Bulk
+ * operations cost one virtual call per column, e.g. `appendValues` formats a
+ * whole block of cells for a writer.
+ *
+ * A new numeric column type therefore costs a traits specialization, an
+ * alias and an explicit instantiation (see `IntegerColumn.hpp` and
+ * `IntegerColumnImpl.cpp`), plus its `ColumnType` and a case in `ColumnFactory`.
+ *
+ * NULL cells hold `T()` as their value and are marked in the validity bitmap
+ * of their segment.
+ *
+ * @tparam T The native type of the cells. Must be arithmetic, for the zone maps and statistics.
+ */
+template <typename T>
+class TypedColumn : public TableColumn {
+private:
+    typedef ColumnTraits<T> Traits;
+
+    ColumnSegments<T> cells;             ///< The values and NULL flags in 64K-row segments, shared with copies and snapshots segment by segment.
+    std::string name;                    ///< The name of this column.
+    mutable ColumnStatistics statistics; ///< Statistics of the values, rebuilt lazily by `getStatistics()` when stale.
+    mutable std::mutex statisticsMutex;  ///< Serializes the lazy rebuild of `statistics` between concurrent readers.
+
+    /**
+     * @brief Builds the message of an out-of-bounds index.
+     * @param index The rejected index.
+     * @return The message.
+     */
+    std::string invalidIndexMessage(int index) const {
+        return "Invalid index " + std::to_string(index) + " for " + Traits::className() + " '" + name
+            + "'. Column size is " + std::to_string(cells.size()) + ".";
+    }
+
+    /**
+     * @brief Throws if `index` is not a valid row of the column.
+     * @param index The index to check.
+     * @throws std::runtime_error If the index is out of the column's bounds.
+     */
+    void checkIndex(int index) const {
+        if (index < 0 || index >= cells.size()) {
+            throw std::runtime_error(invalidIndexMessage(index));
+        }
+    }
+
+    /**
+     * @brief Records the cells of a segment in the statistics.
+     * @param segment The segment whose cells are added.
+     * @param values Receives the non-NULL values for the histogram, or `nullptr`.
+     */
+    void addToStatistics(const typename ColumnSegments<T>::Segment& segment, std::vector<double>* values) const {
+        for (int i = 0; i < segment.size(); ++i) {
+            if (segment.nullCount > 0 && segment.validity.isNull(i)) {
+                statistics.addNull();
+            }
+            else {
+                statistics.addNumber(segment.values[i]);
+                if (values != nullptr) {
+                    values->push_back(static_cast<double>(segment.values[i]));
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an empty column with a specified name.
+     * @param name The name to assign to this column.
+     */
+    TypedColumn(std::string name)
+        : name(name), statistics(Traits::type()) {
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * The copy shares the values and NULL flags with `other` instead of copying
+     * them, so it costs O(segments) regardless of the number of rows. A write to
+     * either column copies only the segment it touches (see `ColumnSegments`), so
+     * the copy still behaves like an independent deep copy.
+     *
+     * @param other The column to copy from.
+     */
+    TypedColumn(const TypedColumn& other)
+        : cells(other.cells),
+        name(other.name),
+        statistics(Traits::type())
+    {
+        std::lock_guard<std::mutex> lock(other.statisticsMutex);
+        statistics = other.statistics;
+    }
+
+    /**
+     * @brief Copy assignment operator.
+     *
+     * Shares the values and NULL flags of `other` like the copy constructor.
+     * Replaced segments stay alive while a snapshot still holds them.
+     * Self-assignment is a no-op.
+     *
+     * @param other The column to assign from.
+     * @return A reference to this column.
+     */
+    TypedColumn& operator=(const TypedColumn& other) {
+        if (this != &other) {
+            cells = other.cells;
+            name = other.name;
+
+            std::lock_guard<std::mutex> lock(other.statisticsMutex);
+            statistics = other.statistics;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Retrieves the name of the column.
+     * @return The name of the column.
+     */
+    std::string getName() const override {
+        return name;
+    }
+
+    /**
+     * @brief Retrieves the data type of the column.
+     * @return The type tag of `T`, e.g. `ColumnType::INTEGER`.
+     */
+    ColumnType getType() const override {
+        return Traits::type();
+    }
+
+    /**
+     * @brief Retrieves the segments holding the cells of the column.
+     * @return A constant reference to the segmented storage of the values and NULL flags.
+     * @note Batch kernels scan the column piece by piece through it, without virtual calls per cell.
+     */
+    const ColumnSegments<T>& getSegments() const {
+        return cells;
+    }
+
+    /**
+     * @brief Retrieves the value of a cell.
+     * @param index The 0-indexed position of the cell.
+     * @return The value of the cell.
+     * @throws std::runtime_error If the `index` is out of the column's bounds or the cell is NULL.
+     * @note This method is not part of the `TableColumn` interface.
+     */
+    T getValueAtGivenIndex(int index) const {
+        checkIndex(index);
+        if (cells.isNull(index)) {
+            throw std::runtime_error("Value at index " + std::to_string(index) + " in " + Traits::className()
+                + " '" + name + "' is NULL.");
+        }
+        return cells.value(index);
+    }
+
+    /**
+     * @brief Changes the value of a cell.
+     *
+     * `val` is converted with `ColumnTraits<T>::parse`. An empty string makes
+     * the cell NULL.
+     *
+     * @param index The 0-indexed position of the cell to modify.
+     * @param val The new value, as text. An empty string `""` implies NULL.
+     * @throws std::runtime_error If the `index` is out of bounds or `val` is not a valid value of the column's type.
+     */
+    void changeValueAtIndex(int index, std::string val) override {
+        checkIndex(index);
+
+        bool wasNull = cells.isNull(index);
+
+        if (val.empty()) {
+            cells.set(index, T(), true);
+        }
+        else {
+            try {
+                cells.set(index, Traits::parse(val), false);
+            }
+            catch (const std::exception& e) {
+                throw std::runtime_error("Error changing value at index " + std::to_string(index) + " in " + Traits::className()
+                    + " '" + name + "': Provided value '" + val + "' is not a valid " + Traits::valueName()
+                    + ". Original error: " + e.what());
+            }
+        }
+
+        statistics.remove(wasNull);
+        if (cells.isNull(index)) {
+            statistics.addNull();
+        }
+        else {
+            statistics.addNumber(cells.value(index));
+        }
+    }
+
+    /**
+     * @brief Adds a new cell to the end of the column.
+     * @param cell The value, as text. An empty string `""` implies NULL.
+     * @throws std::runtime_error If `cell` is not a valid value of the column's type.
+     */
+    void addCell(std::string cell) override {
+        if (cell.empty()) {
+            appendValue(T(), true);
+            return;
+        }
+
+        T value;
+        try {
+            value = Traits::parse(cell);
+        }
+        catch (const std::exception& e) {
+            throw std::runtime_error("Error adding cell to " + std::string(Traits::className()) + " '" + name
+                + "': Provided value '" + cell + "' is not a valid " + Traits::valueName()
+                + ". Original error: " + e.what());
+        }
+        appendValue(value, false);
+    }
+
+    /**
+     * @brief Adds a new cell given in the native type to the end of the column.
+     *
+     * Producers that already hold typed values (`generate`) append them here
+     * instead of formatting them for `addCell` to parse them again.
+     *
+     * @param value The value; ignored if `null` is `true`.
+     * @param null `true` to add a NULL cell.
+     */
+    void appendValue(T value, bool null) {
+        if (null) {
+            cells.push_back(T(), true);
+            statistics.addNull();
+            return;
+        }
+        cells.push_back(value, false);
+        statistics.addNumber(value);
+    }
+
+    /**
+     * @brief Deletes a cell. Only the cells after it in the same segment are shifted.
+     * @param index The 0-indexed position of the cell to delete.
+     * @throws std::runtime_error If the `index` is out of the column's bounds.
+     */
+    void deleteCell(int index) override {
+        checkIndex(index);
+
+        statistics.remove(cells.isNull(index));
+        cells.erase(index);
+    }
+
+    /**
+     * @brief Returns the number of cells in the column.
+     * @return The size of the column.
+     */
+    int getSize() override {
+        return cells.size();
+    }
+
+    /**
+     * @brief Retrieves the value of a cell formatted with `ColumnTraits<T>::append`.
+     *
+     * The NULL flag is only looked up when the column holds NULL cells.
+     *
+     * @param index The 0-indexed position of the cell.
+     * @return The value as text, or `""` if the cell is NULL.
+     * @throws std::runtime_error If the `index` is out of the column's bounds.
+     */
+    std::string returnValueAtGivenIndexAsString(int index) const override {
+        checkIndex(index);
+
+        std::string text;
+        if (cells.hasNoNulls() || !cells.isNull(index)) {
+            Traits::append(text, cells.value(index));
+        }
+        return text;
+    }
+
+    /**
+     * @brief Formats the cells of [begin, end) and adds them to `out`.
+     *
+     * The range is walked segment by segment; segments without NULL cells
+     * skip the NULL flags. Every value is formatted straight into the shared
+     * buffer of `out`, without a temporary string.
+     *
+     * @param begin First row of the range.
+     * @param end One past the last row of the range.
+     * @param out Receives one cell per row, empty for NULL.
+     * @throws std::runtime_error If the range is not within the column's bounds.
+     */
+    void appendValues(int begin, int end, FormattedCells& out) const override {
+        if (begin < 0 || begin > end || end > cells.size()) {
+            throw std::runtime_error(invalidIndexMessage(begin < 0 || begin > end ? begin : end));
+        }
+
+        cells.forEachPiece(begin, end, [&out](const typename ColumnSegments<T>::Segment& segment, int offset, int count) {
+            std::string& text = out.buffer();
+            for (int i = offset; i < offset + count; ++i) {
+                if (segment.nullCount == 0 || !segment.validity.isNull(i)) {
+                    Traits::append(text, segment.values[i]);
+                }
+                out.endCell();
+            }
+        });
+    }
+
+    /**
+     * @brief Retrieves the name of the column's type.
+     * @return The type name, e.g. "Integer".
+     */
+    std::string getTypeAsString() const override {
+        return Traits::typeName();
+    }
+
+    /**
+     * @brief Checks if a cell matches a value given as text.
+     *
+     * A NULL cell matches only the empty string. Otherwise `value` is parsed
+     * and compared numerically; a value that does not parse matches nothing.
+     *
+     * @param rowIndex The 0-indexed position of the cell.
+     * @param value The value to match. An empty string `""` matches NULL.
+     * @return `true` if the cell matches.
+     * @throws std::runtime_error If the `rowIndex` is out of the column's bounds.
+     */
+    bool matchesValues(int rowIndex, const std::string& value) const override {
+        checkIndex(rowIndex);
+
+        if (cells.isNull(rowIndex)) {
+            return value.empty();
+        }
+        try {
+            return cells.value(rowIndex) == Traits::parse(value);
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Compares the values of two cells. NULL cells order first.
+     * @param leftRow The 0-indexed position of the first cell.
+     * @param rightRow The 0-indexed position of the second cell.
+     * @return A negative value, 0 or a positive value if the first cell orders before, equal to or after the second.
+     * @throws std::runtime_error If either index is out of the column's bounds.
+     */
+    int compareValues(int leftRow, int rightRow) const override {
+        if (leftRow < 0 || leftRow >= cells.size() || rightRow < 0 || rightRow >= cells.size()) {
+            throw std::runtime_error("Invalid index for " + std::string(Traits::className()) + " '" + name
+                + "'. Column size is " + std::to_string(cells.size()) + ".");
+        }
+
+        bool leftNull = cells.isNull(leftRow);
+        bool rightNull = cells.isNull(rightRow);
+        if (leftNull || rightNull) {
+            return (leftNull ? 0 : 1) - (rightNull ? 0 : 1);
+        }
+
+        const T& left = cells.value(leftRow);
+        const T& right = cells.value(rightRow);
+        if (left < right) {
+            return -1;
+        }
+        return right < left ? 1 : 0;
+    }
+
+    /**
+     * @brief Returns the statistics of the column, rebuilding them first if they are stale.
+     *
+     * A rebuild feeds every cell into freshly cleared statistics and collects
+     * the non-NULL values for the histogram. It runs under `statisticsMutex`,
+     * since several readers holding a shared table lock may ask at the same time,
+     * and is charged to the `statistics` phase of an active profile.
+     *
+     * @return The up-to-date statistics.
+     */
+    const ColumnStatistics& getStatistics() const override {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        if (statistics.isStale()) {
+            ProfilePhase phase("statistics");
+            std::vector<double> values;
+            values.reserve(cells.size());
+
+            statistics.clear();
+            for (int s = 0; s < cells.segmentCount(); ++s) {
+                addToStatistics(cells.segment(s), &values);
+            }
+            statistics.finishBuild(values);
+        }
+        return statistics;
+    }
+
+    /**
+     * @brief Completes the statistics of a freshly filled column with the histogram of its values.
+     *
+     * Unlike a rebuild in `getStatistics()`, the cells are not fed into the
+     * statistics again; only the non-NULL values are collected for the histogram.
+     */
+    void finishStatistics() override {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+
+        std::vector<double> values;
+        values.reserve(cells.size());
+        cells.forEachPiece(0, cells.size(), [&values](const typename ColumnSegments<T>::Segment& segment, int offset, int count) {
+            for (int i = offset; i < offset + count; ++i) {
+                if (segment.nullCount == 0 || !segment.validity.isNull(i)) {
+                    values.push_back(static_cast<double>(segment.values[i]));
+                }
+            }
+        });
+        statistics.finishBuild(std::move(values));
+    }
+
+    /**
+     * @brief Tells whether the column holds no NULL cell, from the NULL count kept by the segments.
+     * @return `true` if no cell of the column is NULL.
+     */
+    bool hasNoNulls() const override {
+        return cells.hasNoNulls();
+    }
+
+    /**
+     * @brief Appends `size` NULL cells, filling the NULL flags a word at a time.
+     * @param size The number of NULL cells to add.
+     */
+    void fillColumnWithNULL(int size) override {
+        if (size <= 0) {
+            return;
+        }
+        cells.appendNulls(size);
+        statistics.addNulls(size);
+    }
+
+    /**
+     * @brief Reserves storage for at least `capacity` cells.
+     * @param capacity The number of cells the column should be able to hold without reallocating.
+     */
+    void reserve(int capacity) override {
+        cells.reserve(capacity);
+    }
+
+    /**
+     * @brief Moves all cells of another column of the same type to the end of this column.
+     *
+     * The storage is reserved first, so a failing allocation leaves the column
+     * unchanged. The statistics are updated incrementally with the appended cells.
+     *
+     * @param staged The column whose cells are appended. It is left empty.
+     * @throws std::runtime_error If `staged` is of another type or is this column.
+     */
+    void appendColumn(TableColumn& staged) override {
+        if (staged.getType() != Traits::type() || &staged == this) {
+            throw std::runtime_error("Cannot append column '" + staged.getName() + "' of type " + staged.getTypeAsString()
+                + " to " + Traits::className() + " '" + name + "'. ");
+        }
+        TypedColumn* other = static_cast<TypedColumn*>(&staged);
+
+        reserve(cells.size() + other->cells.size());
+
+        for (int s = 0; s < other->cells.segmentCount(); ++s) {
+            addToStatistics(other->cells.segment(s), nullptr);
+        }
+        cells.append(other->cells);
+        other->statistics.clear();
+    }
+
+    /**
+     * @brief Creates a column holding the cells of this column in the order of `order`.
+     *
+     * The NULL flags are only looked up when the column holds NULL cells.
+     *
+     * @param order The rows of this column in their new order; every row appears exactly once.
+     * @return A pointer to a newly allocated column with the reordered values and the same statistics.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    TableColumn* permute(const std::vector<int>& order) const override {
+        TypedColumn* copy = new TypedColumn(name);
+        copy->cells.reserve(static_cast<int>(order.size()));
+
+        bool noNulls = cells.hasNoNulls();
+        for (int row : order) {
+            copy->cells.push_back(cells.value(row), !noNulls && cells.isNull(row));
+        }
+
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        copy->statistics = statistics;
+        return copy;
+    }
+
+    /**
+     * @brief Creates a column that shares the current version of the values.
+     *
+     * The statistics are brought up to date on this column first, so that the
+     * snapshot does not rebuild them again for every reader.
+     *
+     * @return A pointer to a newly allocated column sharing the values.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    TableColumn* snapshot() const override {
+        getStatistics();
+
+        TypedColumn* copy = new TypedColumn(name);
+        copy->cells = cells;
+
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        copy->statistics = statistics;
+        return copy;
+    }
+
+    /**
+     * @brief Checks whether another column shares the current values of this column.
+     *
+     * Compares the versions themselves, not the values: two columns with equal
+     * but separately stored values do not share them.
+     *
+     * @param other The column to compare with.
+     * @return `true` if both columns point to the same values and NULL flags.
+     */
+    bool sharesValuesWith(const TableColumn& other) const override {
+        if (other.getType() != Traits::type()) {
+            return false;
+        }
+        return static_cast<const TypedColumn&>(other).cells.sharesWith(cells);
+    }
+
+    /**
+     * @brief Creates a copy that shares the values with this column until either is modified.
+     * @return A pointer to a newly allocated column.
+     * @warning The caller is responsible for `delete`ing the returned pointer.
+     */
+    TableColumn* clone() const override {
+        Instrumentation::recordColumnClones(1);
+        return new TypedColumn(*this);
+    }
+};
@@ -0,0 +1,234 @@
+#pragma once
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class ValidityBitmap
+ * @brief The NULL flags of a run of cells, one bit per cell packed into 64-bit words.
+ *
+ * Bit `i` is set if cell `i` holds a value and cleared if it is NULL. Unlike
+ * `std::vector<bool>` the words are exposed, so a scan combines the flags of
+ * 64 cells with its predicate results in one operation, NULL counts are
+ * popcounts, and runs of NULL cells are appended a word at a time. Bits
+ * beyond `size()` are always kept at zero.
+ */
+class ValidityBitmap {
+public:
+    /// Number of bits per storage word.
+    static const int WORD_BITS = 64;
+
+private:
+    std::vector<uint64_t> words; ///< The bits, 64 per word, lowest bit first.
+    int bitCount;                ///< The number of valid bits.
+
+    /**
+     * @brief Returns the number of words needed for `bits` bits.
+     * @param bits The number of bits.
+     * @return The word count.
+     */
+    static size_t wordsFor(int bits) {
+        return static_cast<size_t>((bits + WORD_BITS - 1) / WORD_BITS);
+    }
+
+    /**
+     * @brief Returns a word with the lowest `count` bits set.
+     * @param count The number of bits, in [0, 64].
+     * @return The mask.
+     */
+    static uint64_t lowBits(int count) {
+        return count >= WORD_BITS ? ~uint64_t(0) : (uint64_t(1) << count) - 1;
+    }
+
+    /**
+     * @brief Counts the set bits of a word.
+     * @param word The word.
+     * @return The number of set bits.
+     */
+    static int popcount(uint64_t word) {
+        return static_cast<int>(std::bitset<WORD_BITS>(word).count());
+    }
+
+public:
+    /**
+     * @brief Constructs an empty bitmap.
+     */
+    ValidityBitmap()
+        : bitCount(0) {
+    }
+
+    /**
+     * @brief Returns the number of cells.
+     * @return The number of bits.
+     */
+    int size() const {
+        return bitCount;
+    }
+
+    /**
+     * @brief Tells whether a cell is NULL.
+     * @param index A valid cell index.
+     * @return `true` if the bit of the cell is cleared.
+     */
+    bool isNull(int index) const {
+        return ((words[index / WORD_BITS] >> (index % WORD_BITS)) & 1) == 0;
+    }
+
+    /**
+     * @brief Changes the flag of a cell.
+     * @param index A valid cell index.
+     * @param null Whether the cell becomes NULL.
+     */
+    void set(int index, bool null) {
+        uint64_t mask = uint64_t(1) << (index % WORD_BITS);
+        if (null) {
+            words[index / WORD_BITS] &= ~mask;
+        }
+        else {
+            words[index / WORD_BITS] |= mask;
+        }
+    }
+
+    /**
+     * @brief Appends the flag of one cell.
+     * @param null Whether the cell is NULL.
+     */
+    void push_back(bool null) {
+        if (bitCount % WORD_BITS == 0) {
+            words.push_back(0);
+        }
+        if (!null) {
+            words.back() |= uint64_t(1) << (bitCount % WORD_BITS);
+        }
+        ++bitCount;
+    }
+
+    /**
+     * @brief Appends `count` cells with the same flag, filling whole words at once.
+     * @param null Whether the cells are NULL.
+     * @param count The number of cells.
+     */
+    void append(bool null, int count) {
+        if (count <= 0) {
+            return;
+        }
+
+        words.resize(wordsFor(bitCount + count), 0);
+        if (!null) {
+            int begin = bitCount;
+            int end = bitCount + count;
+            while (begin < end) {
+                int take = std::min(end - begin, WORD_BITS - begin % WORD_BITS);
+                words[begin / WORD_BITS] |= lowBits(take) << (begin % WORD_BITS);
+                begin += take;
+            }
+        }
+        bitCount += count;
+    }
+
+    /**
+     * @brief Appends the flags of the cells [from, from + count) of another bitmap.
+     * @param source The bitmap to copy from. Must not be this bitmap.
+     * @param from The first cell of `source` to copy.
+     * @param count The number of cells.
+     */
+    void append(const ValidityBitmap& source, int from, int count) {
+        if (count <= 0) {
+            return;
+        }
+
+        words.resize(wordsFor(bitCount + count), 0);
+        for (int copied = 0; copied < count;) {
+            int take = std::min(count - copied, WORD_BITS - bitCount % WORD_BITS);
+            words[bitCount / WORD_BITS] |= source.extract(from + copied, take) << (bitCount % WORD_BITS);
+            bitCount += take;
+            copied += take;
+        }
+    }
+
+    /**
+     * @brief Returns the flags of up to 64 consecutive cells as one word.
+     * @param from The first cell.
+     * @param count The number of cells, in [1, 64]; `from + count` must not exceed `size()`.
+     * @return The bits of the cells, the flag of `from` in bit 0; higher bits are zero.
+     */
+    uint64_t extract(int from, int count) const {
+        int word = from / WORD_BITS;
+        int shift = from % WORD_BITS;
+
+        uint64_t bits = words[word] >> shift;
+        if (shift != 0 && shift + count > WORD_BITS) {
+            bits |= words[word + 1] << (WORD_BITS - shift);
+        }
+        return bits & lowBits(count);
+    }
+
+    /**
+     * @brief Returns the NULL cells among up to 64 consecutive cells as one word.
+     * @param from The first cell.
+     * @param count The number of cells, in [1, 64]; `from + count` must not exceed `size()`.
+     * @return A word with a set bit for every NULL cell, the cell `from` in bit 0; higher bits are zero.
+     */
+    uint64_t extractNulls(int from, int count) const {
+        return ~extract(from, count) & lowBits(count);
+    }
+
+    /**
+     * @brief Removes the flag of a cell, moving the flags after it down by one.
+     * @param index A valid cell index.
+     */
+    void erase(int index) {
+        size_t word = index / WORD_BITS;
+        int bit = index % WORD_BITS;
+
+        uint64_t below = words[word] & lowBits(bit);
+        uint64_t above = bit == WORD_BITS - 1 ? 0 : (words[word] >> (bit + 1)) << bit;
+        words[word] = below | above;
+        for (size_t i = word; i + 1 < words.size(); ++i) {
+            words[i] |= (words[i + 1] & 1) << (WORD_BITS - 1);
+            words[i + 1] >>= 1;
+        }
+
+        --bitCount;
+        if (words.size() > wordsFor(bitCount)) {
+            words.pop_back();
+        }
+    }
+
+    /**
+     * @brief Counts the NULL cells of [from, from + count) with one popcount per word.
+     * @param from The first cell.
+     * @param count The number of cells.
+     * @return The number of NULL cells.
+     */
+    int countNulls(int from, int count) const {
+        int valid = 0;
+        for (int counted = 0; counted < count;) {
+            int take = std::min(count - counted, WORD_BITS);
+            valid += popcount(extract(from + counted, take));
+            counted += take;
+        }
+        return count - valid;
+    }
+
+    /**
+     * @brief Counts all NULL cells with one popcount per word.
+     * @return The number of NULL cells.
+     */
+    int countNulls() const {
+        int valid = 0;
+        for (uint64_t word : words) {
+            valid += popcount(word);
+        }
+        return bitCount - valid;
+    }
+
+    /**
+     * @brief Allocates the words for `capacity` cells.
+     * @param capacity The number of cells the bitmap should hold without allocating.
+     */
+    void reserve(int capacity) {
+        words.reserve(wordsFor(capacity));
+    }
+};
@@ -0,0 +1,4 @@
+#include "ValidityBitmap.hpp"
+
+/// Definition of the word size, needed where it is bound to a reference, e.g. by `std::min` in `countNulls`.
+const int ValidityBitmap::WORD_BITS;
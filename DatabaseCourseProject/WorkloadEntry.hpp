@@ -0,0 +1,16 @@
+#pragma once
+#include <string>
+
+/**
+ * @struct WorkloadEntry
+ * @brief One command of a captured workload.
+ *
+ * Workload files are written by `WorkloadRecorder` and read by
+ * `InputFileReader::readWorkloadFromFile`. Every entry is one line of the form
+ * `<offset in microseconds>\t<session>\t<command line>`; lines starting with `#` are comments.
+ */
+struct WorkloadEntry {
+    long long offsetMicroseconds; ///< Time since the capture started when the command was dispatched.
+    int sessionNumber;            ///< The server session that dispatched the command, 0 for the console session.
+    std::string commandLine;      ///< The command as typed, parsable by `CommandParser::parseRawCommand`.
+};
@@ -0,0 +1,75 @@
+#pragma once
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @class WorkloadRecorder
+ * @brief Captures the commands dispatched by the `Engine` into a workload file.
+ *
+ * Each dispatched command is appended as one `WorkloadEntry` line with its
+ * offset from the start of the capture and the session that dispatched it,
+ * and flushed immediately so a crashed
+ * session still leaves a usable workload. The file can be re-executed with
+ * `Engine::replay` (see the `--replay` startup option).
+ */
+class WorkloadRecorder {
+private:
+    std::ofstream file;                           ///< The workload file, open while recording.
+    std::chrono::steady_clock::time_point start;  ///< Time the capture started.
+    mutable std::mutex fileMutex;                 ///< Serializes the commands recorded by concurrent server sessions.
+
+public:
+    /**
+     * @brief Creates a recorder that is not recording.
+     */
+    WorkloadRecorder();
+
+    /**
+     * @brief Deleted copy constructor; a workload file has a single writer.
+     */
+    WorkloadRecorder(const WorkloadRecorder& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; a workload file has a single writer.
+     */
+    WorkloadRecorder& operator=(const WorkloadRecorder& other) = delete;
+
+    /**
+     * @brief Starts a capture, replacing the content of `filepath`.
+     * @param filepath The workload file.
+     * @throws std::runtime_error If the file cannot be opened for writing.
+     */
+    void open(const std::string& filepath);
+
+    /**
+     * @brief Checks whether commands are captured.
+     * @return `true` between `open` and `close`.
+     */
+    bool isRecording() const;
+
+    /**
+     * @brief Appends a dispatched command to the workload.
+     * @param params The parsed command, as passed to `Engine::dispatchCommand`.
+     * @param sessionNumber The session that dispatched it (see `CommandContext::sessionNumber`).
+     */
+    void record(const std::vector<std::string>& params, int sessionNumber);
+
+    /**
+     * @brief Ends the capture and closes the file.
+     */
+    void close();
+
+    /**
+     * @brief Turns parsed parameters back into a command line.
+     *
+     * Parameters that are empty or contain spaces are enclosed in double
+     * quotes, so `CommandParser::parseRawCommand` yields the same parameters again.
+     *
+     * @param params The parsed command.
+     * @return The command line.
+     */
+    static std::string formatCommandLine(const std::vector<std::string>& params);
+};
@@ -0,0 +1,95 @@
+#include "WorkloadRecorder.hpp"
+#include <ctime>
+#include <stdexcept>
+
+/**
+ * @brief Creates a recorder that is not recording.
+ */
+WorkloadRecorder::WorkloadRecorder()
+    : start(std::chrono::steady_clock::now()) {
+}
+
+/**
+ * @brief Starts a capture, replacing the content of `filepath`.
+ *
+ * The file starts with a comment line naming the format and the wall-clock
+ * time of the capture.
+ *
+ * @param filepath The workload file.
+ * @throws std::runtime_error If the file cannot be opened for writing.
+ */
+void WorkloadRecorder::open(const std::string& filepath) {
+    close();
+
+    file.open(filepath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open file: " + filepath);
+    }
+
+    start = std::chrono::steady_clock::now();
+    file << "# dbcp workload v2, captured at unix time " << static_cast<long long>(std::time(nullptr)) << "\n";
+    file.flush();
+}
+
+/**
+ * @brief Checks whether commands are captured.
+ * @return `true` between `open` and `close`.
+ */
+bool WorkloadRecorder::isRecording() const {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    return file.is_open();
+}
+
+/**
+ * @brief Appends a dispatched command to the workload and flushes the file.
+ *
+ * Safe to call from several server sessions at once; each command is written
+ * as one whole line tagged with its session, so a replay can keep the
+ * transactions of the sessions apart.
+ *
+ * @param params The parsed command.
+ * @param sessionNumber The session that dispatched it.
+ */
+void WorkloadRecorder::record(const std::vector<std::string>& params, int sessionNumber) {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (!file.is_open()) {
+        return;
+    }
+
+    long long offset = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    file << offset << '\t' << sessionNumber << '\t' << formatCommandLine(params) << "\n";
+    file.flush();
+}
+
+/**
+ * @brief Ends the capture and closes the file.
+ */
+void WorkloadRecorder::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+/**
+ * @brief Turns parsed parameters back into a command line.
+ * @param params The parsed command.
+ * @return The command line.
+ */
+std::string WorkloadRecorder::formatCommandLine(const std::vector<std::string>& params) {
+    std::string line;
+
+    for (size_t i = 0; i < params.size(); ++i) {
+        const std::string& param = params[i];
+        if (i > 0) {
+            line += ' ';
+        }
+        if (param.empty() || param.find(' ') != std::string::npos) {
+            line += '"' + param + '"';
+        }
+        else {
+            line += param;
+        }
+    }
+    return line;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+
+/**
+ * @class Benchmark
+ * @brief Abstract base class of a single measured operation.
+ *
+ * The `BenchmarkRunner` calls `setUp()`, `run()` and `tearDown()` once per
+ * repetition and only times `run()`, so preparing data (building a column,
+ * writing an input file) does not distort the measurement.
+ */
+class Benchmark {
+public:
+    /**
+     * @brief Virtual destructor to ensure proper cleanup of derived benchmarks.
+     */
+    virtual ~Benchmark() = default;
+
+    /**
+     * @brief Returns the unique name of the benchmark, e.g. `column/Integer/addCell/100000`.
+     * @return The name used in the report and by `--filter`.
+     */
+    virtual std::string getName() const = 0;
+
+    /**
+     * @brief Prepares one repetition. Not timed.
+     */
+    virtual void setUp() {}
+
+    /**
+     * @brief Executes the measured operation once.
+     */
+    virtual void run() = 0;
+
+    /**
+     * @brief Cleans up after one repetition. Not timed.
+     */
+    virtual void tearDown() {}
+
+    /**
+     * @brief Returns the number of rows or cells processed by one `run()`.
+     * @return The item count used for the rows/s rate.
+     */
+    virtual long long getItemsProcessed() const = 0;
+
+    /**
+     * @brief Returns the number of bytes processed by one `run()`.
+     * @return The byte count used for the MB/s rate, or 0 if the rate is not meaningful.
+     */
+    virtual long long getBytesProcessed() const { return 0; }
+};
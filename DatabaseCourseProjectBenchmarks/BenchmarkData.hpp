@@ -0,0 +1,51 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Table.hpp"
+
+/**
+ * @class BenchmarkData
+ * @brief A static utility class that generates deterministic data for the benchmarks.
+ *
+ * All generators use a fixed seed, so every run measures the same data.
+ */
+class BenchmarkData {
+public:
+    /**
+     * @brief Generates cell values of one column type.
+     *
+     * Integers are uniform in [0, 1000000), doubles uniform in [0, 10000) with
+     * two decimals, strings are `name_<n>` with 10000 distinct values.
+     *
+     * @param type The column type: `Integer`, `Double` or `String`.
+     * @param count Number of values.
+     * @return The values as they would be passed to `TableColumn::addCell`.
+     * @throws std::runtime_error If the type is not supported.
+     */
+    static std::vector<std::string> makeValues(const std::string& type, int count);
+
+    /**
+     * @brief Builds the fact table used by the file and query benchmarks.
+     *
+     * Columns: `id` (Integer, 0..rows-1), `key` (Integer, uniform in
+     * [0, keyCount)), `value` (Integer, uniform in [0, 1000), so `value < n`
+     * selects n/1000 of the rows), `amount` (Double) and `name` (String).
+     *
+     * @param name The table name.
+     * @param rows Number of rows.
+     * @param keyCount Number of distinct join and grouping keys.
+     * @return The table, with `name + ".csv"` as its file.
+     */
+    static Table makeFactTable(const std::string& name, int rows, int keyCount);
+
+    /**
+     * @brief Builds the dimension table joined with the fact table.
+     *
+     * Columns: `key` (Integer, 0..keyCount-1) and `label` (String).
+     *
+     * @param name The table name.
+     * @param keyCount Number of rows, one per key.
+     * @return The table, with `name + ".csv"` as its file.
+     */
+    static Table makeDimensionTable(const std::string& name, int keyCount);
+};
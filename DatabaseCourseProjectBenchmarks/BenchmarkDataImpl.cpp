@@ -0,0 +1,107 @@
+#include "BenchmarkData.hpp"
+#include "ColumnFactory.hpp"
+#include <random>
+#include <stdexcept>
+#include <cstdio>
+
+namespace {
+    /// Seed of all generators, so that every run uses identical data.
+    const unsigned int SEED = 20240601;
+
+    /**
+     * @brief Formats a double with two decimals.
+     * @param value The value.
+     * @return The formatted value.
+     */
+    std::string formatDouble(double value) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.2f", value);
+        return buffer;
+    }
+}
+
+/**
+ * @brief Generates cell values of one column type.
+ * @param type The column type: `Integer`, `Double` or `String`.
+ * @param count Number of values.
+ * @return The values as they would be passed to `TableColumn::addCell`.
+ * @throws std::runtime_error If the type is not supported.
+ */
+std::vector<std::string> BenchmarkData::makeValues(const std::string& type, int count) {
+    std::mt19937 random(SEED);
+    std::vector<std::string> values;
+    values.reserve(count);
+
+    if (type == "Integer") {
+        std::uniform_int_distribution<int> distribution(0, 999999);
+        for (int i = 0; i < count; ++i) {
+            values.push_back(std::to_string(distribution(random)));
+        }
+    }
+    else if (type == "Double") {
+        std::uniform_real_distribution<double> distribution(0.0, 10000.0);
+        for (int i = 0; i < count; ++i) {
+            values.push_back(formatDouble(distribution(random)));
+        }
+    }
+    else if (type == "String") {
+        std::uniform_int_distribution<int> distribution(0, 9999);
+        for (int i = 0; i < count; ++i) {
+            values.push_back("name_" + std::to_string(distribution(random)));
+        }
+    }
+    else {
+        throw std::runtime_error("Unsupported column type: " + type);
+    }
+    return values;
+}
+
+/**
+ * @brief Builds the fact table used by the file and query benchmarks.
+ * @param name The table name.
+ * @param rows Number of rows.
+ * @param keyCount Number of distinct join and grouping keys.
+ * @return The table, with `name + ".csv"` as its file.
+ */
+Table BenchmarkData::makeFactTable(const std::string& name, int rows, int keyCount) {
+    std::mt19937 random(SEED);
+    std::uniform_int_distribution<int> keys(0, keyCount - 1);
+    std::uniform_int_distribution<int> values(0, 999);
+    std::uniform_real_distribution<double> amounts(0.0, 10000.0);
+
+    std::vector<TableColumn*> columns;
+    columns.push_back(ColumnFactory::makeColumn("id", "Integer"));
+    columns.push_back(ColumnFactory::makeColumn("key", "Integer"));
+    columns.push_back(ColumnFactory::makeColumn("value", "Integer"));
+    columns.push_back(ColumnFactory::makeColumn("amount", "Double"));
+    columns.push_back(ColumnFactory::makeColumn("name", "String"));
+
+    for (int i = 0; i < rows; ++i) {
+        columns[0]->addCell(std::to_string(i));
+        columns[1]->addCell(std::to_string(keys(random)));
+        columns[2]->addCell(std::to_string(values(random)));
+        columns[3]->addCell(formatDouble(amounts(random)));
+        columns[4]->addCell("name_" + std::to_string(i % 10000));
+    }
+
+    return Table(columns, name, name + ".csv");
+}
+
+/**
+ * @brief Builds the dimension table joined with the fact table.
+ * @param name The table name.
+ * @param keyCount Number of rows, one per key.
+ * @return The table, with `name + ".csv"` as its file.
+ */
+Table BenchmarkData::makeDimensionTable(const std::string& name, int keyCount) {
+    std::vector<TableColumn*> columns;
+    columns.push_back(ColumnFactory::makeColumn("key", "Integer"));
+    columns.push_back(ColumnFactory::makeColumn("label", "String"));
+
+    for (int i = 0; i < keyCount; ++i) {
+        columns[0]->addCell(std::to_string(i));
+        columns[1]->addCell("label_" + std::to_string(i));
+    }
+
+    return Table(columns, name, name + ".csv");
+}
@@ -0,0 +1,110 @@
+#include "BenchmarkRunner.hpp"
+#include "ColumnBenchmarks.hpp"
+#include "FileBenchmarks.hpp"
+#include "QueryBenchmarks.hpp"
+#include "OutputFileWritter.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Returns a short description of the supported arguments.
+     * @return A multi-line usage string.
+     */
+    std::string usage() {
+        return "Usage: DatabaseCourseProjectBenchmarks [options]\n"
+            "  --filter <text>       Only run benchmarks whose name contains <text>\n"
+            "  --repetitions <n>     Timed repetitions per benchmark (default 5)\n"
+            "  --output <path>       Write the JSON report to <path> instead of the console\n"
+            "  --label <text>        Label stored in the report, e.g. the commit hash\n"
+            "  --large               Also measure 1000000 rows\n"
+            "  --quiet               Do not print progress";
+    }
+}
+
+/**
+ * @brief The entry point of the benchmark suite.
+ *
+ * Registers the column, file and query benchmarks at 10000 and 100000 rows
+ * (plus 1000000 with `--large`), runs the selected ones and prints the JSON
+ * report (see `BenchmarkRunner::toJson`). Progress goes to `std::cerr`, so the
+ * report on `std::cout` can be redirected to a file as is.
+ *
+ * @param argc The number of program arguments.
+ * @param argv The program arguments.
+ * @return 0 on success, 1 if the arguments are invalid or a benchmark failed.
+ */
+int main(int argc, char* argv[]) {
+    std::string filter;
+    std::string output;
+    std::string label;
+    int repetitions = 5;
+    bool large = false;
+    bool progress = true;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string argument = argv[i];
+            bool hasValue = i + 1 < argc;
+
+            if (argument == "--filter" && hasValue) {
+                filter = argv[++i];
+            }
+            else if (argument == "--output" && hasValue) {
+                output = argv[++i];
+            }
+            else if (argument == "--label" && hasValue) {
+                label = argv[++i];
+            }
+            else if (argument == "--repetitions" && hasValue) {
+                repetitions = std::stoi(argv[++i]);
+                if (repetitions < 1) {
+                    throw std::runtime_error("The number of repetitions must be at least 1. ");
+                }
+            }
+            else if (argument == "--large") {
+                large = true;
+            }
+            else if (argument == "--quiet") {
+                progress = false;
+            }
+            else {
+                throw std::runtime_error("Unknown or incomplete argument: " + argument);
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl << usage() << std::endl;
+        return 1;
+    }
+
+    std::vector<int> scales = { 10000, 100000 };
+    if (large) {
+        scales.push_back(1000000);
+    }
+
+    try {
+        BenchmarkRunner runner;
+        ColumnBenchmarks::registerAll(runner, scales);
+        FileBenchmarks::registerAll(runner, scales);
+        QueryBenchmarks::registerAll(runner, scales);
+
+        runner.run(filter, repetitions, progress);
+
+        if (output.empty()) {
+            std::cout << runner.toJson(label);
+        }
+        else {
+            OutputFileWritter writter;
+            writter.writeTextToFile(runner.toJson(label), output);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+
+/**
+ * @struct BenchmarkResult
+ * @brief The timings of one benchmark over all repetitions.
+ */
+struct BenchmarkResult {
+    std::string name;             ///< The benchmark name.
+    long long items;              ///< Items processed per repetition.
+    long long bytes;              ///< Bytes processed per repetition.
+    std::vector<double> seconds;  ///< Duration of every timed repetition.
+
+    /**
+     * @brief Returns the fastest repetition.
+     * @return The minimum duration in seconds.
+     */
+    double getMin() const;
+
+    /**
+     * @brief Returns the median repetition.
+     * @return The median duration in seconds.
+     */
+    double getMedian() const;
+
+    /**
+     * @brief Returns the mean of all repetitions.
+     * @return The mean duration in seconds.
+     */
+    double getMean() const;
+
+    /**
+     * @brief Returns the sample standard deviation of the repetitions.
+     * @return The standard deviation in seconds, 0 for a single repetition.
+     */
+    double getStandardDeviation() const;
+};
+
+/**
+ * @class BenchmarkRunner
+ * @brief Runs registered benchmarks and reports their results as JSON.
+ *
+ * Each benchmark is run once as warm-up and then `repetitions` times; only
+ * the timed repetitions are reported. The JSON report contains the
+ * per-benchmark statistics and the derived rows/s and MB/s rates (based on the
+ * median), so two runs on different commits can be diffed directly.
+ */
+class BenchmarkRunner {
+private:
+    std::vector<Benchmark*> benchmarks; ///< The registered benchmarks. Owned by the runner.
+    std::vector<BenchmarkResult> results; ///< The results of the last `run()`.
+
+public:
+    /**
+     * @brief Creates an empty runner.
+     */
+    BenchmarkRunner() = default;
+
+    /**
+     * @brief Deletes all registered benchmarks.
+     */
+    ~BenchmarkRunner();
+
+    /**
+     * @brief Deleted copy constructor; the runner owns its benchmarks.
+     */
+    BenchmarkRunner(const BenchmarkRunner& other) = delete;
+
+    /**
+     * @brief Deleted copy assignment; the runner owns its benchmarks.
+     */
+    BenchmarkRunner& operator=(const BenchmarkRunner& other) = delete;
+
+    /**
+     * @brief Registers a benchmark.
+     * @param benchmark The benchmark. Ownership is transferred to the runner.
+     */
+    void add(Benchmark* benchmark);
+
+    /**
+     * @brief Runs every benchmark whose name contains `filter`.
+     *
+     * @param filter Substring a name must contain; empty runs everything.
+     * @param repetitions Number of timed repetitions per benchmark.
+     * @param progress Whether to print one line per finished benchmark to `std::cerr`.
+     */
+    void run(const std::string& filter, int repetitions, bool progress);
+
+    /**
+     * @brief Returns the results of the last `run()`.
+     * @return The results, in registration order.
+     */
+    const std::vector<BenchmarkResult>& getResults() const;
+
+    /**
+     * @brief Formats the results of the last `run()` as a JSON document.
+     *
+     * @param label Free text identifying the run, e.g. a commit hash. May be empty.
+     * @return The JSON report.
+     */
+    std::string toJson(const std::string& label) const;
+};
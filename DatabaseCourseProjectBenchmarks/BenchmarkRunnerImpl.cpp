@@ -0,0 +1,227 @@
+#include "BenchmarkRunner.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+
+namespace {
+    /**
+     * @brief Escapes a string for a JSON string literal.
+     * @param text The raw text.
+     * @return The escaped text, without the surrounding quotes.
+     */
+    std::string escapeJson(const std::string& text) {
+        std::string escaped;
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                escaped += '\\';
+                escaped += c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20) {
+                escaped += ' ';
+            }
+            else {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    /**
+     * @brief Formats a number for the JSON report.
+     * @param value The value.
+     * @return The value with up to 9 significant digits.
+     */
+    std::string formatNumber(double value) {
+        std::ostringstream out;
+        out << std::setprecision(9) << value;
+        return out.str();
+    }
+}
+
+/**
+ * @brief Returns the fastest repetition.
+ * @return The minimum duration in seconds.
+ */
+double BenchmarkResult::getMin() const {
+    return seconds.empty() ? 0.0 : *std::min_element(seconds.begin(), seconds.end());
+}
+
+/**
+ * @brief Returns the median repetition.
+ * @return The median duration in seconds.
+ */
+double BenchmarkResult::getMedian() const {
+    if (seconds.empty()) {
+        return 0.0;
+    }
+    std::vector<double> sorted = seconds;
+    std::sort(sorted.begin(), sorted.end());
+    size_t middle = sorted.size() / 2;
+    return sorted.size() % 2 == 1 ? sorted[middle] : (sorted[middle - 1] + sorted[middle]) / 2.0;
+}
+
+/**
+ * @brief Returns the mean of all repetitions.
+ * @return The mean duration in seconds.
+ */
+double BenchmarkResult::getMean() const {
+    if (seconds.empty()) {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (double value : seconds) {
+        sum += value;
+    }
+    return sum / seconds.size();
+}
+
+/**
+ * @brief Returns the sample standard deviation of the repetitions.
+ * @return The standard deviation in seconds, 0 for a single repetition.
+ */
+double BenchmarkResult::getStandardDeviation() const {
+    if (seconds.size() < 2) {
+        return 0.0;
+    }
+    double mean = getMean();
+    double squares = 0.0;
+    for (double value : seconds) {
+        squares += (value - mean) * (value - mean);
+    }
+    return std::sqrt(squares / (seconds.size() - 1));
+}
+
+/**
+ * @brief Deletes all registered benchmarks.
+ */
+BenchmarkRunner::~BenchmarkRunner() {
+    for (Benchmark* benchmark : benchmarks) {
+        delete benchmark;
+    }
+    benchmarks.clear();
+}
+
+/**
+ * @brief Registers a benchmark.
+ * @param benchmark The benchmark. Ownership is transferred to the runner.
+ */
+void BenchmarkRunner::add(Benchmark* benchmark) {
+    benchmarks.push_back(benchmark);
+}
+
+/**
+ * @brief Runs every benchmark whose name contains `filter`.
+ *
+ * Every benchmark runs one untimed warm-up repetition first, which fills the
+ * caches and lets lazily built state (e.g. column statistics) settle. The
+ * item and byte counts are read afterwards, so benchmarks may determine them
+ * during the first repetition.
+ *
+ * @param filter Substring a name must contain; empty runs everything.
+ * @param repetitions Number of timed repetitions per benchmark.
+ * @param progress Whether to print one line per finished benchmark to `std::cerr`.
+ */
+void BenchmarkRunner::run(const std::string& filter, int repetitions, bool progress) {
+    results.clear();
+
+    for (Benchmark* benchmark : benchmarks) {
+        std::string name = benchmark->getName();
+        if (!filter.empty() && name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        BenchmarkResult result;
+        result.name = name;
+
+        for (int i = -1; i < repetitions; ++i) {
+            benchmark->setUp();
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            benchmark->run();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            benchmark->tearDown();
+
+            if (i >= 0) {
+                result.seconds.push_back(elapsed.count());
+            }
+        }
+
+        result.items = benchmark->getItemsProcessed();
+        result.bytes = benchmark->getBytesProcessed();
+
+        if (progress) {
+            std::cerr << std::left << std::setw(48) << name << " median "
+                << std::fixed << std::setprecision(3) << result.getMedian() * 1000.0 << " ms" << std::endl;
+        }
+        results.push_back(result);
+    }
+}
+
+/**
+ * @brief Returns the results of the last `run()`.
+ * @return The results, in registration order.
+ */
+const std::vector<BenchmarkResult>& BenchmarkRunner::getResults() const {
+    return results;
+}
+
+/**
+ * @brief Formats the results of the last `run()` as a JSON document.
+ *
+ * The `context` object describes the run (label, time, hardware threads and
+ * whether assertions were compiled in); every entry of `benchmarks` holds the
+ * raw repetition times and the derived statistics. Rates are computed from
+ * the median and omitted when the benchmark reports no items or bytes.
+ *
+ * @param label Free text identifying the run, e.g. a commit hash. May be empty.
+ * @return The JSON report.
+ */
+std::string BenchmarkRunner::toJson(const std::string& label) const {
+    std::ostringstream json;
+
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+
+    json << "{\n  \"context\": {\n"
+        << "    \"label\": \"" << escapeJson(label) << "\",\n"
+        << "    \"timestamp\": " << static_cast<long long>(std::time(nullptr)) << ",\n"
+        << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n"
+        << "    \"build\": \"" << buildType << "\"\n"
+        << "  },\n  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        double median = result.getMedian();
+
+        json << (i == 0 ? "\n" : ",\n")
+            << "    {\"name\": \"" << escapeJson(result.name) << "\""
+            << ", \"repetitions\": " << result.seconds.size()
+            << ", \"items\": " << result.items
+            << ", \"bytes\": " << result.bytes
+            << ", \"min_seconds\": " << formatNumber(result.getMin())
+            << ", \"median_seconds\": " << formatNumber(median)
+            << ", \"mean_seconds\": " << formatNumber(result.getMean())
+            << ", \"stddev_seconds\": " << formatNumber(result.getStandardDeviation());
+        if (median > 0.0 && result.items > 0) {
+            json << ", \"items_per_second\": " << formatNumber(result.items / median);
+        }
+        if (median > 0.0 && result.bytes > 0) {
+            json << ", \"mb_per_second\": " << formatNumber(result.bytes / median / (1024.0 * 1024.0));
+        }
+        json << ", \"seconds\": [";
+        for (size_t j = 0; j < result.seconds.size(); ++j) {
+            json << (j == 0 ? "" : ", ") << formatNumber(result.seconds[j]);
+        }
+        json << "]}";
+    }
+
+    json << "\n  ]\n}\n";
+    return json.str();
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "BenchmarkRunner.hpp"
+#include "TableColumn.hpp"
+
+/**
+ * @class ColumnAddCellBenchmark
+ * @brief Measures appending cells to an empty column of one type.
+ */
+class ColumnAddCellBenchmark : public Benchmark {
+private:
+    std::string type;                ///< The column type.
+    std::vector<std::string> values; ///< The cells to append, generated once.
+    long long bytes;                 ///< Total length of `values`.
+    TableColumn* column;             ///< The column of the current repetition. Owned.
+
+public:
+    /**
+     * @brief Creates the benchmark and generates its values.
+     * @param type The column type: `Integer`, `Double` or `String`.
+     * @param rows Number of cells appended per repetition.
+     */
+    ColumnAddCellBenchmark(const std::string& type, int rows);
+
+    /**
+     * @brief Deletes the column of an unfinished repetition.
+     */
+    ~ColumnAddCellBenchmark() override;
+
+    std::string getName() const override;
+    void setUp() override;
+    void run() override;
+    void tearDown() override;
+    long long getItemsProcessed() const override;
+    long long getBytesProcessed() const override;
+};
+
+/**
+ * @class ColumnScanBenchmark
+ * @brief Measures reading every cell of a column as a string, the access path of all commands.
+ */
+class ColumnScanBenchmark : public Benchmark {
+private:
+    std::string type;    ///< The column type.
+    int rows;            ///< Number of cells.
+    TableColumn* column; ///< The scanned column, built on the first `setUp()`. Owned.
+    size_t checksum;     ///< Accumulated result, keeps the scan from being optimized away.
+
+public:
+    /**
+     * @brief Creates the benchmark. The column is built lazily.
+     * @param type The column type: `Integer`, `Double` or `String`.
+     * @param rows Number of cells scanned per repetition.
+     */
+    ColumnScanBenchmark(const std::string& type, int rows);
+
+    /**
+     * @brief Deletes the scanned column.
+     */
+    ~ColumnScanBenchmark() override;
+
+    std::string getName() const override;
+    void setUp() override;
+    void run() override;
+    long long getItemsProcessed() const override;
+};
+
+/**
+ * @class ColumnDeleteBenchmark
+ * @brief Measures deleting cells from the middle of a column.
+ */
+class ColumnDeleteBenchmark : public Benchmark {
+private:
+    std::string type;                ///< The column type.
+    std::vector<std::string> values; ///< The cells the column is rebuilt from before every repetition.
+    int deletes;                     ///< Number of cells deleted per repetition.
+    TableColumn* column;             ///< The column of the current repetition. Owned.
+
+public:
+    /**
+     * @brief Creates the benchmark and generates its values.
+     * @param type The column type: `Integer`, `Double` or `String`.
+     * @param rows Number of cells in the column.
+     * @param deletes Number of cells deleted per repetition; at most `rows`.
+     */
+    ColumnDeleteBenchmark(const std::string& type, int rows, int deletes);
+
+    /**
+     * @brief Deletes the column of an unfinished repetition.
+     */
+    ~ColumnDeleteBenchmark() override;
+
+    std::string getName() const override;
+    void setUp() override;
+    void run() override;
+    void tearDown() override;
+    long long getItemsProcessed() const override;
+};
+
+/**
+ * @class ColumnBenchmarks
+ * @brief Registers the column benchmarks of every column type.
+ */
+class ColumnBenchmarks {
+public:
+    /**
+     * @brief Registers addCell, scan and delete benchmarks for every type and scale.
+     * @param runner The runner to register with.
+     * @param scales The row counts to measure.
+     */
+    static void registerAll(BenchmarkRunner& runner, const std::vector<int>& scales);
+};
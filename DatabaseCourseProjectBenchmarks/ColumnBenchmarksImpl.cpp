@@ -0,0 +1,209 @@
+#include "ColumnBenchmarks.hpp"
+#include "BenchmarkData.hpp"
+#include "ColumnFactory.hpp"
+#include <algorithm>
+
+namespace {
+    /// The column types every column benchmark is registered for.
+    const char* const COLUMN_TYPES[] = { "Integer", "Double", "String" };
+
+    /// Upper bound of cells deleted per repetition; `deleteCell` shifts the tail, so it is quadratic.
+    const int MAX_DELETES = 2000;
+}
+
+/**
+ * @brief Creates the benchmark and generates its values.
+ * @param type The column type: `Integer`, `Double` or `String`.
+ * @param rows Number of cells appended per repetition.
+ */
+ColumnAddCellBenchmark::ColumnAddCellBenchmark(const std::string& type, int rows)
+    : type(type), values(BenchmarkData::makeValues(type, rows)), bytes(0), column(nullptr) {
+    for (const std::string& value : values) {
+        bytes += static_cast<long long>(value.size());
+    }
+}
+
+/**
+ * @brief Deletes the column of an unfinished repetition.
+ */
+ColumnAddCellBenchmark::~ColumnAddCellBenchmark() {
+    delete column;
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return `column/<type>/addCell/<rows>`.
+ */
+std::string ColumnAddCellBenchmark::getName() const {
+    return "column/" + type + "/addCell/" + std::to_string(values.size());
+}
+
+/**
+ * @brief Creates an empty column.
+ */
+void ColumnAddCellBenchmark::setUp() {
+    column = ColumnFactory::makeColumn("c", type);
+}
+
+/**
+ * @brief Appends all values.
+ */
+void ColumnAddCellBenchmark::run() {
+    for (const std::string& value : values) {
+        column->addCell(value);
+    }
+}
+
+/**
+ * @brief Deletes the filled column.
+ */
+void ColumnAddCellBenchmark::tearDown() {
+    delete column;
+    column = nullptr;
+}
+
+/**
+ * @brief Returns the number of appended cells.
+ * @return The row count.
+ */
+long long ColumnAddCellBenchmark::getItemsProcessed() const {
+    return static_cast<long long>(values.size());
+}
+
+/**
+ * @brief Returns the text length of the appended cells.
+ * @return The byte count.
+ */
+long long ColumnAddCellBenchmark::getBytesProcessed() const {
+    return bytes;
+}
+
+/**
+ * @brief Creates the benchmark. The column is built lazily.
+ * @param type The column type: `Integer`, `Double` or `String`.
+ * @param rows Number of cells scanned per repetition.
+ */
+ColumnScanBenchmark::ColumnScanBenchmark(const std::string& type, int rows)
+    : type(type), rows(rows), column(nullptr), checksum(0) {
+}
+
+/**
+ * @brief Deletes the scanned column.
+ */
+ColumnScanBenchmark::~ColumnScanBenchmark() {
+    delete column;
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return `column/<type>/scan/<rows>`.
+ */
+std::string ColumnScanBenchmark::getName() const {
+    return "column/" + type + "/scan/" + std::to_string(rows);
+}
+
+/**
+ * @brief Builds the column on the first repetition; later repetitions reuse it.
+ */
+void ColumnScanBenchmark::setUp() {
+    if (column != nullptr) {
+        return;
+    }
+    column = ColumnFactory::makeColumn("c", type);
+    for (const std::string& value : BenchmarkData::makeValues(type, rows)) {
+        column->addCell(value);
+    }
+}
+
+/**
+ * @brief Reads every cell as a string.
+ */
+void ColumnScanBenchmark::run() {
+    int size = column->getSize();
+    for (int i = 0; i < size; ++i) {
+        checksum += column->returnValueAtGivenIndexAsString(i).size();
+    }
+}
+
+/**
+ * @brief Returns the number of scanned cells.
+ * @return The row count.
+ */
+long long ColumnScanBenchmark::getItemsProcessed() const {
+    return rows;
+}
+
+/**
+ * @brief Creates the benchmark and generates its values.
+ * @param type The column type: `Integer`, `Double` or `String`.
+ * @param rows Number of cells in the column.
+ * @param deletes Number of cells deleted per repetition; at most `rows`.
+ */
+ColumnDeleteBenchmark::ColumnDeleteBenchmark(const std::string& type, int rows, int deletes)
+    : type(type), values(BenchmarkData::makeValues(type, rows)), deletes(std::min(deletes, rows)), column(nullptr) {
+}
+
+/**
+ * @brief Deletes the column of an unfinished repetition.
+ */
+ColumnDeleteBenchmark::~ColumnDeleteBenchmark() {
+    delete column;
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return `column/<type>/delete/<rows>`.
+ */
+std::string ColumnDeleteBenchmark::getName() const {
+    return "column/" + type + "/delete/" + std::to_string(values.size());
+}
+
+/**
+ * @brief Builds a full column.
+ */
+void ColumnDeleteBenchmark::setUp() {
+    column = ColumnFactory::makeColumn("c", type);
+    for (const std::string& value : values) {
+        column->addCell(value);
+    }
+}
+
+/**
+ * @brief Deletes `deletes` cells from the middle of the column.
+ */
+void ColumnDeleteBenchmark::run() {
+    for (int i = 0; i < deletes; ++i) {
+        column->deleteCell(column->getSize() / 2);
+    }
+}
+
+/**
+ * @brief Deletes the column.
+ */
+void ColumnDeleteBenchmark::tearDown() {
+    delete column;
+    column = nullptr;
+}
+
+/**
+ * @brief Returns the number of deleted cells.
+ * @return The delete count.
+ */
+long long ColumnDeleteBenchmark::getItemsProcessed() const {
+    return deletes;
+}
+
+/**
+ * @brief Registers addCell, scan and delete benchmarks for every type and scale.
+ * @param runner The runner to register with.
+ * @param scales The row counts to measure.
+ */
+void ColumnBenchmarks::registerAll(BenchmarkRunner& runner, const std::vector<int>& scales) {
+    for (const char* type : COLUMN_TYPES) {
+        for (int rows : scales) {
+            runner.add(new ColumnAddCellBenchmark(type, rows));
+            runner.add(new ColumnScanBenchmark(type, rows));
+            runner.add(new ColumnDeleteBenchmark(type, rows, MAX_DELETES));
+        }
+    }
+}
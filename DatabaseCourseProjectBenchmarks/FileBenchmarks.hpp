@@ -0,0 +1,79 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "BenchmarkRunner.hpp"
+#include "Table.hpp"
+#include "OutputConsoleWritter.hpp"
+
+/**
+ * @class FileSaveBenchmark
+ * @brief Measures `OutputFileWritter::writeTableToFile` on a generated fact table.
+ */
+class FileSaveBenchmark : public Benchmark {
+private:
+    Table table;      ///< The table that is written.
+    std::string path; ///< The output file, removed when the benchmark is destroyed.
+    long long bytes;  ///< Size of the written file.
+
+public:
+    /**
+     * @brief Creates the benchmark and generates its table.
+     * @param rows Number of rows of the table.
+     */
+    explicit FileSaveBenchmark(int rows);
+
+    /**
+     * @brief Removes the output file.
+     */
+    ~FileSaveBenchmark() override;
+
+    std::string getName() const override;
+    void run() override;
+    long long getItemsProcessed() const override;
+    long long getBytesProcessed() const override;
+};
+
+/**
+ * @class FileLoadBenchmark
+ * @brief Measures `InputFileReader::readTableFromFile` on a generated fact table.
+ */
+class FileLoadBenchmark : public Benchmark {
+private:
+    int rows;                            ///< Number of rows in the file.
+    std::string path;                    ///< The input file, written on the first `setUp()`.
+    long long bytes;                     ///< Size of the input file.
+    OutputConsoleWritter consoleWritter; ///< Console writer required by the reader.
+
+public:
+    /**
+     * @brief Creates the benchmark. The input file is written lazily.
+     * @param rows Number of rows in the file.
+     */
+    explicit FileLoadBenchmark(int rows);
+
+    /**
+     * @brief Removes the input file.
+     */
+    ~FileLoadBenchmark() override;
+
+    std::string getName() const override;
+    void setUp() override;
+    void run() override;
+    long long getItemsProcessed() const override;
+    long long getBytesProcessed() const override;
+};
+
+/**
+ * @class FileBenchmarks
+ * @brief Registers the load and save benchmarks.
+ */
+class FileBenchmarks {
+public:
+    /**
+     * @brief Registers a load and a save benchmark for every scale.
+     * @param runner The runner to register with.
+     * @param scales The row counts to measure.
+     */
+    static void registerAll(BenchmarkRunner& runner, const std::vector<int>& scales);
+};
@@ -0,0 +1,144 @@
+#include "FileBenchmarks.hpp"
+#include "BenchmarkData.hpp"
+#include "InputFileReader.hpp"
+#include "OutputFileWritter.hpp"
+#include <cstdio>
+#include <fstream>
+
+namespace {
+    /// Number of join keys of the generated tables; irrelevant for file I/O.
+    const int KEY_COUNT = 1000;
+
+    /**
+     * @brief Returns the size of a file.
+     * @param path The file.
+     * @return The size in bytes, 0 if the file cannot be opened.
+     */
+    long long fileSize(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        return file.is_open() ? static_cast<long long>(file.tellg()) : 0;
+    }
+}
+
+/**
+ * @brief Creates the benchmark and generates its table.
+ * @param rows Number of rows of the table.
+ */
+FileSaveBenchmark::FileSaveBenchmark(int rows)
+    : table(BenchmarkData::makeFactTable("Fact", rows, KEY_COUNT)),
+    path("benchmark_save_" + std::to_string(rows) + ".csv"), bytes(0) {
+}
+
+/**
+ * @brief Removes the output file.
+ */
+FileSaveBenchmark::~FileSaveBenchmark() {
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return `file/save/<rows>`.
+ */
+std::string FileSaveBenchmark::getName() const {
+    return "file/save/" + std::to_string(table.getNumberOfRows());
+}
+
+/**
+ * @brief Writes the table and records the file size.
+ */
+void FileSaveBenchmark::run() {
+    OutputFileWritter writter;
+    writter.writeTableToFile(table, path);
+    bytes = fileSize(path);
+}
+
+/**
+ * @brief Returns the number of written rows.
+ * @return The row count.
+ */
+long long FileSaveBenchmark::getItemsProcessed() const {
+    return table.getNumberOfRows();
+}
+
+/**
+ * @brief Returns the size of the written file.
+ * @return The byte count.
+ */
+long long FileSaveBenchmark::getBytesProcessed() const {
+    return bytes;
+}
+
+/**
+ * @brief Creates the benchmark. The input file is written lazily.
+ * @param rows Number of rows in the file.
+ */
+FileLoadBenchmark::FileLoadBenchmark(int rows)
+    : rows(rows), path("benchmark_load_" + std::to_string(rows) + ".csv"), bytes(0) {
+}
+
+/**
+ * @brief Removes the input file.
+ */
+FileLoadBenchmark::~FileLoadBenchmark() {
+    if (bytes > 0) {
+        std::remove(path.c_str());
+    }
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return `file/load/<rows>`.
+ */
+std::string FileLoadBenchmark::getName() const {
+    return "file/load/" + std::to_string(rows);
+}
+
+/**
+ * @brief Writes the input file on the first repetition.
+ */
+void FileLoadBenchmark::setUp() {
+    if (bytes > 0) {
+        return;
+    }
+    Table table = BenchmarkData::makeFactTable("Fact", rows, KEY_COUNT);
+    OutputFileWritter writter;
+    writter.writeTableToFile(table, path);
+    bytes = fileSize(path);
+}
+
+/**
+ * @brief Reads the input file into a table.
+ */
+void FileLoadBenchmark::run() {
+    InputFileReader reader(consoleWritter);
+    Table table = reader.readTableFromFile(path);
+}
+
+/**
+ * @brief Returns the number of read rows.
+ * @return The row count.
+ */
+long long FileLoadBenchmark::getItemsProcessed() const {
+    return rows;
+}
+
+/**
+ * @brief Returns the size of the input file.
+ * @return The byte count.
+ */
+long long FileLoadBenchmark::getBytesProcessed() const {
+    return bytes;
+}
+
+/**
+ * @brief Registers a load and a save benchmark for every scale.
+ * @param runner The runner to register with.
+ * @param scales The row counts to measure.
+ */
+void FileBenchmarks::registerAll(BenchmarkRunner& runner, const std::vector<int>& scales) {
+    for (int rows : scales) {
+        runner.add(new FileLoadBenchmark(rows));
+        runner.add(new FileSaveBenchmark(rows));
+    }
+}
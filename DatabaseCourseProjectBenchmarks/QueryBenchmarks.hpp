@@ -0,0 +1,55 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "BenchmarkRunner.hpp"
+#include "Catalog.hpp"
+
+/**
+ * @class QueryBenchmark
+ * @brief Measures one statement of the `query` command: parsing, planning and executing the pipeline.
+ *
+ * The result rows are produced but not printed.
+ */
+class QueryBenchmark : public Benchmark {
+private:
+    std::string name;                 ///< The benchmark name.
+    std::shared_ptr<Catalog> catalog; ///< The catalog the statement runs on, shared by the benchmarks of one scale.
+    std::string sql;                  ///< The statement.
+    long long scannedRows;            ///< Rows of all tables the statement reads.
+    size_t resultRows;                ///< Result size of the last repetition.
+
+public:
+    /**
+     * @brief Creates the benchmark.
+     * @param name The benchmark name.
+     * @param catalog The catalog the statement runs on.
+     * @param sql The statement.
+     * @param scannedRows Rows of all tables the statement reads, reported as items.
+     */
+    QueryBenchmark(const std::string& name, std::shared_ptr<Catalog> catalog, const std::string& sql, long long scannedRows);
+
+    std::string getName() const override;
+    void run() override;
+    long long getItemsProcessed() const override;
+};
+
+/**
+ * @class QueryBenchmarks
+ * @brief Registers the select, aggregate and join benchmarks.
+ */
+class QueryBenchmarks {
+public:
+    /**
+     * @brief Registers the query benchmarks for every scale.
+     *
+     * Per scale a catalog with a fact table of that many rows and a dimension
+     * table of 1000 keys is generated. Selects are measured at 1%, 10% and 50%
+     * selectivity, followed by a grouped aggregate and a join.
+     *
+     * @param runner The runner to register with.
+     * @param scales The fact table row counts to measure.
+     */
+    static void registerAll(BenchmarkRunner& runner, const std::vector<int>& scales);
+};
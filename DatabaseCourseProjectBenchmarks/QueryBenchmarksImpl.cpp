@@ -0,0 +1,79 @@
+#include "QueryBenchmarks.hpp"
+#include "BenchmarkData.hpp"
+#include "QueryParser.hpp"
+#include "QueryPlanner.hpp"
+#include "QueryPipeline.hpp"
+
+namespace {
+    /// Number of distinct keys, i.e. groups of the aggregate and rows of the dimension table.
+    const int KEY_COUNT = 1000;
+
+    /// Selectivities of the select benchmarks, in percent.
+    const int SELECTIVITIES[] = { 1, 10, 50 };
+}
+
+/**
+ * @brief Creates the benchmark.
+ * @param name The benchmark name.
+ * @param catalog The catalog the statement runs on.
+ * @param sql The statement.
+ * @param scannedRows Rows of all tables the statement reads, reported as items.
+ */
+QueryBenchmark::QueryBenchmark(const std::string& name, std::shared_ptr<Catalog> catalog, const std::string& sql, long long scannedRows)
+    : name(name), catalog(catalog), sql(sql), scannedRows(scannedRows), resultRows(0) {
+}
+
+/**
+ * @brief Returns the benchmark name.
+ * @return The name given at construction.
+ */
+std::string QueryBenchmark::getName() const {
+    return name;
+}
+
+/**
+ * @brief Parses, plans and executes the statement.
+ */
+void QueryBenchmark::run() {
+    QueryPipeline* pipeline = QueryPlanner::compile(QueryParser::parse(sql), *catalog);
+    try {
+        pipeline->execute();
+        resultRows = pipeline->getRows().size();
+    }
+    catch (...) {
+        delete pipeline;
+        throw;
+    }
+    delete pipeline;
+}
+
+/**
+ * @brief Returns the number of scanned rows.
+ * @return The row count of all read tables.
+ */
+long long QueryBenchmark::getItemsProcessed() const {
+    return scannedRows;
+}
+
+/**
+ * @brief Registers the query benchmarks for every scale.
+ * @param runner The runner to register with.
+ * @param scales The fact table row counts to measure.
+ */
+void QueryBenchmarks::registerAll(BenchmarkRunner& runner, const std::vector<int>& scales) {
+    for (int rows : scales) {
+        std::shared_ptr<Catalog> catalog(new Catalog());
+        catalog->addTable(BenchmarkData::makeFactTable("Fact", rows, KEY_COUNT));
+        catalog->addTable(BenchmarkData::makeDimensionTable("Dim", KEY_COUNT));
+        std::string scale = std::to_string(rows);
+
+        for (int percent : SELECTIVITIES) {
+            runner.add(new QueryBenchmark("query/select/" + std::to_string(percent) + "pct/" + scale, catalog,
+                "SELECT id, amount FROM Fact WHERE value < " + std::to_string(percent * 10), rows));
+        }
+        runner.add(new QueryBenchmark("query/aggregate/" + scale, catalog,
+            "SELECT key, COUNT(*), SUM(amount) FROM Fact GROUP BY key", rows));
+        runner.add(new QueryBenchmark("query/join/" + scale, catalog,
+            "SELECT Fact.id, Dim.label FROM Fact JOIN Dim ON Fact.key = Dim.key", rows + KEY_COUNT));
+    }
+}